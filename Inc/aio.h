@@ -0,0 +1,119 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - E/S asíncrona de archivos
+ * ============================================================================
+ * Las tareas describen una lectura o escritura (ruta, posición, buffer) y
+ * siguen ejecutándose; una tarea de E/S de baja prioridad la atiende:
+ *
+ * - Orden de ascensor: dentro del archivo en curso se sirve la petición con
+ *   la menor posición por delante del cabezal. Al agotarse, o si la más
+ *   antigua lleva esperando AIO_DEADLINE_MS, se pasa a la más antigua.
+ * - Fusión: las peticiones contiguas del mismo archivo y sentido se sirven
+ *   con una sola apertura y búsqueda; debajo, la caché de sectores y las
+ *   órdenes multibloque de la SD juntan los sectores.
+ * - Nunca se adelanta una petición a otra más antigua que la solapa (o que
+ *   añade al final) si alguna de las dos escribe.
+ * - Cada turno mueve como mucho AIO_CHUNK bytes, así una escritura larga no
+ *   retiene la CPU más que eso aunque el planificador sea cooperativo.
+ *
+ * Igual que en spi_dma, el descriptor es del llamador: al terminar el estado
+ * pasa a DONE o ERROR, se llama a done (desde la tarea de E/S) y se libera
+ * sem.
+ * ============================================================================
+ */
+
+#ifndef AIO_H // Guarda de inclusión para la E/S asíncrona
+#define AIO_H
+
+#pragma once
+#include <stdint.h>
+#include "sync.h"
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Bytes transferidos como mucho por turno de la tarea de E/S. */
+#define AIO_CHUNK 1024
+/** Espera máxima antes de que una petición pase delante del ascensor. */
+#define AIO_DEADLINE_MS 200
+/** Pausa de la tarea de E/S cuando la cola está vacía. */
+#define AIO_IDLE_MS 5
+/** Longitud máxima de la ruta (igual que VFS_MAX_PATH). */
+#define AIO_MAX_PATH 64
+
+/** Sentido de la petición. */
+#define AIO_READ  0
+#define AIO_WRITE 1
+
+/** Estado de una petición. */
+typedef enum {
+    AIO_IDLE = 0,      /** Nunca enviada o ya recogida. */
+    AIO_QUEUED,        /** En la cola. */
+    AIO_ACTIVE,        /** Transfiriéndose. */
+    AIO_DONE,          /** Terminada; result tiene los bytes. */
+    AIO_ERROR          /** Falló la apertura o la transferencia. */
+} aio_state_t;
+
+/**
+ * Petición de E/S. La memoria (y buf) debe seguir viva hasta que el estado
+ * sea DONE o ERROR.
+ */
+typedef struct aio_req {
+    char path[AIO_MAX_PATH];  /** Ruta VFS ("/sd/log.txt"; sin prefijo, el montaje por defecto). */
+    uint32_t offset;          /** Posición en el archivo (se ignora con VFS_O_APPEND). */
+    void* buf;                /** Destino (lectura) u origen (escritura). */
+    uint32_t len;             /** Bytes a transferir. */
+    uint8_t op;               /** AIO_READ / AIO_WRITE. */
+    uint8_t flags;            /** Escritura: VFS_O_CREAT | VFS_O_TRUNC | VFS_O_APPEND. */
+    void (*done)(struct aio_req* r);  /** Al terminar (puede ser NULL). */
+    void* ctx;                /** Contexto libre para done. */
+    sem_t* sem;               /** Semáforo a liberar al terminar (puede ser NULL). */
+    volatile uint8_t state;   /** aio_state_t. */
+    int result;               /** Bytes transferidos, o -1 si error. */
+
+    /* Privado */
+    uint32_t submitted_ms;
+    uint32_t progress;        /** Bytes ya transferidos. */
+    struct aio_req* next;
+} aio_req_t;
+
+/** Contadores de la cola. */
+typedef struct {
+    uint32_t submitted;       /** Peticiones encoladas. */
+    uint32_t completed;       /** Peticiones terminadas (incluye errores). */
+    uint32_t errors;          /** Peticiones con error. */
+    uint32_t batches;         /** Aperturas de archivo (una por grupo fusionado). */
+    uint32_t merged;          /** Peticiones servidas dentro del grupo de otra. */
+    uint32_t reordered;       /** Peticiones servidas antes que otra más antigua. */
+    uint32_t bytes;           /** Bytes transferidos. */
+    uint32_t max_depth;       /** Máximo de peticiones en cola. */
+    uint32_t latency_total_ms; /** Suma de (fin - envío) de las peticiones. */
+    uint32_t latency_max_ms;  /** Peor latencia. */
+} aio_stats_t;
+
+/* ========================================================================== */
+/* API                                               */
+/* ========================================================================== */
+
+/**
+ * Encolar una petición (path, offset, buf, len, op y flags ya rellenos).
+ * @return 0 si OK, -1 si ya está en la cola o los campos no son válidos.
+ */
+int aio_submit(aio_req_t* r);
+
+/** @return 1 si la petición terminó (DONE o ERROR). */
+uint8_t aio_is_done(const aio_req_t* r);
+
+/** @return Peticiones pendientes (en cola o en curso). */
+uint32_t aio_pending(void);
+
+/**
+ * Tarea de E/S: atiende la cola, un tramo de como mucho AIO_CHUNK bytes
+ * por turno. Crear con prioridad baja.
+ */
+void aio_task(void);
+
+void aio_get_stats(aio_stats_t* stats);
+
+#endif /* AIO_H */
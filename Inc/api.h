@@ -4,6 +4,7 @@
 #pragma once // Directiva alternativa de guarda (dependiente del compilador)
 #include <stdint.h> // Incluye tipos de enteros fijos
 #include <stddef.h> // Incluye la definición de size_t y NULL
+#include "aio.h"    // Descriptor de E/S asíncrona (daos_aio_t)
 
 #ifdef __cplusplus
 extern "C" { // Bloque para permitir la invocación desde C++
@@ -150,8 +151,22 @@ int daos_sem_get_count(daos_sem_t s);
 #define DAOS_SEEK_CUR 1
 #define DAOS_SEEK_END 2
 
+/**
+ * Modos de `daos_open_flags`. Las rutas pasan por el VFS: "/ram/..." (RAMFS,
+ * también el destino de las rutas sin prefijo), "/rom/..." (fs.c, solo
+ * lectura) y "/sd/..." (tarjeta SD).
+ */
+#define DAOS_O_RDONLY 0x01
+#define DAOS_O_WRONLY 0x02
+#define DAOS_O_RDWR   0x03
+#define DAOS_O_CREAT  0x04
+#define DAOS_O_TRUNC  0x08
+#define DAOS_O_APPEND 0x10
+
 /** Abre un archivo. @param path Ruta del archivo. @return Descriptor de archivo (fd) o error. */
 int daos_open(const char* path);
+/** Abre un archivo con modos DAOS_O_*. @return Descriptor de archivo (fd) o < 0 si error. */
+int daos_open_flags(const char* path, int flags);
 /** Lee de un archivo. @param fd Descriptor. @param buf Buffer de destino. @param n Bytes a leer. @return Bytes leídos. */
 int daos_read(int fd, void* buf, int n);
 /** Escribe en un archivo. @param fd Descriptor. @param buf Buffer de origen. @param n Bytes a escribir. @return Bytes escritos. */
@@ -160,7 +175,7 @@ int daos_write(int fd, const void* buf, int n);
 int daos_close(int fd);
 /** Mueve el puntero de lectura/escritura. */
 int daos_seek(int fd, int offset, int whence);
-/** Lista los archivos del directorio raíz. @param out Buffer de salida. @param max Tamaño. @return Número de archivos. */
+/** Lista la raíz: puntos de montaje y archivos de /ram. @param out Buffer de salida. @param max Tamaño. @return Número de archivos. */
 int daos_listdir(char* out, int max);
 /** Verifica si un archivo existe. @return 1 si existe, 0 si no. */
 int daos_exists(const char* path);
@@ -172,6 +187,79 @@ int daos_create_file(const char* name, const void* data, uint32_t size);
 int daos_delete_file(const char* name);
 /** Añade datos al final de un archivo existente. */
 int daos_append(const char* name, const void* data, uint32_t size);
+/** Copia un archivo, también entre sistemas de archivos. @return Bytes copiados o < 0 si error. */
+int daos_copy_file(const char* src, const char* dst);
+/** Renombra o mueve un archivo (entre sistemas de archivos copia y borra). @return 0 si OK, < 0 si error. */
+int daos_rename(const char* old_path, const char* new_path);
+/** Obtiene la fragmentación del espacio libre (0-100 %). */
+int daos_fs_get_fragmentation(void);
+/** Activa (1) o desactiva (0) la compresión LZ de un archivo. @return 0 si OK, < 0 si error. */
+int daos_fs_set_compression(const char* name, int enable);
+/** Tarea de compactación en segundo plano (crear con DAOS_PRIO_LOW). */
+void daos_fs_compact_task(void);
+/** Monta RAMFS sobre el log persistente en flash interna. @return 0 si OK, < 0 si error. */
+int daos_fs_mount_persistent(void);
+
+/** Inicializa la tarjeta SD y monta su FAT32 en /sd. @return 0 si OK, < 0 si no hay tarjeta o volumen. */
+int daos_sd_mount(void);
+/** Tarea que inicializa la SD y monta /sd en segundo plano; termina sola (crear con DAOS_PRIO_LOW). */
+void daos_sd_mount_task(void);
+/** Escribe a la tarjeta los sectores retenidos por la caché (cerrar un archivo no lo hace). @return 0 si OK, < 0 si error. */
+int daos_sd_sync(void);
+/** Escribe lo pendiente y desmonta /sd. */
+void daos_sd_unmount(void);
+/** Capacidad y espacio libre de /sd en KB (libre = 0xFFFFFFFF si se desconoce). @return 0 si OK, < 0 si no está montada. */
+int daos_sd_get_info(uint32_t* total_kb, uint32_t* free_kb);
+
+/** Longitud máxima de una ruta ("/logs/tron/scores"). */
+#define DAOS_MAX_PATH 64
+
+/** Entrada de directorio devuelta por `daos_readdir`. */
+typedef struct {
+    char name[32];   /** Nombre de la entrada (sin ruta). */
+    uint8_t is_dir;  /** 1 si es un directorio. */
+    uint32_t size;   /** Tamaño en bytes (0 para directorios). */
+} daos_dirent_t;
+
+/** Crea un directorio (el padre debe existir). @return 0 si OK, < 0 si error. */
+int daos_mkdir(const char* path);
+/** Elimina un directorio vacío. @return 0 si OK, < 0 si error. */
+int daos_rmdir(const char* path);
+/** Abre un directorio para recorrerlo ("/" es la raíz). @return Descriptor o < 0 si error. */
+int daos_opendir(const char* path);
+/** Lee la siguiente entrada. @return 1 si hay entrada, 0 al final, < 0 si error. */
+int daos_readdir(int dh, daos_dirent_t* ent);
+/** Cierra un directorio abierto con `daos_opendir`. */
+int daos_closedir(int dh);
+/** Verifica si una ruta es un directorio. @return 1 si lo es, 0 si no. */
+int daos_is_dir(const char* path);
+
+// ========================================================================
+// E/S ASÍNCRONA
+// ========================================================================
+
+/**
+ * Petición de E/S asíncrona. El llamador la reserva (estática) y puede
+ * fijar done, ctx y sem antes de enviarla; result y state dicen cómo
+ * terminó. Ver aio.h.
+ */
+typedef aio_req_t daos_aio_t;
+
+/**
+ * Encola una lectura: la tarea de E/S la sirve y la tarea sigue su curso.
+ * @return 0 si se encoló, < 0 si la petición ya está en curso o la ruta es muy larga.
+ */
+int daos_aio_read(daos_aio_t* req, const char* path, uint32_t offset, void* buf, uint32_t len);
+/**
+ * Encola una escritura (buf debe seguir vivo hasta que termine).
+ * @param flags DAOS_O_CREAT | DAOS_O_TRUNC | DAOS_O_APPEND (con APPEND se ignora offset).
+ * @return 0 si se encoló, < 0 si error.
+ */
+int daos_aio_write(daos_aio_t* req, const char* path, uint32_t offset, const void* buf, uint32_t len, int flags);
+/** @return 1 si la petición terminó (ver req->result). */
+int daos_aio_done(const daos_aio_t* req);
+/** Tarea de E/S que atiende las peticiones (crear con DAOS_PRIO_LOW). */
+void daos_aio_task(void);
 
 // ========================================================================
 // GRÁFICOS
@@ -198,6 +286,41 @@ int daos_append(const char* name, const void* data, uint32_t size);
 
 /** Inicializa el subsistema gráfico. */
 void daos_gfx_init(void);
+/**
+ * Tarea de pantalla (crear una, con DAOS_PRIO_NORMAL). Mientras corre, lo
+ * que las tareas dibujan fuera de un cuadro se encola y ella lo envía por
+ * tandas: funde rellenos contiguos, descarta lo que un relleno posterior
+ * tapa y usa una sola transacción del bus por tanda. Ver dlist.h.
+ */
+void daos_gfx_task(void);
+/**
+ * Envía ya lo encolado y dibuja directamente hasta que la tarea de
+ * pantalla vuelva a correr. Llamar antes de una espera activa o de matar
+ * las tareas.
+ */
+void daos_gfx_sync(void);
+/**
+ * Empieza un cuadro. Hasta daos_gfx_frame_end el dibujo no toca la pantalla:
+ * se redibuja la escena entera sobre el fondo bg y al cerrar solo se envían
+ * los tiles de 16x16 que cambiaron respecto al cuadro anterior. Los bitmaps
+ * de daos_gfx_blit16 se leen al cerrar: deben seguir vivos hasta entonces.
+ */
+void daos_gfx_frame_begin(uint16_t bg);
+/** Cierra el cuadro y envía los tiles que cambiaron. */
+void daos_gfx_frame_end(void);
+/**
+ * Como daos_gfx_frame_end (o, fuera de un cuadro, como vaciar lo encolado),
+ * pero el envío espera al comienzo del próximo refresco del panel para no
+ * cortar la imagen. Sustituye al daos_sleep_ms del final del cuadro:
+ *
+ *     daos_sleep_ms(daos_gfx_present(100));
+ *
+ * @param interval_ms Cada cuánto dibuja el juego (se redondea a refrescos
+ *        de unos 14 ms).
+ * @return Milisegundos a dormir para que el próximo cuadro esté listo
+ *         justo antes de su refresco.
+ */
+uint32_t daos_gfx_present(uint32_t interval_ms);
 /** Limpia la pantalla con un color. */
 void daos_gfx_clear(uint16_t color);
 /** Rellena un rectángulo. */
@@ -212,8 +335,44 @@ void daos_gfx_draw_text_large(int x, int y, const char* text, uint16_t color, ui
 void daos_gfx_draw_circle(int x0, int y0, int radius, uint16_t color);
 /** Dibuja un círculo relleno. */
 void daos_gfx_draw_circle_filled(int x0, int y0, int radius, uint16_t color);
-/** Copia un bitmap de 16 bits (blit). */
+/**
+ * Contorno de un rectángulo con las esquinas en cuartos de círculo de
+ * radio r (se reduce si no cabe).
+ */
+void daos_gfx_draw_round_rect(int x, int y, int w, int h, int r, uint16_t color);
+/** Rectángulo relleno con las esquinas redondeadas. */
+void daos_gfx_fill_round_rect(int x, int y, int w, int h, int r, uint16_t color);
+/** Dibuja una línea entre dos puntos (ambos incluidos). */
+void daos_gfx_draw_line(int x0, int y0, int x1, int y1, uint16_t color);
+/** Dibuja el contorno de un triángulo. */
+void daos_gfx_draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color);
+/** Rellena un triángulo (cubre también su contorno). */
+void daos_gfx_fill_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color);
+/**
+ * Copia un bitmap RGB565 de w*h píxeles (fila a fila) con una sola ventana,
+ * recortado a la pantalla. Al retornar, src ya puede reutilizarse.
+ */
 void daos_gfx_blit16(int x, int y, const uint16_t* src, int w, int h);
+/** Como daos_gfx_blit16, pero los píxeles de color key son transparentes. */
+void daos_gfx_blit16_key(int x, int y, const uint16_t* src, int w, int h, uint16_t key);
+
+/**
+ * Sprite RGB565 ya escalado, generado por tools/sprites.py (Inc/sprites_*.h).
+ * data: por fila, el número de corridas y cada corrida como (salto, largo,
+ * color) o (salto, DAOS_SPRITE_LITERAL | largo, píxeles...); el salto son
+ * píxeles transparentes. Una fila DAOS_SPRITE_ROW_REPEAT repite la anterior.
+ */
+typedef struct {
+    uint16_t w;              /** Ancho en pantalla. */
+    uint16_t h;              /** Alto en pantalla. */
+    const uint16_t* data;    /** Filas codificadas. */
+} daos_sprite_t;
+
+#define DAOS_SPRITE_ROW_REPEAT 0x8000
+#define DAOS_SPRITE_LITERAL    0x8000
+
+/** Dibuja un sprite precompilado (una ventana por tramo opaco, recortado). */
+void daos_gfx_draw_sprite(int x, int y, const daos_sprite_t* sprite);
 /** Dibuja el contorno de un rectángulo. */
 void daos_gfx_draw_rect(int x, int y, int w, int h, uint16_t color);
 /** Dibuja una línea horizontal. */
@@ -221,6 +380,35 @@ void daos_gfx_hline(int x, int y, int w, uint16_t color);
 /** Dibuja una línea vertical. */
 void daos_gfx_vline(int x, int y, int h, uint16_t color);
 
+// ========================================================================
+// CONSOLA
+// ========================================================================
+
+/**
+ * Consola de texto en una franja de la pantalla: filas de 10 píxeles y 53
+ * columnas, desplazamiento al pasar de la última fila. Guarda lo que
+ * muestra cada celda y daos_console_flush solo redibuja las que cambiaron.
+ * Ver console.h.
+ * @param y Primera fila de píxeles de la franja.
+ * @param rows Filas de texto (hasta 20).
+ */
+void daos_console_init(int y, int rows);
+/** Color del texto y del fondo de lo que se escriba a partir de ahora. */
+void daos_console_color(uint16_t color, uint16_t bg);
+/** Escribe en el cursor ('\n', '\r', '\b', '\t' y ESC [2J incluidos). */
+void daos_console_puts(const char* str);
+/** Escribe en una celda fija, sin mover el cursor (marcadores, estadísticas). */
+void daos_console_write_at(int col, int row, const char* str);
+/** Muestra u oculta el cursor. */
+void daos_console_cursor(int visible);
+/** Con on, lo que sale por daos_uart_puts, putc y putint va también a la consola. */
+void daos_console_echo(int on);
+/**
+ * Redibuja las celdas que cambiaron, fuera de un cuadro (vacía antes lo
+ * encolado para la tarea de pantalla).
+ */
+void daos_console_flush(void);
+
 // ========================================================================
 // AUDIO
 // ========================================================================
@@ -343,6 +531,48 @@ typedef struct {
     int used_blocks;
     int free_blocks;
     int total_kb;
+    int fragmentation; /** Fragmentación del espacio libre (0-100 %). */
+    int inline_files;  /** Archivos pequeños guardados dentro del inodo. */
+    int packed_files;  /** Archivos guardados comprimidos. */
+    uint32_t dcache_hits;   /** Componentes de ruta resueltos por la caché. */
+    uint32_t dcache_misses; /** Componentes que recorrieron la tabla de inodos. */
+    uint32_t packed_raw_bytes;    /** Tamaño lógico de los archivos comprimidos. */
+    uint32_t packed_stored_bytes; /** Bytes que ocupan comprimidos. */
+    int persistent;    /** 1 si RAMFS está montado sobre el log en flash. */
+    uint32_t log_used_bytes; /** Bytes ocupados en la región activa del log. */
+    uint32_t vfs_cache_hits;   /** Aperturas servidas por la caché de archivos del VFS. */
+    uint32_t vfs_cache_misses; /** Aperturas de lectura que llegaron al backend. */
+    int vfs_open_fds;          /** Descriptores del VFS en uso. */
+    uint32_t sd_cache_hits;    /** Sectores de la SD servidos por la caché de bloques. */
+    uint32_t sd_cache_misses;  /** Sectores que hubo que leer de la tarjeta. */
+    int sd_cache_dirty;        /** Sectores modificados pendientes de escribir. */
+    uint32_t sd_crc_errors;    /** Bloques de la SD con CRC incorrecto (se repitieron). */
+    uint32_t sd_crc_failures;  /** Transferencias de la SD abandonadas tras los reintentos. */
+    uint32_t spi_transactions; /** Transacciones en el bus SPI1. */
+    uint32_t spi_switches;     /** Cambios de dispositivo (pantalla <-> SD). */
+    uint32_t spi_switch_cycles; /** Ciclos de CPU por cambio (promedio). */
+    uint32_t aio_requests;     /** Peticiones de E/S asíncrona atendidas. */
+    uint32_t aio_merged;       /** Peticiones servidas junto a una contigua. */
+    uint32_t aio_latency_ms;   /** Latencia media de una petición (envío a fin). */
+    uint32_t gfx_frames;       /** Cuadros compuestos por tiles. */
+    uint32_t gfx_tiles_per_frame; /** Tiles enviados por cuadro (promedio, de 300). */
+    uint32_t gfx_bytes_per_frame; /** Bytes por SPI por cuadro (promedio). */
+    uint32_t gfx_queued;       /** Primitivas encoladas para la tarea de pantalla. */
+    uint32_t gfx_merged;       /** Rellenos encolados fundidos con el anterior. */
+    uint32_t gfx_culled;       /** Primitivas encoladas tapadas (no se dibujaron). */
+    uint32_t gfx_batches;      /** Tandas enviadas por la lista. */
+    uint32_t gfx_presented;    /** Cuadros enviados con daos_gfx_present. */
+    uint32_t gfx_dropped;      /** Cuadros que no llegaron a su refresco. */
+    uint32_t gfx_torn;         /** Cuadros más largos que un refresco del panel. */
+    uint32_t gfx_present_latency_us; /** Espera media hasta el refresco. */
+    uint32_t gfx_present_max_us;     /** Espera más larga hasta el refresco. */
+    uint32_t gfx_period_us;    /** Periodo de refresco del panel. */
+    int gfx_vsync_source;      /** 0 reloj, 1 línea del panel, 2 pin TE. */
+    uint32_t gfx_glyph_hits;   /** Glifos dibujados desde la caché. */
+    uint32_t gfx_glyph_misses; /** Glifos que hubo que expandir. */
+    uint32_t gfx_console_chars; /** Caracteres escritos en la consola. */
+    uint32_t gfx_console_cells; /** Celdas de la consola redibujadas. */
+    uint32_t gfx_console_runs;  /** Tramos (ventanas) de celdas enviados. */
 } daos_memory_info_t;
 
 /** Rellena la estructura con la información de memoria. */
@@ -0,0 +1,153 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Interfaz de Dispositivo de Bloques
+ * ============================================================================
+ * Abstracción común para medios de almacenamiento (flash interna, SD,
+ * archivo en el host). Los sistemas de archivos solo hablan con esta
+ * interfaz, nunca con los registros del medio.
+ * ============================================================================
+ */
+
+#ifndef BLOCKDEV_H // Guarda de inclusión para la interfaz de bloques
+#define BLOCKDEV_H
+
+#pragma once
+#include <stdint.h>
+
+/**
+ * Dispositivo de bloques.
+ * Un "bloque" es la unidad de borrado del medio (sector de flash, sector
+ * de SD). Dentro de un bloque se puede leer y programar a cualquier offset.
+ * Todas las operaciones retornan 0 si OK y -1 si error.
+ */
+typedef struct blockdev {
+    uint32_t block_size;   /** Tamaño de cada bloque en bytes. */
+    uint32_t block_count;  /** Número de bloques del dispositivo. */
+
+    /** Leer len bytes desde (block, off). */
+    int (*read)(const struct blockdev* bd, uint32_t block, uint32_t off,
+                void* buf, uint32_t len);
+
+    /** Programar len bytes en (block, off). En flash solo pasa bits de 1 a 0. */
+    int (*prog)(const struct blockdev* bd, uint32_t block, uint32_t off,
+                const void* buf, uint32_t len);
+
+    /** Borrar un bloque completo (todos los bytes a 0xFF). NULL si el medio no lo requiere. */
+    int (*erase)(const struct blockdev* bd, uint32_t block);
+
+    /** Vaciar buffers pendientes hacia el medio. NULL si no aplica. */
+    int (*sync)(const struct blockdev* bd);
+
+    /**
+     * Leer count bloques completos y consecutivos en una sola transferencia.
+     * NULL si el medio no lo soporta (el llamador usa read bloque a bloque).
+     */
+    int (*read_blocks)(const struct blockdev* bd, uint32_t block, uint32_t count,
+                       void* buf);
+
+    /** Programar count bloques completos y consecutivos. NULL si no aplica. */
+    int (*prog_blocks)(const struct blockdev* bd, uint32_t block, uint32_t count,
+                       const void* buf);
+
+    void* ctx;             /** Estado privado de la implementación. */
+} blockdev_t;
+
+/* ========================================================================== */
+/* IMPLEMENTACIONES                                  */
+/* ========================================================================== */
+
+/**
+ * Flash interna del STM32F446 (sectores 6 y 7, 2 x 128 KB en 0x08040000).
+ * Esos sectores quedan fuera de la región FLASH del linker script.
+ * @return Dispositivo de 2 bloques de 128 KB.
+ */
+const blockdev_t* blockdev_flash_get(void);
+
+/**
+ * Tarjeta SD por SPI (sectores de 512 bytes, sin borrado).
+ * read_blocks/prog_blocks usan las órdenes multibloque (CMD18/CMD25).
+ * La tarjeta debe estar inicializada con sd_init().
+ * @return Dispositivo de sectores de 512 bytes.
+ */
+const blockdev_t* blockdev_sd_get(void);
+
+/* ========================================================================== */
+/* CACHÉ DE BLOQUES                                  */
+/* ========================================================================== */
+
+/** Bloques retenidos por la caché (se puede redefinir al compilar). */
+#ifndef BLOCKDEV_CACHE_BLOCKS
+#define BLOCKDEV_CACHE_BLOCKS 16
+#endif
+/** Tamaño máximo de bloque que admite la caché (sectores de SD). */
+#define BLOCKDEV_CACHE_BLOCK_SIZE 512
+
+/** Contadores de la caché. */
+typedef struct {
+    uint32_t hits;        /** Accesos servidos sin tocar el medio. */
+    uint32_t misses;      /** Accesos que tuvieron que leer el bloque. */
+    uint32_t reads;       /** Bloques leídos del medio. */
+    uint32_t writes;      /** Bloques escritos al medio. */
+    uint8_t dirty;        /** Bloques modificados pendientes de escribir. */
+} blockdev_cache_stats_t;
+
+/**
+ * Envolver un dispositivo con una caché LRU de escritura diferida.
+ * prog solo modifica la copia en RAM; los bloques sucios se escriben al
+ * desalojarse o en sync. fat.c llama a sync al cerrar un archivo abierto
+ * para escritura, al terminar de crear, borrar o renombrar, en fat_sync y
+ * al desmontar: lo que se acumula en RAM es lo de los archivos que siguen
+ * abiertos. Solo hay una instancia: envolver un
+ * dispositivo (aunque sea el mismo) vacía e invalida primero la caché.
+ * read_blocks/prog_blocks pasan directo al medio (los bloques ya retenidos
+ * se sirven o actualizan en la caché) para que una transferencia grande no
+ * desaloje los metadatos.
+ * El medio debe sobrescribir sin borrado (SD, imagen de disco).
+ * @param lower Dispositivo real (block_size <= BLOCKDEV_CACHE_BLOCK_SIZE).
+ * @return Dispositivo con caché, o NULL si lower no es compatible.
+ */
+const blockdev_t* blockdev_cache_wrap(const blockdev_t* lower);
+
+/** Escribir los bloques sucios al medio. @return 0 si OK, -1 si error. */
+int blockdev_cache_flush(void);
+
+/**
+ * Escribir los bloques sucios y olvidar todos los retenidos, para que la
+ * próxima lectura vaya al medio (al desmontar una tarjeta que se puede
+ * cambiar por otra).
+ * @return 0 si OK, -1 si falló la escritura (los bloques se olvidan igual).
+ */
+int blockdev_cache_invalidate(void);
+
+void blockdev_cache_get_stats(blockdev_cache_stats_t* stats);
+
+#ifdef DAOS_HOST
+/**
+ * Dispositivo respaldado por un archivo del host (solo compilación DAOS_HOST).
+ * El archivo se crea borrado (0xFF) si no existe.
+ * @param bd Estructura a rellenar.
+ * @param path Ruta del archivo imagen.
+ * @param block_size Tamaño de bloque en bytes.
+ * @param block_count Número de bloques.
+ * @return 0 si OK, -1 si error.
+ */
+int blockdev_file_open(blockdev_t* bd, const char* path,
+                       uint32_t block_size, uint32_t block_count);
+
+/**
+ * Imagen de disco del host (solo compilación DAOS_HOST).
+ * A diferencia de blockdev_file_open, prog sobrescribe (semántica de
+ * tarjeta SD) y no hay borrado. El archivo debe existir; el número de
+ * bloques sale de su tamaño.
+ * @param bd Estructura a rellenar.
+ * @param path Ruta de la imagen (p. ej. una imagen FAT32).
+ * @param block_size Tamaño de bloque en bytes (512 para SD).
+ * @return 0 si OK, -1 si error.
+ */
+int blockdev_file_open_disk(blockdev_t* bd, const char* path, uint32_t block_size);
+
+/** Cerrar un dispositivo abierto con blockdev_file_open o blockdev_file_open_disk. */
+void blockdev_file_close(blockdev_t* bd);
+#endif
+
+#endif /* BLOCKDEV_H */
@@ -0,0 +1,110 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Compositor por tiles
+ * ============================================================================
+ * Un framebuffer completo (320x240 RGB565 = 150 KB) no cabe en los 128 KB
+ * de RAM. El compositor deja que un juego redibuje la escena entera en cada
+ * cuadro y aun así solo envía a la pantalla lo que cambió:
+ *
+ * - Entre compositor_begin y compositor_end las primitivas no tocan la
+ *   pantalla: se anotan en una lista (los rellenos contiguos del mismo
+ *   color se funden con el anterior, y un relleno de pantalla completa
+ *   descarta todo lo anterior).
+ * - Al cerrar el cuadro, la pantalla se recorre en franjas de
+ *   COMPOSITOR_TILE filas. Cada franja se pinta en un buffer de
+ *   320 x COMPOSITOR_TILE píxeles con las primitivas que la cruzan.
+ * - Cada tile de COMPOSITOR_TILE x COMPOSITOR_TILE guarda un hash de lo
+ *   que muestra la pantalla. Solo los tiles cuyo hash cambió salen por el
+ *   bus; los tiles sucios vecinos de una franja comparten una ventana.
+ *
+ * Fuera de un cuadro (o si la lista se llena) las funciones retornan -1 y
+ * el llamador dibuja directamente; el compositor marca esos tiles como
+ * desconocidos y el próximo cuadro los vuelve a enviar.
+ *
+ * Las funciones reciben los mismos argumentos que las de pantalla.h y
+ * producen exactamente los mismos píxeles.
+ * ============================================================================
+ */
+
+#ifndef COMPOSITOR_H // Guarda de inclusión para el compositor
+#define COMPOSITOR_H
+
+#pragma once
+#include <stdint.h>
+#include "pantalla.h"
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Lado de un tile en píxeles (divide a SCREEN_WIDTH y SCREEN_HEIGHT). */
+#define COMPOSITOR_TILE 16
+/** Tiles por fila y por columna de la pantalla. */
+#define COMPOSITOR_COLS (SCREEN_WIDTH / COMPOSITOR_TILE)
+#define COMPOSITOR_ROWS (SCREEN_HEIGHT / COMPOSITOR_TILE)
+/** Primitivas que caben en un cuadro. */
+#define COMPOSITOR_MAX_OPS 256
+/** Bytes para copiar los textos de un cuadro. */
+#define COMPOSITOR_TEXT_POOL 512
+
+/** Contadores del compositor. */
+typedef struct {
+    uint32_t frames;          /** Cuadros cerrados. */
+    uint32_t ops;             /** Primitivas anotadas. */
+    uint32_t merged;          /** Rellenos fundidos con el anterior. */
+    uint32_t spills;          /** Cuadros que llenaron la lista (el resto se dibujó directo). */
+    uint32_t tiles;           /** Tiles enviados a la pantalla. */
+    uint32_t windows;         /** Ventanas abiertas para enviarlos. */
+    uint32_t bytes;           /** Bytes por SPI (ventanas y píxeles). */
+} compositor_stats_t;
+
+/* ========================================================================== */
+/* CUADROS                                           */
+/* ========================================================================== */
+
+/**
+ * Empezar un cuadro. Lo que no cubra ninguna primitiva queda del color bg.
+ * Solo una tarea debe dibujar cuadros; si ya hay uno abierto no hace nada.
+ */
+void compositor_begin(uint16_t bg);
+
+/** Cerrar el cuadro: pintar las franjas y enviar los tiles que cambiaron. */
+void compositor_end(void);
+
+/** @return 1 si hay un cuadro abierto. */
+uint8_t compositor_active(void);
+
+/**
+ * Olvidar lo que muestra la pantalla: el próximo cuadro la envía entera.
+ * Para cuando alguien dibuja sin pasar por daos_gfx.
+ */
+void compositor_invalidate(void);
+
+void compositor_get_stats(compositor_stats_t* stats);
+
+/* ========================================================================== */
+/* PRIMITIVAS                                        */
+/* ========================================================================== */
+/* 0 si se anotó en el cuadro; -1 si el llamador debe dibujar directamente. */
+
+int compositor_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+/** Texto de pantalla_draw_string (escala 1) o pantalla_draw_string_large. */
+int compositor_text(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg, uint8_t scale, uint8_t large);
+/** Círculo (contorno o relleno) con el centro en coordenadas con signo. */
+int compositor_circle(int16_t x0, int16_t y0, uint16_t radius, uint16_t color, uint8_t filled);
+/** Rectángulo redondeado (contorno o relleno), como pantalla_draw_round_rect. */
+int compositor_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color, uint8_t filled);
+/** Línea, como pantalla_draw_line. */
+int compositor_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+/** Triángulo (contorno o relleno), como pantalla_draw_triangle. */
+int compositor_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color, uint8_t filled);
+/**
+ * Bitmap ya recortado por la izquierda y por arriba. src se lee al cerrar
+ * el cuadro: debe seguir vivo hasta entonces.
+ * @param keyed 1 si los píxeles iguales a key son transparentes.
+ */
+int compositor_bitmap(uint16_t x, uint16_t y, const uint16_t* src, uint16_t w, uint16_t h, uint16_t stride, uint8_t keyed, uint16_t key);
+/** Sprite codificado (daos_sprite_t); data suele estar en flash. */
+int compositor_sprite(int16_t x, int16_t y, const uint16_t* data, uint16_t w, uint16_t h);
+
+#endif /* COMPOSITOR_H */
@@ -0,0 +1,99 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Consola de texto en una región de la pantalla
+ * ============================================================================
+ * Texto por celdas de 6x10 píxeles (el glifo de 5x8, una columna y dos
+ * filas de separación) en una franja de la pantalla: el shell escribe ahí
+ * lo que manda por la UART y sigue dibujando su cabecera por encima.
+ *
+ * La consola guarda dos copias de la franja, carácter y color por celda:
+ * la que escriben console_puts y console_write_at, y la que ya está en el
+ * panel. console_flush compara ambas y solo redibuja las celdas que
+ * cambiaron, cada tramo seguido del mismo color con una ventana
+ * (pantalla_draw_text_cells). Escribir un carácter cuesta una celda, no un
+ * bloque de texto entero.
+ *
+ * Las líneas forman un anillo: al pasar de la última, la de arriba se
+ * recicla en vez de copiar las demás, y el flush redibuja cada fila
+ * contra lo que el panel ya muestra en ella (el espacio sobre espacio no
+ * se envía). El desplazamiento por hardware del ILI9341 (VSCRDEF /
+ * VSCRSADD) no sirve aquí: mueve las 320 líneas físicas del panel, y con
+ * la orientación apaisada de pantalla_init (MADCTL 0xE8) eso es el eje X
+ * de la pantalla, no el de las filas de texto.
+ *
+ * Entienden '\n', '\r', '\b', '\t', la secuencia ESC [2J de borrar y las
+ * líneas de caja en UTF-8 (se dibujan con '=', '-', '|' y '+'); el resto
+ * de UTF-8 (emojis) no ocupa celda.
+ * ============================================================================
+ */
+
+#ifndef CONSOLE_H // Guarda de inclusión para la consola
+#define CONSOLE_H
+
+#pragma once
+#include <stdint.h>
+#include "pantalla.h"
+#include "glyph.h"
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Alto de una celda (el glifo más dos filas de separación). */
+#define CONSOLE_ROW_HEIGHT 10
+/** Columnas: las que caben a lo ancho de la pantalla. */
+#define CONSOLE_COLS (SCREEN_WIDTH / GLYPH_ADVANCE)
+/** Filas como máximo (200 píxeles). */
+#define CONSOLE_MAX_ROWS 20
+/** Parejas de color y fondo distintas en la consola a la vez. */
+#define CONSOLE_COLORS 8
+
+/** Contadores de la consola. */
+typedef struct {
+    uint32_t chars;           /** Caracteres escritos. */
+    uint32_t scrolls;         /** Líneas desplazadas. */
+    uint32_t cells;           /** Celdas redibujadas. */
+    uint32_t runs;            /** Tramos (ventanas) enviados. */
+} console_stats_t;
+
+/* ========================================================================== */
+/* API                                               */
+/* ========================================================================== */
+
+/**
+ * Ocupar una franja de la pantalla y vaciarla. El próximo console_flush la
+ * dibuja entera.
+ * @param y Primera fila de píxeles.
+ * @param rows Filas de texto (se recorta a CONSOLE_MAX_ROWS y a la pantalla).
+ */
+void console_init(uint16_t y, uint8_t rows);
+
+/** Color del texto que se escriba a partir de ahora. */
+void console_set_color(uint16_t color, uint16_t bg);
+
+/** Vaciar la consola y llevar el cursor arriba a la izquierda. */
+void console_clear(void);
+
+/** Escribir en el cursor; al pasar de la última fila se desplaza. */
+void console_putc(char c);
+void console_puts(const char* str);
+
+/**
+ * Escribir en una celda fija sin mover el cursor ni desplazar (marcadores,
+ * estadísticas). Lo que no cabe en la fila se descarta.
+ */
+void console_write_at(uint8_t col, uint8_t row, const char* str);
+
+/** Mostrar el cursor ('_' sobre la celda, si está vacía). */
+void console_cursor(uint8_t visible);
+
+/**
+ * Redibujar las celdas que cambiaron desde el último flush, en una sola
+ * transacción del bus. Dibuja directamente: quien lo llama debe tener el
+ * bus (daos_console_flush vacía antes la lista de dibujo).
+ */
+void console_flush(void);
+
+void console_get_stats(console_stats_t* stats);
+
+#endif /* CONSOLE_H */
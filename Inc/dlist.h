@@ -0,0 +1,101 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Lista de dibujo diferida
+ * ============================================================================
+ * Varias tareas dibujan en la pantalla (la de render del juego, la de los
+ * botones, la del cursor del shell). Cada primitiva abría su propia
+ * transacción en SPI1 y mandaba su ventana, intercaladas en el orden en que
+ * corrían las tareas.
+ *
+ * Con la lista, daos_gfx anota las primitivas en un anillo y una sola tarea
+ * de pantalla (dlist_task) las dibuja por tandas:
+ *
+ * - Un relleno contiguo al anterior y del mismo color se funde con él, y
+ *   uno de pantalla completa descarta todo lo anotado.
+ * - Antes de dibujar, se descarta cada primitiva que un relleno posterior
+ *   de la misma tanda tapa por completo.
+ * - La tanda sale en una sola transacción del bus (pantalla_batch_begin):
+ *   el CS queda bajo de la primera ventana a la última.
+ *
+ * La lista solo anota mientras corre la tarea de pantalla. Antes (menú,
+ * arranque) y después de dlist_sync las funciones retornan -1 y el
+ * llamador dibuja directamente. Si el anillo o los textos se llenan, la
+ * tarea que dibuja vacía la lista ella misma.
+ *
+ * Los bitmaps no se anotan: el llamador puede reusar su buffer al retornar.
+ * daos_gfx vacía la lista y los dibuja directamente.
+ * ============================================================================
+ */
+
+#ifndef DLIST_H // Guarda de inclusión para la lista de dibujo
+#define DLIST_H
+
+#pragma once
+#include <stdint.h>
+#include "pantalla.h"
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Primitivas en el anillo. */
+#define DLIST_MAX_OPS 64
+/** Bytes para copiar los textos anotados. */
+#define DLIST_TEXT_POOL 256
+/** Periodo de la tarea de pantalla. */
+#define DLIST_PERIOD_MS 20
+
+/** Contadores de la lista. */
+typedef struct {
+    uint32_t ops;             /** Primitivas anotadas. */
+    uint32_t merged;          /** Rellenos fundidos con el anterior. */
+    uint32_t culled;          /** Primitivas tapadas que no se dibujaron. */
+    uint32_t batches;         /** Tandas dibujadas (una transacción cada una). */
+    uint32_t overflows;       /** Tandas que vació quien dibujaba (anillo lleno). */
+} dlist_stats_t;
+
+/* ========================================================================== */
+/* TAREA                                             */
+/* ========================================================================== */
+
+/**
+ * Tarea de pantalla: activa la lista y dibuja lo anotado. Crear una sola,
+ * con DAOS_PRIO_NORMAL.
+ */
+void dlist_task(void);
+
+/** Dibujar ya lo anotado (p. ej. antes de un bitmap o de cerrar un cuadro). */
+void dlist_flush(void);
+
+/**
+ * Dibujar lo anotado y volver a dibujar directamente hasta que la tarea de
+ * pantalla corra otra vez. Para antes de matar las tareas o de una espera
+ * activa, cuando la tarea ya no va a correr.
+ */
+void dlist_sync(void);
+
+/** @return 1 si las primitivas se anotan. */
+uint8_t dlist_active(void);
+
+/** @return Primitivas anotadas sin dibujar. */
+uint16_t dlist_pending(void);
+
+void dlist_get_stats(dlist_stats_t* stats);
+
+/* ========================================================================== */
+/* PRIMITIVAS                                        */
+/* ========================================================================== */
+/* Mismos argumentos que en pantalla.h. 0 si se anotó; -1 si el llamador
+ * debe dibujar directamente. */
+
+int dlist_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+/** Texto de pantalla_draw_string (escala 1) o pantalla_draw_string_large. */
+int dlist_text(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg, uint8_t scale, uint8_t large);
+int dlist_circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t color, uint8_t filled);
+int dlist_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color, uint8_t filled);
+int dlist_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+int dlist_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color, uint8_t filled);
+/** Sprite codificado (daos_sprite_t): data debe seguir vivo hasta dibujarse. */
+int dlist_sprite(int16_t x, int16_t y, const uint16_t* data, uint16_t w, uint16_t h);
+
+#endif /* DLIST_H */
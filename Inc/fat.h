@@ -1,87 +1,159 @@
-// fat.h - Librería SD con múltiples métodos de inicialización
-#ifndef FAT_H // Guarda de inclusión para la librería FAT
+/**
+ * ============================================================================
+ * DaOS v2.0 - FAT32
+ * ============================================================================
+ * Sistema de archivos FAT32 sobre un dispositivo de bloques de 512 bytes
+ * (la tarjeta SD en el equipo, una imagen de disco en el host).
+ *
+ * - Lee el BPB del sector 0 o de la primera partición FAT32 del MBR.
+ * - Recorre cadenas de clusters; cada archivo abierto recuerda el último
+ *   cluster visitado, así la lectura secuencial consulta la FAT una vez
+ *   por cluster y esa consulta la sirve la caché de sectores de FAT.
+ * - Nombres largos (LFN) en lectura y escritura; los nombres que caben en
+ *   8.3 se guardan solo como entrada corta.
+ * - Caché de entradas de directorio: las búsquedas repetidas de una ruta
+ *   no vuelven a recorrer el directorio.
+ *
+ * Todas las funciones retornan >= 0 si OK y -1 si error (como RAMFS).
+ * ============================================================================
+ */
+
+#ifndef FAT_H // Guarda de inclusión para FAT32
 #define FAT_H
 
-#include <stdint.h> // Incluye tipos de enteros fijos
+#pragma once
+#include <stdint.h>
+#include "blockdev.h"
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Tamaño de sector soportado. */
+#define FAT_SECTOR_SIZE 512
+/** Máximo de archivos y directorios abiertos. */
+#define FAT_MAX_OPEN 4
+/** Longitud máxima de un nombre (un componente de la ruta). */
+#define FAT_MAX_NAME 64
+/** Longitud máxima de una ruta completa. */
+#define FAT_MAX_PATH 64
+/** Sectores de FAT retenidos en la caché (128 entradas cada uno). */
+#define FAT_FAT_CACHE 4
+/** Entradas de la caché de directorio. */
+#define FAT_DCACHE_SIZE 8
+
+/* ========================================================================== */
+/* MODOS DE APERTURA                                 */
+/* ========================================================================== */
+/* Mismos valores que RAMFS_O_* y VFS_O_*. */
 
-// Configuración de pines (ajustar según tu conexión)
-/** Puerto para el pin Chip Select (CS) del SD. */
-#define SD_CS_PORT      GPIOA
-/** Pin específico para Chip Select (CS) del SD (ej: PA10 = D2). */
-#define SD_CS_PIN       10
+#define FAT_O_RDONLY  0x01
+#define FAT_O_WRONLY  0x02
+#define FAT_O_RDWR    0x03
+#define FAT_O_CREAT   0x04
+#define FAT_O_TRUNC   0x08
+#define FAT_O_APPEND  0x10
 
-// Estructura de archivo simple
-/** Estructura que representa un archivo dentro del sistema FAT simple. */
+#define FAT_SEEK_SET  0
+#define FAT_SEEK_CUR  1
+#define FAT_SEEK_END  2
+
+/* ========================================================================== */
+/* TIPOS                                             */
+/* ========================================================================== */
+
+/** Entrada de directorio devuelta por fat_readdir. */
 typedef struct {
-    char nombre[32];    /** Nombre del archivo. */
-    char contenido[200];/** Contenido del archivo (limitado a 200 bytes). */
-    uint8_t usado;      /** Bandera que indica si la entrada está en uso (1) o libre (0). */
-} Archivo;
-
-// Configuración
-/** Sector donde comienza el sistema de archivos (ej: 1000). */
-#define SECTOR_START    1000
-/** Número máximo de archivos soportados. */
-#define MAX_FILES       10
-/** Tamaño estándar de un sector en bytes (512). */
-#define SECTOR_SIZE     512
-
-// Funciones públicas
-/**
- * Inicializa el sistema de archivos FAT y la tarjeta SD.
- * @return 0 en éxito, > 0 si error.
- */
-uint8_t fat_init(void);
+    char name[FAT_MAX_NAME];  /** Nombre largo, o el corto si no hay LFN. */
+    uint8_t is_dir;           /** 1 si es un directorio. */
+    uint32_t size;            /** Tamaño en bytes (0 para directorios). */
+} fat_dirent_t;
 
-/**
- * Lee un sector específico de la tarjeta SD.
- * @param sector Número de sector a leer.
- * @param buffer Buffer de destino (debe ser de SECTOR_SIZE).
- * @return 0 en éxito, > 0 si error.
- */
-uint8_t fat_read_sector(uint32_t sector, uint8_t *buffer);
+/** Estadísticas del volumen y de las cachés. */
+typedef struct {
+    uint32_t cluster_size;    /** Bytes por cluster. */
+    uint32_t total_clusters;  /** Clusters de datos del volumen. */
+    uint32_t free_clusters;   /** Clusters libres (0xFFFFFFFF si desconocido). */
+    uint32_t fat_hits;        /** Consultas a la FAT servidas por la caché. */
+    uint32_t fat_misses;      /** Sectores de FAT leídos del medio. */
+    uint32_t dcache_hits;     /** Búsquedas resueltas por la caché de directorio. */
+    uint32_t dcache_misses;   /** Búsquedas que recorrieron el directorio. */
+} fat_stats_t;
 
-/**
- * Escribe un sector específico en la tarjeta SD.
- * @param sector Número de sector a escribir.
- * @param buffer Buffer de origen (debe ser de SECTOR_SIZE).
- * @return 0 en éxito, > 0 si error.
- */
-uint8_t fat_write_sector(uint32_t sector, uint8_t *buffer);
+/* ========================================================================== */
+/* MONTAJE                                           */
+/* ========================================================================== */
 
 /**
- * Verifica si la tarjeta SD y el sistema FAT están listos.
- * @return 1 si está listo, 0 si no.
+ * Montar un volumen FAT32.
+ * @param bd Dispositivo con bloques de FAT_SECTOR_SIZE bytes.
+ * @return 0 si OK, -1 si no hay un FAT32 válido.
  */
-uint8_t fat_is_ready(void);
+int fat_mount(const blockdev_t* bd);
 
-// Comandos de archivos
 /**
- * Crea un nuevo archivo en el sistema.
- * @param nombre Nombre del nuevo archivo.
- * @param contenido Contenido inicial del archivo.
- * @return 0 en éxito, > 0 si error.
+ * Escribir todo lo pendiente y desmontar (cierra los archivos abiertos).
  */
-uint8_t fat_crear_archivo(const char *nombre, const char *contenido);
+void fat_umount(void);
+
+/** @return 1 si hay un volumen montado. */
+int fat_is_mounted(void);
 
 /**
- * Muestra una lista de todos los archivos existentes.
+ * Escribir al medio los sectores sucios (FAT, datos, FSInfo) y los
+ * tamaños de los archivos abiertos, y llamar a sync del dispositivo.
+ * Cerrar un archivo abierto para escritura, y terminar fat_unlink,
+ * fat_mkdir, fat_rmdir o fat_rename, hace lo mismo: con una caché de
+ * escritura diferida debajo, solo queda en RAM lo de los archivos que
+ * siguen abiertos.
+ * @return 0 si OK, -1 si error.
  */
-void fat_listar_archivos(void);
+int fat_sync(void);
+
+/* ========================================================================== */
+/* ARCHIVOS                                          */
+/* ========================================================================== */
 
 /**
- * Lee el contenido de un archivo por su nombre.
- * @param nombre Nombre del archivo a leer.
- * @param buffer Buffer donde se almacenará el contenido.
- * @return 0 en éxito, > 0 si error.
+ * Abrir un archivo.
+ * @param path Ruta absoluta dentro del volumen ("/logs/a.txt").
+ * @param flags FAT_O_*.
+ * @return Handle (>= 0) o -1 si error.
  */
-uint8_t fat_leer_archivo(const char *nombre, char *buffer);
+int fat_open(const char* path, int flags);
+int fat_read(int h, void* buf, uint32_t n);
+int fat_write(int h, const void* buf, uint32_t n);
+/** @return Nueva posición o -1 si error. */
+int fat_seek(int h, int offset, int whence);
+/** Cerrar un archivo o un directorio. */
+int fat_close(int h);
+
+/* ========================================================================== */
+/* DIRECTORIOS Y RUTAS                               */
+/* ========================================================================== */
+
+int fat_opendir(const char* path);
+/** @return 1 si hay entrada, 0 al final, -1 si error. */
+int fat_readdir(int h, fat_dirent_t* ent);
 
 /**
- * Borra un archivo por su nombre.
- * @param nombre Nombre del archivo a borrar.
- * @return 0 en éxito, > 0 si error.
+ * Consultar una ruta.
+ * @param is_dir Salida: 1 si es directorio (puede ser NULL).
+ * @return Tamaño en bytes (0 para directorios) o -1 si no existe.
  */
-uint8_t fat_borrar_archivo(const char *nombre);
+int fat_stat(const char* path, uint8_t* is_dir);
+
+int fat_unlink(const char* path);
+int fat_mkdir(const char* path);
+/** Eliminar un directorio vacío. */
+int fat_rmdir(const char* path);
+/** Renombrar o mover dentro del volumen. Falla si el destino existe. */
+int fat_rename(const char* old_path, const char* new_path);
+
+/* ========================================================================== */
+/* DIAGNÓSTICO                                       */
+/* ========================================================================== */
+
+void fat_get_stats(fat_stats_t* stats);
 
-#endif // FAT_H
+#endif /* FAT_H */
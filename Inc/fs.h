@@ -1,32 +1,32 @@
 #pragma once // Directiva alternativa de guarda
 #include <stdint.h> // Incluye tipos de enteros fijos
 
-/** Número máximo de archivos soportados. */
-#define FS_MAX_FILES 8
+/* API heredada de archivos planos. Los datos viven en RAMFS, dentro de
+ * FS_DIR; aquí solo se reparten los archivos abiertos. */
+
+/** Ranuras que recorre fs_name_at (igual que RAMFS_MAX_FILES). */
+#define FS_MAX_FILES 32
+/** Archivos abiertos a la vez (tamaño del pool de handles, máximo 16). */
+#define FS_MAX_OPEN 8
 /** Longitud máxima del nombre de un archivo. */
 #define FS_MAX_FILENAME 16
-/** Tamaño de cada bloque de datos en bytes. */
-#define FS_BLOCK_SIZE 256
-/** Número máximo de bloques disponibles en el sistema de archivos. */
-#define FS_MAX_BLOCKS 32
+/** Directorio de RAMFS donde se guardan los archivos. */
+#define FS_DIR "/rom"
 
-/** Estructura Inodo (metadatos del archivo). */
-typedef struct {
-char name[FS_MAX_FILENAME];  /** Nombre del archivo. */
-uint32_t size;               /** Tamaño del archivo en bytes. */
-uint32_t start_block;        /** Primer bloque de datos del archivo. */
-uint8_t in_use;              /** Bandera: 1 si está en uso, 0 si está libre. */
-} FSInode;
+/** Orígenes para fs_seek_fd (mismos valores que VFS_SEEK_*). */
+#define FS_SEEK_SET 0
+#define FS_SEEK_CUR 1
+#define FS_SEEK_END 2
 
 /** Estructura de archivo abierto (descriptor de archivo). */
 typedef struct {
-int fd;                      /** Descriptor de archivo (File Descriptor). */
-uint32_t position;           /** Posición actual del puntero de lectura/escritura. */
-FSInode *inode;              /** Puntero al inodo asociado en el sistema. */
+int fd;                      /** Handle con generación (ver fs_open_fd), -1 si está cerrado. */
+uint32_t position;           /** Posición actual del puntero de lectura. */
+uint32_t size;               /** Tamaño al abrirlo; fs_seek_fd lo actualiza desde RAMFS. */
 } FSFile;
 
 /* Inicializar filesystem */
-/** Inicializa la estructura del sistema de archivos. */
+/** Vacía el pool de archivos abiertos (los datos están en RAMFS). */
 void fs_init(void);
 
 /* Crear/escribir archivo */
@@ -54,6 +54,24 @@ int fs_read(FSFile *file, void *buffer, uint32_t size);
 /** Cierra un descriptor de archivo abierto. */
 void fs_close(FSFile *file);
 
+/* Handles */
+/**
+ * Abre un archivo y retorna su handle: ranura del pool en los 4 bits bajos
+ * y generación de la ranura encima. Cerrar incrementa la generación, así
+ * que un handle viejo no se confunde con el archivo que reutiliza la ranura.
+ * @return Handle (>= 0) o -1 si no existe o el pool está lleno.
+ */
+int fs_open_fd(const char *name);
+
+/** @return Bytes leídos, o -1 si el handle no es válido. */
+int fs_read_fd(int fd, void *buffer, uint32_t size);
+
+/** @return Nueva posición (acotada al tamaño), o -1 si el handle no es válido. */
+int fs_seek_fd(int fd, int offset, int whence);
+
+/** @return 0 si OK, -1 si el handle no es válido (ya cerrado o viejo). */
+int fs_close_fd(int fd);
+
 /* Listar archivos */
 /** Muestra la lista de archivos disponibles. */
 void fs_list(void);
@@ -71,3 +89,11 @@ int fs_get_size(const char *name);
  * @return 0 en éxito, < 0 si error.
  */
 int fs_delete(const char *name);
+
+/* Recorrer archivos */
+/**
+ * Obtiene el nombre del archivo en una ranura (0 <= idx < FS_MAX_FILES).
+ * El nombre es válido hasta la siguiente llamada.
+ * @return Nombre, o NULL si la ranura no tiene un archivo de FS_DIR.
+ */
+const char* fs_name_at(int idx);
@@ -0,0 +1,70 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Fuente 5x8 y caché de glifos
+ * ============================================================================
+ * La fuente cubre el ASCII imprimible (0x20 a 0x7E). Cada glifo son 5
+ * columnas de 8 bits; el bit 0 es la fila de arriba.
+ *
+ * Para dibujar, un glifo se expande a píxeles RGB565 con su color, su
+ * fondo y su escala: 40 píxeles a escala 1, 160 a escala 2. La caché
+ * guarda los últimos glifos expandidos, así un texto que se repinta con
+ * los mismos colores (el shell, las estadísticas de las demos, los
+ * marcadores) sale por DMA directamente desde ella, sin volver a recorrer
+ * los bits.
+ *
+ * Es asociativa por conjuntos de GLYPH_CACHE_WAYS: el carácter y los
+ * colores eligen el conjunto, y dentro de él se reemplaza el menos usado
+ * recientemente. Las escalas 1 y 2 tienen su propia tabla; las mayores no
+ * se guardan (quien dibuja las expande como antes).
+ * ============================================================================
+ */
+
+#ifndef GLYPH_H // Guarda de inclusión para la fuente
+#define GLYPH_H
+
+#pragma once
+#include <stdint.h>
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Columnas y filas de un glifo. */
+#define GLYPH_WIDTH 5
+#define GLYPH_HEIGHT 8
+/** Avance de un carácter al siguiente (una columna de separación). */
+#define GLYPH_ADVANCE 6
+
+/** Glifos de escala 1 en caché (80 bytes cada uno). */
+#define GLYPH_CACHE_SLOTS 32
+/** Glifos de escala 2 en caché (320 bytes cada uno). */
+#define GLYPH_CACHE_LARGE_SLOTS 4
+/** Vías por conjunto (divide a las dos cantidades anteriores). */
+#define GLYPH_CACHE_WAYS 4
+
+/** Contadores de la caché. */
+typedef struct {
+    uint32_t hits;            /** Glifos servidos ya expandidos. */
+    uint32_t misses;          /** Glifos expandidos al pedirlos. */
+    uint32_t uncached;        /** Pedidos con una escala que no se guarda. */
+} glyph_stats_t;
+
+/* ========================================================================== */
+/* API                                               */
+/* ========================================================================== */
+
+/** @return Las 5 columnas del carácter, o NULL si la fuente no lo tiene. */
+const uint8_t* glyph_bits(char c);
+
+/**
+ * Glifo expandido: (GLYPH_WIDTH * scale) x (GLYPH_HEIGHT * scale) píxeles por
+ * filas. El puntero vale hasta el próximo glyph_pixels (que puede
+ * reemplazarlo): si se envía por DMA, esperar a que termine antes.
+ * @return Píxeles, o NULL si la fuente no tiene el carácter o la escala
+ *         no se guarda.
+ */
+const uint16_t* glyph_pixels(char c, uint16_t color, uint16_t bg, uint8_t scale);
+
+void glyph_get_stats(glyph_stats_t* stats);
+
+#endif /* GLYPH_H */
@@ -0,0 +1,100 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Panel ILI9341 emulado (host)
+ * ============================================================================
+ * Solo se compila con -DDAOS_HOST. pantalla.c no cambia: en el host sus
+ * líneas CS, DC y RST llaman a lcd_host_select, lcd_host_dc y
+ * lcd_host_reset, y spi_dma.c entrega al emulador cada byte que sale por
+ * SPI1 (por sondeo con spi_dma_host_exchange, por DMA con
+ * spi_dma_host_start).
+ *
+ * Como el DMA real, un tramo no sale al lanzarlo: sus bytes llegan al
+ * panel cuando la CPU espera al bus (spi_dma_wait, spi_dma_flush, o
+ * cualquier byte por sondeo, que vacía antes la cola), con el CS y el DC
+ * que haya en ese momento. Un driver que cambia el DC o suelta el CS con
+ * píxeles aún en cola corrompe aquí la imagen igual que en el panel.
+ * Las funciones de inspección esperan antes a que la cola se vacíe.
+ *
+ * El emulador decodifica la misma secuencia que recibe el panel: 0x2A y
+ * 0x2B fijan la ventana y 0x2C escribe píxeles RGB565 en un framebuffer de
+ * 320x240, que recorre la ventana fila a fila como la memoria del panel.
+ * Con él se pueden comparar cuadros contra imágenes de referencia
+ * (lcd_host_save_ppm / lcd_host_save_png) y medir el tráfico del bus por
+ * cuadro (lcd_host_frame).
+ *
+ * Solo se emula la orientación que programa pantalla_init (MADCTL 0xE8,
+ * apaisada, 16 bits por píxel). Las lecturas devuelven 0xFF, como un
+ * módulo sin MISO.
+ *
+ * Para compilar un programa del host con la pantalla:
+ *
+ *     gcc -DDAOS_HOST -IInc prog.c Src/pantalla.c Src/raster.c
+ *         Src/spi_dma.c Src/lcd_host.c
+ * ============================================================================
+ */
+
+#ifndef LCD_HOST_H // Guarda de inclusión para el panel emulado
+#define LCD_HOST_H
+
+#pragma once
+#include <stdint.h>
+#include "pantalla.h"
+
+#ifdef DAOS_HOST
+
+/** Tráfico que recibió el panel. */
+typedef struct {
+    uint32_t bytes;           /** Bytes con el CS bajo (comandos, parámetros y píxeles). */
+    uint32_t selects;         /** Veces que bajó el CS (transacciones). */
+    uint32_t windows;         /** Ventanas abiertas (comandos 0x2C). */
+    uint32_t commands;        /** Comandos (bytes con DC bajo). */
+    uint32_t pixels;          /** Píxeles escritos en la memoria. */
+} lcd_host_stats_t;
+
+/* ========================================================================== */
+/* LÍNEAS DEL PANEL (las usa pantalla.c)             */
+/* ========================================================================== */
+
+/** CS: 1 = seleccionado (línea baja). */
+void lcd_host_select(uint8_t active);
+/** DC: 0 = comando, 1 = datos. */
+void lcd_host_dc(uint8_t level);
+/** RST: 1 = en reset (línea baja). Al soltarlo el panel vuelve al estado inicial. */
+void lcd_host_reset(uint8_t active);
+
+/* ========================================================================== */
+/* INSPECCIÓN                                        */
+/* ========================================================================== */
+
+/** @return Framebuffer del panel, SCREEN_WIDTH x SCREEN_HEIGHT por filas. */
+const uint16_t* lcd_host_framebuffer(void);
+
+/** @return Píxel (x, y) del panel, o 0 fuera de la pantalla. */
+uint16_t lcd_host_pixel(uint16_t x, uint16_t y);
+
+/** Contadores desde el arranque. */
+void lcd_host_get_stats(lcd_host_stats_t* stats);
+
+/**
+ * Cerrar un cuadro: copia los contadores desde el lcd_host_frame anterior
+ * y empieza a contar el siguiente.
+ * @param frame Destino (puede ser NULL para solo reiniciar).
+ */
+void lcd_host_frame(lcd_host_stats_t* frame);
+
+/**
+ * Guardar el framebuffer como PPM binario (P6, 8 bits por canal).
+ * @return 0 o -1 si no se pudo escribir.
+ */
+int lcd_host_save_ppm(const char* path);
+
+/**
+ * Guardar el framebuffer como PNG RGB de 8 bits (sin comprimir: bloques
+ * deflate almacenados, no hace falta zlib).
+ * @return 0 o -1 si no se pudo escribir.
+ */
+int lcd_host_save_png(const char* path);
+
+#endif /* DAOS_HOST */
+
+#endif /* LCD_HOST_H */
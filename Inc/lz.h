@@ -0,0 +1,57 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Compresor LZ de ventana pequeña
+ * ============================================================================
+ * Códec LZ77 orientado a bytes, pensado para trozos de hasta LZ_WINDOW
+ * bytes que se comprimen y descomprimen de forma independiente. El
+ * descompresor no necesita más memoria que el buffer de salida.
+ *
+ * Formato (secuencia de tokens):
+ *   0x00-0x7F  literal: siguen (c + 1) bytes copiados tal cual
+ *   0x80-0xFF  copia: longitud (c & 0x7F) + LZ_MIN_MATCH, seguida de un
+ *              byte con la distancia - 1 (1..LZ_WINDOW)
+ * ============================================================================
+ */
+
+#ifndef LZ_H // Guarda de inclusión para el códec LZ
+#define LZ_H
+
+#pragma once
+#include <stdint.h>
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Distancia máxima de una copia (y tamaño de trozo recomendado). */
+#define LZ_WINDOW 256
+/** Longitud mínima de una copia. */
+#define LZ_MIN_MATCH 3
+/** Longitud máxima de una copia. */
+#define LZ_MAX_MATCH (0x7F + LZ_MIN_MATCH)
+
+/* ========================================================================== */
+/* API                                               */
+/* ========================================================================== */
+
+/**
+ * Comprimir un buffer.
+ * @param src Datos de entrada.
+ * @param len Longitud de la entrada (máx. 65535).
+ * @param dst Buffer de salida.
+ * @param cap Capacidad del buffer de salida.
+ * @return Bytes escritos, o -1 si la salida no cabe en cap.
+ */
+int lz_compress(const uint8_t* src, uint32_t len, uint8_t* dst, uint32_t cap);
+
+/**
+ * Descomprimir un buffer.
+ * @param src Datos comprimidos.
+ * @param len Longitud de los datos comprimidos.
+ * @param dst Buffer de salida.
+ * @param cap Capacidad del buffer de salida.
+ * @return Bytes producidos, o -1 si los datos están dañados o no caben.
+ */
+int lz_decompress(const uint8_t* src, uint32_t len, uint8_t* dst, uint32_t cap);
+
+#endif /* LZ_H */
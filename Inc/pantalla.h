@@ -8,6 +8,13 @@
 /** Alto de la pantalla en píxeles. */
 #define SCREEN_HEIGHT 240
 
+/**
+ * Pin de GPIOA (5 a 9) cableado a la salida TE del panel. Definido, cada
+ * comienzo de barrido llega por EXTI a vsync_te_edge. El módulo de serie
+ * no la tiene: sin definir, vsync lee la línea del panel.
+ */
+// #define PANTALLA_TE_PIN 8
+
 // Definiciones de colores (formato RGB565)
 /** Color negro (0x0000). */
 #define COLOR_BLACK   0x0000
@@ -56,7 +63,8 @@ void pantalla_draw_pixel(uint16_t x, uint16_t y, uint16_t color);
 void pantalla_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
 
 /**
- * Dibuja el contorno de un círculo.
+ * Dibuja el contorno de un círculo (punto medio); cada tramo del arco con
+ * la misma x lleva una ventana.
  * @param x0 Centro X.
  * @param y0 Centro Y.
  * @param radius Radio.
@@ -65,7 +73,8 @@ void pantalla_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t
 void pantalla_draw_circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t color);
 
 /**
- * Dibuja un círculo relleno.
+ * Dibuja un círculo relleno: una ventana y un relleno por fila (o por
+ * grupo de filas del mismo ancho).
  * @param x0 Centro X.
  * @param y0 Centro Y.
  * @param radius Radio.
@@ -73,6 +82,37 @@ void pantalla_draw_circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t co
  */
 void pantalla_draw_circle_filled(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t color);
 
+/**
+ * Dibuja el contorno de un rectángulo con las esquinas redondeadas.
+ * @param x Coordenada X (puede ser negativa).
+ * @param y Coordenada Y (puede ser negativa).
+ * @param w Ancho.
+ * @param h Alto.
+ * @param r Radio de las esquinas (se reduce si no cabe).
+ * @param color Color.
+ */
+void pantalla_draw_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+
+/** Igual que pantalla_draw_round_rect, pero relleno. */
+void pantalla_fill_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+
+/**
+ * Dibuja una línea (Bresenham) con ambos extremos. Los píxeles seguidos en
+ * la misma fila (o columna, si es más alta que ancha) salen en un tramo.
+ * @param x0 X inicial.
+ * @param y0 Y inicial.
+ * @param x1 X final.
+ * @param y1 Y final.
+ * @param color Color.
+ */
+void pantalla_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+/** Dibuja el contorno de un triángulo (sus tres lados). */
+void pantalla_draw_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+/** Dibuja un triángulo relleno, un tramo por fila. */
+void pantalla_fill_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
 /**
  * Dibuja un carácter.
  * @param x Coordenada X.
@@ -84,7 +124,8 @@ void pantalla_draw_circle_filled(uint16_t x0, uint16_t y0, uint16_t radius, uint
 void pantalla_draw_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg);
 
 /**
- * Dibuja una cadena de texto.
+ * Dibuja una cadena de texto (ASCII 0x20 a 0x7E; el resto deja su hueco),
+ * en una sola transacción.
  * @param x Coordenada X.
  * @param y Coordenada Y.
  * @param str Cadena de texto.
@@ -104,6 +145,86 @@ void pantalla_draw_string(uint16_t x, uint16_t y, const char* str, uint16_t colo
  */
 void pantalla_draw_string_large(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg, uint8_t scale);
 
+/**
+ * Dibuja n caracteres seguidos en celdas de GLYPH_ADVANCE x h píxeles, con
+ * una sola ventana. La columna de separación y las filas bajo el glifo (h
+ * mayor que 8) se pintan con el fondo, así la celda tapa lo que hubiera.
+ * Cada fila de la ventana se compone mientras la anterior sale por DMA.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param str Caracteres (no hace falta el terminador).
+ * @param n Número de caracteres.
+ * @param h Alto de la celda.
+ * @param color Color del texto.
+ * @param bg Color de fondo.
+ */
+void pantalla_draw_text_cells(uint16_t x, uint16_t y, const char* str, uint16_t n, uint16_t h, uint16_t color, uint16_t bg);
+
+/**
+ * Copia un bitmap RGB565 con una sola ventana y una ráfaga por DMA. Lo que
+ * cae fuera de la pantalla se recorta. Retorna cuando el bitmap ya salió
+ * por el bus, así src puede ser un buffer temporal.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param src Píxeles, fila a fila.
+ * @param w Ancho.
+ * @param h Alto.
+ * @param stride Píxeles por fila en src (>= w).
+ */
+void pantalla_draw_bitmap(uint16_t x, uint16_t y, const uint16_t* src, uint16_t w, uint16_t h, uint16_t stride);
+
+/**
+ * Igual que pantalla_draw_bitmap, pero los píxeles iguales a key no se
+ * dibujan: cada fila se parte en tramos opacos.
+ * @param key Color transparente.
+ */
+void pantalla_draw_bitmap_key(uint16_t x, uint16_t y, const uint16_t* src, uint16_t w, uint16_t h, uint16_t stride, uint16_t key);
+
+/**
+ * Dibuja un sprite codificado por corridas (formato de daos_sprite_t, ver
+ * tools/sprites.py). Cada tramo opaco de una fila lleva una ventana; las
+ * corridas de un color salen como relleno por DMA y las literales se
+ * envían directamente desde la flash. Se recorta a la pantalla.
+ * @param x Coordenada X (puede ser negativa).
+ * @param y Coordenada Y (puede ser negativa).
+ * @param data Filas codificadas.
+ * @param h Número de filas.
+ */
+void pantalla_draw_sprite(int16_t x, int16_t y, const uint16_t* data, uint16_t h);
+
+/**
+ * Glifo 5x8 de un carácter: 5 columnas, el bit 0 es la fila de arriba.
+ * @param c Carácter.
+ * @return Las 5 columnas, o NULL si la fuente no tiene el carácter.
+ */
+const uint8_t* pantalla_get_glyph(char c);
+
+/**
+ * Espera a que termine el glifo que se está enviando desde la caché de
+ * glyph.h. Llamar antes de glyph_pixels fuera de pantalla.c: puede
+ * reutilizar el hueco que el DMA todavía está leyendo.
+ */
+void pantalla_glyph_wait(void);
+
+/**
+ * Agrupa las primitivas siguientes en una sola transacción de SPI1: el CS
+ * queda bajo hasta pantalla_batch_end y cada primitiva solo envía su
+ * ventana y sus píxeles. Se puede anidar. Mientras tanto nadie más debe
+ * usar el bus.
+ */
+void pantalla_batch_begin(void);
+
+/** Cierra la transacción abierta por pantalla_batch_begin. */
+void pantalla_batch_end(void);
+
+/**
+ * Lee la línea que está barriendo el panel (Get Scanline, 0x45). Abre su
+ * propia transacción, a menor velocidad: no llamar dentro de una tanda.
+ * @return Línea (0 a 323, 0 al empezar el barrido) o -1 si el panel no
+ *         contesta (sin MISO la lectura da 0xFF).
+ */
+int pantalla_get_scanline(void);
+
 /**
  * Establece una ventana de dibujo (área de interés).
  * @param x0 X inicial.
@@ -17,16 +17,28 @@
 /* CONFIGURACIÓN                                     */
 /* ========================================================================== */
 
-/** Máximo número de archivos. */
-#define RAMFS_MAX_FILES 16
-/** Longitud máxima del nombre de archivo. */
+/** Máximo número de archivos (incluye directorios). */
+#define RAMFS_MAX_FILES 32
+/** Longitud máxima del nombre de archivo (un componente de la ruta). */
 #define RAMFS_MAX_FILENAME 32
+/** Longitud máxima de una ruta completa ("/logs/tron/scores"). */
+#define RAMFS_MAX_PATH 64
+/** Entradas de la caché de componentes de ruta (potencia de 2). */
+#define RAMFS_DCACHE_SIZE 16
 /** Tamaño de cada bloque en bytes. */
 #define RAMFS_BLOCK_SIZE 256
 /** Total de bloques disponibles (capacidad total). */
 #define RAMFS_MAX_BLOCKS 64
 /** Máximo de archivos abiertos simultáneamente. */
 #define RAMFS_MAX_OPEN 8
+/** Tamaño máximo (bytes) de un archivo guardado dentro de su inodo. */
+#define RAMFS_INLINE_MAX 48
+/** Bloques máximos que el compactador mueve por rebanada de tiempo. */
+#define RAMFS_COMPACT_SLICE_BLOCKS 8
+/** Fragmentación (%) a partir de la cual la tarea de compactación trabaja. */
+#define RAMFS_COMPACT_THRESHOLD 25
+/** Periodo de la tarea de compactación en ms. */
+#define RAMFS_COMPACT_PERIOD_MS 100
 
 /* ========================================================================== */
 /* MODOS DE APERTURA                                 */
@@ -45,6 +57,17 @@
 /** Posicionar el puntero al final antes de cada escritura. */
 #define RAMFS_O_APPEND  0x10
 
+/* ========================================================================== */
+/* ATRIBUTOS DE ARCHIVO                              */
+/* ========================================================================== */
+
+/** Guardar el archivo comprimido (LZ por bloques) cuando se cierra. */
+#define RAMFS_ATTR_COMPRESS 0x01
+
+/** Tipos de inodo. */
+#define RAMFS_TYPE_FILE 0
+#define RAMFS_TYPE_DIR  1
+
 /* ========================================================================== */
 /* SEEK WHENCE                                       */
 /* ========================================================================== */
@@ -63,15 +86,31 @@
 /* ========================================================================== */
 
 /**
- * Inodo - Metadatos de un archivo
+ * Inodo - Metadatos de un archivo o directorio
+ * name es solo el último componente; la ruta completa se obtiene siguiendo
+ * parent hasta la raíz (parent == -1). La raíz no ocupa inodo.
+ * Si num_blocks == 0 el contenido (hasta RAMFS_INLINE_MAX bytes) vive en
+ * inline_data y el archivo no consume bloques; al crecer más allá del
+ * umbral se promueve a bloques de forma transparente.
+ *
+ * Si packed == 1 el extent guarda el archivo comprimido por trozos de
+ * RAMFS_BLOCK_SIZE bytes, cada uno precedido por una cabecera de 2 bytes
+ * (bit 15 = trozo sin comprimir, bits 0-14 = longitud). size sigue siendo
+ * el tamaño lógico y stored_size los bytes ocupados en el extent.
  */
 typedef struct {
-    char name[RAMFS_MAX_FILENAME];  /** Nombre del archivo. */
+    char name[RAMFS_MAX_FILENAME];  /** Nombre del archivo dentro de su directorio. */
+    uint8_t type;                    /** RAMFS_TYPE_FILE o RAMFS_TYPE_DIR. */
+    int8_t parent;                   /** Inodo del directorio padre (-1 = raíz). */
     uint32_t size;                   /** Tamaño actual del archivo en bytes. */
     uint32_t capacity;               /** Capacidad asignada en bytes (bloques*RAMFS_BLOCK_SIZE). */
     uint16_t start_block;            /** Índice del primer bloque de datos. */
-    uint16_t num_blocks;             /** Número total de bloques asignados. */
+    uint16_t num_blocks;             /** Número total de bloques asignados (0 = inline). */
     uint8_t in_use;                  /** Bandera: 1 si el inodo está en uso. */
+    uint8_t attr;                    /** Atributos persistentes (RAMFS_ATTR_*). */
+    uint8_t packed;                  /** Bandera: 1 si el extent está comprimido. */
+    uint32_t stored_size;            /** Bytes comprimidos en el extent (si packed). */
+    uint8_t inline_data[RAMFS_INLINE_MAX]; /** Contenido de archivos pequeños. */
 } ramfs_inode_t;
 
 /**
@@ -82,8 +121,18 @@ typedef struct {
     uint32_t position;               /** Posición actual de lectura/escritura (offset). */
     uint8_t mode;                    /** Modo de apertura (RAMFS_O_*). */
     uint8_t is_open;                 /** Bandera: 1 si está abierto. */
+    uint8_t dirty;                   /** Bandera: 1 si se escribió desde la apertura. */
 } ramfs_fd_t;
 
+/**
+ * Entrada de directorio devuelta por ramfs_readdir
+ */
+typedef struct {
+    char name[RAMFS_MAX_FILENAME];  /** Nombre de la entrada. */
+    uint8_t type;                    /** RAMFS_TYPE_FILE o RAMFS_TYPE_DIR. */
+    uint32_t size;                   /** Tamaño en bytes (0 para directorios). */
+} ramfs_dirent_t;
+
 /* ========================================================================== */
 /* API PÚBLICA (POSIX-LIKE)                          */
 /* ========================================================================== */
@@ -165,7 +214,8 @@ int ramfs_exists(const char* name);
 int ramfs_get_size(const char* name);
 
 /**
- * Listar archivos a un buffer de salida.
+ * Listar las entradas del directorio raíz a un buffer de salida.
+ * Los directorios se marcan con '/' al final.
  * @param out Buffer de salida.
  * @param max Tamaño máximo del buffer.
  * @return Bytes escritos en el buffer.
@@ -185,6 +235,38 @@ void ramfs_listdir_uart(void);
  */
 void ramfs_stats(int* total_files, int* used_blocks, int* free_blocks);
 
+/**
+ * Contar archivos cuyo contenido está guardado dentro del inodo.
+ * @return Número de archivos inline (no vacíos).
+ */
+int ramfs_inline_count(void);
+
+/**
+ * Activar o desactivar la compresión de un archivo.
+ * Al activarla el archivo se comprime de inmediato (si ahorra al menos un
+ * bloque) y se vuelve a comprimir cada vez que se cierra tras escribirlo.
+ * Las lecturas descomprimen un trozo a la vez; una escritura expande el
+ * archivo de forma transparente.
+ * @param name Nombre del archivo.
+ * @param enable 1 para comprimir, 0 para guardarlo sin comprimir.
+ * @return 0 si OK, -1 si no existe o no hay bloques para expandirlo.
+ */
+int ramfs_set_compress(const char* name, int enable);
+
+/**
+ * Obtener los atributos de un archivo.
+ * @return Máscara RAMFS_ATTR_*, o -1 si no existe.
+ */
+int ramfs_get_attr(const char* name);
+
+/**
+ * Estadísticas de compresión.
+ * @param files Archivos actualmente comprimidos.
+ * @param raw_bytes Tamaño lógico total de esos archivos.
+ * @param stored_bytes Bytes que ocupan comprimidos.
+ */
+void ramfs_compression_stats(int* files, uint32_t* raw_bytes, uint32_t* stored_bytes);
+
 /**
  * Truncar archivo a tamaño especificado (cambiar tamaño).
  * @param name Nombre del archivo.
@@ -207,4 +289,122 @@ int ramfs_rename(const char* old_name, const char* new_name);
  */
 int ramfs_append(const char* name, const void* data, uint32_t size);
 
+/**
+ * Leer desde un archivo por nombre sin ocupar un file descriptor.
+ * @param name Nombre del archivo.
+ * @param offset Posición inicial.
+ * @param buf Buffer de destino.
+ * @param count Bytes a leer.
+ * @return Bytes leídos o -1 si no existe.
+ */
+int ramfs_pread(const char* name, uint32_t offset, void* buf, uint32_t count);
+
+/**
+ * Obtener la ruta completa de la entrada en una ranura de la tabla de inodos.
+ * Permite recorrer todo el árbol con 0 <= idx < RAMFS_MAX_FILES.
+ * @param idx Ranura.
+ * @param path Buffer de salida (RAMFS_MAX_PATH bytes).
+ * @return RAMFS_TYPE_FILE / RAMFS_TYPE_DIR, o -1 si la ranura está libre.
+ */
+int ramfs_path_at(int idx, char* path);
+
+/* ========================================================================== */
+/* DIRECTORIOS                                       */
+/* ========================================================================== */
+
+/**
+ * Crear un directorio. El padre debe existir.
+ * @return 0 si OK, -1 si ya existe, falta el padre o no hay inodos.
+ */
+int ramfs_mkdir(const char* path);
+
+/**
+ * Eliminar un directorio vacío.
+ * @return 0 si OK, -1 si no existe o no está vacío.
+ */
+int ramfs_rmdir(const char* path);
+
+/**
+ * Abrir un directorio para recorrerlo ("/" es la raíz).
+ * @return Descriptor (se cierra con ramfs_close), o -1 si error.
+ */
+int ramfs_opendir(const char* path);
+
+/**
+ * Leer la siguiente entrada de un directorio abierto.
+ * @param fd Descriptor de ramfs_opendir.
+ * @param ent Entrada de salida.
+ * @return 1 si hay entrada, 0 al final, -1 si error.
+ */
+int ramfs_readdir(int fd, ramfs_dirent_t* ent);
+
+/**
+ * Verificar si una ruta es un directorio.
+ * @return 1 si es directorio (o la raíz), 0 si no.
+ */
+int ramfs_is_dir(const char* path);
+
+/**
+ * Estadísticas de la caché de componentes de ruta.
+ * @param hits Búsquedas resueltas por la caché.
+ * @param misses Búsquedas que recorrieron la tabla de inodos.
+ */
+void ramfs_dcache_stats(uint32_t* hits, uint32_t* misses);
+
+/* ========================================================================== */
+/* JOURNAL (PERSISTENCIA)                            */
+/* ========================================================================== */
+
+/**
+ * Callbacks invocados después de cada modificación exitosa del contenido.
+ * Un backend persistente (ver ramfs_log.h) los usa para registrar los
+ * cambios; cualquier callback puede ser NULL.
+ */
+typedef struct {
+    void (*on_write)(const char* name, uint32_t offset, const void* data, uint32_t len);
+    void (*on_truncate)(const char* name, uint32_t new_size);
+    void (*on_delete)(const char* name);
+    void (*on_rename)(const char* old_name, const char* new_name);
+    void (*on_attr)(const char* name, uint8_t attr);
+    void (*on_mkdir)(const char* path);
+} ramfs_journal_t;
+
+/**
+ * Registrar (o quitar con NULL) el journal activo.
+ */
+void ramfs_set_journal(const ramfs_journal_t* journal);
+
+/* ========================================================================== */
+/* COMPACTACIÓN                                      */
+/* ========================================================================== */
+
+/**
+ * Obtener la fragmentación del espacio libre.
+ * Es 0 cuando todos los bloques libres forman un solo hueco contiguo y se
+ * acerca a 100 cuando el espacio libre está repartido en huecos pequeños.
+ * @return Porcentaje 0-100 (1 - hueco_mayor / bloques_libres).
+ */
+int ramfs_fragmentation(void);
+
+/**
+ * Ejecutar una rebanada de compactación.
+ * Desplaza extents completos hacia el inicio de data_blocks hasta agotar
+ * el presupuesto; siempre mueve al menos un extent si hay huecos.
+ * @param max_blocks Presupuesto de bloques a mover en esta llamada.
+ * @return Bloques movidos (0 si el espacio ya está compactado).
+ */
+int ramfs_compact_step(int max_blocks);
+
+/**
+ * Compactar por completo (todas las rebanadas seguidas).
+ * @return Bloques movidos en total.
+ */
+int ramfs_compact(void);
+
+/**
+ * Tarea de baja prioridad que compacta en rebanadas acotadas.
+ * Crear con daos_task_create(..., DAOS_PRIO_LOW).
+ */
+void ramfs_compact_task(void);
+
 #endif /* RAMFS_H */
@@ -0,0 +1,95 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Persistencia de RAMFS en log estructurado
+ * ============================================================================
+ * Cada modificación de RAMFS se agrega como un registro al final de un log
+ * sobre un dispositivo de bloques (flash interna en el target, archivo en
+ * el host). El log usa dos bloques: uno activo y otro de reserva donde el
+ * compactador escribe una instantánea (checkpoint) completa.
+ *
+ * Formato de un bloque:
+ *   [cabecera de región: magic, generación, crc]
+ *   [MKDIR ...] [FILE ...] [CKPT] [registros de operaciones ...] [0xFF ...]
+ *
+ * Un registro se confirma programando su palabra "commit" al final; un
+ * reinicio a mitad de escritura deja el registro sin confirmar y se ignora
+ * al montar. Una región solo es válida si su CKPT está confirmado, así que
+ * un corte durante la compactación conserva la región anterior.
+ * ============================================================================
+ */
+
+#ifndef RAMFS_LOG_H // Guarda de inclusión para el log de RAMFS
+#define RAMFS_LOG_H
+
+#pragma once
+#include <stdint.h>
+#include "blockdev.h"
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Bytes de operaciones tras el checkpoint que piden una compactación. */
+#define RAMFS_LOG_MAX_TAIL (32 * 1024)
+
+/** Estadísticas del log. */
+typedef struct {
+    uint32_t generation;       /** Generación de la región activa. */
+    uint32_t active_block;     /** Bloque activo del dispositivo. */
+    uint32_t used_bytes;       /** Bytes ocupados en la región activa. */
+    uint32_t snapshot_bytes;   /** Bytes ocupados por el último checkpoint. */
+    uint32_t records_replayed; /** Registros aplicados en el último montaje. */
+    uint32_t records_skipped;  /** Registros sin confirmar ignorados al montar. */
+    uint32_t mount_us;         /** Duración del último montaje en µs. */
+    uint32_t compactions;      /** Compactaciones realizadas desde el montaje. */
+    uint32_t errors;           /** Errores de escritura en el medio. */
+} ramfs_log_stats_t;
+
+/* ========================================================================== */
+/* API                                               */
+/* ========================================================================== */
+
+/**
+ * Montar RAMFS sobre un log persistente.
+ * Si el medio contiene una región válida, RAMFS se reinicia y se reconstruye
+ * reproduciendo el log; si no, se formatea con el contenido actual de RAMFS.
+ * Después del montaje, cada cambio en RAMFS se registra automáticamente.
+ * @param bd Dispositivo con al menos 2 bloques.
+ * @return 0 si OK, -1 si error.
+ */
+int ramfs_log_mount(const blockdev_t* bd);
+
+/**
+ * Desmontar: deja de registrar cambios y sincroniza el dispositivo.
+ */
+void ramfs_log_unmount(void);
+
+/**
+ * Escribir un checkpoint en el bloque de reserva y pasar a usarlo.
+ * @return 0 si OK, -1 si error.
+ */
+int ramfs_log_compact(void);
+
+/**
+ * Escribir el checkpoint pendiente, si lo hay. Los registros no compactan
+ * al pasar de RAMFS_LOG_MAX_TAIL (el borrado de un bloque de flash bloquea
+ * la CPU): solo lo piden, y esta función se llama desde una tarea de baja
+ * prioridad (daos_fs_compact_task). Con el bloque lleno se compacta al
+ * momento.
+ * @return 1 si compactó, 0 si no había nada pendiente, -1 si error.
+ */
+int ramfs_log_maintain(void);
+
+/**
+ * Verificar si hay un log montado.
+ * @return 1 si está montado, 0 si no.
+ */
+int ramfs_log_is_mounted(void);
+
+/**
+ * Obtener estadísticas del log.
+ * @param stats Estructura de salida.
+ */
+void ramfs_log_get_stats(ramfs_log_stats_t* stats);
+
+#endif /* RAMFS_LOG_H */
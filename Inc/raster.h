@@ -0,0 +1,45 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Rasterizado por tramos
+ * ============================================================================
+ * Las figuras (círculos, rectángulos redondeados, líneas y triángulos) se
+ * descomponen en rectángulos: una fila de un disco, un tramo horizontal o
+ * vertical de una línea, un trozo de arco con la misma x. Quien dibuja
+ * recibe cada rectángulo ya recortado a la pantalla y lo pinta de una vez:
+ * pantalla.c con una ventana y un relleno por DMA, el compositor con un
+ * tramo en su franja.
+ *
+ * Las coordenadas llevan signo: lo que cae fuera de la pantalla se recorta.
+ * Un mismo píxel puede llegar en dos rectángulos (siempre del mismo color).
+ * ============================================================================
+ */
+
+#ifndef RASTER_H // Guarda de inclusión para el rasterizado
+#define RASTER_H
+
+#pragma once
+#include <stdint.h>
+#include "pantalla.h"
+
+/** Recibe un rectángulo dentro de la pantalla (w y h mayores que 0). */
+typedef void (*raster_fn)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+/**
+ * Círculo de punto medio (el de siempre de pantalla_draw_circle) o disco
+ * con los puntos dx*dx + dy*dy <= r*r.
+ */
+void raster_circle(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint8_t filled, raster_fn fn);
+
+/**
+ * Rectángulo de w x h con las esquinas en cuartos de círculo de radio r
+ * (se reduce si no cabe). Con r = 0 es un rectángulo normal.
+ */
+void raster_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color, uint8_t filled, raster_fn fn);
+
+/** Línea de Bresenham entre dos puntos (ambos incluidos). */
+void raster_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, raster_fn fn);
+
+/** Triángulo: contorno (tres líneas) o relleno por filas. */
+void raster_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color, uint8_t filled, raster_fn fn);
+
+#endif /* RASTER_H */
@@ -0,0 +1,127 @@
+// sd.h - Driver SPI de la tarjeta SD
+#ifndef SD_H // Guarda de inclusión para el driver SD
+#define SD_H
+
+#include <stdint.h> // Incluye tipos de enteros fijos
+
+// Configuración de pines (ajustar según tu conexión)
+/** Puerto para el pin Chip Select (CS) del SD. */
+#define SD_CS_PORT      GPIOA
+/** Pin específico para Chip Select (CS) del SD (ej: PA10 = D2). */
+#define SD_CS_PIN       10
+
+/** Tamaño de un bloque de la tarjeta en bytes. */
+#define SD_BLOCK_SIZE   512
+
+/**
+ * Consumidor de bloques para sd_read_blocks.
+ * @param index Índice del bloque dentro de la transferencia (0 = primero).
+ * @param data Contenido del bloque (SD_BLOCK_SIZE bytes, válido solo durante la llamada).
+ * @param ctx Contexto del llamador.
+ * @return 0 para seguir, distinto de 0 para detener la lectura.
+ */
+typedef int (*sd_block_cb_t)(uint32_t index, const uint8_t *data, void *ctx);
+
+/**
+ * Contadores del enlace con la tarjeta. Cada bloque lleva CRC16: un bloque
+ * leído con CRC incorrecto, o rechazado por la tarjeta al escribirlo, se
+ * repite hasta 3 veces seguidas antes de dar error.
+ */
+typedef struct {
+    uint8_t crc_enabled;    /** 1 si la tarjeta comprueba el CRC (CMD59). */
+    uint32_t crc_errors;    /** Bloques con CRC incorrecto (leídos o rechazados). */
+    uint32_t retries;       /** Transferencias repetidas por CRC. */
+    uint32_t failures;      /** Transferencias abandonadas tras agotar los reintentos. */
+} sd_stats_t;
+
+/** Resultado de un paso de inicialización. */
+typedef enum {
+    SD_INIT_BUSY = 0,   /** Faltan pasos: volver a llamar. */
+    SD_INIT_OK,         /** Tarjeta lista. */
+    SD_INIT_FAILED      /** No hay tarjeta o no respondió a tiempo. */
+} sd_init_status_t;
+
+/**
+ * Avanza la inicialización un comando (CMD0, CMD8, ACMD41, CMD58, CMD16).
+ * No bloquea: pensada para llamarse desde una tarea en cada turno. El tipo
+ * de tarjeta (SDHC o SDSC) sale del OCR, y los plazos de millis() (el
+ * planificador debe estar en marcha).
+ * La primera llamada arranca la secuencia; tras OK o FAILED, la siguiente
+ * vuelve a empezar (salvo que la tarjeta ya esté lista).
+ * @return SD_INIT_BUSY mientras quedan pasos.
+ */
+sd_init_status_t sd_init_step(void);
+
+/**
+ * Inicializa el bus SPI y la tarjeta SD de una vez (o termina una
+ * inicialización ya empezada con sd_init_step). Espera activamente.
+ * @return 1 en éxito, 0 si la tarjeta no respondió.
+ */
+uint8_t sd_init(void);
+
+/**
+ * Lee un bloque de la tarjeta.
+ * @param sector Número de bloque (LBA).
+ * @param buffer Buffer de destino (SD_BLOCK_SIZE bytes).
+ * @return 1 en éxito, 0 si error.
+ */
+uint8_t sd_read_block(uint32_t sector, uint8_t *buffer);
+
+/**
+ * Escribe un bloque de la tarjeta.
+ * @param sector Número de bloque (LBA).
+ * @param buffer Buffer de origen (SD_BLOCK_SIZE bytes).
+ * @return 1 en éxito, 0 si error.
+ */
+uint8_t sd_write_block(uint32_t sector, const uint8_t *buffer);
+
+/**
+ * Lee bloques consecutivos con una sola orden (CMD18). La tarjeta los
+ * envía uno tras otro sin repetir comando ni esperas entre bloques.
+ * @param sector Primer bloque (LBA).
+ * @param count Número de bloques.
+ * @param buffer Destino (count * SD_BLOCK_SIZE bytes).
+ * @return 1 en éxito, 0 si error.
+ */
+uint8_t sd_read_multi(uint32_t sector, uint32_t count, uint8_t *buffer);
+
+/**
+ * Lectura en flujo: como sd_read_multi, pero cada bloque se entrega al
+ * callback en cuanto llega, usando un único buffer de un bloque.
+ * @param sector Primer bloque (LBA).
+ * @param count Número de bloques.
+ * @param cb Consumidor; si retorna distinto de 0 la lectura se detiene.
+ * @param ctx Contexto para el callback.
+ * @return 1 en éxito (también si el callback detuvo la lectura), 0 si error.
+ */
+uint8_t sd_read_blocks(uint32_t sector, uint32_t count, sd_block_cb_t cb, void *ctx);
+
+/**
+ * Escribe bloques consecutivos con una sola orden (CMD25). Antes avisa
+ * el número de bloques (ACMD23) para que la tarjeta pueda pre-borrarlos.
+ * @param sector Primer bloque (LBA).
+ * @param count Número de bloques.
+ * @param buffer Origen (count * SD_BLOCK_SIZE bytes).
+ * @return 1 en éxito, 0 si error.
+ */
+uint8_t sd_write_multi(uint32_t sector, uint32_t count, const uint8_t *buffer);
+
+/**
+ * Obtiene los contadores de CRC y reintentos.
+ * @param stats Estructura de salida.
+ */
+void sd_get_stats(sd_stats_t *stats);
+
+/**
+ * Verifica si la tarjeta está inicializada.
+ * @return 1 si está lista, 0 si no.
+ */
+uint8_t sd_is_ready(void);
+
+/**
+ * Olvida la tarjeta (al desmontar, porque se puede cambiar por otra): la
+ * próxima sd_init o sd_init_step repite CMD0, ACMD41 y CMD58.
+ */
+void sd_reset(void);
+
+#endif // SD_H
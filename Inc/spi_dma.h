@@ -0,0 +1,224 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Motor de transferencias SPI1 por DMA
+ * ============================================================================
+ * SPI1 lo comparten la pantalla y la tarjeta SD. En vez de empujar byte a
+ * byte esperando dos banderas de estado por byte, los drivers describen la
+ * transferencia y el DMA2 la mueve mientras la CPU ejecuta otras tareas:
+ *
+ *   TX: DMA2 Stream3, canal 3 (memoria -> SPI1_DR)
+ *   RX: DMA2 Stream0, canal 3 (SPI1_DR -> memoria); su fin de transferencia
+ *       marca el final (la última trama ya salió por el bus)
+ *
+ * Cada dispositivo del bus (pantalla, SD) se registra con su prescaler,
+ * su modo y su función de CS. Una transacción empieza con spi_bus_begin:
+ * si el bus venía de otro dispositivo se reprograma SPI1_CR1 (el coste se
+ * mide con el contador de ciclos); si es el mismo, no se toca nada.
+ *
+ * Las transferencias se encolan en orden de llegada. Cada una puede tener
+ * un callback de inicio (bajar CS, fijar D/C) y uno de fin (subir CS), que
+ * se ejecuta desde la interrupción, y un semáforo que se libera al acabar.
+ * Las muy cortas se hacen por sondeo: preparar el DMA cuesta más.
+ *
+ * En el host (DAOS_HOST) el hardware lo sustituye un mock: el arranque de
+ * cada tramo se avisa a spi_dma_host_start(), las esperas activas llaman a
+ * spi_dma_host_idle() en cada vuelta (ahí el mock hace salir el tramo), los
+ * bytes por sondeo pasan por spi_dma_host_exchange() y la interrupción se
+ * simula con spi_dma_host_irq(). lcd_host.c implementa el mock con un
+ * panel emulado.
+ * ============================================================================
+ */
+
+#ifndef SPI_DMA_H // Guarda de inclusión para el motor SPI/DMA
+#define SPI_DMA_H
+
+#pragma once
+#include <stdint.h>
+#include "sync.h"
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Tramas máximas por tramo de DMA (NDTR es de 16 bits). */
+#define SPI_DMA_MAX_CHUNK  65535
+/** Transferencias más cortas que esto se hacen por sondeo. */
+#define SPI_DMA_MIN_FRAMES 8
+/** Dispositivos que pueden registrarse en el bus. */
+#define SPI_BUS_MAX_DEVICES 4
+
+/* ========================================================================== */
+/* OPCIONES                                          */
+/* ========================================================================== */
+
+/** Tramas de 16 bits (píxeles RGB565, se envía primero el byte alto). */
+#define SPI_DMA_16BIT   0x01
+/** Enviar count veces el primer elemento de tx (rellenos de color). */
+#define SPI_DMA_REPEAT  0x02
+
+/** Estado de una transferencia. */
+typedef enum {
+    SPI_DMA_IDLE = 0,   /** Nunca enviada o ya recogida. */
+    SPI_DMA_QUEUED,     /** En la cola, esperando el bus. */
+    SPI_DMA_ACTIVE,     /** Transfiriendo. */
+    SPI_DMA_DONE,       /** Terminada. */
+    SPI_DMA_ERROR       /** El DMA reportó un error. */
+} spi_dma_state_t;
+
+/**
+ * Descripción de una transferencia. La memoria es del llamador y debe
+ * seguir viva (igual que tx y rx) hasta que el estado sea DONE o ERROR.
+ */
+typedef struct spi_dma_xfer {
+    const void* tx;           /** Datos a enviar (NULL = enviar 0xFF). */
+    void* rx;                 /** Destino de lo recibido (NULL = descartar). */
+    uint32_t count;           /** Número de tramas (bytes o palabras de 16 bits). */
+    uint8_t flags;            /** SPI_DMA_16BIT | SPI_DMA_REPEAT. */
+    void (*begin)(struct spi_dma_xfer* x);  /** Antes de empezar (puede ser NULL). */
+    void (*done)(struct spi_dma_xfer* x);   /** Al terminar, desde la IRQ (puede ser NULL). */
+    void* ctx;                /** Contexto libre para los callbacks. */
+    sem_t* sem;               /** Semáforo a liberar al terminar (puede ser NULL). */
+    volatile uint8_t state;   /** spi_dma_state_t. */
+
+    /* Privado */
+    uint32_t offset;          /** Tramas ya transferidas. */
+    struct spi_dma_xfer* next;
+} spi_dma_xfer_t;
+
+/** Modos SPI (bits CPOL/CPHA de SPI1_CR1). */
+#define SPI_MODE0  0x00   /** CPOL=0, CPHA=0 (pantalla y SD). */
+#define SPI_MODE1  0x01
+#define SPI_MODE2  0x02
+#define SPI_MODE3  0x03
+
+/** Configuración de un dispositivo del bus. */
+typedef struct {
+    const char* name;         /** Nombre (diagnóstico). */
+    uint8_t prescaler;        /** Campo BR de SPI1_CR1: SCK = PCLK2 / 2^(BR+1). */
+    uint8_t mode;             /** SPI_MODE0..3. */
+    void (*select)(uint8_t active);  /** CS: 1 = seleccionado. Puede llamarse desde la IRQ. */
+} spi_bus_device_t;
+
+/** Contadores del motor. */
+typedef struct {
+    uint32_t submitted;       /** Transferencias encoladas. */
+    uint32_t polled;          /** Transferencias cortas hechas por sondeo. */
+    uint32_t chunks;          /** Tramos de DMA lanzados. */
+    uint32_t frames;          /** Tramas movidas por DMA. */
+    uint32_t errors;          /** Errores de DMA. */
+    uint32_t transactions;    /** Llamadas a spi_bus_begin. */
+    uint32_t switches;        /** Cambios de dispositivo (reprogramar SPI1). */
+    uint32_t switch_cycles;   /** Ciclos de CPU gastados en los cambios. */
+} spi_dma_stats_t;
+
+/* ========================================================================== */
+/* API                                               */
+/* ========================================================================== */
+
+/**
+ * Habilitar SPI1, DMA2 y su interrupción. Los pines los configura cada
+ * driver; velocidad y modo salen del dispositivo activo del bus.
+ */
+void spi_dma_init(void);
+
+/**
+ * Encolar una transferencia. Retorna enseguida: el estado pasa a DONE
+ * (o ERROR) cuando termina. Las transferencias cortas con la cola vacía
+ * se completan antes de retornar.
+ * @return 0 si OK, -1 si el descriptor ya está en la cola o count es 0.
+ */
+int spi_dma_submit(spi_dma_xfer_t* x);
+
+/** @return 1 si la transferencia terminó (DONE o ERROR). */
+uint8_t spi_dma_is_done(const spi_dma_xfer_t* x);
+
+/** @return 1 si hay transferencias en curso o en cola. */
+uint8_t spi_dma_busy(void);
+
+/**
+ * Esperar (activamente) a que una transferencia termine.
+ * @return 0 si DONE, -1 si ERROR.
+ */
+int spi_dma_wait(spi_dma_xfer_t* x);
+
+/** Esperar a que la cola quede vacía (antes de usar el bus a mano). */
+void spi_dma_flush(void);
+
+/**
+ * Transferencia síncrona: encolar y esperar.
+ * @return 0 si OK, -1 si error.
+ */
+int spi_dma_transfer(const void* tx, void* rx, uint32_t count, uint8_t flags);
+
+/**
+ * Intercambiar un byte por sondeo (comandos, respuestas). Vacía antes la
+ * cola para no mezclarse con una transferencia en curso.
+ * @return Byte recibido.
+ */
+uint8_t spi_dma_exchange(uint8_t data);
+
+void spi_dma_get_stats(spi_dma_stats_t* stats);
+
+/* ========================================================================== */
+/* BUS COMPARTIDO                                    */
+/* ========================================================================== */
+
+/**
+ * Registrar un dispositivo (o actualizar uno ya registrado con la misma
+ * función de CS). Se copia la configuración.
+ * @return Identificador (>= 0) o -1 si la tabla está llena.
+ */
+int spi_bus_add(const spi_bus_device_t* dev);
+
+/**
+ * Dejar SPI1 configurado para un dispositivo sin seleccionarlo (ciclos de
+ * reloj con CS alto, como los de arranque de la SD).
+ */
+void spi_bus_use(int dev);
+
+/**
+ * Empezar una transacción: vaciar la cola, reprogramar SPI1 si el bus
+ * venía de otro dispositivo y seleccionar este.
+ */
+void spi_bus_begin(int dev);
+
+/**
+ * Terminar una transacción. Si quedan transferencias del dispositivo en
+ * la cola, el CS se suelta desde la interrupción cuando terminen.
+ */
+void spi_bus_end(int dev);
+
+/**
+ * Cambiar el prescaler de un dispositivo (p. ej. la SD tras inicializarse).
+ * Se aplica ya si el bus está configurado para él.
+ */
+void spi_bus_set_prescaler(int dev, uint8_t prescaler);
+
+#ifdef DAOS_HOST
+/**
+ * Mock del hardware (solo DAOS_HOST): lo implementa la prueba. Se llama
+ * al lanzar cada tramo de DMA.
+ * @param x Transferencia en curso.
+ * @param first Primera trama del tramo.
+ * @param frames Tramas del tramo.
+ */
+void spi_dma_host_start(const spi_dma_xfer_t* x, uint32_t first, uint32_t frames);
+
+/** Simular la interrupción de fin del tramo en curso (solo DAOS_HOST). */
+void spi_dma_host_irq(void);
+
+/**
+ * Mock del hardware (solo DAOS_HOST): la CPU espera al bus (spi_dma_wait,
+ * spi_dma_flush). El mock puede enviar aquí el tramo lanzado y llamar a
+ * spi_dma_host_irq.
+ */
+void spi_dma_host_idle(void);
+
+/**
+ * Mock del hardware (solo DAOS_HOST): un byte por sondeo.
+ * @return Byte recibido.
+ */
+uint8_t spi_dma_host_exchange(uint8_t data);
+#endif
+
+#endif /* SPI_DMA_H */
@@ -0,0 +1,286 @@
+/**
+ * Generado por tools/sprites.py desde assets/banners.sprites: no editar a mano.
+ * Formato de los datos: ver daos_sprite_t en api.h.
+ */
+
+#ifndef SPRITES_BANNERS_H
+#define SPRITES_BANNERS_H
+
+#include "api.h"
+
+static const uint16_t banner_tron4p_data[546] = {
+    0x0004, 0x0000, 0x000C, 0x7DDD, 0x0000, 0x0006, 0x24FE, 0x003C, 0x0006, 0xC162, 0x0000, 0x000C,
+    0xFB49, 0x8000, 0x8000, 0x000A, 0x0000, 0x0009, 0x7DDD, 0x0000, 0x0003, 0x24FE, 0x0000, 0x0003,
+    0x10A2, 0x0000, 0x0003, 0x7DDD, 0x0000, 0x0003, 0x24FE, 0x0036, 0x0003, 0xC162, 0x0000, 0x0003,
+    0xFB49, 0x0000, 0x0003, 0x10A2, 0x0000, 0x0003, 0xC162, 0x0000, 0x0009, 0xFB49, 0x8000, 0x8000,
+    0x000D, 0x0000, 0x0006, 0x7DDD, 0x0000, 0x0003, 0x10A2, 0x0000, 0x0003, 0x2966, 0x0000, 0x0006,
+    0x10A2, 0x0000, 0x0003, 0x2966, 0x0000, 0x0003, 0x24FE, 0x001B, 0x0006, 0xD71D, 0x000F, 0x0003,
+    0xC162, 0x0000, 0x0003, 0x2966, 0x0000, 0x0006, 0x10A2, 0x0000, 0x0003, 0x2966, 0x0000, 0x0003,
+    0x10A2, 0x0000, 0x0006, 0xFB49, 0x8000, 0x8000, 0x0010, 0x0000, 0x0006, 0x7DDD, 0x0000, 0x0003,
+    0x2966, 0x0000, 0x0003, 0x5B0C, 0x0000, 0x0006, 0x2966, 0x0000, 0x0003, 0x5B0C, 0x0000, 0x0003,
+    0x2966, 0x0018, 0x0003, 0xD71D, 0x0000, 0x0003, 0x0022, 0x0000, 0x0003, 0x2946, 0x0000, 0x0003,
+    0xD71D, 0x000C, 0x0003, 0x2966, 0x0000, 0x0003, 0x5B0C, 0x0000, 0x0006, 0x2966, 0x0000, 0x0003,
+    0x5B0C, 0x0000, 0x0003, 0x2966, 0x0000, 0x0006, 0xFB49, 0x8000, 0x8000, 0x000A, 0x0000, 0x0009,
+    0x7DDD, 0x0000, 0x0003, 0x2966, 0x0006, 0x0003, 0x2966, 0x0015, 0x0003, 0xD71D, 0x0000, 0x0003,
+    0xC6FD, 0x0000, 0x0009, 0x0022, 0x0000, 0x0003, 0xD71D, 0x000F, 0x0003, 0x2966, 0x0006, 0x0003,
+    0x2966, 0x0000, 0x0009, 0xFB49, 0x8000, 0x8000, 0x0006, 0x0027, 0x0003, 0xC6FD, 0x0000, 0x0006,
+    0x0022, 0x0000, 0x0003, 0x2946, 0x0000, 0x0003, 0x0022, 0x0000, 0x0003, 0x2946, 0x0000, 0x0003,
+    0xC6FD, 0x8000, 0x8000, 0x0006, 0x0015, 0x000C, 0x24FE, 0x0003, 0x0009, 0x24FE, 0x0000, 0x0006,
+    0xD71D, 0x0000, 0x0009, 0x24FE, 0x0003, 0x0003, 0x24FE, 0x0006, 0x0003, 0x24FE, 0x8000, 0x8000,
+    0x000A, 0x0015, 0x000C, 0x24FE, 0x0000, 0x0003, 0xC6FD, 0x0000, 0x0003, 0x24FE, 0x0000, 0x0003,
+    0xD71D, 0x0000, 0x0003, 0x24FE, 0x0006, 0x0003, 0x24FE, 0x0000, 0x0003, 0x2946, 0x0000, 0x0003,
+    0x24FE, 0x0003, 0x0006, 0x24FE, 0x0003, 0x0003, 0x24FE, 0x8000, 0x8000, 0x0009, 0x0018, 0x0006,
+    0x55BF, 0x0000, 0x0003, 0xC6FD, 0x0000, 0x0003, 0x2946, 0x0000, 0x0009, 0x55BF, 0x0000, 0x0006,
+    0xD71D, 0x0000, 0x0003, 0x55BF, 0x0000, 0x0003, 0x2946, 0x0000, 0x0003, 0x55BF, 0x0003, 0x000C,
+    0x55BF, 0x8000, 0x8000, 0x000B, 0x0018, 0x0006, 0x55BF, 0x0003, 0x0003, 0xC6FD, 0x0000, 0x0003,
+    0x55BF, 0x0000, 0x0003, 0x2946, 0x0000, 0x0006, 0x55BF, 0x0000, 0x0003, 0x2946, 0x0000, 0x0003,
+    0x55BF, 0x0000, 0x0003, 0x2946, 0x0000, 0x0003, 0x55BF, 0x0003, 0x0003, 0x55BF, 0x0003, 0x0006,
+    0x55BF, 0x8000, 0x8000, 0x0009, 0x0018, 0x0006, 0xA6BE, 0x0006, 0x0003, 0xA6BE, 0x0000, 0x0003,
+    0xC6FD, 0x0000, 0x0006, 0xA6BE, 0x0000, 0x0003, 0xD71D, 0x0000, 0x0006, 0xA6BE, 0x0000, 0x0003,
+    0x24FE, 0x0003, 0x0003, 0xA6BE, 0x0003, 0x0003, 0xA6BE, 0x8000, 0x8000, 0x0004, 0x0030, 0x0003,
+    0xC6FD, 0x0000, 0x0003, 0x2946, 0x0000, 0x0003, 0x0022, 0x0000, 0x0003, 0xC6FD, 0x8000, 0x8000,
+    0x0004, 0x0030, 0x0003, 0xD71D, 0x0000, 0x0003, 0x0863, 0x0000, 0x0003, 0x2946, 0x0000, 0x0003,
+    0xD71D, 0x8000, 0x8000, 0x0004, 0x0030, 0x0003, 0xC6FD, 0x0000, 0x0003, 0x0863, 0x0000, 0x0003,
+    0x2946, 0x0000, 0x0003, 0xC6FD, 0x8000, 0x8000, 0x0001, 0x0033, 0x0006, 0xD71D, 0x8000, 0x8000,
+    0x0004, 0x0000, 0x0012, 0xBF69, 0x0000, 0x000C, 0xA6C3, 0x0027, 0x0006, 0x2D20, 0x0000, 0x0015,
+    0x6708, 0x8000, 0x8000, 0x000A, 0x0000, 0x0012, 0xBF69, 0x0000, 0x0006, 0xA6C3, 0x0000, 0x0003,
+    0x10A2, 0x0000, 0x0003, 0xBF69, 0x0000, 0x0003, 0xA6C3, 0x0021, 0x0003, 0x2D20, 0x0000, 0x0003,
+    0x6708, 0x0000, 0x0003, 0x10A2, 0x0000, 0x0003, 0x2D20, 0x0000, 0x0012, 0x6708, 0x8000, 0x8000,
+    0x000C, 0x0000, 0x0012, 0xBF69, 0x0000, 0x0003, 0x10A2, 0x0000, 0x0003, 0x2966, 0x0000, 0x0006,
+    0x10A2, 0x0000, 0x0003, 0x2966, 0x0000, 0x0003, 0xA6C3, 0x001B, 0x0003, 0x2D20, 0x0000, 0x0003,
+    0x2966, 0x0000, 0x0006, 0x10A2, 0x0000, 0x0003, 0x2966, 0x0000, 0x0003, 0x10A2, 0x0000, 0x000F,
+    0x6708, 0x8000, 0x8000, 0x000C, 0x0000, 0x0012, 0xBF69, 0x0000, 0x0003, 0x2966, 0x0000, 0x0003,
+    0x5B0C, 0x0000, 0x0006, 0x2966, 0x0000, 0x0003, 0x5B0C, 0x0000, 0x0003, 0x2966, 0x001B, 0x0003,
+    0x2966, 0x0000, 0x0003, 0x5B0C, 0x0000, 0x0006, 0x2966, 0x0000, 0x0003, 0x5B0C, 0x0000, 0x0003,
+    0x2966, 0x0000, 0x000F, 0x6708, 0x8000, 0x8000, 0x0007, 0x0000, 0x0012, 0xBF69, 0x0000, 0x0003,
+    0xA6C3, 0x0000, 0x0003, 0x2966, 0x0006, 0x0003, 0x2966, 0x0021, 0x0003, 0x2966, 0x0006, 0x0003,
+    0x2966, 0x0000, 0x0012, 0x6708, 0x8000, 0x8000,
+};
+/* 32x20 -> 96x60: 2560 B ARGB8888 -> 1092 B */
+static const daos_sprite_t banner_tron4p = { 96, 60, banner_tron4p_data };
+
+static const uint16_t banner_tanque_data[363] = {
+    0x0001, 0x0003, 0x0027, 0x53DD, 0x8000, 0x8000, 0x0002, 0x000F, 0x0003, 0x841D, 0x0042, 0x0003,
+    0x53DD, 0x8000, 0x8000, 0x0003, 0x000F, 0x0003, 0x841D, 0x0021, 0x000C, 0x53DD, 0x0012, 0x0003,
+    0x53DD, 0x8000, 0x8000, 0x0004, 0x000C, 0x0006, 0x841D, 0x0021, 0x0003, 0x53DD, 0x0006, 0x0003,
+    0x53DD, 0x0012, 0x0003, 0x53DD, 0x8000, 0x8000, 0x0007, 0x000C, 0x0003, 0xB59E, 0x0006, 0x000C,
+    0x53DD, 0x0006, 0x0006, 0x53DD, 0x0006, 0x000C, 0x841D, 0x0003, 0x0003, 0x53DD, 0x0006, 0x0003,
+    0x53DD, 0x0003, 0x0006, 0x841D, 0x8000, 0x8000, 0x0009, 0x000C, 0x0003, 0xB59E, 0x0006, 0x0003,
+    0x841D, 0x0006, 0x0003, 0x841D, 0x0003, 0x0003, 0x841D, 0x0003, 0x0006, 0x841D, 0x0009, 0x0006,
+    0xB59E, 0x0003, 0x0003, 0x841D, 0x0006, 0x0003, 0x841D, 0x0003, 0x0003, 0x841D, 0x8000, 0x8000,
+    0x0008, 0x000C, 0x0003, 0xC63E, 0x0006, 0x0009, 0xB59E, 0x0006, 0x0003, 0xB59E, 0x0006, 0x0003,
+    0xB59E, 0x000C, 0x0003, 0xB59E, 0x0006, 0x0003, 0x841D, 0x0000, 0x0003, 0xB59E, 0x0006, 0x0003,
+    0xB59E, 0x8000, 0x8000, 0x0006, 0x001B, 0x0003, 0xC63E, 0x0006, 0x0003, 0xC63E, 0x0006, 0x0003,
+    0xC63E, 0x000C, 0x0003, 0xC63E, 0x0006, 0x0006, 0xC63E, 0x0006, 0x0006, 0xC63E, 0x8000, 0x8000,
+    0x0000, 0x8000, 0x8000, 0x0002, 0x0027, 0x0003, 0xC61E, 0x000C, 0x0003, 0xF30C, 0x8000, 0x8000,
+    0x0002, 0x002A, 0x0003, 0xC61E, 0x0009, 0x0003, 0xF30C, 0x8000, 0x8000, 0x0003, 0x0027, 0x0006,
+    0xC61E, 0x0003, 0x0003, 0xFEDB, 0x0003, 0x0006, 0xF30C, 0x8000, 0x8000, 0x000C, 0x000F, 0x0003,
+    0x0023, 0x0000, 0x0003, 0x2105, 0x0003, 0x0006, 0x2105, 0x0000, 0x0006, 0xAD5D, 0x0000, 0x0003,
+    0x0023, 0x0006, 0x0003, 0xC61E, 0x0000, 0x0003, 0xFEDB, 0x0000, 0x0006, 0xF30C, 0x0000, 0x0003,
+    0x2105, 0x0000, 0x0006, 0xD0C3, 0x0000, 0x0009, 0x2105, 0x0003, 0x0006, 0x2105, 0x8000, 0x8000,
+    0x000C, 0x000F, 0x0003, 0x0023, 0x0000, 0x0003, 0x2105, 0x0000, 0x0003, 0x0023, 0x0000, 0x0003,
+    0x2105, 0x0000, 0x0003, 0x0023, 0x0009, 0x0006, 0xC61E, 0x0003, 0x0003, 0xFEDB, 0x0003, 0x0006,
+    0xF30C, 0x0006, 0x0003, 0x2105, 0x0000, 0x0003, 0x0861, 0x0000, 0x0003, 0x2105, 0x0000, 0x0009,
+    0x0861, 0x8000, 0x8000, 0x000C, 0x000C, 0x0003, 0x0023, 0x0000, 0x0006, 0x2105, 0x0000, 0x0003,
+    0x0023, 0x0000, 0x0003, 0xAD5D, 0x0000, 0x0003, 0x0023, 0x000C, 0x0003, 0xC61E, 0x000C, 0x0003,
+    0xF30C, 0x0006, 0x0003, 0x0861, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0006, 0x0861, 0x0000, 0x0003,
+    0x2105, 0x0000, 0x0003, 0x0861, 0x8000, 0x8000, 0x000E, 0x0009, 0x0003, 0x0023, 0x0000, 0x0003,
+    0x2105, 0x0000, 0x0003, 0x0023, 0x0000, 0x0003, 0x2105, 0x0000, 0x0003, 0x0023, 0x0000, 0x0006,
+    0xAD5D, 0x0000, 0x0003, 0x0023, 0x0006, 0x0003, 0xC61E, 0x000F, 0x0003, 0xF30C, 0x0003, 0x0003,
+    0x0861, 0x0000, 0x0006, 0xD0C3, 0x0000, 0x0003, 0x2105, 0x0000, 0x0003, 0x0861, 0x0000, 0x0009,
+    0x2105, 0x8000, 0x8000, 0x0004, 0x000C, 0x000C, 0xAD5D, 0x0003, 0x0006, 0xAD5D, 0x001E, 0x0006,
+    0xD0C3, 0x0003, 0x000C, 0xD0C3, 0x8000, 0x8000, 0x0000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+    0x8000, 0x8000, 0x8000,
+};
+/* 32x20 -> 96x60: 2560 B ARGB8888 -> 726 B */
+static const daos_sprite_t banner_tanque = { 96, 60, banner_tanque_data };
+
+static const uint16_t banner_tron2p_data[603] = {
+    0x0000, 0x8000, 0x8000, 0x0002, 0x001B, 0x0006, 0x4BD9, 0x000F, 0x0009, 0x4BD9, 0x8000, 0x8000,
+    0x0002, 0x001B, 0x0009, 0x4BD9, 0x000C, 0x0003, 0x4BD9, 0x8000, 0x8000, 0x0006, 0x001B, 0x0003,
+    0x4BD9, 0x0003, 0x0003, 0x4BD9, 0x0003, 0x0003, 0x4BD9, 0x0006, 0x0009, 0x4BD9, 0x0003, 0x0003,
+    0x4BD9, 0x0003, 0x0003, 0x4BD9, 0x8000, 0x8000, 0x0007, 0x001B, 0x0003, 0x64BD, 0x0003, 0x0003,
+    0x64BD, 0x0003, 0x0003, 0x4BD9, 0x000C, 0x0003, 0x4BD9, 0x0003, 0x0003, 0x4BD9, 0x0003, 0x0003,
+    0x64BD, 0x0015, 0x0006, 0xF492, 0x8000, 0x8000, 0x0006, 0x001B, 0x0003, 0x64BD, 0x0003, 0x0003,
+    0x64BD, 0x0003, 0x0003, 0x64BD, 0x000C, 0x0003, 0x64BD, 0x0003, 0x0009, 0x64BD, 0x0012, 0x0006,
+    0xF492, 0x8000, 0x8000, 0x000A, 0x0000, 0x0006, 0xDEFD, 0x0015, 0x0003, 0x9E1F, 0x0003, 0x0003,
+    0x9E1F, 0x0003, 0x0003, 0x64BD, 0x0006, 0x0003, 0x9E1F, 0x0000, 0x0006, 0x64BD, 0x0003, 0x0003,
+    0x64BD, 0x0000, 0x0003, 0x9E1F, 0x0012, 0x0003, 0xE32C, 0x0000, 0x0003, 0xF492, 0x8000, 0x8000,
+    0x0007, 0x0003, 0x0009, 0xDEFD, 0x000F, 0x0006, 0x9E1F, 0x0006, 0x0003, 0x9E1F, 0x0003, 0x0006,
+    0x9E1F, 0x0009, 0x0003, 0x9E1F, 0x0003, 0x0003, 0x9E1F, 0x000F, 0x0003, 0xE32C, 0x8000, 0x8000,
+    0x0004, 0x0009, 0x0006, 0xDEFD, 0x0000, 0x0003, 0xBE7C, 0x0039, 0x0003, 0xD0C3, 0x0000, 0x0009,
+    0xE32C, 0x8000, 0x8000, 0x0008, 0x000F, 0x0003, 0xBE7C, 0x0003, 0x0003, 0x2125, 0x0000, 0x0006,
+    0x0020, 0x0000, 0x0003, 0x2125, 0x001B, 0x0003, 0x2125, 0x0000, 0x0006, 0x0020, 0x0000, 0x0003,
+    0x2125, 0x0000, 0x0006, 0xD0C3, 0x8000, 0x8000, 0x000B, 0x0000, 0x0009, 0xDEFD, 0x0009, 0x0006,
+    0x0020, 0x0000, 0x0006, 0xBE7C, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x0015, 0x0006,
+    0x0020, 0x0000, 0x0006, 0xD0C3, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x0006, 0x0003,
+    0xD0C3, 0x0000, 0x0003, 0xE32C, 0x8000, 0x8000, 0x0012, 0x0006, 0x0003, 0xDEFD, 0x0000, 0x0003,
+    0xBE7C, 0x0003, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0006,
+    0x0000, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x000F, 0x0003,
+    0x2125, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0006, 0x0000, 0x0000, 0x0003,
+    0xD0C3, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0xD0C3, 0x0003, 0x0009,
+    0xE32C, 0x8000, 0x8000, 0x0010, 0x000C, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003,
+    0xBE7C, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0000, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0006,
+    0x2125, 0x0009, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003,
+    0x0000, 0x0006, 0x0003, 0x0000, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0006, 0x2125, 0x0009, 0x0003,
+    0xE32C, 0x0000, 0x0003, 0xF492, 0x8000, 0x8000, 0x000D, 0x000C, 0x0003, 0x2125, 0x0000, 0x0003,
+    0xBE7C, 0x0000, 0x0003, 0x0000, 0x000C, 0x0003, 0x0000, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003,
+    0x0020, 0x0009, 0x0003, 0x2125, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0000, 0x000C, 0x0003,
+    0x0000, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0020, 0x0000, 0x0006, 0xD0C3, 0x8000, 0x8000,
+    0x0010, 0x0000, 0x0009, 0xDEFD, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003,
+    0xBE7C, 0x0000, 0x0003, 0x0000, 0x000C, 0x0003, 0x0000, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003,
+    0x2125, 0x0009, 0x0003, 0x2125, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0000, 0x000C, 0x0003,
+    0x0000, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x2125, 0x0003, 0x0006, 0xE32C, 0x0000, 0x0006,
+    0xF492, 0x8000, 0x8000, 0x000C, 0x000C, 0x0003, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003,
+    0x0020, 0x000C, 0x0003, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x0020, 0x0009, 0x0003,
+    0x0020, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0020, 0x000C, 0x0003, 0x0020, 0x0000, 0x0003,
+    0xD0C3, 0x0000, 0x0003, 0x0020, 0x8000, 0x8000, 0x0010, 0x0006, 0x0003, 0xDEFD, 0x0000, 0x0003,
+    0xBE7C, 0x0003, 0x0003, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x0020, 0x0006, 0x0003,
+    0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x0020, 0x000F, 0x0003, 0x0020, 0x0000, 0x0003,
+    0xD0C3, 0x0000, 0x0003, 0x0020, 0x0006, 0x0003, 0x0020, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003,
+    0x0020, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0xE32C, 0x8000, 0x8000, 0x000F, 0x0000, 0x0009,
+    0xDEFD, 0x0006, 0x0006, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0006, 0x2125, 0x0000, 0x0003,
+    0xBE7C, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x000F, 0x0006, 0x0020, 0x0000, 0x0003,
+    0xD0C3, 0x0000, 0x0006, 0x2125, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003,
+    0x2125, 0x0003, 0x0009, 0xE32C, 0x0000, 0x0006, 0xF492, 0x8000, 0x8000, 0x0008, 0x000C, 0x0003,
+    0xBE7C, 0x0006, 0x0006, 0x0020, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x001B, 0x0006,
+    0x0020, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0xD0C3, 0x8000, 0x8000,
+    0x0004, 0x0000, 0x000C, 0xDEFD, 0x0000, 0x0003, 0xBE7C, 0x0039, 0x0012, 0xE32C, 0x0000, 0x0006,
+    0xF492, 0x8000, 0x8000,
+};
+/* 32x20 -> 96x60: 2560 B ARGB8888 -> 1206 B */
+static const daos_sprite_t banner_tron2p = { 96, 60, banner_tron2p_data };
+
+static const uint16_t banner_reconocedor_data[282] = {
+    0x0001, 0x000C, 0x0009, 0x641F, 0x8000, 0x8000, 0x0001, 0x000C, 0x0003, 0x641F, 0x8000, 0x8000,
+    0x0003, 0x000C, 0x000C, 0x641F, 0x0003, 0x0003, 0x641F, 0x000C, 0x0003, 0x641F, 0x8000, 0x8000,
+    0x0004, 0x0015, 0x0003, 0x641F, 0x0003, 0x0003, 0x641F, 0x000C, 0x0003, 0x641F, 0x000C, 0x0003,
+    0x641F, 0x8000, 0x8000, 0x0007, 0x0015, 0x0003, 0x9CDC, 0x0003, 0x0003, 0x9CDC, 0x0000, 0x0003,
+    0x641F, 0x0000, 0x0003, 0x9CDC, 0x0006, 0x0003, 0x9CDC, 0x0000, 0x0003, 0x641F, 0x0009, 0x0003,
+    0x9CDC, 0x8000, 0x8000, 0x0004, 0x0015, 0x0003, 0x9CDC, 0x0003, 0x0009, 0x9CDC, 0x0006, 0x0009,
+    0x9CDC, 0x0006, 0x0009, 0x9CDC, 0x8000, 0x8000, 0x000A, 0x0009, 0x000F, 0xCE7E, 0x0003, 0x0003,
+    0xCE7E, 0x0003, 0x0003, 0xCE7E, 0x0003, 0x0006, 0xCE7E, 0x0003, 0x0003, 0xCE7E, 0x0006, 0x0003,
+    0xCE7E, 0x0003, 0x0003, 0xCE7E, 0x0006, 0x0003, 0xCE7E, 0x0003, 0x0003, 0xCE7E, 0x0003, 0x0003,
+    0xCE7E, 0x8000, 0x8000, 0x0001, 0x000F, 0x0006, 0xCE7E, 0x8000, 0x8000, 0x0000, 0x8000, 0x8000,
+    0x0001, 0x002D, 0x0006, 0x641F, 0x8000, 0x8000, 0x0006, 0x0027, 0x0003, 0xA5BF, 0x0000, 0x0003,
+    0x641F, 0x0000, 0x0003, 0x0000, 0x0000, 0x0003, 0x0862, 0x0000, 0x0003, 0x641F, 0x0000, 0x0003,
+    0xA5BF, 0x8000, 0x8000, 0x0007, 0x0024, 0x0003, 0x641F, 0x0000, 0x0003, 0x0000, 0x0000, 0x0006,
+    0x0862, 0x0000, 0x0003, 0x0000, 0x0000, 0x0003, 0x0862, 0x0000, 0x0003, 0x0000, 0x0000, 0x0003,
+    0x641F, 0x8000, 0x8000, 0x0003, 0x0021, 0x000C, 0x641F, 0x0000, 0x0006, 0xA5BF, 0x0000, 0x000C,
+    0x641F, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x0007, 0x0021, 0x0003, 0xA5BF, 0x0000, 0x0003,
+    0x641F, 0x0000, 0x0006, 0x0000, 0x0000, 0x0006, 0xA5BF, 0x0000, 0x0006, 0x0000, 0x0000, 0x0003,
+    0x641F, 0x0000, 0x0003, 0xA5BF, 0x8000, 0x8000, 0x0007, 0x001E, 0x0003, 0xA5BF, 0x0000, 0x0006,
+    0x641F, 0x0000, 0x0003, 0x0862, 0x0000, 0x0006, 0x0000, 0x0000, 0x0009, 0x0862, 0x0000, 0x0006,
+    0x641F, 0x0000, 0x0003, 0xA5BF, 0x8000, 0x8000, 0x0007, 0x001E, 0x0003, 0x641F, 0x0000, 0x0006,
+    0x0000, 0x0000, 0x0003, 0x0862, 0x0000, 0x000C, 0x0000, 0x0000, 0x0003, 0x0862, 0x0000, 0x0006,
+    0x0000, 0x0000, 0x0003, 0x641F, 0x8000, 0x8000, 0x0005, 0x001E, 0x0003, 0x641F, 0x0000, 0x0003,
+    0xA5BF, 0x0000, 0x0018, 0x641F, 0x0000, 0x0003, 0xA5BF, 0x0000, 0x0003, 0x641F, 0x8000, 0x8000,
+    0x0000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+};
+/* 32x20 -> 96x60: 2560 B ARGB8888 -> 564 B */
+static const daos_sprite_t banner_reconocedor = { 96, 60, banner_reconocedor_data };
+
+static const uint16_t banner_snake_data[495] = {
+    0x0003, 0x000F, 0x0003, 0xA5FB, 0x0000, 0x000C, 0x1BFB, 0x0030, 0x0009, 0x1BFB, 0x8000, 0x8000,
+    0x0003, 0x000C, 0x0006, 0xA5FB, 0x0000, 0x0006, 0x1BFB, 0x0036, 0x0003, 0x1BFB, 0x8000, 0x8000,
+    0x0004, 0x0009, 0x0003, 0x0042, 0x0000, 0x0003, 0xA5FB, 0x0006, 0x0009, 0x1BFB, 0x0030, 0x0003,
+    0x1BFB, 0x8000, 0x8000, 0x0004, 0x0006, 0x0003, 0x0042, 0x0000, 0x0003, 0xA5FB, 0x000F, 0x0006,
+    0x1BFB, 0x002D, 0x0003, 0x1BFB, 0x8000, 0x8000, 0x0006, 0x0003, 0x0006, 0x0042, 0x0000, 0x0003,
+    0xA5FB, 0x0012, 0x0003, 0x1BFB, 0x001E, 0x0003, 0x1BFB, 0x0003, 0x0003, 0x1BFB, 0x0003, 0x0009,
+    0x1BFB, 0x8000, 0x8000, 0x0008, 0x0003, 0x0003, 0x0042, 0x0000, 0x0003, 0xA5FB, 0x0006, 0x0006,
+    0x759E, 0x0009, 0x0003, 0x5D3D, 0x0003, 0x0006, 0x1BFB, 0x0006, 0x000C, 0x1BFB, 0x0003, 0x0006,
+    0x1BFB, 0x0006, 0x0003, 0x5D3D, 0x8000, 0x8000, 0x0008, 0x0003, 0x0003, 0xA5FB, 0x0009, 0x0003,
+    0x759E, 0x000C, 0x0003, 0x5D3D, 0x0003, 0x0009, 0x5D3D, 0x0003, 0x0003, 0x5D3D, 0x0006, 0x0003,
+    0x5D3D, 0x0003, 0x0009, 0x5D3D, 0x0003, 0x0003, 0x5D3D, 0x8000, 0x8000, 0x000B, 0x0003, 0x0003,
+    0x0042, 0x0000, 0x0003, 0xA5FB, 0x0006, 0x0006, 0x759E, 0x0003, 0x0006, 0xBE7C, 0x0000, 0x0003,
+    0x759E, 0x0003, 0x0003, 0x759E, 0x0003, 0x0003, 0x759E, 0x0003, 0x000C, 0x759E, 0x0003, 0x0003,
+    0x759E, 0x0003, 0x0003, 0x759E, 0x0003, 0x0003, 0x759E, 0x8000, 0x8000, 0x000A, 0x0003, 0x0003,
+    0x0042, 0x0000, 0x0003, 0xA5FB, 0x0009, 0x0009, 0xBE7C, 0x0009, 0x0003, 0x759E, 0x0003, 0x0003,
+    0xBE7C, 0x000C, 0x0003, 0xBE7C, 0x0003, 0x0003, 0x759E, 0x0003, 0x0003, 0xBE7C, 0x0003, 0x0003,
+    0x759E, 0x0000, 0x0006, 0xBE7C, 0x8000, 0x8000, 0x0003, 0x0003, 0x0006, 0x0042, 0x0000, 0x0003,
+    0xA5FB, 0x003F, 0x0009, 0x0042, 0x8000, 0x8000, 0x0009, 0x0006, 0x0006, 0x0042, 0x0000, 0x0009,
+    0xA5FB, 0x000F, 0x0006, 0xA5FB, 0x0006, 0x0009, 0xA5FB, 0x000C, 0x0003, 0xA5FB, 0x0000, 0x0003,
+    0x0042, 0x0000, 0x0003, 0xD71D, 0x0000, 0x0003, 0xD506, 0x0000, 0x0003, 0x18C3, 0x8000, 0x8000,
+    0x000D, 0x0009, 0x000C, 0x0042, 0x0000, 0x0006, 0xA5FB, 0x0006, 0x0003, 0xA5FB, 0x0000, 0x0003,
+    0x0042, 0x0000, 0x0003, 0xA5FB, 0x0003, 0x0003, 0xA5FB, 0x0000, 0x0009, 0x0042, 0x0000, 0x0003,
+    0xA5FB, 0x0006, 0x0003, 0xA5FB, 0x0000, 0x0003, 0x0042, 0x0000, 0x0003, 0x18C3, 0x0000, 0x0003,
+    0x0042, 0x0000, 0x0003, 0x18C3, 0x8000, 0x8000, 0x000E, 0x000C, 0x0009, 0x0042, 0x0000, 0x0003,
+    0x18C3, 0x0000, 0x0003, 0x0042, 0x0000, 0x0003, 0xA5FB, 0x0003, 0x0003, 0xA5FB, 0x0000, 0x0003,
+    0x0042, 0x0000, 0x0003, 0xA5FB, 0x0003, 0x0003, 0xA5FB, 0x0000, 0x0009, 0x0042, 0x0000, 0x0003,
+    0xA5FB, 0x0003, 0x0006, 0xA5FB, 0x0000, 0x0006, 0x0042, 0x0000, 0x0006, 0x18C3, 0x0000, 0x0003,
+    0xA5FB, 0x8000, 0x8000, 0x000D, 0x0012, 0x0009, 0x0042, 0x0000, 0x0003, 0xA5FB, 0x0003, 0x0003,
+    0xA5FB, 0x0000, 0x0003, 0x0042, 0x0000, 0x0003, 0xA5FB, 0x0003, 0x0003, 0xA5FB, 0x0000, 0x0003,
+    0x0042, 0x0003, 0x0003, 0x0042, 0x0000, 0x0006, 0xA5FB, 0x0000, 0x0006, 0x0042, 0x0000, 0x0003,
+    0xA5FB, 0x0000, 0x0003, 0x0042, 0x0000, 0x0009, 0xA5FB, 0x8000, 0x8000, 0x000B, 0x0015, 0x0003,
+    0x18C3, 0x0000, 0x0003, 0x0042, 0x0000, 0x0003, 0xA5FB, 0x0003, 0x0003, 0xA5FB, 0x0000, 0x0003,
+    0x0042, 0x0000, 0x0009, 0xA5FB, 0x0000, 0x0003, 0x0042, 0x0003, 0x0006, 0x0042, 0x0000, 0x0003,
+    0x18C3, 0x0000, 0x0003, 0x0042, 0x0000, 0x0003, 0x18C3, 0x8000, 0x8000, 0x000B, 0x0015, 0x0003,
+    0x18C3, 0x0000, 0x0003, 0x0042, 0x0000, 0x0003, 0xA5FB, 0x0003, 0x0003, 0xA5FB, 0x0000, 0x0003,
+    0x0042, 0x0003, 0x0003, 0x0042, 0x0000, 0x0003, 0x18C3, 0x0000, 0x0003, 0x0042, 0x0003, 0x0003,
+    0x0042, 0x0000, 0x0006, 0x18C3, 0x0000, 0x0006, 0x0042, 0x8000, 0x8000, 0x0007, 0x0015, 0x0003,
+    0x0042, 0x0000, 0x0003, 0x18C3, 0x0000, 0x0003, 0xA5FB, 0x0003, 0x0003, 0xA5FB, 0x0000, 0x0003,
+    0x0042, 0x0003, 0x0009, 0x18C3, 0x0009, 0x0006, 0x0042, 0x8000, 0x8000, 0x0006, 0x0018, 0x0006,
+    0x0042, 0x0000, 0x0003, 0xA5FB, 0x0000, 0x0006, 0x0042, 0x0003, 0x0003, 0x0042, 0x0000, 0x0003,
+    0x18C3, 0x0000, 0x0003, 0x0042, 0x8000, 0x8000, 0x0001, 0x001B, 0x0009, 0x0042, 0x8000, 0x8000,
+    0x0000, 0x8000, 0x8000,
+};
+/* 32x20 -> 96x60: 2560 B ARGB8888 -> 990 B */
+static const daos_sprite_t banner_snake = { 96, 60, banner_snake_data };
+
+static const uint16_t banner_disco_data[603] = {
+    0x0000, 0x8000, 0x8000, 0x0002, 0x001B, 0x0006, 0x4BD9, 0x000F, 0x0009, 0x4BD9, 0x8000, 0x8000,
+    0x0002, 0x001B, 0x0009, 0x4BD9, 0x000C, 0x0003, 0x4BD9, 0x8000, 0x8000, 0x0006, 0x001B, 0x0003,
+    0x4BD9, 0x0003, 0x0003, 0x4BD9, 0x0003, 0x0003, 0x4BD9, 0x0006, 0x0009, 0x4BD9, 0x0003, 0x0003,
+    0x4BD9, 0x0003, 0x0003, 0x4BD9, 0x8000, 0x8000, 0x0007, 0x001B, 0x0003, 0x64BD, 0x0003, 0x0003,
+    0x64BD, 0x0003, 0x0003, 0x4BD9, 0x000C, 0x0003, 0x4BD9, 0x0003, 0x0003, 0x4BD9, 0x0003, 0x0003,
+    0x64BD, 0x0015, 0x0006, 0xF492, 0x8000, 0x8000, 0x0006, 0x001B, 0x0003, 0x64BD, 0x0003, 0x0003,
+    0x64BD, 0x0003, 0x0003, 0x64BD, 0x000C, 0x0003, 0x64BD, 0x0003, 0x0009, 0x64BD, 0x0012, 0x0006,
+    0xF492, 0x8000, 0x8000, 0x000A, 0x0000, 0x0006, 0xDEFD, 0x0015, 0x0003, 0x9E1F, 0x0003, 0x0003,
+    0x9E1F, 0x0003, 0x0003, 0x64BD, 0x0006, 0x0003, 0x9E1F, 0x0000, 0x0006, 0x64BD, 0x0003, 0x0003,
+    0x64BD, 0x0000, 0x0003, 0x9E1F, 0x0012, 0x0003, 0xE32C, 0x0000, 0x0003, 0xF492, 0x8000, 0x8000,
+    0x0007, 0x0003, 0x0009, 0xDEFD, 0x000F, 0x0006, 0x9E1F, 0x0006, 0x0003, 0x9E1F, 0x0003, 0x0006,
+    0x9E1F, 0x0009, 0x0003, 0x9E1F, 0x0003, 0x0003, 0x9E1F, 0x000F, 0x0003, 0xE32C, 0x8000, 0x8000,
+    0x0004, 0x0009, 0x0006, 0xDEFD, 0x0000, 0x0003, 0xBE7C, 0x0039, 0x0003, 0xD0C3, 0x0000, 0x0009,
+    0xE32C, 0x8000, 0x8000, 0x0008, 0x000F, 0x0003, 0xBE7C, 0x0003, 0x0003, 0x2125, 0x0000, 0x0006,
+    0x0020, 0x0000, 0x0003, 0x2125, 0x001B, 0x0003, 0x2125, 0x0000, 0x0006, 0x0020, 0x0000, 0x0003,
+    0x2125, 0x0000, 0x0006, 0xD0C3, 0x8000, 0x8000, 0x000B, 0x0000, 0x0009, 0xDEFD, 0x0009, 0x0006,
+    0x0020, 0x0000, 0x0006, 0xBE7C, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x0015, 0x0006,
+    0x0020, 0x0000, 0x0006, 0xD0C3, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x0006, 0x0003,
+    0xD0C3, 0x0000, 0x0003, 0xE32C, 0x8000, 0x8000, 0x0012, 0x0006, 0x0003, 0xDEFD, 0x0000, 0x0003,
+    0xBE7C, 0x0003, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0006,
+    0x0000, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x000F, 0x0003,
+    0x2125, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0006, 0x0000, 0x0000, 0x0003,
+    0xD0C3, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0xD0C3, 0x0003, 0x0009,
+    0xE32C, 0x8000, 0x8000, 0x0010, 0x000C, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003,
+    0xBE7C, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0000, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0006,
+    0x2125, 0x0009, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003,
+    0x0000, 0x0006, 0x0003, 0x0000, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0006, 0x2125, 0x0009, 0x0003,
+    0xE32C, 0x0000, 0x0003, 0xF492, 0x8000, 0x8000, 0x000D, 0x000C, 0x0003, 0x2125, 0x0000, 0x0003,
+    0xBE7C, 0x0000, 0x0003, 0x0000, 0x000C, 0x0003, 0x0000, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003,
+    0x0020, 0x0009, 0x0003, 0x2125, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0000, 0x000C, 0x0003,
+    0x0000, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0020, 0x0000, 0x0006, 0xD0C3, 0x8000, 0x8000,
+    0x0010, 0x0000, 0x0009, 0xDEFD, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003,
+    0xBE7C, 0x0000, 0x0003, 0x0000, 0x000C, 0x0003, 0x0000, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003,
+    0x2125, 0x0009, 0x0003, 0x2125, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0000, 0x000C, 0x0003,
+    0x0000, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x2125, 0x0003, 0x0006, 0xE32C, 0x0000, 0x0006,
+    0xF492, 0x8000, 0x8000, 0x000C, 0x000C, 0x0003, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003,
+    0x0020, 0x000C, 0x0003, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x0020, 0x0009, 0x0003,
+    0x0020, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0020, 0x000C, 0x0003, 0x0020, 0x0000, 0x0003,
+    0xD0C3, 0x0000, 0x0003, 0x0020, 0x8000, 0x8000, 0x0010, 0x0006, 0x0003, 0xDEFD, 0x0000, 0x0003,
+    0xBE7C, 0x0003, 0x0003, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x0020, 0x0006, 0x0003,
+    0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0003, 0x0020, 0x000F, 0x0003, 0x0020, 0x0000, 0x0003,
+    0xD0C3, 0x0000, 0x0003, 0x0020, 0x0006, 0x0003, 0x0020, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003,
+    0x0020, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0xE32C, 0x8000, 0x8000, 0x000F, 0x0000, 0x0009,
+    0xDEFD, 0x0006, 0x0006, 0x0020, 0x0000, 0x0003, 0xBE7C, 0x0000, 0x0006, 0x2125, 0x0000, 0x0003,
+    0xBE7C, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0x2125, 0x000F, 0x0006, 0x0020, 0x0000, 0x0003,
+    0xD0C3, 0x0000, 0x0006, 0x2125, 0x0000, 0x0003, 0xD0C3, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003,
+    0x2125, 0x0003, 0x0009, 0xE32C, 0x0000, 0x0006, 0xF492, 0x8000, 0x8000, 0x0008, 0x000C, 0x0003,
+    0xBE7C, 0x0006, 0x0006, 0x0020, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x001B, 0x0006,
+    0x0020, 0x0000, 0x0003, 0x2125, 0x0000, 0x0003, 0x0020, 0x0000, 0x0003, 0xD0C3, 0x8000, 0x8000,
+    0x0004, 0x0000, 0x000C, 0xDEFD, 0x0000, 0x0003, 0xBE7C, 0x0039, 0x0012, 0xE32C, 0x0000, 0x0006,
+    0xF492, 0x8000, 0x8000,
+};
+/* 32x20 -> 96x60: 2560 B ARGB8888 -> 1206 B */
+static const daos_sprite_t banner_disco = { 96, 60, banner_disco_data };
+
+#endif /* SPRITES_BANNERS_H */
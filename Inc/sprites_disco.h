@@ -0,0 +1,108 @@
+/**
+ * Generado por tools/sprites.py desde assets/disco.sprites: no editar a mano.
+ * Formato de los datos: ver daos_sprite_t en api.h.
+ */
+
+#ifndef SPRITES_DISCO_H
+#define SPRITES_DISCO_H
+
+#include "api.h"
+
+static const uint16_t sprite_p1_idle2_data[125] = {
+    0x0003, 0x0005, 0x0005, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000, 0x0005, 0x771C, 0x8000, 0x8000,
+    0x0003, 0x0003, 0x0002, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000, 0x000C, 0x771C, 0x8000, 0x0003,
+    0x0003, 0x0007, 0x771C, 0x0000, 0x0008, 0xCF3C, 0x0000, 0x0002, 0x771C, 0x8000, 0x8000, 0x0001,
+    0x0003, 0x8011, 0xCF3C, 0xCF3C, 0x771C, 0x771C, 0x771C, 0xCF3C, 0xCF3C, 0x18E3, 0x18E3, 0x18E3,
+    0xCF3C, 0xCF3C, 0x18E3, 0x18E3, 0x18E3, 0xCF3C, 0xCF3C, 0x8000, 0x0002, 0x0003, 0x0002, 0x771C,
+    0x0000, 0x000F, 0xCF3C, 0x8000, 0x8000, 0x0001, 0x0005, 0x000D, 0xCF3C, 0x8000, 0x0005, 0x0003,
+    0x0007, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000, 0x0002, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000,
+    0x0002, 0x771C, 0x8000, 0x8000, 0x0006, 0x0003, 0x0002, 0x45F7, 0x0000, 0x0003, 0xCF3C, 0x0000,
+    0x0005, 0x771C, 0x0000, 0x0002, 0xCF3C, 0x0000, 0x0003, 0x771C, 0x0000, 0x0002, 0x45F7, 0x8000,
+    0x0002, 0x0005, 0x0003, 0xCF3C, 0x0000, 0x000A, 0x771C, 0x8000, 0x8000, 0x0002, 0x0005, 0x0005,
+    0x45F7, 0x0003, 0x0005, 0x45F7, 0x8000,
+};
+/* 10x10 -> 25x25: 400 B ARGB8888 -> 250 B */
+static const daos_sprite_t sprite_p1_idle2 = { 25, 25, sprite_p1_idle2_data };
+
+static const uint16_t sprite_p1_idle1_data[119] = {
+    0x0000, 0x8000, 0x8000, 0x0003, 0x0005, 0x0005, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000, 0x0005,
+    0x771C, 0x8000, 0x0003, 0x0003, 0x0002, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000, 0x000C, 0x771C,
+    0x8000, 0x8000, 0x0003, 0x0003, 0x0007, 0x771C, 0x0000, 0x0008, 0xCF3C, 0x0000, 0x0002, 0x771C,
+    0x8000, 0x0001, 0x0003, 0x8011, 0xCF3C, 0xCF3C, 0x771C, 0x771C, 0x771C, 0xCF3C, 0xCF3C, 0x18E3,
+    0x18E3, 0x18E3, 0xCF3C, 0xCF3C, 0x18E3, 0x18E3, 0x18E3, 0xCF3C, 0xCF3C, 0x8000, 0x8000, 0x0002,
+    0x0003, 0x0002, 0x771C, 0x0000, 0x000F, 0xCF3C, 0x8000, 0x0001, 0x0005, 0x000D, 0xCF3C, 0x8000,
+    0x8000, 0x0005, 0x0003, 0x0007, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000, 0x0002, 0x771C, 0x0000,
+    0x0003, 0xCF3C, 0x0000, 0x0002, 0x771C, 0x8000, 0x0006, 0x0003, 0x0002, 0x45F7, 0x0000, 0x0003,
+    0xCF3C, 0x0000, 0x0005, 0x771C, 0x0000, 0x0002, 0xCF3C, 0x0000, 0x0003, 0x771C, 0x0000, 0x0002,
+    0x45F7, 0x8000, 0x8000, 0x0002, 0x0005, 0x0003, 0xCF3C, 0x0000, 0x000A, 0x771C, 0x8000,
+};
+/* 10x10 -> 25x25: 400 B ARGB8888 -> 238 B */
+static const daos_sprite_t sprite_p1_idle1 = { 25, 25, sprite_p1_idle1_data };
+
+static const uint16_t sprite_p2_idle2_data[139] = {
+    0x0003, 0x0008, 0x0002, 0x1000, 0x0000, 0x0005, 0xF800, 0x0000, 0x0005, 0x1000, 0x8000, 0x8000,
+    0x0005, 0x0005, 0x0003, 0x1000, 0x0000, 0x0002, 0x2104, 0x0000, 0x0005, 0x1000, 0x0000, 0x0003,
+    0x2104, 0x0000, 0x0005, 0x1000, 0x8000, 0x0006, 0x0005, 0x0003, 0x1000, 0x0000, 0x0002, 0x2104,
+    0x0000, 0x0005, 0x1000, 0x0000, 0x0003, 0x2104, 0x0000, 0x0002, 0x1000, 0x0000, 0x0003, 0xF800,
+    0x8000, 0x8000, 0x0004, 0x0005, 0x0008, 0x1000, 0x0000, 0x0002, 0x2104, 0x0000, 0x0005, 0x1000,
+    0x0000, 0x0003, 0xF800, 0x8000, 0x0003, 0x0005, 0x0008, 0x1000, 0x0000, 0x0002, 0x2104, 0x0000,
+    0x0008, 0x1000, 0x8000, 0x8000, 0x0001, 0x0008, 0x000C, 0x1000, 0x8000, 0x0005, 0x0005, 0x0003,
+    0x1000, 0x0000, 0x0002, 0x2104, 0x0000, 0x0003, 0x1000, 0x0000, 0x0007, 0x2104, 0x0000, 0x0003,
+    0x1000, 0x8000, 0x8000, 0x0006, 0x0005, 0x0003, 0x2104, 0x0000, 0x0002, 0xF800, 0x0000, 0x0003,
+    0x2104, 0x0000, 0x0002, 0xF800, 0x0000, 0x0005, 0x1000, 0x0000, 0x0003, 0x2104, 0x8000, 0x0003,
+    0x0008, 0x0002, 0x1000, 0x0000, 0x0003, 0xF800, 0x0000, 0x0007, 0x1000, 0x8000, 0x8000, 0x0002,
+    0x0008, 0x0005, 0x2104, 0x0002, 0x0005, 0x2104, 0x8000,
+};
+/* 10x10 -> 25x25: 400 B ARGB8888 -> 278 B */
+static const daos_sprite_t sprite_p2_idle2 = { 25, 25, sprite_p2_idle2_data };
+
+static const uint16_t sprite_p2_idle1_data[133] = {
+    0x0000, 0x8000, 0x8000, 0x0003, 0x0008, 0x0002, 0x1000, 0x0000, 0x0005, 0xF800, 0x0000, 0x0005,
+    0x1000, 0x8000, 0x0005, 0x0005, 0x0003, 0x1000, 0x0000, 0x0002, 0x2104, 0x0000, 0x0005, 0x1000,
+    0x0000, 0x0003, 0x2104, 0x0000, 0x0005, 0x1000, 0x8000, 0x8000, 0x0006, 0x0005, 0x0003, 0x1000,
+    0x0000, 0x0002, 0x2104, 0x0000, 0x0005, 0x1000, 0x0000, 0x0003, 0x2104, 0x0000, 0x0002, 0x1000,
+    0x0000, 0x0003, 0xF800, 0x8000, 0x0004, 0x0005, 0x0008, 0x1000, 0x0000, 0x0002, 0x2104, 0x0000,
+    0x0005, 0x1000, 0x0000, 0x0003, 0xF800, 0x8000, 0x8000, 0x0003, 0x0005, 0x0008, 0x1000, 0x0000,
+    0x0002, 0x2104, 0x0000, 0x0008, 0x1000, 0x8000, 0x0001, 0x0008, 0x000C, 0x1000, 0x8000, 0x8000,
+    0x0005, 0x0005, 0x0003, 0x1000, 0x0000, 0x0002, 0x2104, 0x0000, 0x0003, 0x1000, 0x0000, 0x0007,
+    0x2104, 0x0000, 0x0003, 0x1000, 0x8000, 0x0006, 0x0005, 0x0003, 0x2104, 0x0000, 0x0002, 0xF800,
+    0x0000, 0x0003, 0x2104, 0x0000, 0x0002, 0xF800, 0x0000, 0x0005, 0x1000, 0x0000, 0x0003, 0x2104,
+    0x8000, 0x8000, 0x0003, 0x0008, 0x0002, 0x1000, 0x0000, 0x0003, 0xF800, 0x0000, 0x0007, 0x1000,
+    0x8000,
+};
+/* 10x10 -> 25x25: 400 B ARGB8888 -> 266 B */
+static const daos_sprite_t sprite_p2_idle1 = { 25, 25, sprite_p2_idle1_data };
+
+static const uint16_t sprite_p1_shoot_data[113] = {
+    0x0003, 0x0005, 0x0005, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000, 0x0005, 0x771C, 0x8000, 0x8000,
+    0x0003, 0x0003, 0x0002, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000, 0x000C, 0x771C, 0x8000, 0x0003,
+    0x0003, 0x0007, 0x771C, 0x0000, 0x0008, 0xCF3C, 0x0000, 0x0002, 0x771C, 0x8000, 0x8000, 0x0001,
+    0x0003, 0x8011, 0xCF3C, 0xCF3C, 0x771C, 0x771C, 0x771C, 0xCF3C, 0xCF3C, 0x18E3, 0x18E3, 0x18E3,
+    0xCF3C, 0xCF3C, 0x18E3, 0x18E3, 0x18E3, 0xCF3C, 0xCF3C, 0x8000, 0x0002, 0x0003, 0x0002, 0x771C,
+    0x0000, 0x000F, 0xCF3C, 0x8000, 0x8000, 0x0001, 0x0005, 0x000D, 0xCF3C, 0x8000, 0x0001, 0x0005,
+    0x0012, 0xCF3C, 0x8000, 0x8000, 0x0003, 0x0003, 0x0005, 0xCF3C, 0x0000, 0x0005, 0x771C, 0x0000,
+    0x000A, 0xCF3C, 0x8000, 0x0007, 0x0003, 0x0002, 0xCF3C, 0x0000, 0x0003, 0x771C, 0x0000, 0x0005,
+    0xCF3C, 0x0000, 0x0002, 0x771C, 0x0000, 0x0003, 0xCF3C, 0x0000, 0x0002, 0x771C, 0x0000, 0x0003,
+    0xCF3C, 0x8000, 0x8000, 0x8000, 0x8000,
+};
+/* 10x10 -> 25x25: 400 B ARGB8888 -> 226 B */
+static const daos_sprite_t sprite_p1_shoot = { 25, 25, sprite_p1_shoot_data };
+
+static const uint16_t sprite_p2_shoot_data[133] = {
+    0x0003, 0x0008, 0x0002, 0x1000, 0x0000, 0x0005, 0xF800, 0x0000, 0x0005, 0x1000, 0x8000, 0x8000,
+    0x0005, 0x0005, 0x0003, 0x1000, 0x0000, 0x0002, 0x2104, 0x0000, 0x0005, 0x1000, 0x0000, 0x0003,
+    0x2104, 0x0000, 0x0005, 0x1000, 0x8000, 0x0006, 0x0005, 0x0003, 0x1000, 0x0000, 0x0002, 0x2104,
+    0x0000, 0x0005, 0x1000, 0x0000, 0x0003, 0x2104, 0x0000, 0x0002, 0x1000, 0x0000, 0x0003, 0xF800,
+    0x8000, 0x8000, 0x0004, 0x0005, 0x0008, 0x1000, 0x0000, 0x0002, 0x2104, 0x0000, 0x0005, 0x1000,
+    0x0000, 0x0003, 0xF800, 0x8000, 0x0003, 0x0005, 0x0008, 0x1000, 0x0000, 0x0002, 0x2104, 0x0000,
+    0x0008, 0x1000, 0x8000, 0x8000, 0x0001, 0x0008, 0x000C, 0x1000, 0x8000, 0x0004, 0x0003, 0x000A,
+    0x1000, 0x0000, 0x0002, 0x2104, 0x0000, 0x0003, 0x1000, 0x0000, 0x0002, 0x2104, 0x8000, 0x8000,
+    0x0004, 0x0003, 0x0005, 0x1000, 0x0000, 0x0005, 0xF800, 0x0000, 0x0005, 0x1000, 0x0000, 0x0002,
+    0x2104, 0x8000, 0x0006, 0x0003, 0x0002, 0x1000, 0x0000, 0x0003, 0xF800, 0x0000, 0x0005, 0x1000,
+    0x0000, 0x0002, 0xF800, 0x0000, 0x0003, 0x2104, 0x0000, 0x0002, 0x1000, 0x8000, 0x8000, 0x8000,
+    0x8000,
+};
+/* 10x10 -> 25x25: 400 B ARGB8888 -> 266 B */
+static const daos_sprite_t sprite_p2_shoot = { 25, 25, sprite_p2_shoot_data };
+
+#endif /* SPRITES_DISCO_H */
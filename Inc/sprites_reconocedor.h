@@ -0,0 +1,262 @@
+/**
+ * Generado por tools/sprites.py desde assets/reconocedor.sprites: no editar a mano.
+ * Formato de los datos: ver daos_sprite_t en api.h.
+ */
+
+#ifndef SPRITES_RECONOCEDOR_H
+#define SPRITES_RECONOCEDOR_H
+
+#include "api.h"
+
+static const uint16_t sprite_pared_azul_data[112] = {
+    0x0004, 0x0000, 0x0002, 0x4996, 0x0000, 0x0002, 0x25B9, 0x0000, 0x000B, 0x72DA, 0x0000, 0x0001,
+    0x4996, 0x8000, 0x0003, 0x0000, 0x0002, 0x72DA, 0x0000, 0x000D, 0x4996, 0x0000, 0x0001, 0x72DA,
+    0x8000, 0x0001, 0x0000, 0x8010, 0x72DA, 0x72DA, 0x4996, 0x4996, 0x4996, 0x72DA, 0x72DA, 0x4996,
+    0x4996, 0x4996, 0x72DA, 0x72DA, 0x4996, 0x4996, 0x4996, 0x72DA, 0x8000, 0x8000, 0x0001, 0x0000,
+    0x8010, 0x72DA, 0x72DA, 0x4996, 0x4996, 0x4996, 0x72DA, 0x72DA, 0x4996, 0x4996, 0x4996, 0x72DA,
+    0x72DA, 0x4996, 0x4996, 0x4996, 0x25B9, 0x0001, 0x0000, 0x8010, 0x72DA, 0x72DA, 0x4996, 0x4996,
+    0x4996, 0x25B9, 0x25B9, 0x4996, 0x4996, 0x4996, 0x25B9, 0x25B9, 0x4996, 0x4996, 0x4996, 0x25B9,
+    0x8000, 0x8000, 0x8000, 0x8000, 0x0003, 0x0000, 0x0002, 0x25B9, 0x0000, 0x000D, 0x4996, 0x0000,
+    0x0001, 0x25B9, 0x8000, 0x0004, 0x0000, 0x0002, 0x4996, 0x0000, 0x000B, 0x72DA, 0x0000, 0x0002,
+    0x25B9, 0x0000, 0x0001, 0x4996,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 224 B */
+static const daos_sprite_t sprite_pared_azul = { 16, 16, sprite_pared_azul_data };
+
+static const uint16_t sprite_pared_verde_data[112] = {
+    0x0004, 0x0000, 0x0002, 0x3586, 0x0000, 0x0002, 0x3664, 0x0000, 0x000B, 0x5E8D, 0x0000, 0x0001,
+    0x3586, 0x8000, 0x0003, 0x0000, 0x0002, 0x5E8D, 0x0000, 0x000D, 0x3586, 0x0000, 0x0001, 0x5E8D,
+    0x8000, 0x0001, 0x0000, 0x8010, 0x5E8D, 0x5E8D, 0x3586, 0x3586, 0x3586, 0x5E8D, 0x5E8D, 0x3586,
+    0x3586, 0x3586, 0x5E8D, 0x5E8D, 0x3586, 0x3586, 0x3586, 0x5E8D, 0x8000, 0x8000, 0x0001, 0x0000,
+    0x8010, 0x5E8D, 0x5E8D, 0x3586, 0x3586, 0x3586, 0x5E8D, 0x5E8D, 0x3586, 0x3586, 0x3586, 0x5E8D,
+    0x5E8D, 0x3586, 0x3586, 0x3586, 0x3664, 0x0001, 0x0000, 0x8010, 0x5E8D, 0x5E8D, 0x3586, 0x3586,
+    0x3586, 0x3664, 0x3664, 0x3586, 0x3586, 0x3586, 0x3664, 0x3664, 0x3586, 0x3586, 0x3586, 0x3664,
+    0x8000, 0x8000, 0x8000, 0x8000, 0x0003, 0x0000, 0x0002, 0x3664, 0x0000, 0x000D, 0x3586, 0x0000,
+    0x0001, 0x3664, 0x8000, 0x0004, 0x0000, 0x0002, 0x3586, 0x0000, 0x000B, 0x5E8D, 0x0000, 0x0002,
+    0x3664, 0x0000, 0x0001, 0x3586,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 224 B */
+static const daos_sprite_t sprite_pared_verde = { 16, 16, sprite_pared_verde_data };
+
+static const uint16_t sprite_pared_amarilla_data[112] = {
+    0x0004, 0x0000, 0x0002, 0xA586, 0x0000, 0x0002, 0xC664, 0x0000, 0x000B, 0xD62B, 0x0000, 0x0001,
+    0xA586, 0x8000, 0x0003, 0x0000, 0x0002, 0xD62B, 0x0000, 0x000D, 0xA586, 0x0000, 0x0001, 0xD62B,
+    0x8000, 0x0001, 0x0000, 0x8010, 0xD62B, 0xD62B, 0xA586, 0xA586, 0xA586, 0xD62B, 0xD62B, 0xA586,
+    0xA586, 0xA586, 0xD62B, 0xD62B, 0xA586, 0xA586, 0xA586, 0xD62B, 0x8000, 0x8000, 0x0001, 0x0000,
+    0x8010, 0xD62B, 0xD62B, 0xA586, 0xA586, 0xA586, 0xD62B, 0xD62B, 0xA586, 0xA586, 0xA586, 0xD62B,
+    0xD62B, 0xA586, 0xA586, 0xA586, 0xC664, 0x0001, 0x0000, 0x8010, 0xD62B, 0xD62B, 0xA586, 0xA586,
+    0xA586, 0xC664, 0xC664, 0xA586, 0xA586, 0xA586, 0xC664, 0xC664, 0xA586, 0xA586, 0xA586, 0xC664,
+    0x8000, 0x8000, 0x8000, 0x8000, 0x0003, 0x0000, 0x0002, 0xC664, 0x0000, 0x000D, 0xA586, 0x0000,
+    0x0001, 0xC664, 0x8000, 0x0004, 0x0000, 0x0002, 0xA586, 0x0000, 0x000B, 0xD62B, 0x0000, 0x0002,
+    0xC664, 0x0000, 0x0001, 0xA586,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 224 B */
+static const daos_sprite_t sprite_pared_amarilla = { 16, 16, sprite_pared_amarilla_data };
+
+static const uint16_t sprite_caja_data[76] = {
+    0x0003, 0x0000, 0x0002, 0xA2A0, 0x0000, 0x000D, 0x7A62, 0x0000, 0x0001, 0xA2A0, 0x8000, 0x0003,
+    0x0000, 0x0004, 0x7A62, 0x0000, 0x000B, 0xA2A0, 0x0000, 0x0001, 0x7A62, 0x8000, 0x0001, 0x0002,
+    0x800D, 0xA2A0, 0xA2A0, 0xE445, 0xA2A0, 0xA2A0, 0xE445, 0xE445, 0xE445, 0xA2A0, 0xA2A0, 0xE445,
+    0xA2A0, 0xA2A0, 0x0001, 0x0002, 0x800D, 0x7A62, 0x7A62, 0xE445, 0x7A62, 0x7A62, 0xE445, 0xE445,
+    0xE445, 0x7A62, 0x7A62, 0xE445, 0xA2A0, 0xA2A0, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+    0x8000, 0x0003, 0x0000, 0x0002, 0xA2A0, 0x0000, 0x000D, 0x7A62, 0x0000, 0x0001, 0xA2A0, 0x8000,
+    0x0001, 0x0000, 0x0010, 0xA2A0,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 152 B */
+static const daos_sprite_t sprite_caja = { 16, 16, sprite_caja_data };
+
+static const uint16_t sprite_jugador_data0[133] = {
+    0x0001, 0x0002, 0x800D, 0x2537, 0x2537, 0xBDD7, 0x2537, 0x2537, 0xBDD7, 0xBDD7, 0xBDD7, 0x2537,
+    0x2537, 0xBDD7, 0x2537, 0x2537, 0x8000, 0x0001, 0x0000, 0x0010, 0x2537, 0x8000, 0x0005, 0x0000,
+    0x0002, 0xBDD7, 0x0000, 0x0003, 0x2537, 0x0000, 0x0007, 0xBDD7, 0x0000, 0x0003, 0x2537, 0x0000,
+    0x0001, 0xBDD7, 0x0001, 0x0000, 0x8010, 0xBDD7, 0xBDD7, 0x2537, 0x2537, 0xBDD7, 0x2104, 0x2104,
+    0xBDD7, 0xBDD7, 0xBDD7, 0x2104, 0x2104, 0xBDD7, 0x2537, 0x2537, 0xBDD7, 0x8000, 0x0001, 0x0000,
+    0x8010, 0x2537, 0x2537, 0x2537, 0x2537, 0xBDD7, 0x2104, 0x2104, 0xBDD7, 0xBDD7, 0xBDD7, 0x2104,
+    0x2104, 0xBDD7, 0x2537, 0x2537, 0x2537, 0x0003, 0x0002, 0x0002, 0x2537, 0x0000, 0x0009, 0xBDD7,
+    0x0000, 0x0002, 0x2537, 0x8000, 0x0001, 0x0004, 0x0009, 0xBDD7, 0x8000, 0x0005, 0x0000, 0x0005,
+    0x2537, 0x0000, 0x0002, 0xBDD7, 0x0000, 0x0003, 0x2537, 0x0000, 0x0002, 0xBDD7, 0x0000, 0x0004,
+    0x2537, 0x0005, 0x0000, 0x0002, 0xBDD7, 0x0000, 0x0005, 0x2537, 0x0000, 0x0003, 0xBDD7, 0x0000,
+    0x0005, 0x2537, 0x0000, 0x0001, 0xBDD7, 0x8000, 0x0002, 0x0002, 0x0005, 0x2537, 0x0003, 0x0005,
+    0x2537,
+};
+static const uint16_t sprite_jugador_data1[125] = {
+    0x0004, 0x0002, 0x8003, 0xBDD7, 0xBDD7, 0x2537, 0x0003, 0x0002, 0x2537, 0x0000, 0x0003, 0xBDD7,
+    0x0000, 0x0002, 0x2537, 0x8000, 0x0002, 0x0000, 0x0005, 0x2537, 0x0002, 0x0009, 0x2537, 0x8000,
+    0x0004, 0x0000, 0x0005, 0x2537, 0x0000, 0x0007, 0xBDD7, 0x0000, 0x0003, 0x2537, 0x0000, 0x0001,
+    0xBDD7, 0x0005, 0x0000, 0x0004, 0x2537, 0x0000, 0x0004, 0xBDD7, 0x0000, 0x0004, 0x2104, 0x0000,
+    0x0001, 0xBDD7, 0x0000, 0x0003, 0x2537, 0x8000, 0x0005, 0x0002, 0x0002, 0xBDD7, 0x0000, 0x0001,
+    0x2537, 0x0000, 0x0008, 0xBDD7, 0x0000, 0x0002, 0x2537, 0x0000, 0x0001, 0xBDD7, 0x8000, 0x8000,
+    0x0005, 0x0000, 0x0004, 0x2537, 0x0000, 0x0004, 0xBDD7, 0x0000, 0x0004, 0x2104, 0x0000, 0x0001,
+    0xBDD7, 0x0000, 0x0003, 0x2537, 0x8000, 0x0004, 0x0000, 0x0005, 0x2537, 0x0000, 0x0007, 0xBDD7,
+    0x0000, 0x0003, 0x2537, 0x0000, 0x0001, 0xBDD7, 0x0002, 0x0000, 0x0005, 0x2537, 0x0002, 0x0009,
+    0x2537, 0x8000, 0x0004, 0x0002, 0x8003, 0xBDD7, 0xBDD7, 0x2537, 0x0003, 0x0002, 0x2537, 0x0000,
+    0x0003, 0xBDD7, 0x0000, 0x0002, 0x2537,
+};
+static const uint16_t sprite_jugador_data2[133] = {
+    0x0002, 0x0002, 0x0005, 0x2537, 0x0003, 0x0005, 0x2537, 0x8000, 0x0005, 0x0000, 0x0002, 0xBDD7,
+    0x0000, 0x0005, 0x2537, 0x0000, 0x0003, 0xBDD7, 0x0000, 0x0005, 0x2537, 0x0000, 0x0001, 0xBDD7,
+    0x8000, 0x0005, 0x0000, 0x0005, 0x2537, 0x0000, 0x0002, 0xBDD7, 0x0000, 0x0003, 0x2537, 0x0000,
+    0x0002, 0xBDD7, 0x0000, 0x0004, 0x2537, 0x0001, 0x0004, 0x0009, 0xBDD7, 0x8000, 0x0003, 0x0002,
+    0x0002, 0x2537, 0x0000, 0x0009, 0xBDD7, 0x0000, 0x0002, 0x2537, 0x0001, 0x0000, 0x8010, 0x2537,
+    0x2537, 0x2537, 0x2537, 0xBDD7, 0x2104, 0x2104, 0xBDD7, 0xBDD7, 0xBDD7, 0x2104, 0x2104, 0xBDD7,
+    0x2537, 0x2537, 0x2537, 0x8000, 0x0001, 0x0000, 0x8010, 0xBDD7, 0xBDD7, 0x2537, 0x2537, 0xBDD7,
+    0x2104, 0x2104, 0xBDD7, 0xBDD7, 0xBDD7, 0x2104, 0x2104, 0xBDD7, 0x2537, 0x2537, 0xBDD7, 0x8000,
+    0x0005, 0x0000, 0x0002, 0xBDD7, 0x0000, 0x0003, 0x2537, 0x0000, 0x0007, 0xBDD7, 0x0000, 0x0003,
+    0x2537, 0x0000, 0x0001, 0xBDD7, 0x0001, 0x0000, 0x0010, 0x2537, 0x8000, 0x0001, 0x0002, 0x800D,
+    0x2537, 0x2537, 0xBDD7, 0x2537, 0x2537, 0xBDD7, 0xBDD7, 0xBDD7, 0x2537, 0x2537, 0xBDD7, 0x2537,
+    0x2537,
+};
+static const uint16_t sprite_jugador_data3[123] = {
+    0x0002, 0x0002, 0x8006, 0x2537, 0x2537, 0xBDD7, 0xBDD7, 0xBDD7, 0x2537, 0x0004, 0x8003, 0x2537,
+    0xBDD7, 0xBDD7, 0x8000, 0x0002, 0x0000, 0x000A, 0x2537, 0x0002, 0x0004, 0x2537, 0x8000, 0x0004,
+    0x0000, 0x0002, 0xBDD7, 0x0000, 0x0003, 0x2537, 0x0000, 0x0007, 0xBDD7, 0x0000, 0x0004, 0x2537,
+    0x0005, 0x0000, 0x0004, 0x2537, 0x0000, 0x0001, 0xBDD7, 0x0000, 0x0003, 0x2104, 0x0000, 0x0005,
+    0xBDD7, 0x0000, 0x0003, 0x2537, 0x8000, 0x0005, 0x0000, 0x0002, 0xBDD7, 0x0000, 0x0002, 0x2537,
+    0x0000, 0x0008, 0xBDD7, 0x0000, 0x0001, 0x2537, 0x0000, 0x0002, 0xBDD7, 0x8000, 0x8000, 0x0005,
+    0x0000, 0x0004, 0x2537, 0x0000, 0x0001, 0xBDD7, 0x0000, 0x0003, 0x2104, 0x0000, 0x0005, 0xBDD7,
+    0x0000, 0x0003, 0x2537, 0x8000, 0x0004, 0x0000, 0x0002, 0xBDD7, 0x0000, 0x0003, 0x2537, 0x0000,
+    0x0007, 0xBDD7, 0x0000, 0x0004, 0x2537, 0x0002, 0x0000, 0x000A, 0x2537, 0x0002, 0x0004, 0x2537,
+    0x8000, 0x0002, 0x0002, 0x8006, 0x2537, 0x2537, 0xBDD7, 0xBDD7, 0xBDD7, 0x2537, 0x0004, 0x8003,
+    0x2537, 0xBDD7, 0xBDD7,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 1028 B */
+static const daos_sprite_t sprite_jugador[4] = {
+    { 16, 16, sprite_jugador_data0 },
+    { 16, 16, sprite_jugador_data1 },
+    { 16, 16, sprite_jugador_data2 },
+    { 16, 16, sprite_jugador_data3 },
+};
+
+static const uint16_t sprite_maniqui_1_data0[148] = {
+    0x0003, 0x0002, 0x0002, 0x0000, 0x0000, 0x0009, 0x2124, 0x0000, 0x0002, 0x0000, 0x8000, 0x0005,
+    0x0000, 0x0002, 0x0000, 0x0000, 0x0003, 0xFF21, 0x0000, 0x0007, 0x2124, 0x0000, 0x0003, 0xFF21,
+    0x0000, 0x0001, 0x0000, 0x8000, 0x0005, 0x0000, 0x0004, 0x0000, 0x0000, 0x0001, 0xFF21, 0x0000,
+    0x0007, 0x2124, 0x0000, 0x0001, 0xFF21, 0x0000, 0x0003, 0x0000, 0x0001, 0x0000, 0x8010, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xFF21, 0x0000, 0x0000, 0x2124, 0x2124, 0x2124, 0x0000, 0x0000, 0xFF21,
+    0x0000, 0x0000, 0x0000, 0x8000, 0x0003, 0x0000, 0x0007, 0x0000, 0x0000, 0x0003, 0x2124, 0x0000,
+    0x0006, 0x0000, 0x0005, 0x0002, 0x0003, 0x0000, 0x0000, 0x0002, 0xFF21, 0x0000, 0x0003, 0x0000,
+    0x0000, 0x0002, 0xFF21, 0x0000, 0x0003, 0x0000, 0x8000, 0x0003, 0x0004, 0x0001, 0x2124, 0x0000,
+    0x0007, 0x0000, 0x0000, 0x0001, 0x2124, 0x8000, 0x0001, 0x0000, 0x8010, 0x0000, 0x0000, 0xFF21,
+    0xFF21, 0x2124, 0xFF21, 0xFF21, 0x2124, 0x2124, 0x2124, 0xFF21, 0xFF21, 0x2124, 0xFF21, 0xFF21,
+    0x0000, 0x0001, 0x0000, 0x8010, 0x2124, 0x2124, 0x0000, 0x0000, 0x0000, 0xFF21, 0xFF21, 0x0000,
+    0x0000, 0x0000, 0xFF21, 0xFF21, 0x0000, 0x0000, 0x0000, 0x2124, 0x8000, 0x0002, 0x0002, 0x0005,
+    0x0000, 0x0003, 0x0005, 0x0000,
+};
+static const uint16_t sprite_maniqui_1_data1[140] = {
+    0x0002, 0x0002, 0x8003, 0x2124, 0x2124, 0x0000, 0x0003, 0x0007, 0x0000, 0x8000, 0x0005, 0x0000,
+    0x0004, 0x0000, 0x0000, 0x0001, 0xFF21, 0x0002, 0x0006, 0x0000, 0x0000, 0x0002, 0xFF21, 0x0000,
+    0x0001, 0x0000, 0x8000, 0x0005, 0x0000, 0x0004, 0x0000, 0x0000, 0x0003, 0x2124, 0x0000, 0x0003,
+    0x0000, 0x0000, 0x0005, 0xFF21, 0x0000, 0x0001, 0x2124, 0x0006, 0x0000, 0x0002, 0x0000, 0x0000,
+    0x0003, 0xFF21, 0x0000, 0x0002, 0x0000, 0x0000, 0x0001, 0xFF21, 0x0000, 0x0004, 0x0000, 0x0000,
+    0x0004, 0x2124, 0x8000, 0x0004, 0x0002, 0x0002, 0x0000, 0x0000, 0x0001, 0x2124, 0x0000, 0x0003,
+    0x0000, 0x0000, 0x0008, 0x2124, 0x8000, 0x8000, 0x0006, 0x0000, 0x0002, 0x0000, 0x0000, 0x0003,
+    0xFF21, 0x0000, 0x0002, 0x0000, 0x0000, 0x0001, 0xFF21, 0x0000, 0x0004, 0x0000, 0x0000, 0x0004,
+    0x2124, 0x8000, 0x0005, 0x0000, 0x0004, 0x0000, 0x0000, 0x0003, 0x2124, 0x0000, 0x0003, 0x0000,
+    0x0000, 0x0005, 0xFF21, 0x0000, 0x0001, 0x2124, 0x0005, 0x0000, 0x0004, 0x0000, 0x0000, 0x0001,
+    0xFF21, 0x0002, 0x0006, 0x0000, 0x0000, 0x0002, 0xFF21, 0x0000, 0x0001, 0x0000, 0x8000, 0x0002,
+    0x0002, 0x8003, 0x2124, 0x2124, 0x0000, 0x0003, 0x0007, 0x0000,
+};
+static const uint16_t sprite_maniqui_1_data2[148] = {
+    0x0002, 0x0002, 0x0005, 0x0000, 0x0003, 0x0005, 0x0000, 0x8000, 0x0001, 0x0000, 0x8010, 0x2124,
+    0x2124, 0x0000, 0x0000, 0x0000, 0xFF21, 0xFF21, 0x0000, 0x0000, 0x0000, 0xFF21, 0xFF21, 0x0000,
+    0x0000, 0x0000, 0x2124, 0x8000, 0x0001, 0x0000, 0x8010, 0x0000, 0x0000, 0xFF21, 0xFF21, 0x2124,
+    0xFF21, 0xFF21, 0x2124, 0x2124, 0x2124, 0xFF21, 0xFF21, 0x2124, 0xFF21, 0xFF21, 0x0000, 0x0003,
+    0x0004, 0x0001, 0x2124, 0x0000, 0x0007, 0x0000, 0x0000, 0x0001, 0x2124, 0x8000, 0x0005, 0x0002,
+    0x0003, 0x0000, 0x0000, 0x0002, 0xFF21, 0x0000, 0x0003, 0x0000, 0x0000, 0x0002, 0xFF21, 0x0000,
+    0x0003, 0x0000, 0x0003, 0x0000, 0x0007, 0x0000, 0x0000, 0x0003, 0x2124, 0x0000, 0x0006, 0x0000,
+    0x8000, 0x0001, 0x0000, 0x8010, 0x0000, 0x0000, 0x0000, 0x0000, 0xFF21, 0x0000, 0x0000, 0x2124,
+    0x2124, 0x2124, 0x0000, 0x0000, 0xFF21, 0x0000, 0x0000, 0x0000, 0x8000, 0x0005, 0x0000, 0x0004,
+    0x0000, 0x0000, 0x0001, 0xFF21, 0x0000, 0x0007, 0x2124, 0x0000, 0x0001, 0xFF21, 0x0000, 0x0003,
+    0x0000, 0x0005, 0x0000, 0x0002, 0x0000, 0x0000, 0x0003, 0xFF21, 0x0000, 0x0007, 0x2124, 0x0000,
+    0x0003, 0xFF21, 0x0000, 0x0001, 0x0000, 0x8000, 0x0003, 0x0002, 0x0002, 0x0000, 0x0000, 0x0009,
+    0x2124, 0x0000, 0x0002, 0x0000,
+};
+static const uint16_t sprite_maniqui_1_data3[140] = {
+    0x0002, 0x0002, 0x0006, 0x0000, 0x0004, 0x8003, 0x0000, 0x2124, 0x2124, 0x8000, 0x0005, 0x0000,
+    0x0002, 0x0000, 0x0000, 0x0002, 0xFF21, 0x0000, 0x0006, 0x0000, 0x0002, 0x0001, 0xFF21, 0x0000,
+    0x0003, 0x0000, 0x8000, 0x0005, 0x0000, 0x0002, 0x2124, 0x0000, 0x0005, 0xFF21, 0x0000, 0x0003,
+    0x0000, 0x0000, 0x0003, 0x2124, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0005, 0x2124, 0x0000,
+    0x0003, 0x0000, 0x0000, 0x0002, 0xFF21, 0x0000, 0x0002, 0x0000, 0x0000, 0x0003, 0xFF21, 0x0000,
+    0x0001, 0x0000, 0x8000, 0x0004, 0x0000, 0x0008, 0x2124, 0x0000, 0x0004, 0x0000, 0x0000, 0x0001,
+    0x2124, 0x0000, 0x0002, 0x0000, 0x8000, 0x8000, 0x0006, 0x0000, 0x0005, 0x2124, 0x0000, 0x0003,
+    0x0000, 0x0000, 0x0002, 0xFF21, 0x0000, 0x0002, 0x0000, 0x0000, 0x0003, 0xFF21, 0x0000, 0x0001,
+    0x0000, 0x8000, 0x0005, 0x0000, 0x0002, 0x2124, 0x0000, 0x0005, 0xFF21, 0x0000, 0x0003, 0x0000,
+    0x0000, 0x0003, 0x2124, 0x0000, 0x0003, 0x0000, 0x0005, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002,
+    0xFF21, 0x0000, 0x0006, 0x0000, 0x0002, 0x0001, 0xFF21, 0x0000, 0x0003, 0x0000, 0x8000, 0x0002,
+    0x0002, 0x0006, 0x0000, 0x0004, 0x8003, 0x0000, 0x2124, 0x2124,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 1152 B */
+static const daos_sprite_t sprite_maniqui_1[4] = {
+    { 16, 16, sprite_maniqui_1_data0 },
+    { 16, 16, sprite_maniqui_1_data1 },
+    { 16, 16, sprite_maniqui_1_data2 },
+    { 16, 16, sprite_maniqui_1_data3 },
+};
+
+static const uint16_t sprite_maniqui_2_data0[145] = {
+    0x0003, 0x0002, 0x0002, 0x0000, 0x0000, 0x0009, 0x2124, 0x0000, 0x0002, 0x0000, 0x8000, 0x0005,
+    0x0000, 0x0002, 0x0000, 0x0000, 0x0003, 0xF800, 0x0000, 0x0007, 0x2124, 0x0000, 0x0003, 0xF800,
+    0x0000, 0x0001, 0x0000, 0x8000, 0x0005, 0x0000, 0x0004, 0x0000, 0x0000, 0x0001, 0xF800, 0x0000,
+    0x0007, 0x2124, 0x0000, 0x0001, 0xF800, 0x0000, 0x0003, 0x0000, 0x0001, 0x0000, 0x8010, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x2124, 0x2124, 0x2124, 0x0000, 0x0000, 0xF800,
+    0x0000, 0x0000, 0x0000, 0x8000, 0x0003, 0x0000, 0x0007, 0x0000, 0x0000, 0x0003, 0x2124, 0x0000,
+    0x0006, 0x0000, 0x0005, 0x0002, 0x0003, 0x0000, 0x0000, 0x0002, 0xF800, 0x0000, 0x0003, 0x0000,
+    0x0000, 0x0002, 0xF800, 0x0000, 0x0003, 0x0000, 0x8000, 0x0003, 0x0004, 0x0001, 0x2124, 0x0000,
+    0x0007, 0x0000, 0x0000, 0x0001, 0x2124, 0x8000, 0x0005, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002,
+    0xF800, 0x0000, 0x0009, 0x2124, 0x0000, 0x0002, 0xF800, 0x0000, 0x0001, 0x0000, 0x0001, 0x0000,
+    0x8010, 0x2124, 0x2124, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0xF800,
+    0xF800, 0x0000, 0x0000, 0x0000, 0x2124, 0x8000, 0x0002, 0x0002, 0x0005, 0x0000, 0x0003, 0x0005,
+    0x0000,
+};
+static const uint16_t sprite_maniqui_2_data1[140] = {
+    0x0002, 0x0002, 0x8003, 0x2124, 0x2124, 0x0000, 0x0003, 0x0007, 0x0000, 0x8000, 0x0005, 0x0000,
+    0x0004, 0x0000, 0x0000, 0x0001, 0xF800, 0x0002, 0x0006, 0x0000, 0x0000, 0x0002, 0xF800, 0x0000,
+    0x0001, 0x0000, 0x8000, 0x0005, 0x0000, 0x0004, 0x0000, 0x0000, 0x0003, 0x2124, 0x0000, 0x0003,
+    0x0000, 0x0000, 0x0005, 0xF800, 0x0000, 0x0001, 0x2124, 0x0001, 0x0000, 0x8010, 0x0000, 0x0000,
+    0xF800, 0xF800, 0x2124, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x2124,
+    0x2124, 0x2124, 0x8000, 0x0004, 0x0002, 0x0002, 0x0000, 0x0000, 0x0001, 0x2124, 0x0000, 0x0003,
+    0x0000, 0x0000, 0x0008, 0x2124, 0x8000, 0x8000, 0x0001, 0x0000, 0x8010, 0x0000, 0x0000, 0xF800,
+    0xF800, 0x2124, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x2124, 0x2124,
+    0x2124, 0x8000, 0x0005, 0x0000, 0x0004, 0x0000, 0x0000, 0x0003, 0x2124, 0x0000, 0x0003, 0x0000,
+    0x0000, 0x0005, 0xF800, 0x0000, 0x0001, 0x2124, 0x0005, 0x0000, 0x0004, 0x0000, 0x0000, 0x0001,
+    0xF800, 0x0002, 0x0006, 0x0000, 0x0000, 0x0002, 0xF800, 0x0000, 0x0001, 0x0000, 0x8000, 0x0002,
+    0x0002, 0x8003, 0x2124, 0x2124, 0x0000, 0x0003, 0x0007, 0x0000,
+};
+static const uint16_t sprite_maniqui_2_data2[145] = {
+    0x0002, 0x0002, 0x0005, 0x0000, 0x0003, 0x0005, 0x0000, 0x8000, 0x0001, 0x0000, 0x8010, 0x2124,
+    0x2124, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000,
+    0x0000, 0x0000, 0x2124, 0x8000, 0x0005, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002, 0xF800, 0x0000,
+    0x0009, 0x2124, 0x0000, 0x0002, 0xF800, 0x0000, 0x0001, 0x0000, 0x0003, 0x0004, 0x0001, 0x2124,
+    0x0000, 0x0007, 0x0000, 0x0000, 0x0001, 0x2124, 0x8000, 0x0005, 0x0002, 0x0003, 0x0000, 0x0000,
+    0x0002, 0xF800, 0x0000, 0x0003, 0x0000, 0x0000, 0x0002, 0xF800, 0x0000, 0x0003, 0x0000, 0x0003,
+    0x0000, 0x0007, 0x0000, 0x0000, 0x0003, 0x2124, 0x0000, 0x0006, 0x0000, 0x8000, 0x0001, 0x0000,
+    0x8010, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x2124, 0x2124, 0x2124, 0x0000,
+    0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x8000, 0x0005, 0x0000, 0x0004, 0x0000, 0x0000, 0x0001,
+    0xF800, 0x0000, 0x0007, 0x2124, 0x0000, 0x0001, 0xF800, 0x0000, 0x0003, 0x0000, 0x0005, 0x0000,
+    0x0002, 0x0000, 0x0000, 0x0003, 0xF800, 0x0000, 0x0007, 0x2124, 0x0000, 0x0003, 0xF800, 0x0000,
+    0x0001, 0x0000, 0x8000, 0x0003, 0x0002, 0x0002, 0x0000, 0x0000, 0x0009, 0x2124, 0x0000, 0x0002,
+    0x0000,
+};
+static const uint16_t sprite_maniqui_2_data3[140] = {
+    0x0002, 0x0002, 0x0006, 0x0000, 0x0004, 0x8003, 0x0000, 0x2124, 0x2124, 0x8000, 0x0005, 0x0000,
+    0x0002, 0x0000, 0x0000, 0x0002, 0xF800, 0x0000, 0x0006, 0x0000, 0x0002, 0x0001, 0xF800, 0x0000,
+    0x0003, 0x0000, 0x8000, 0x0005, 0x0000, 0x0002, 0x2124, 0x0000, 0x0005, 0xF800, 0x0000, 0x0003,
+    0x0000, 0x0000, 0x0003, 0x2124, 0x0000, 0x0003, 0x0000, 0x0001, 0x0000, 0x8010, 0x2124, 0x2124,
+    0x2124, 0x2124, 0x2124, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x2124, 0xF800,
+    0xF800, 0x0000, 0x8000, 0x0004, 0x0000, 0x0008, 0x2124, 0x0000, 0x0004, 0x0000, 0x0000, 0x0001,
+    0x2124, 0x0000, 0x0002, 0x0000, 0x8000, 0x8000, 0x0001, 0x0000, 0x8010, 0x2124, 0x2124, 0x2124,
+    0x2124, 0x2124, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x2124, 0xF800, 0xF800,
+    0x0000, 0x8000, 0x0005, 0x0000, 0x0002, 0x2124, 0x0000, 0x0005, 0xF800, 0x0000, 0x0003, 0x0000,
+    0x0000, 0x0003, 0x2124, 0x0000, 0x0003, 0x0000, 0x0005, 0x0000, 0x0002, 0x0000, 0x0000, 0x0002,
+    0xF800, 0x0000, 0x0006, 0x0000, 0x0002, 0x0001, 0xF800, 0x0000, 0x0003, 0x0000, 0x8000, 0x0002,
+    0x0002, 0x0006, 0x0000, 0x0004, 0x8003, 0x0000, 0x2124, 0x2124,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 1140 B */
+static const daos_sprite_t sprite_maniqui_2[4] = {
+    { 16, 16, sprite_maniqui_2_data0 },
+    { 16, 16, sprite_maniqui_2_data1 },
+    { 16, 16, sprite_maniqui_2_data2 },
+    { 16, 16, sprite_maniqui_2_data3 },
+};
+
+#endif /* SPRITES_RECONOCEDOR_H */
@@ -0,0 +1,186 @@
+/**
+ * Generado por tools/sprites.py desde assets/tanque.sprites: no editar a mano.
+ * Formato de los datos: ver daos_sprite_t en api.h.
+ */
+
+#ifndef SPRITES_TANQUE_H
+#define SPRITES_TANQUE_H
+
+#include "api.h"
+
+static const uint16_t sprite_bloque_destructible_data[184] = {
+    0x0005, 0x0000, 0x0002, 0x9982, 0x0000, 0x0006, 0x8962, 0x0000, 0x0002, 0x9982, 0x0000, 0x0003,
+    0x8962, 0x0000, 0x0003, 0x9982, 0x8000, 0x0001, 0x0000, 0x8010, 0x8962, 0x8962, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xCE79, 0xCE79, 0xCE79, 0x8962, 0x8962, 0xFFFF, 0xFFFF, 0xCE79, 0x8962, 0x8962, 0x9982,
+    0x8000, 0x0005, 0x0000, 0x0002, 0x9982, 0x0000, 0x0006, 0x8962, 0x0000, 0x0002, 0x9982, 0x0000,
+    0x0003, 0x8962, 0x0000, 0x0003, 0x9982, 0x0001, 0x0000, 0x8010, 0x8962, 0x8962, 0xFFFF, 0xFFFF,
+    0xCE79, 0x8962, 0x8962, 0xFFFF, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0x8962, 0xFFFF, 0xFFFF, 0x8962,
+    0x8000, 0x0001, 0x0000, 0x8010, 0x9982, 0x9982, 0x8962, 0x8962, 0x8962, 0x9982, 0x9982, 0x8962,
+    0x8962, 0x8962, 0x8962, 0x8962, 0x9982, 0x8962, 0x8962, 0x9982, 0x0005, 0x0000, 0x0002, 0x9982,
+    0x0000, 0x0006, 0x8962, 0x0000, 0x0002, 0x9982, 0x0000, 0x0005, 0x8962, 0x0000, 0x0001, 0x9982,
+    0x8000, 0x0001, 0x0000, 0x8010, 0x8962, 0x8962, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0xCE79, 0xCE79,
+    0x8962, 0x8962, 0xFFFF, 0xFFFF, 0xCE79, 0xCE79, 0xCE79, 0x8962, 0x8000, 0x0005, 0x0000, 0x0002,
+    0x9982, 0x0000, 0x0006, 0x8962, 0x0000, 0x0002, 0x9982, 0x0000, 0x0005, 0x8962, 0x0000, 0x0001,
+    0x9982, 0x0001, 0x0000, 0x8010, 0x8962, 0x8962, 0xFFFF, 0xFFFF, 0xCE79, 0x8962, 0x8962, 0xFFFF,
+    0xCE79, 0xCE79, 0x8962, 0x8962, 0xFFFF, 0xCE79, 0xCE79, 0x8962, 0x8000, 0x0001, 0x0000, 0x8010,
+    0x9982, 0x9982, 0x8962, 0x8962, 0x8962, 0x9982, 0x9982, 0x8962, 0x8962, 0x8962, 0x9982, 0x9982,
+    0x8962, 0x8962, 0x8962, 0x9982,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 368 B */
+static const daos_sprite_t sprite_bloque_destructible = { 16, 16, sprite_bloque_destructible_data };
+
+static const uint16_t sprite_bloque_acero_data[133] = {
+    0x0001, 0x0000, 0x0010, 0x7BCF, 0x8000, 0x0001, 0x0000, 0x8010, 0x7BCF, 0x7BCF, 0xAD75, 0xAD75,
+    0x4A48, 0x4A48, 0x4A48, 0x7BCF, 0x7BCF, 0x7BCF, 0xAD75, 0xAD75, 0x4A48, 0x4A48, 0x4A48, 0x7BCF,
+    0x8000, 0x0001, 0x0000, 0x8010, 0x7BCF, 0x7BCF, 0x4A48, 0x4A48, 0xAD75, 0x4A48, 0x4A48, 0x7BCF,
+    0x7BCF, 0x7BCF, 0x4A48, 0x4A48, 0xAD75, 0x4A48, 0x4A48, 0x7BCF, 0x8000, 0x8000, 0x0001, 0x0000,
+    0x8010, 0x7BCF, 0x7BCF, 0x4A48, 0x4A48, 0x4A48, 0xAD75, 0xAD75, 0x7BCF, 0x7BCF, 0x7BCF, 0x4A48,
+    0x4A48, 0x4A48, 0xAD75, 0xAD75, 0x7BCF, 0x0001, 0x0000, 0x0010, 0x7BCF, 0x8000, 0x0001, 0x0000,
+    0x8010, 0x7BCF, 0x7BCF, 0xAD75, 0xAD75, 0x4A48, 0x4A48, 0x4A48, 0x7BCF, 0x7BCF, 0x7BCF, 0xAD75,
+    0xAD75, 0x4A48, 0x4A48, 0x4A48, 0x7BCF, 0x8000, 0x0001, 0x0000, 0x8010, 0x7BCF, 0x7BCF, 0x4A48,
+    0x4A48, 0xAD75, 0x4A48, 0x4A48, 0x7BCF, 0x7BCF, 0x7BCF, 0x4A48, 0x4A48, 0xAD75, 0x4A48, 0x4A48,
+    0x7BCF, 0x0001, 0x0000, 0x8010, 0x7BCF, 0x7BCF, 0x4A48, 0x4A48, 0x4A48, 0xAD75, 0xAD75, 0x7BCF,
+    0x7BCF, 0x7BCF, 0x4A48, 0x4A48, 0x4A48, 0xAD75, 0xAD75, 0x7BCF, 0x8000, 0x0001, 0x0000, 0x0010,
+    0x7BCF,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 266 B */
+static const daos_sprite_t sprite_bloque_acero = { 16, 16, sprite_bloque_acero_data };
+
+static const uint16_t sprite_planta_data[141] = {
+    0x0003, 0x0002, 0x8003, 0x1C45, 0x1C45, 0x2D67, 0x0003, 0x0002, 0x1C45, 0x0002, 0x0001, 0x1C45,
+    0x8000, 0x0002, 0x0004, 0x8003, 0x2D67, 0x766F, 0x766F, 0x0001, 0x8008, 0x766F, 0x766F, 0x2D67,
+    0x2D67, 0x2D67, 0x766F, 0x766F, 0x1C45, 0x8000, 0x0004, 0x0000, 0x0002, 0x2D67, 0x0003, 0x0002,
+    0x1C45, 0x0000, 0x0003, 0x2D67, 0x0002, 0x0001, 0x1C45, 0x0003, 0x0002, 0x8005, 0x766F, 0x766F,
+    0x1C45, 0x2D67, 0x2D67, 0x0003, 0x0002, 0x2D67, 0x0001, 0x8003, 0x766F, 0x766F, 0x1C45, 0x8000,
+    0x0003, 0x0000, 0x0002, 0x766F, 0x0003, 0x0005, 0x2D67, 0x0002, 0x0001, 0x766F, 0x0004, 0x0000,
+    0x8005, 0x1C45, 0x1C45, 0x2D67, 0x2D67, 0x1C45, 0x0003, 0x0002, 0x2D67, 0x0002, 0x0001, 0x1C45,
+    0x0002, 0x0001, 0x1C45, 0x8000, 0x0003, 0x0002, 0x0002, 0x1C45, 0x0003, 0x0005, 0x2D67, 0x0001,
+    0x0002, 0x2D67, 0x8000, 0x0004, 0x0000, 0x0002, 0x2D67, 0x0002, 0x0003, 0x2D67, 0x0001, 0x0002,
+    0x766F, 0x0003, 0x0002, 0x766F, 0x0003, 0x0000, 0x0004, 0x2D67, 0x0001, 0x0002, 0x2D67, 0x0001,
+    0x8007, 0x1C45, 0x1C45, 0x2D67, 0x2D67, 0x766F, 0x1C45, 0x1C45, 0x8000, 0x0003, 0x0005, 0x8003,
+    0x766F, 0x766F, 0x1C45, 0x0002, 0x0002, 0x2D67, 0x0003, 0x0001, 0x1C45,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 282 B */
+static const daos_sprite_t sprite_planta = { 16, 16, sprite_planta_data };
+
+static const uint16_t sprite_tanque_azul_data0[130] = {
+    0x0001, 0x0007, 0x0003, 0x4253, 0x8000, 0x0003, 0x0000, 0x0004, 0x5AF9, 0x0003, 0x0003, 0x4253,
+    0x0003, 0x0003, 0x5AF9, 0x8000, 0x0005, 0x0000, 0x0004, 0x1913, 0x0000, 0x0001, 0x10EC, 0x0002,
+    0x0003, 0x4253, 0x0002, 0x0001, 0x10EC, 0x0000, 0x0003, 0x1913, 0x0003, 0x0000, 0x0004, 0x5AF9,
+    0x0000, 0x0009, 0x10EC, 0x0000, 0x0003, 0x5AF9, 0x8000, 0x0005, 0x0000, 0x0004, 0x1913, 0x0000,
+    0x0003, 0x10EC, 0x0000, 0x0003, 0x2990, 0x0000, 0x0003, 0x10EC, 0x0000, 0x0003, 0x1913, 0x0005,
+    0x0000, 0x0004, 0x5AF9, 0x0000, 0x0001, 0x10EC, 0x0000, 0x0007, 0x2990, 0x0000, 0x0001, 0x10EC,
+    0x0000, 0x0003, 0x5AF9, 0x8000, 0x0005, 0x0000, 0x0004, 0x1913, 0x0000, 0x0003, 0x10EC, 0x0000,
+    0x0003, 0x2990, 0x0000, 0x0003, 0x10EC, 0x0000, 0x0003, 0x1913, 0x8000, 0x0005, 0x0000, 0x0004,
+    0x5AF9, 0x0000, 0x0001, 0x4209, 0x0000, 0x0007, 0x10EC, 0x0000, 0x0001, 0x4209, 0x0000, 0x0003,
+    0x5AF9, 0x0005, 0x0000, 0x0004, 0x1913, 0x0000, 0x0003, 0x4209, 0x0000, 0x0003, 0x10EC, 0x0000,
+    0x0003, 0x4209, 0x0000, 0x0003, 0x1913, 0x8000, 0x0001, 0x0004, 0x0009, 0x4209,
+};
+static const uint16_t sprite_tanque_azul_data1[97] = {
+    0x0001, 0x0002, 0x800D, 0x1913, 0x1913, 0x5AF9, 0x1913, 0x1913, 0x5AF9, 0x1913, 0x1913, 0x5AF9,
+    0x5AF9, 0x1913, 0x5AF9, 0x5AF9, 0x8000, 0x8000, 0x8000, 0x0002, 0x0000, 0x0005, 0x4209, 0x0000,
+    0x0008, 0x10EC, 0x0004, 0x0000, 0x0004, 0x4209, 0x0000, 0x0003, 0x10EC, 0x0000, 0x0001, 0x2990,
+    0x0000, 0x0004, 0x10EC, 0x8000, 0x0005, 0x0000, 0x0002, 0x4209, 0x0000, 0x0003, 0x10EC, 0x0000,
+    0x0005, 0x2990, 0x0000, 0x0002, 0x10EC, 0x0000, 0x0004, 0x4253, 0x8000, 0x8000, 0x0004, 0x0000,
+    0x0004, 0x4209, 0x0000, 0x0003, 0x10EC, 0x0000, 0x0001, 0x2990, 0x0000, 0x0004, 0x10EC, 0x8000,
+    0x0002, 0x0000, 0x0005, 0x4209, 0x0000, 0x0008, 0x10EC, 0x0001, 0x0002, 0x800D, 0x1913, 0x1913,
+    0x5AF9, 0x1913, 0x1913, 0x5AF9, 0x1913, 0x1913, 0x5AF9, 0x5AF9, 0x1913, 0x5AF9, 0x5AF9, 0x8000,
+    0x8000,
+};
+static const uint16_t sprite_tanque_azul_data2[130] = {
+    0x0001, 0x0004, 0x0009, 0x4209, 0x8000, 0x0005, 0x0000, 0x0004, 0x1913, 0x0000, 0x0003, 0x4209,
+    0x0000, 0x0003, 0x10EC, 0x0000, 0x0003, 0x4209, 0x0000, 0x0003, 0x1913, 0x8000, 0x0005, 0x0000,
+    0x0004, 0x5AF9, 0x0000, 0x0001, 0x4209, 0x0000, 0x0007, 0x10EC, 0x0000, 0x0001, 0x4209, 0x0000,
+    0x0003, 0x5AF9, 0x0005, 0x0000, 0x0004, 0x1913, 0x0000, 0x0003, 0x10EC, 0x0000, 0x0003, 0x2990,
+    0x0000, 0x0003, 0x10EC, 0x0000, 0x0003, 0x1913, 0x8000, 0x0005, 0x0000, 0x0004, 0x5AF9, 0x0000,
+    0x0001, 0x10EC, 0x0000, 0x0007, 0x2990, 0x0000, 0x0001, 0x10EC, 0x0000, 0x0003, 0x5AF9, 0x0005,
+    0x0000, 0x0004, 0x1913, 0x0000, 0x0003, 0x10EC, 0x0000, 0x0003, 0x2990, 0x0000, 0x0003, 0x10EC,
+    0x0000, 0x0003, 0x1913, 0x8000, 0x0003, 0x0000, 0x0004, 0x5AF9, 0x0000, 0x0009, 0x10EC, 0x0000,
+    0x0003, 0x5AF9, 0x8000, 0x0005, 0x0000, 0x0004, 0x1913, 0x0000, 0x0001, 0x10EC, 0x0002, 0x0003,
+    0x4253, 0x0002, 0x0001, 0x10EC, 0x0000, 0x0003, 0x1913, 0x0003, 0x0000, 0x0004, 0x5AF9, 0x0003,
+    0x0003, 0x4253, 0x0003, 0x0003, 0x5AF9, 0x8000, 0x0001, 0x0007, 0x0003, 0x4253,
+};
+static const uint16_t sprite_tanque_azul_data3[97] = {
+    0x0001, 0x0002, 0x800D, 0x5AF9, 0x5AF9, 0x1913, 0x5AF9, 0x5AF9, 0x1913, 0x5AF9, 0x5AF9, 0x1913,
+    0x1913, 0x5AF9, 0x1913, 0x1913, 0x8000, 0x8000, 0x8000, 0x0002, 0x0004, 0x0008, 0x10EC, 0x0000,
+    0x0004, 0x4209, 0x0004, 0x0005, 0x0003, 0x10EC, 0x0000, 0x0002, 0x2990, 0x0000, 0x0003, 0x10EC,
+    0x0000, 0x0003, 0x4209, 0x8000, 0x0005, 0x0000, 0x0005, 0x4253, 0x0000, 0x0002, 0x10EC, 0x0000,
+    0x0005, 0x2990, 0x0000, 0x0003, 0x10EC, 0x0000, 0x0001, 0x4209, 0x8000, 0x8000, 0x0004, 0x0005,
+    0x0003, 0x10EC, 0x0000, 0x0002, 0x2990, 0x0000, 0x0003, 0x10EC, 0x0000, 0x0003, 0x4209, 0x8000,
+    0x0002, 0x0004, 0x0008, 0x10EC, 0x0000, 0x0004, 0x4209, 0x0001, 0x0002, 0x800D, 0x5AF9, 0x5AF9,
+    0x1913, 0x5AF9, 0x5AF9, 0x1913, 0x5AF9, 0x5AF9, 0x1913, 0x1913, 0x5AF9, 0x1913, 0x1913, 0x8000,
+    0x8000,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 908 B */
+static const daos_sprite_t sprite_tanque_azul[4] = {
+    { 16, 16, sprite_tanque_azul_data0 },
+    { 16, 16, sprite_tanque_azul_data1 },
+    { 16, 16, sprite_tanque_azul_data2 },
+    { 16, 16, sprite_tanque_azul_data3 },
+};
+
+static const uint16_t sprite_tanque_rojo_data0[145] = {
+    0x0002, 0x0005, 0x0002, 0xB0E3, 0x0003, 0x0002, 0xB0E3, 0x8000, 0x0003, 0x0000, 0x0002, 0xE904,
+    0x0005, 0x0003, 0xB0E3, 0x0005, 0x0001, 0xE904, 0x8000, 0x0003, 0x0000, 0x0004, 0xE904, 0x0003,
+    0x0003, 0xB0E3, 0x0003, 0x0003, 0xE904, 0x0005, 0x0000, 0x0004, 0xB965, 0x0000, 0x0001, 0xAA28,
+    0x0002, 0x0003, 0xB0E3, 0x0002, 0x0001, 0xAA28, 0x0000, 0x0003, 0xB965, 0x8000, 0x0006, 0x0000,
+    0x0004, 0xE904, 0x0000, 0x0001, 0xAA28, 0x0000, 0x0002, 0xB965, 0x0000, 0x0003, 0xB0E3, 0x0000,
+    0x0003, 0xAA28, 0x0000, 0x0003, 0xE904, 0x0006, 0x0000, 0x0004, 0xB965, 0x0000, 0x0001, 0xAA28,
+    0x0000, 0x0002, 0xB965, 0x0000, 0x0003, 0x9B6D, 0x0000, 0x0003, 0xAA28, 0x0000, 0x0003, 0xB965,
+    0x8000, 0x0005, 0x0000, 0x0004, 0xE904, 0x0000, 0x0001, 0xAA28, 0x0000, 0x0007, 0x9B6D, 0x0000,
+    0x0001, 0xAA28, 0x0000, 0x0003, 0xE904, 0x8000, 0x0006, 0x0000, 0x0004, 0xB965, 0x0000, 0x0003,
+    0xAA28, 0x0000, 0x0003, 0x9B6D, 0x0000, 0x0002, 0xB965, 0x0000, 0x0001, 0xAA28, 0x0000, 0x0003,
+    0xB965, 0x0006, 0x0000, 0x0004, 0xE904, 0x0000, 0x0001, 0x52AA, 0x0000, 0x0002, 0xAA28, 0x0000,
+    0x0005, 0xB965, 0x0000, 0x0001, 0x52AA, 0x0000, 0x0003, 0xE904, 0x8000, 0x0001, 0x0004, 0x0009,
+    0x52AA,
+};
+static const uint16_t sprite_tanque_rojo_data1[126] = {
+    0x0001, 0x0002, 0x800D, 0xE904, 0xE904, 0xB965, 0xE904, 0xE904, 0xB965, 0xE904, 0xE904, 0xB965,
+    0xB965, 0xE904, 0xE904, 0xE904, 0x8000, 0x0001, 0x0002, 0x800B, 0xE904, 0xE904, 0xB965, 0xE904,
+    0xE904, 0xB965, 0xE904, 0xE904, 0xB965, 0xB965, 0xE904, 0x8000, 0x0002, 0x0000, 0x0004, 0x52AA,
+    0x0000, 0x0008, 0xAA28, 0x0005, 0x0000, 0x0002, 0x52AA, 0x0000, 0x0003, 0xAA28, 0x0000, 0x0002,
+    0x9B6D, 0x0000, 0x0003, 0xB965, 0x0005, 0x0001, 0xB0E3, 0x8000, 0x0004, 0x0000, 0x0002, 0x52AA,
+    0x0000, 0x0002, 0xB965, 0x0000, 0x0004, 0x9B6D, 0x0000, 0x0007, 0xB0E3, 0x8000, 0x8000, 0x0005,
+    0x0000, 0x0002, 0x52AA, 0x0000, 0x0003, 0xB965, 0x0000, 0x0002, 0x9B6D, 0x0000, 0x0003, 0xAA28,
+    0x0005, 0x0001, 0xB0E3, 0x8000, 0x0002, 0x0000, 0x0004, 0x52AA, 0x0000, 0x0008, 0xAA28, 0x0001,
+    0x0002, 0x800B, 0xE904, 0xE904, 0xB965, 0xE904, 0xE904, 0xB965, 0xE904, 0xE904, 0xB965, 0xB965,
+    0xE904, 0x8000, 0x0001, 0x0002, 0x800D, 0xE904, 0xE904, 0xB965, 0xE904, 0xE904, 0xB965, 0xE904,
+    0xE904, 0xB965, 0xB965, 0xE904, 0xE904, 0xE904,
+};
+static const uint16_t sprite_tanque_rojo_data2[145] = {
+    0x0001, 0x0004, 0x0009, 0x52AA, 0x8000, 0x0006, 0x0000, 0x0004, 0xE904, 0x0000, 0x0001, 0x52AA,
+    0x0000, 0x0005, 0xB965, 0x0000, 0x0002, 0xAA28, 0x0000, 0x0001, 0x52AA, 0x0000, 0x0003, 0xE904,
+    0x8000, 0x0006, 0x0000, 0x0004, 0xB965, 0x0000, 0x0001, 0xAA28, 0x0000, 0x0002, 0xB965, 0x0000,
+    0x0003, 0x9B6D, 0x0000, 0x0003, 0xAA28, 0x0000, 0x0003, 0xB965, 0x0005, 0x0000, 0x0004, 0xE904,
+    0x0000, 0x0001, 0xAA28, 0x0000, 0x0007, 0x9B6D, 0x0000, 0x0001, 0xAA28, 0x0000, 0x0003, 0xE904,
+    0x8000, 0x0006, 0x0000, 0x0004, 0xB965, 0x0000, 0x0003, 0xAA28, 0x0000, 0x0003, 0x9B6D, 0x0000,
+    0x0002, 0xB965, 0x0000, 0x0001, 0xAA28, 0x0000, 0x0003, 0xB965, 0x0006, 0x0000, 0x0004, 0xE904,
+    0x0000, 0x0003, 0xAA28, 0x0000, 0x0003, 0xB0E3, 0x0000, 0x0002, 0xB965, 0x0000, 0x0001, 0xAA28,
+    0x0000, 0x0003, 0xE904, 0x8000, 0x0005, 0x0000, 0x0004, 0xB965, 0x0000, 0x0001, 0xAA28, 0x0002,
+    0x0003, 0xB0E3, 0x0002, 0x0001, 0xAA28, 0x0000, 0x0003, 0xB965, 0x8000, 0x0003, 0x0000, 0x0004,
+    0xE904, 0x0003, 0x0003, 0xB0E3, 0x0003, 0x0003, 0xE904, 0x0003, 0x0000, 0x0002, 0xE904, 0x0005,
+    0x0003, 0xB0E3, 0x0005, 0x0001, 0xE904, 0x8000, 0x0002, 0x0005, 0x0002, 0xB0E3, 0x0003, 0x0002,
+    0xB0E3,
+};
+static const uint16_t sprite_tanque_rojo_data3[124] = {
+    0x0001, 0x0002, 0x800D, 0xE904, 0xE904, 0xE904, 0xB965, 0xB965, 0xE904, 0xB965, 0xB965, 0xE904,
+    0xE904, 0xB965, 0xE904, 0xE904, 0x8000, 0x0001, 0x0004, 0x800B, 0xE904, 0xB965, 0xB965, 0xE904,
+    0xB965, 0xB965, 0xE904, 0xE904, 0xB965, 0xE904, 0xE904, 0x8000, 0x0002, 0x0005, 0x0008, 0xAA28,
+    0x0000, 0x0003, 0x52AA, 0x0002, 0x0000, 0x0002, 0xB0E3, 0x0005, 0x8009, 0xAA28, 0xAA28, 0xAA28,
+    0x9B6D, 0x9B6D, 0xB965, 0xB965, 0xB965, 0x52AA, 0x8000, 0x0004, 0x0002, 0x0006, 0xB0E3, 0x0000,
+    0x0005, 0x9B6D, 0x0000, 0x0002, 0xB965, 0x0000, 0x0001, 0x52AA, 0x8000, 0x8000, 0x0002, 0x0000,
+    0x0002, 0xB0E3, 0x0005, 0x8009, 0xB965, 0xB965, 0xB965, 0x9B6D, 0x9B6D, 0xAA28, 0xAA28, 0xAA28,
+    0x52AA, 0x8000, 0x0002, 0x0005, 0x0008, 0xAA28, 0x0000, 0x0003, 0x52AA, 0x0001, 0x0004, 0x800B,
+    0xE904, 0xB965, 0xB965, 0xE904, 0xB965, 0xB965, 0xE904, 0xE904, 0xB965, 0xE904, 0xE904, 0x8000,
+    0x0001, 0x0002, 0x800D, 0xE904, 0xE904, 0xE904, 0xB965, 0xB965, 0xE904, 0xB965, 0xB965, 0xE904,
+    0xE904, 0xB965, 0xE904, 0xE904,
+};
+/* 10x10 -> 16x16: 400 B ARGB8888 -> 1080 B */
+static const daos_sprite_t sprite_tanque_rojo[4] = {
+    { 16, 16, sprite_tanque_rojo_data0 },
+    { 16, 16, sprite_tanque_rojo_data1 },
+    { 16, 16, sprite_tanque_rojo_data2 },
+    { 16, 16, sprite_tanque_rojo_data3 },
+};
+
+#endif /* SPRITES_TANQUE_H */
@@ -72,6 +72,12 @@ int sem_wait(sem_t *s);
  */
 void sem_post(sem_t *s);
 
+/**
+ * Libera un recurso desde una interrupción (fin de DMA, etc.).
+ * No toca prioridades ni fuerza un cambio de tarea.
+ */
+void sem_post_isr(sem_t *s);
+
 /**
  * Intenta adquirir recurso sin aplicar herencia ni bloquear.
  * @return 1 si adquirido, 0 si no disponible.
@@ -0,0 +1,201 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - VFS (Virtual File System)
+ * ============================================================================
+ * Capa única sobre los sistemas de archivos del sistema. Cada backend se
+ * monta bajo un prefijo y expone una tabla de operaciones (vfs_ops_t):
+ *
+ *   /ram  -> RAMFS (montaje por defecto: "hola.txt" == "/ram/hola.txt")
+ *   /rom  -> fs.c (almacén heredado, solo lectura)
+ *   /sd   -> tarjeta SD (FAT32, fat.c)
+ *
+ * Todas las aplicaciones comparten una sola tabla de descriptores; una
+ * lectura o escritura cuesta una sola llamada indirecta al backend.
+ * Los archivos cerrados en modo lectura se guardan en una caché de
+ * archivos abiertos para que reabrirlos no repita la búsqueda del backend.
+ * ============================================================================
+ */
+
+#ifndef VFS_H // Guarda de inclusión para el VFS
+#define VFS_H
+
+#pragma once
+#include <stdint.h>
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Máximo de sistemas de archivos montados. */
+#define VFS_MAX_MOUNTS 4
+/** Máximo de descriptores abiertos (archivos y directorios). */
+#define VFS_MAX_FDS 8
+/** Longitud máxima de una ruta completa (incluye el prefijo de montaje). */
+#define VFS_MAX_PATH 64
+/** Longitud máxima del prefijo de montaje ("/ram"). */
+#define VFS_MAX_PREFIX 8
+/** Longitud máxima del nombre de una entrada de directorio. */
+#define VFS_MAX_NAME 32
+/** Archivos de solo lectura que se mantienen abiertos tras cerrarlos. */
+#define VFS_CACHE_SIZE 4
+
+/* ========================================================================== */
+/* MODOS DE APERTURA                                 */
+/* ========================================================================== */
+/* Mismos valores que RAMFS_O_*: el backend de RAMFS no necesita traducirlos. */
+
+#define VFS_O_RDONLY  0x01
+#define VFS_O_WRONLY  0x02
+#define VFS_O_RDWR    0x03
+#define VFS_O_CREAT   0x04
+#define VFS_O_TRUNC   0x08
+#define VFS_O_APPEND  0x10
+
+/** Origen de vfs_seek (mismos valores que SEEK_*). */
+#define VFS_SEEK_SET  0
+#define VFS_SEEK_CUR  1
+#define VFS_SEEK_END  2
+
+/* ========================================================================== */
+/* TIPOS                                             */
+/* ========================================================================== */
+
+/** Entrada de directorio. */
+typedef struct {
+    char name[VFS_MAX_NAME];  /** Nombre de la entrada (sin ruta). */
+    uint8_t is_dir;           /** 1 si es un directorio. */
+    uint32_t size;            /** Tamaño en bytes (0 para directorios). */
+} vfs_dirent_t;
+
+/** Información de una ruta. */
+typedef struct {
+    uint8_t is_dir;           /** 1 si es un directorio. */
+    uint32_t size;            /** Tamaño en bytes. */
+} vfs_stat_t;
+
+/**
+ * Operaciones de un backend.
+ * Las rutas llegan relativas al punto de montaje y siempre empiezan con '/'.
+ * Los handles son enteros propios del backend (>= 0). Cualquier operación
+ * puede ser NULL si el backend no la soporta (el VFS devuelve -1).
+ */
+typedef struct vfs_ops {
+    const char* name;         /** Nombre del backend (para diagnóstico). */
+    int (*open)(void* ctx, const char* path, int flags);
+    int (*read)(void* ctx, int h, void* buf, uint32_t n);
+    int (*write)(void* ctx, int h, const void* buf, uint32_t n);
+    int (*seek)(void* ctx, int h, int offset, int whence);
+    int (*close)(void* ctx, int h);
+    int (*opendir)(void* ctx, const char* path);
+    int (*readdir)(void* ctx, int h, vfs_dirent_t* ent);
+    int (*closedir)(void* ctx, int h);
+    int (*stat)(void* ctx, const char* path, vfs_stat_t* st);
+    int (*unlink)(void* ctx, const char* path);
+    int (*mkdir)(void* ctx, const char* path);
+    int (*rmdir)(void* ctx, const char* path);
+    int (*rename)(void* ctx, const char* old_path, const char* new_path);
+} vfs_ops_t;
+
+/** Estadísticas del VFS. */
+typedef struct {
+    uint32_t cache_hits;      /** Aperturas servidas por la caché de archivos. */
+    uint32_t cache_misses;    /** Aperturas de lectura que llegaron al backend. */
+    uint8_t open_fds;         /** Descriptores en uso. */
+    uint8_t cached;           /** Archivos retenidos en la caché. */
+    uint8_t mounts;           /** Sistemas de archivos montados. */
+} vfs_stats_t;
+
+/* ========================================================================== */
+/* BACKENDS                                          */
+/* ========================================================================== */
+
+extern const vfs_ops_t vfs_ramfs_ops;  /** RAMFS (Src/vfs_ramfs.c). */
+extern const vfs_ops_t vfs_rom_ops;    /** fs.c (Src/vfs_rom.c). */
+extern const vfs_ops_t vfs_sd_ops;     /** Tarjeta SD, FAT32 (Src/vfs_sd.c). */
+
+/* ========================================================================== */
+/* MONTAJE                                           */
+/* ========================================================================== */
+
+/**
+ * Inicializar el VFS y montar /ram (por defecto), /rom y /sd.
+ */
+void vfs_init(void);
+
+/**
+ * Montar un backend bajo un prefijo.
+ * @param prefix Prefijo absoluto de un componente ("/ram").
+ * @param ops Operaciones del backend.
+ * @param ctx Contexto que recibe cada operación.
+ * @return 0 si OK, -1 si la tabla está llena o el prefijo ya existe.
+ */
+int vfs_mount(const char* prefix, const vfs_ops_t* ops, void* ctx);
+
+/**
+ * Desmontar un backend. Falla si tiene descriptores abiertos.
+ * @return 0 si OK, -1 si error.
+ */
+int vfs_umount(const char* prefix);
+
+/* ========================================================================== */
+/* ARCHIVOS                                          */
+/* ========================================================================== */
+
+/**
+ * Abrir un archivo.
+ * @param path Ruta absoluta o relativa al montaje por defecto.
+ * @param flags VFS_O_*.
+ * @return Descriptor (>= 0) o -1 si error.
+ */
+int vfs_open(const char* path, int flags);
+int vfs_read(int fd, void* buf, uint32_t n);
+int vfs_write(int fd, const void* buf, uint32_t n);
+int vfs_seek(int fd, int offset, int whence);
+int vfs_close(int fd);
+
+/** @return 0 si OK, -1 si no existe. */
+int vfs_stat(const char* path, vfs_stat_t* st);
+int vfs_unlink(const char* path);
+int vfs_mkdir(const char* path);
+int vfs_rmdir(const char* path);
+
+/**
+ * Renombrar o mover. Entre backends distintos copia y luego borra el origen.
+ * @return 0 si OK, -1 si error.
+ */
+int vfs_rename(const char* old_path, const char* new_path);
+
+/**
+ * Copiar un archivo (puede cruzar backends).
+ * @return Bytes copiados, o -1 si error.
+ */
+int vfs_copy(const char* src, const char* dst);
+
+/* ========================================================================== */
+/* DIRECTORIOS                                       */
+/* ========================================================================== */
+
+/**
+ * Abrir un directorio. "/" lista los puntos de montaje y después el
+ * contenido del montaje por defecto.
+ * @return Descriptor o -1 si error.
+ */
+int vfs_opendir(const char* path);
+
+/** @return 1 si hay entrada, 0 al final, -1 si error. */
+int vfs_readdir(int fd, vfs_dirent_t* ent);
+int vfs_closedir(int fd);
+
+/* ========================================================================== */
+/* DIAGNÓSTICO                                       */
+/* ========================================================================== */
+
+/**
+ * Cerrar los archivos retenidos en la caché (antes de desmontar o borrar
+ * fuera del VFS).
+ */
+void vfs_cache_flush(void);
+
+void vfs_get_stats(vfs_stats_t* stats);
+
+#endif /* VFS_H */
@@ -0,0 +1,121 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Ritmo de cuadros alineado al refresco del panel
+ * ============================================================================
+ * El ILI9341 relee su memoria unas 70 veces por segundo, línea a línea. Si
+ * un juego envía el cuadro mientras el barrido pasa por la zona que está
+ * cambiando, el panel muestra media imagen vieja y media nueva (tearing),
+ * y como cada juego duerme lo que quiere, el corte cae en un sitio distinto
+ * en cada cuadro.
+ *
+ * vsync_present espera al comienzo del próximo barrido para enviar el
+ * cuadro, y devuelve cuánto debe dormir la tarea para que el siguiente
+ * cuadro esté listo justo antes del refresco que le toca. El refresco se
+ * conoce, de mejor a peor, por:
+ *
+ * - TE: el pin de tearing effect del panel (PANTALLA_TE_PIN), cuya
+ *   interrupción marca cada comienzo de barrido y mide el periodo.
+ * - Línea: el comando Get Scanline (0x45) del panel, leído cada
+ *   VSYNC_RESYNC_MS. Dos lecturas corrigen también el periodo.
+ * - Reloj: sin TE ni lectura (el módulo no tiene el MISO cableado), solo
+ *   el periodo nominal. El ritmo es estable, pero el corte queda en un
+ *   sitio fijo y desconocido de la pantalla.
+ *
+ * El tiempo se cuenta en ciclos del DWT (16 por microsegundo). La lógica no
+ * toca el hardware fuera de vsync_clock y pantalla_get_scanline: en el
+ * host (DAOS_HOST) la prueba los implementa con un panel simulado.
+ * ============================================================================
+ */
+
+#ifndef VSYNC_H // Guarda de inclusión para el ritmo de cuadros
+#define VSYNC_H
+
+#pragma once
+#include <stdint.h>
+
+/* ========================================================================== */
+/* CONFIGURACIÓN                                     */
+/* ========================================================================== */
+
+/** Periodo nominal del panel: 70 Hz (FRMCTR1 por defecto). */
+#define VSYNC_PERIOD_US 14286
+/** Líneas de un barrido: 320 visibles más los porches (VFP y VBP de 2). */
+#define VSYNC_LINES 324
+/** Cada cuánto se vuelve a leer la línea del panel sin TE. */
+#define VSYNC_RESYNC_MS 100
+/** La tarea despierta este margen antes de lo que suele tardar en dibujar. */
+#define VSYNC_MARGIN_US 1000
+
+/** De dónde sale el comienzo de cada barrido. */
+typedef enum {
+    VSYNC_SRC_CLOCK = 0,      /** Periodo nominal, sin fase conocida. */
+    VSYNC_SRC_SCANLINE,       /** Lectura de la línea del panel. */
+    VSYNC_SRC_TE              /** Interrupción del pin TE. */
+} vsync_source_t;
+
+/** Contadores del ritmo de cuadros. */
+typedef struct {
+    uint32_t frames;          /** Cuadros presentados. */
+    uint32_t dropped;         /** Cuadros que no llegaron al refresco que les tocaba. */
+    uint32_t deferred;        /** Cuadros que llegaron pronto y se aplazaron (ver vsync_present). */
+    uint32_t torn;            /** Envíos más largos que un barrido (el panel los alcanzó). */
+    uint32_t latency_total_us; /** Espera total desde present hasta el refresco. */
+    uint32_t latency_max_us;  /** Espera más larga. */
+    uint32_t flush_total_us;  /** Tiempo total enviando cuadros. */
+    uint32_t period_us;       /** Periodo del panel (medido con TE o línea). */
+    uint8_t source;           /** vsync_source_t. */
+} vsync_stats_t;
+
+/** Envía el cuadro (daos_gfx vacía la lista y cierra el compositor). */
+typedef void (*vsync_flush_fn)(void);
+
+/* ========================================================================== */
+/* API                                               */
+/* ========================================================================== */
+
+/** Vuelve al periodo nominal y sin fase; borra los contadores. */
+void vsync_init(void);
+
+/** @return Ciclos del DWT (en el host, los de la prueba). */
+uint32_t vsync_clock(void);
+
+/**
+ * Presentar un cuadro: esperar al comienzo del próximo barrido y llamar a
+ * flush. Si flush es NULL no hay nada que enviar: no se espera y solo se
+ * mantiene el ritmo.
+ * La espera activa es como mucho VSYNC_MARGIN_US (más el redondeo a ms).
+ * Si el barrido queda más lejos, no envía nada: retorna los ms a dormir y
+ * vsync_pending() vale 1 hasta que otra llamada envíe el cuadro.
+ * @param interval_ms Cada cuánto quiere dibujar el juego (se redondea a
+ *        refrescos enteros, al menos uno).
+ * @return Milisegundos que la tarea debe dormir antes de dibujar el
+ *         siguiente cuadro (o, con vsync_pending, antes de volver a llamar).
+ */
+uint32_t vsync_present(uint32_t interval_ms, vsync_flush_fn flush);
+
+/** @return 1 si el último vsync_present aplazó el envío del cuadro. */
+uint8_t vsync_pending(void);
+
+/**
+ * Comienzo de barrido observado en el pin TE (desde su interrupción).
+ * @param now Ciclos (vsync_clock) del flanco.
+ */
+void vsync_te_edge(uint32_t now);
+
+/**
+ * Línea del panel leída en el instante now. Sin TE, fija la fase y, con
+ * una lectura anterior, corrige el periodo.
+ */
+void vsync_scanline(uint32_t now, uint16_t line);
+
+/** @return Ciclos en que empieza el primer barrido a partir de now. */
+uint32_t vsync_next(uint32_t now);
+
+void vsync_get_stats(vsync_stats_t* stats);
+
+#ifdef DAOS_HOST
+/** Reloj del panel simulado (solo DAOS_HOST): lo implementa la prueba. */
+uint32_t vsync_host_clock(void);
+#endif
+
+#endif /* VSYNC_H */
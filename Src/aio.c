@@ -0,0 +1,261 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - E/S asíncrona de archivos
+ * ============================================================================
+ * Cola de peticiones en orden de llegada y una tarea que la atiende sobre
+ * el VFS. Ver aio.h para el orden de servicio y la fusión.
+ * ============================================================================
+ */
+
+#include "aio.h"
+#include "vfs.h"
+#include "sched.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                          ESTADO                                            */
+/* ========================================================================== */
+
+static aio_req_t* queue;              // Pendientes, en orden de llegada
+static aio_req_t* batch;              // Grupo en curso; la cabeza se está transfiriendo
+static int batch_fd = -1;
+static char head_path[AIO_MAX_PATH];  // Cabezal del ascensor: archivo y posición
+static uint32_t head_pos;
+static uint32_t depth;                // En cola + en curso
+static aio_stats_t stats;
+
+/* ========================================================================== */
+/*                          COLA                                              */
+/* ========================================================================== */
+
+/**
+ * Dos peticiones del mismo archivo no pueden cambiar de orden si alguna
+ * escribe y sus rangos se solapan (o alguna añade al final).
+ */
+static uint8_t conflicts(const aio_req_t* a, const aio_req_t* b) {
+    if (a->op == AIO_READ && b->op == AIO_READ) return 0;
+    if (strcmp(a->path, b->path) != 0) return 0;
+    if ((a->flags | b->flags) & (VFS_O_APPEND | VFS_O_TRUNC)) return 1;
+
+    return a->offset < b->offset + b->len && b->offset < a->offset + a->len;
+}
+
+/** @return 1 si alguna petición más antigua que c le impide adelantarse. */
+static uint8_t blocked(const aio_req_t* c) {
+    for (const aio_req_t* e = queue; e && e != c; e = e->next) {
+        if (conflicts(e, c)) return 1;
+    }
+    return 0;
+}
+
+static void unlink_req(aio_req_t* r) {
+    aio_req_t** link = &queue;
+
+    while (*link && *link != r) link = &(*link)->next;
+    if (*link) *link = r->next;
+    r->next = NULL;
+}
+
+/**
+ * Siguiente petición: la de menor posición por delante del cabezal en el
+ * archivo en curso; si no hay, o si la más antigua venció su plazo, la más
+ * antigua.
+ */
+static aio_req_t* pick(void) {
+    aio_req_t* oldest = queue;
+    aio_req_t* best = NULL;
+
+    if (!oldest) return NULL;
+    if (millis() - oldest->submitted_ms >= AIO_DEADLINE_MS) return oldest;
+
+    for (aio_req_t* c = queue; c; c = c->next) {
+        if ((c->flags & VFS_O_APPEND) || c->offset < head_pos) continue;
+        if (strcmp(c->path, head_path) != 0) continue;
+        if (best && c->offset >= best->offset) continue;
+        if (!blocked(c)) best = c;
+    }
+
+    return best ? best : oldest;
+}
+
+/** Petición que continúa el grupo (contigua, mismo archivo y sentido). */
+static aio_req_t* find_next(const aio_req_t* head, uint32_t end) {
+    for (aio_req_t* n = queue; n; n = n->next) {
+        if (n->op != head->op || n->offset != end) continue;
+        if (n->flags & (VFS_O_TRUNC | VFS_O_APPEND)) continue;
+        if ((n->flags & VFS_O_CREAT) && !(head->flags & VFS_O_CREAT)) continue;
+        if (strcmp(n->path, head->path) != 0) continue;
+        if (!blocked(n)) return n;
+    }
+    return NULL;
+}
+
+/* ========================================================================== */
+/*                          SERVICIO                                          */
+/* ========================================================================== */
+
+static void complete(aio_req_t* r, int result) {
+    uint32_t latency = millis() - r->submitted_ms;
+
+    r->result = result;
+    depth--;
+    stats.completed++;
+    if (result < 0) {
+        stats.errors++;
+    } else {
+        stats.bytes += (uint32_t)result;
+    }
+    stats.latency_total_ms += latency;
+    if (latency > stats.latency_max_ms) stats.latency_max_ms = latency;
+
+    // El estado va primero: el callback puede volver a enviar la petición
+    r->state = (result < 0) ? AIO_ERROR : AIO_DONE;
+    if (r->done) r->done(r);
+    if (r->sem) sem_post(r->sem);
+}
+
+/** Terminar todas las peticiones del grupo con el mismo resultado. */
+static void finish_batch(int result) {
+    while (batch) {
+        aio_req_t* r = batch;
+        batch = r->next;
+        complete(r, result);
+    }
+    if (batch_fd >= 0) {
+        vfs_close(batch_fd);
+        batch_fd = -1;
+    }
+}
+
+/** Elegir la siguiente petición, fusionar las contiguas y abrir el archivo. */
+static uint8_t start_batch(void) {
+    aio_req_t* r = pick();
+    aio_req_t* tail;
+    uint32_t end;
+    int flags;
+
+    if (!r) return 0;
+    if (r != queue) stats.reordered++;
+
+    unlink_req(r);
+    batch = tail = r;
+    end = r->offset + r->len;
+    stats.batches++;
+
+    if (!(r->flags & VFS_O_APPEND)) {
+        aio_req_t* n;
+        while ((n = find_next(r, end)) != NULL) {
+            unlink_req(n);
+            tail->next = n;
+            tail = n;
+            end += n->len;
+            stats.merged++;
+        }
+    }
+
+    for (aio_req_t* m = batch; m; m = m->next) m->state = AIO_ACTIVE;
+
+    strcpy(head_path, r->path);
+    head_pos = end;
+
+    if (r->op == AIO_READ) {
+        flags = VFS_O_RDONLY;
+    } else {
+        flags = ((r->flags & VFS_O_APPEND) ? VFS_O_RDWR : VFS_O_WRONLY) |
+                (r->flags & (VFS_O_CREAT | VFS_O_TRUNC | VFS_O_APPEND));
+    }
+
+    batch_fd = vfs_open(r->path, flags);
+    if (batch_fd < 0) {
+        finish_batch(-1);
+        return 1;
+    }
+
+    if (!(r->flags & VFS_O_APPEND) && r->offset > 0 &&
+        vfs_seek(batch_fd, (int)r->offset, VFS_SEEK_SET) != (int)r->offset) {
+        finish_batch(r->op == AIO_READ ? 0 : -1);  // Más allá del final
+    }
+    return 1;
+}
+
+/** Transferir un tramo de la petición en curso. */
+static void step(void) {
+    aio_req_t* r = batch;
+    uint32_t n = r->len - r->progress;
+    int got = 0;
+
+    if (n > AIO_CHUNK) n = AIO_CHUNK;
+    if (n > 0) {
+        uint8_t* p = (uint8_t*)r->buf + r->progress;
+        got = (r->op == AIO_READ) ? vfs_read(batch_fd, p, n) : vfs_write(batch_fd, p, n);
+    }
+
+    if (got < 0) {
+        finish_batch(-1);
+        return;
+    }
+
+    r->progress += (uint32_t)got;
+    if (r->progress < r->len && got == (int)n) return;  // Sigue en el próximo turno
+
+    // Terminada (o fin de archivo / disco lleno)
+    batch = r->next;
+    if (batch && got < (int)n) {
+        // Las fusionadas detrás empezaban donde esta no llegó
+        complete(r, (int)r->progress);
+        finish_batch(r->op == AIO_READ ? 0 : -1);
+    } else if (!batch) {
+        // Con escritura diferida el error puede aparecer al cerrar
+        int closed = vfs_close(batch_fd);
+        batch_fd = -1;
+        complete(r, (closed < 0 && r->op == AIO_WRITE) ? -1 : (int)r->progress);
+    } else {
+        complete(r, (int)r->progress);
+    }
+}
+
+/* ========================================================================== */
+/*                          API                                               */
+/* ========================================================================== */
+
+int aio_submit(aio_req_t* r) {
+    aio_req_t** link = &queue;
+
+    if (!r || r->state == AIO_QUEUED || r->state == AIO_ACTIVE) return -1;
+    if (r->op > AIO_WRITE || (!r->buf && r->len > 0)) return -1;
+    if (r->path[0] == '\0' || !memchr(r->path, '\0', AIO_MAX_PATH)) return -1;
+
+    r->submitted_ms = millis();
+    r->progress = 0;
+    r->result = 0;
+    r->next = NULL;
+    r->state = AIO_QUEUED;
+
+    while (*link) link = &(*link)->next;
+    *link = r;
+
+    depth++;
+    stats.submitted++;
+    if (depth > stats.max_depth) stats.max_depth = depth;
+    return 0;
+}
+
+uint8_t aio_is_done(const aio_req_t* r) {
+    return r->state == AIO_DONE || r->state == AIO_ERROR;
+}
+
+uint32_t aio_pending(void) {
+    return depth;
+}
+
+void aio_task(void) {
+    if (!batch && !start_batch()) {
+        task_delay(AIO_IDLE_MS);
+        return;
+    }
+    if (batch) step();
+}
+
+void aio_get_stats(aio_stats_t* out) {
+    *out = stats;
+}
@@ -2,11 +2,22 @@
 #include "sched.h"  // Funciones del planificador
 #include "sync.h"   // Primitivas de sincronización
 #include "ramfs.h"  // Sistema de archivos en RAM
+#include "ramfs_log.h" // Persistencia de RAMFS en flash
+#include "vfs.h"    // Sistema de archivos virtual
+#include "fat.h"    // FAT32 de la tarjeta SD
+#include "sd.h"     // Driver de la tarjeta SD
 #include "uart.h"   // Comunicación serial
 #include "button.h" // Entrada de botones
 #include "loader.h" // Cargador de aplicaciones
 #include "shell.h"  // Intérprete de comandos
 #include "pantalla.h" // Gráficos (TFT)
+#include "compositor.h" // Cuadros por tiles sobre la pantalla
+#include "dlist.h"      // Lista de dibujo de la tarea de pantalla
+#include "vsync.h"      // Ritmo de cuadros alineado al refresco
+#include "glyph.h"      // Caché de glifos
+#include "console.h"    // Consola de texto en la pantalla
+#include "spi_dma.h" // Bus SPI1 compartido (pantalla y SD)
+#include "aio.h"    // E/S asíncrona
 #include "buzzer.h" // Salida de audio
 #include "aleatorio.h" // Generador de números aleatorios
 #include <string.h> // Funciones de cadena (memcpy, etc.)
@@ -130,62 +141,258 @@ void daos_sem_init(daos_sem_t s, int initial, int max) {
 }
 
 // ========================================================================
-// SISTEMA DE ARCHIVOS (RAMFS Wrapper)
+// SISTEMA DE ARCHIVOS (VFS Wrapper)
 // ========================================================================
 
 /** Abre archivo para solo lectura. */
 int daos_open(const char* path) {
-    return ramfs_open(path, RAMFS_O_RDONLY);
+    return vfs_open(path, VFS_O_RDONLY);
+}
+
+/** Abre archivo con modos DAOS_O_* (mismos valores que VFS_O_*). */
+int daos_open_flags(const char* path, int flags) {
+    return vfs_open(path, flags);
 }
 
 /** Lee desde un archivo. */
 int daos_read(int fd, void* buf, int n) {
-    return ramfs_read(fd, buf, n);
+    if (n < 0) return -1;
+    return vfs_read(fd, buf, (uint32_t)n);
 }
 
 /** Escribe en un archivo. */
 int daos_write(int fd, const void* buf, int n) {
-    return ramfs_write(fd, buf, n);
+    if (n < 0) return -1;
+    return vfs_write(fd, buf, (uint32_t)n);
 }
 
 /** Cierra un archivo. */
 int daos_close(int fd) {
-    return ramfs_close(fd);
+    return vfs_close(fd);
 }
 
 /** Mueve el puntero de lectura/escritura. */
 int daos_seek(int fd, int offset, int whence) {
-    return ramfs_seek(fd, offset, whence);
+    return vfs_seek(fd, offset, whence);
 }
 
-/** Lista archivos a un buffer. */
+/** Lista la raíz (puntos de montaje y archivos de /ram) a un buffer. */
 int daos_listdir(char* out, int max) {
-    return ramfs_listdir(out, max);
+    vfs_dirent_t ent;
+    int used = 0;
+
+    int dh = vfs_opendir("/");
+    if (dh < 0) return -1;
+
+    while (vfs_readdir(dh, &ent) == 1) {
+        int len = strlen(ent.name);
+        if (used + len + 3 >= max) break;
+
+        strcpy(out + used, ent.name);
+        used += len;
+        if (ent.is_dir) out[used++] = '/';
+        out[used++] = '\n';
+    }
+    vfs_closedir(dh);
+
+    out[used] = '\0';
+    return used;
 }
 
 /** Verifica si un archivo existe. */
 int daos_exists(const char* path) {
-    return ramfs_exists(path);
+    vfs_stat_t st;
+    return vfs_stat(path, &st) == 0;
 }
 
 /** Obtiene el tamaño de un archivo. */
 int daos_get_file_size(const char* path) {
-    return ramfs_get_size(path);
+    vfs_stat_t st;
+    if (vfs_stat(path, &st) < 0 || st.is_dir) return -1;
+    return (int)st.size;
+}
+
+/**
+ * Escribir un buffer completo con los modos indicados
+ */
+static int write_whole(const char* path, int flags, const void* data, uint32_t size) {
+    int fd = vfs_open(path, flags);
+    if (fd < 0) return -1;
+
+    int written = vfs_write(fd, data, size);
+    int closed = vfs_close(fd);
+
+    return (written == (int)size && closed == 0) ? 0 : -1;
 }
 
 /** Crea un archivo con contenido inicial. */
 int daos_create_file(const char* name, const void* data, uint32_t size) {
-    return ramfs_create(name, data, size);
+    return write_whole(name, VFS_O_WRONLY | VFS_O_CREAT | VFS_O_TRUNC, data, size);
 }
 
 /** Elimina un archivo. */
 int daos_delete_file(const char* name) {
-    return ramfs_delete(name);
+    return vfs_unlink(name);
 }
 
 /** Añade contenido al final de un archivo. */
 int daos_append(const char* name, const void* data, uint32_t size) {
-    return ramfs_append(name, data, size);
+    return write_whole(name, VFS_O_RDWR | VFS_O_APPEND, data, size);
+}
+
+/** Copia un archivo (puede cruzar sistemas de archivos). */
+int daos_copy_file(const char* src, const char* dst) {
+    return vfs_copy(src, dst);
+}
+
+/** Renombra o mueve un archivo o directorio. */
+int daos_rename(const char* old_path, const char* new_path) {
+    return vfs_rename(old_path, new_path);
+}
+
+/** Obtiene la fragmentación del espacio libre. */
+int daos_fs_get_fragmentation(void) {
+    return ramfs_fragmentation();
+}
+
+/** Activa o desactiva la compresión de un archivo. */
+int daos_fs_set_compression(const char* name, int enable) {
+    return ramfs_set_compress(name, enable);
+}
+
+/** Tarea de compactación en segundo plano (checkpoint del log y ramfs_compact_task). */
+void daos_fs_compact_task(void) {
+    ramfs_log_maintain();   // Checkpoint pedido por el log (borra un bloque de flash)
+    ramfs_compact_task();
+}
+
+/** Monta RAMFS sobre el log persistente en flash interna. */
+int daos_fs_mount_persistent(void) {
+    vfs_cache_flush();  // El montaje reconstruye RAMFS: cerrar los retenidos
+    return ramfs_log_mount(blockdev_flash_get());
+}
+
+/** Inicializa la tarjeta SD y monta su volumen FAT32 en /sd. */
+int daos_sd_mount(void) {
+    if (fat_is_mounted()) return 0;
+    if (!sd_is_ready() && !sd_init()) return -1;
+    return fat_mount(blockdev_cache_wrap(blockdev_sd_get()));
+}
+
+/** Tarea que inicializa la SD y monta /sd sin bloquear (un comando por turno). */
+void daos_sd_mount_task(void) {
+    sd_init_status_t status;
+
+    if (fat_is_mounted()) task_exit();
+
+    status = sd_init_step();
+    if (status == SD_INIT_BUSY) return;  // Siguiente paso en el próximo turno
+
+    if (status == SD_INIT_OK && fat_mount(blockdev_cache_wrap(blockdev_sd_get())) == 0) {
+        daos_uart_puts("SD montada en /sd\r\n");
+    }
+    task_exit();
+}
+
+/** Escribe a la tarjeta lo retenido en la caché de sectores. */
+int daos_sd_sync(void) {
+    return fat_sync();
+}
+
+/** Escribe lo pendiente y desmonta la SD (se puede retirar la tarjeta). */
+void daos_sd_unmount(void) {
+    vfs_cache_flush();  // Cierra los handles FAT retenidos por el VFS
+    fat_umount();
+    blockdev_cache_invalidate();  // La próxima tarjeta puede ser otra
+    sd_reset();                   // y hay que volver a inicializarla
+}
+
+static int aio_prepare(daos_aio_t* req, const char* path, uint32_t offset,
+                       void* buf, uint32_t len, uint8_t op, int flags) {
+    size_t n = path ? strlen(path) : AIO_MAX_PATH;
+
+    // No tocar una petición que la tarea de E/S todavía está usando
+    if (!req || n >= AIO_MAX_PATH) return -1;
+    if (req->state == AIO_QUEUED || req->state == AIO_ACTIVE) return -1;
+
+    memcpy(req->path, path, n + 1);
+    req->offset = offset;
+    req->buf = buf;
+    req->len = len;
+    req->op = op;
+    req->flags = (uint8_t)flags;
+    return aio_submit(req);
+}
+
+/** Encola una lectura asíncrona. */
+int daos_aio_read(daos_aio_t* req, const char* path, uint32_t offset, void* buf, uint32_t len) {
+    return aio_prepare(req, path, offset, buf, len, AIO_READ, 0);
+}
+
+/** Encola una escritura asíncrona. */
+int daos_aio_write(daos_aio_t* req, const char* path, uint32_t offset, const void* buf, uint32_t len, int flags) {
+    return aio_prepare(req, path, offset, (void*)buf, len, AIO_WRITE,
+                       flags & (DAOS_O_CREAT | DAOS_O_TRUNC | DAOS_O_APPEND));
+}
+
+/** Consulta si una petición asíncrona terminó. */
+int daos_aio_done(const daos_aio_t* req) {
+    return aio_is_done(req);
+}
+
+/** Tarea de E/S (wrapper a aio_task). */
+void daos_aio_task(void) {
+    aio_task();
+}
+
+/** Obtiene capacidad y espacio libre de la SD en KB. */
+int daos_sd_get_info(uint32_t* total_kb, uint32_t* free_kb) {
+    fat_stats_t st;
+    if (!fat_is_mounted()) return -1;
+
+    fat_get_stats(&st);
+    *total_kb = (uint32_t)(((uint64_t)st.total_clusters * st.cluster_size) / 1024);
+    *free_kb = (st.free_clusters == 0xFFFFFFFF) ? 0xFFFFFFFF :
+               (uint32_t)(((uint64_t)st.free_clusters * st.cluster_size) / 1024);
+    return 0;
+}
+
+/** Crea un directorio. */
+int daos_mkdir(const char* path) {
+    return vfs_mkdir(path);
+}
+
+/** Elimina un directorio vacío. */
+int daos_rmdir(const char* path) {
+    return vfs_rmdir(path);
+}
+
+/** Abre un directorio. */
+int daos_opendir(const char* path) {
+    return vfs_opendir(path);
+}
+
+/** Lee la siguiente entrada de un directorio. */
+int daos_readdir(int dh, daos_dirent_t* ent) {
+    vfs_dirent_t e;
+    int r = vfs_readdir(dh, &e);
+    if (r == 1) {
+        strcpy(ent->name, e.name);
+        ent->is_dir = e.is_dir;
+        ent->size = e.size;
+    }
+    return r;
+}
+
+/** Cierra un directorio. */
+int daos_closedir(int dh) {
+    return vfs_closedir(dh);
+}
+
+/** Verifica si una ruta es un directorio. */
+int daos_is_dir(const char* path) {
+    vfs_stat_t st;
+    return vfs_stat(path, &st) == 0 && st.is_dir;
 }
 
 // ========================================================================
@@ -195,46 +402,186 @@ int daos_append(const char* name, const void* data, uint32_t size) {
 /** Inicializa el subsistema gráfico. */
 void daos_gfx_init(void) {
     pantalla_init();
+    vsync_init();
+}
+
+/*
+ * Dentro de un cuadro (daos_gfx_frame_begin) el compositor anota cada
+ * primitiva y retorna 0. Fuera de él retorna -1 y la primitiva va a la
+ * lista de la tarea de pantalla; si la tarea no corre (menú, arranque) la
+ * lista también retorna -1 y se dibuja directamente.
+ */
+
+/** Tarea de pantalla (wrapper a dlist_task). */
+void daos_gfx_task(void) {
+    dlist_task();
+}
+
+/** Dibuja ya lo encolado; hasta que vuelva a correr la tarea se dibuja directo. */
+void daos_gfx_sync(void) {
+    dlist_sync();
+}
+
+/** Empieza un cuadro compuesto por tiles. */
+void daos_gfx_frame_begin(uint16_t bg) {
+    dlist_flush();   // Lo encolado antes va debajo del cuadro
+    compositor_begin(bg);
+}
+
+/** Cierra el cuadro y envía los tiles que cambiaron. */
+void daos_gfx_frame_end(void) {
+    dlist_flush();
+    compositor_end();
+}
+
+static void present_flush(void) {
+    dlist_flush();
+    if (compositor_active()) compositor_end();
+}
+
+/** Cierra el cuadro (o vacía la lista) al comienzo del próximo refresco. */
+uint32_t daos_gfx_present(uint32_t interval_ms) {
+    uint8_t pending = compositor_active() || dlist_pending() > 0;
+    uint32_t sleep_ms = vsync_present(interval_ms, pending ? present_flush : 0);
+
+    // Llegó pronto: dormir hasta poco antes del refresco en vez de esperar
+    // activamente, y entonces enviar
+    while (vsync_pending()) {
+        task_delay(sleep_ms);
+        sleep_ms = vsync_present(interval_ms, present_flush);
+    }
+    return sleep_ms;
 }
 
 /** Limpia la pantalla. */
 void daos_gfx_clear(uint16_t color) {
+    if (compositor_fill(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, color) == 0) return;
+    if (dlist_fill(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, color) == 0) return;
     pantalla_clear(color);
 }
 
 /** Rellena un rectángulo. */
 void daos_gfx_fill_rect(int x, int y, int w, int h, uint16_t color) {
+    if (compositor_fill((uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h, color) == 0) return;
+    if (dlist_fill((uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h, color) == 0) return;
     pantalla_fill_rect((uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h, color);
 }
 
 /** Dibuja un píxel. */
 void daos_gfx_draw_pixel(int x, int y, uint16_t color) {
+    if (compositor_fill((uint16_t)x, (uint16_t)y, 1, 1, color) == 0) return;
+    if (dlist_fill((uint16_t)x, (uint16_t)y, 1, 1, color) == 0) return;
     pantalla_draw_pixel((uint16_t)x, (uint16_t)y, color);
 }
 
 /** Dibuja texto simple. */
 void daos_gfx_draw_text(int x, int y, const char* text, uint16_t color, uint16_t bg) {
+    if (compositor_text((uint16_t)x, (uint16_t)y, text, color, bg, 1, 0) == 0) return;
+    if (dlist_text((uint16_t)x, (uint16_t)y, text, color, bg, 1, 0) == 0) return;
     pantalla_draw_string((uint16_t)x, (uint16_t)y, text, color, bg);
 }
 
 /** Dibuja texto escalado. */
 void daos_gfx_draw_text_large(int x, int y, const char* text, uint16_t color, uint16_t bg, uint8_t scale) {
+    if (compositor_text((uint16_t)x, (uint16_t)y, text, color, bg, scale, 1) == 0) return;
+    if (dlist_text((uint16_t)x, (uint16_t)y, text, color, bg, scale, 1) == 0) return;
     pantalla_draw_string_large((uint16_t)x, (uint16_t)y, text, color, bg, scale);
 }
 
 /** Dibuja el contorno de un círculo. */
 void daos_gfx_draw_circle(int x0, int y0, int radius, uint16_t color) {
+    if (compositor_circle((int16_t)x0, (int16_t)y0, (uint16_t)radius, color, 0) == 0) return;
+    if (dlist_circle((uint16_t)x0, (uint16_t)y0, (uint16_t)radius, color, 0) == 0) return;
     pantalla_draw_circle((uint16_t)x0, (uint16_t)y0, (uint16_t)radius, color);
 }
 
 /** Dibuja un círculo relleno. */
 void daos_gfx_draw_circle_filled(int x0, int y0, int radius, uint16_t color) {
+    if (compositor_circle((int16_t)x0, (int16_t)y0, (uint16_t)radius, color, 1) == 0) return;
+    if (dlist_circle((uint16_t)x0, (uint16_t)y0, (uint16_t)radius, color, 1) == 0) return;
     pantalla_draw_circle_filled((uint16_t)x0, (uint16_t)y0, (uint16_t)radius, color);
 }
 
-/** No implementado: Copia un bitmap (blit). */
+/** Dibuja el contorno de un rectángulo con las esquinas redondeadas. */
+void daos_gfx_draw_round_rect(int x, int y, int w, int h, int r, uint16_t color) {
+    if (compositor_round_rect((int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, (int16_t)r, color, 0) == 0) return;
+    if (dlist_round_rect((int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, (int16_t)r, color, 0) == 0) return;
+    pantalla_draw_round_rect((int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, (int16_t)r, color);
+}
+
+/** Rellena un rectángulo con las esquinas redondeadas. */
+void daos_gfx_fill_round_rect(int x, int y, int w, int h, int r, uint16_t color) {
+    if (compositor_round_rect((int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, (int16_t)r, color, 1) == 0) return;
+    if (dlist_round_rect((int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, (int16_t)r, color, 1) == 0) return;
+    pantalla_fill_round_rect((int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, (int16_t)r, color);
+}
+
+/** Dibuja una línea entre dos puntos. */
+void daos_gfx_draw_line(int x0, int y0, int x1, int y1, uint16_t color) {
+    if (compositor_line((int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, color) == 0) return;
+    if (dlist_line((int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, color) == 0) return;
+    pantalla_draw_line((int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, color);
+}
+
+/** Dibuja el contorno de un triángulo. */
+void daos_gfx_draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color) {
+    if (compositor_triangle((int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, color, 0) == 0) return;
+    if (dlist_triangle((int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, color, 0) == 0) return;
+    pantalla_draw_triangle((int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, color);
+}
+
+/** Rellena un triángulo. */
+void daos_gfx_fill_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color) {
+    if (compositor_triangle((int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, color, 1) == 0) return;
+    if (dlist_triangle((int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, color, 1) == 0) return;
+    pantalla_fill_triangle((int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2, color);
+}
+
+/**
+ * Recortar un bitmap por la izquierda y por arriba (la pantalla recorta a
+ * la derecha y abajo). @return 0 si no queda nada que dibujar.
+ */
+static int blit_clip(int* x, int* y, const uint16_t** src, int* w, int* h, int stride) {
+    if (!*src || *w <= 0 || *h <= 0) return 0;
+
+    if (*x < 0) {
+        *src -= *x;
+        *w += *x;
+        *x = 0;
+    }
+    if (*y < 0) {
+        *src -= (*y) * stride;
+        *h += *y;
+        *y = 0;
+    }
+    return *w > 0 && *h > 0 && *x < SCREEN_WIDTH && *y < SCREEN_HEIGHT;
+}
+
+/** Copia un bitmap RGB565 (w*h píxeles, fila a fila). */
 void daos_gfx_blit16(int x, int y, const uint16_t* src, int w, int h) {
-    (void)x; (void)y; (void)src; (void)w; (void)h;
+    int stride = w;
+    if (!blit_clip(&x, &y, &src, &w, &h, stride)) return;
+    if (compositor_bitmap((uint16_t)x, (uint16_t)y, src, (uint16_t)w, (uint16_t)h, (uint16_t)stride, 0, 0) == 0) return;
+    dlist_flush();   // src no se encola: se envía antes de retornar
+    pantalla_draw_bitmap((uint16_t)x, (uint16_t)y, src, (uint16_t)w, (uint16_t)h, (uint16_t)stride);
+}
+
+/** Copia un bitmap RGB565 saltando los píxeles del color clave. */
+void daos_gfx_blit16_key(int x, int y, const uint16_t* src, int w, int h, uint16_t key) {
+    int stride = w;
+    if (!blit_clip(&x, &y, &src, &w, &h, stride)) return;
+    if (compositor_bitmap((uint16_t)x, (uint16_t)y, src, (uint16_t)w, (uint16_t)h, (uint16_t)stride, 1, key) == 0) return;
+    dlist_flush();
+    pantalla_draw_bitmap_key((uint16_t)x, (uint16_t)y, src, (uint16_t)w, (uint16_t)h, (uint16_t)stride, key);
+}
+
+/** Dibuja un sprite precompilado. */
+void daos_gfx_draw_sprite(int x, int y, const daos_sprite_t* sprite) {
+    if (!sprite || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
+    if (x + (int)sprite->w <= 0 || y + (int)sprite->h <= 0) return;
+    if (compositor_sprite((int16_t)x, (int16_t)y, sprite->data, sprite->w, sprite->h) == 0) return;
+    if (dlist_sprite((int16_t)x, (int16_t)y, sprite->data, sprite->w, sprite->h) == 0) return;
+    pantalla_draw_sprite((int16_t)x, (int16_t)y, sprite->data, sprite->h);
 }
 
 /** Dibuja el contorno de un rectángulo (compuesto por líneas). */
@@ -255,6 +602,50 @@ void daos_gfx_vline(int x, int y, int h, uint16_t color) {
     daos_gfx_fill_rect(x, y, 1, h, color);
 }
 
+// ========================================================================
+// CONSOLA
+// ========================================================================
+
+// Lo que sale por daos_uart_* se copia también en la consola
+static uint8_t console_echo;
+
+/** Ocupa una franja de la pantalla con la consola. */
+void daos_console_init(int y, int rows) {
+    console_init((uint16_t)y, (uint8_t)rows);
+}
+
+/** Color de lo que se escriba a partir de ahora. */
+void daos_console_color(uint16_t color, uint16_t bg) {
+    console_set_color(color, bg);
+}
+
+/** Escribe en el cursor de la consola. */
+void daos_console_puts(const char* str) {
+    console_puts(str);
+}
+
+/** Escribe en una celda fija. */
+void daos_console_write_at(int col, int row, const char* str) {
+    if (col < 0 || row < 0) return;
+    console_write_at((uint8_t)col, (uint8_t)row, str);
+}
+
+/** Muestra u oculta el cursor. */
+void daos_console_cursor(int visible) {
+    console_cursor(visible != 0);
+}
+
+/** Copia la salida de la UART en la consola. */
+void daos_console_echo(int on) {
+    console_echo = (on != 0);
+}
+
+/** Redibuja las celdas que cambiaron. */
+void daos_console_flush(void) {
+    dlist_flush();   // Lo encolado antes va debajo
+    console_flush();
+}
+
 // ========================================================================
 // AUDIO (Buzzer Wrapper)
 // ========================================================================
@@ -370,21 +761,35 @@ void daos_return_to_menu(void) {
 /** Envía una cadena por UART. */
 void daos_uart_puts(const char* str) {
     uart_puts(str);
+    if (console_echo) console_puts(str);
 }
 
 /** Envía un carácter por UART. */
 void daos_uart_putc(char c) {
     uart_putc(c);
+    if (console_echo) console_putc(c);
 }
 
 /** Envía un entero por UART. */
 void daos_uart_putint(uint32_t num) {
     uart_putint(num);
+
+    if (console_echo) {
+        char digits[11];
+        int i = 0;
+
+        do {
+            digits[i++] = (char)('0' + num % 10);
+            num /= 10;
+        } while (num > 0);
+        while (i > 0) console_putc(digits[--i]);
+    }
 }
 
 /** Envía nueva línea por UART. */
 void daos_uart_newline(void) {
     uart_newline();
+    if (console_echo) console_puts("\r\n");
 }
 
 /** Causa un pánico en el kernel y detiene el sistema. */
@@ -465,6 +870,79 @@ void daos_get_memory_info(daos_memory_info_t* info) {
     info->used_blocks = used;
     info->free_blocks = free;
     info->total_kb = (used * 256) / 1024;
+    info->fragmentation = ramfs_fragmentation();
+    info->inline_files = ramfs_inline_count();
+    ramfs_compression_stats(&info->packed_files, &info->packed_raw_bytes,
+                            &info->packed_stored_bytes);
+    ramfs_dcache_stats(&info->dcache_hits, &info->dcache_misses);
+
+    ramfs_log_stats_t log;
+    ramfs_log_get_stats(&log);
+    info->persistent = ramfs_log_is_mounted();
+    info->log_used_bytes = log.used_bytes;
+
+    vfs_stats_t vfs;
+    vfs_get_stats(&vfs);
+    info->vfs_cache_hits = vfs.cache_hits;
+    info->vfs_cache_misses = vfs.cache_misses;
+    info->vfs_open_fds = vfs.open_fds;
+
+    blockdev_cache_stats_t sd;
+    blockdev_cache_get_stats(&sd);
+    info->sd_cache_hits = sd.hits;
+    info->sd_cache_misses = sd.misses;
+    info->sd_cache_dirty = sd.dirty;
+
+    sd_stats_t link;
+    sd_get_stats(&link);
+    info->sd_crc_errors = link.crc_errors;
+    info->sd_crc_failures = link.failures;
+
+    spi_dma_stats_t spi;
+    spi_dma_get_stats(&spi);
+    info->spi_transactions = spi.transactions;
+    info->spi_switches = spi.switches;
+    info->spi_switch_cycles = spi.switches ? spi.switch_cycles / spi.switches : 0;
+
+    aio_stats_t aio;
+    aio_get_stats(&aio);
+    info->aio_requests = aio.completed;
+    info->aio_merged = aio.merged;
+    info->aio_latency_ms = aio.completed ? aio.latency_total_ms / aio.completed : 0;
+
+    compositor_stats_t gfx;
+    compositor_get_stats(&gfx);
+    info->gfx_frames = gfx.frames;
+    info->gfx_tiles_per_frame = gfx.frames ? gfx.tiles / gfx.frames : 0;
+    info->gfx_bytes_per_frame = gfx.frames ? gfx.bytes / gfx.frames : 0;
+
+    dlist_stats_t dl;
+    dlist_get_stats(&dl);
+    info->gfx_queued = dl.ops;
+    info->gfx_merged = dl.merged;
+    info->gfx_culled = dl.culled;
+    info->gfx_batches = dl.batches;
+
+    vsync_stats_t vs;
+    vsync_get_stats(&vs);
+    info->gfx_presented = vs.frames;
+    info->gfx_dropped = vs.dropped;
+    info->gfx_torn = vs.torn;
+    info->gfx_present_latency_us = vs.frames ? vs.latency_total_us / vs.frames : 0;
+    info->gfx_present_max_us = vs.latency_max_us;
+    info->gfx_period_us = vs.period_us;
+    info->gfx_vsync_source = vs.source;
+
+    glyph_stats_t gl;
+    glyph_get_stats(&gl);
+    info->gfx_glyph_hits = gl.hits;
+    info->gfx_glyph_misses = gl.misses;
+
+    console_stats_t cs;
+    console_get_stats(&cs);
+    info->gfx_console_chars = cs.chars;
+    info->gfx_console_cells = cs.cells;
+    info->gfx_console_runs = cs.runs;
 }
 
 /** Obtiene el tiempo de funcionamiento en segundos. */
@@ -482,6 +960,7 @@ void daos_init(void) {
     button_init();
     buttons_init();
     ramfs_init();
+    vfs_init();
     loader_init();
     daos_gfx_init();
     daos_audio_init();
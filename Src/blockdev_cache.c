@@ -0,0 +1,238 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Caché LRU de bloques con escritura diferida
+ * ============================================================================
+ * Se intercala entre un sistema de archivos y un medio lento (la SD por
+ * SPI). Los metadatos (FAT, directorios, FSInfo) se leen y reescriben una
+ * y otra vez; con la caché solo viajan al medio al desalojarse o en sync.
+ * ============================================================================
+ */
+
+#include "blockdev.h"
+#include <string.h>
+
+#define NO_BLOCK 0xFFFFFFFF
+
+/** Bloque retenido. */
+typedef struct {
+    uint32_t block;
+    uint32_t stamp;               // Para desalojar el menos usado
+    uint8_t dirty;
+    uint8_t data[BLOCKDEV_CACHE_BLOCK_SIZE];
+} cache_block_t;
+
+static cache_block_t blocks[BLOCKDEV_CACHE_BLOCKS];
+static const blockdev_t* lower_dev = NULL;
+static blockdev_t cache_dev;
+static uint32_t cache_clock = 0;
+static blockdev_cache_stats_t stats;
+
+/* ========================================================================== */
+/*                          FUNCIONES AUXILIARES                              */
+/* ========================================================================== */
+
+static int write_back(cache_block_t* b) {
+    if (!b->dirty) return 0;
+
+    if (lower_dev->prog(lower_dev, b->block, 0, b->data, lower_dev->block_size) < 0) {
+        return -1;
+    }
+    b->dirty = 0;
+    stats.writes++;
+    return 0;
+}
+
+/**
+ * Buscar un bloque en la caché o cargarlo desalojando el menos usado
+ * @param fill Si es 0, no leer del medio (el llamador lo sobrescribe entero).
+ * @return Bloque en la caché, o NULL si error.
+ */
+static cache_block_t* get_block(uint32_t block, int fill) {
+    cache_block_t* victim = &blocks[0];
+
+    for (int i = 0; i < BLOCKDEV_CACHE_BLOCKS; i++) {
+        if (blocks[i].block == block) {
+            blocks[i].stamp = ++cache_clock;
+            stats.hits++;
+            return &blocks[i];
+        }
+        if (blocks[i].block == NO_BLOCK) {
+            if (victim->block != NO_BLOCK) victim = &blocks[i];
+        } else if (victim->block != NO_BLOCK && blocks[i].stamp < victim->stamp) {
+            victim = &blocks[i];
+        }
+    }
+
+    stats.misses++;
+    if (write_back(victim) < 0) return NULL;
+    victim->block = NO_BLOCK;
+
+    if (fill) {
+        if (lower_dev->read(lower_dev, block, 0, victim->data, lower_dev->block_size) < 0) {
+            return NULL;
+        }
+        stats.reads++;
+    }
+
+    victim->block = block;
+    victim->stamp = ++cache_clock;
+    return victim;
+}
+
+static int check(const blockdev_t* bd, uint32_t block, uint32_t off, uint32_t len) {
+    return (block < bd->block_count && off + len <= bd->block_size) ? 0 : -1;
+}
+
+/* ========================================================================== */
+/*                          OPERACIONES                                       */
+/* ========================================================================== */
+
+static int cache_read(const blockdev_t* bd, uint32_t block, uint32_t off,
+                      void* buf, uint32_t len) {
+    if (check(bd, block, off, len) < 0) return -1;
+
+    cache_block_t* b = get_block(block, 1);
+    if (!b) return -1;
+
+    memcpy(buf, b->data + off, len);
+    return 0;
+}
+
+static int cache_prog(const blockdev_t* bd, uint32_t block, uint32_t off,
+                      const void* buf, uint32_t len) {
+    if (check(bd, block, off, len) < 0) return -1;
+
+    cache_block_t* b = get_block(block, len != bd->block_size);
+    if (!b) return -1;
+
+    memcpy(b->data + off, buf, len);
+    b->dirty = 1;
+    return 0;
+}
+
+/**
+ * Transferencias de varios bloques: van directo al medio en una sola orden.
+ * Los bloques que ya están en la caché mandan sobre lo leído (pueden estar
+ * sucios) y se actualizan con lo escrito; no se carga ningún bloque nuevo.
+ */
+static int cache_read_blocks(const blockdev_t* bd, uint32_t block, uint32_t count,
+                             void* buf) {
+    uint8_t* dst = (uint8_t*)buf;
+
+    if (count == 0 || block + count > bd->block_count) return -1;
+    if (lower_dev->read_blocks(lower_dev, block, count, buf) < 0) return -1;
+    stats.reads += count;
+
+    for (int i = 0; i < BLOCKDEV_CACHE_BLOCKS; i++) {
+        if (blocks[i].block == NO_BLOCK) continue;
+        if (blocks[i].block >= block && blocks[i].block - block < count) {
+            memcpy(dst + (blocks[i].block - block) * bd->block_size,
+                   blocks[i].data, bd->block_size);
+        }
+    }
+    return 0;
+}
+
+static int cache_prog_blocks(const blockdev_t* bd, uint32_t block, uint32_t count,
+                             const void* buf) {
+    const uint8_t* src = (const uint8_t*)buf;
+
+    if (count == 0 || block + count > bd->block_count) return -1;
+    if (lower_dev->prog_blocks(lower_dev, block, count, buf) < 0) return -1;
+    stats.writes += count;
+
+    for (int i = 0; i < BLOCKDEV_CACHE_BLOCKS; i++) {
+        if (blocks[i].block == NO_BLOCK) continue;
+        if (blocks[i].block >= block && blocks[i].block - block < count) {
+            memcpy(blocks[i].data, src + (blocks[i].block - block) * bd->block_size,
+                   bd->block_size);
+            blocks[i].dirty = 0;
+        }
+    }
+    return 0;
+}
+
+static int cache_erase(const blockdev_t* bd, uint32_t block) {
+    (void)bd;
+
+    for (int i = 0; i < BLOCKDEV_CACHE_BLOCKS; i++) {
+        if (blocks[i].block == block) {
+            blocks[i].block = NO_BLOCK;
+            blocks[i].dirty = 0;
+        }
+    }
+    return lower_dev->erase ? lower_dev->erase(lower_dev, block) : 0;
+}
+
+int blockdev_cache_flush(void) {
+    int result = 0;
+
+    if (!lower_dev) return 0;
+
+    // En orden de bloque: la tarjeta escribe mejor secuencialmente
+    uint32_t last = 0;
+    int first = 1;
+    while (1) {
+        cache_block_t* next = NULL;
+        for (int i = 0; i < BLOCKDEV_CACHE_BLOCKS; i++) {
+            if (!blocks[i].dirty || (!first && blocks[i].block <= last)) continue;
+            if (!next || blocks[i].block < next->block) next = &blocks[i];
+        }
+        if (!next) break;
+
+        if (write_back(next) < 0) result = -1;
+        last = next->block;
+        first = 0;
+    }
+    return result;
+}
+
+static int cache_sync(const blockdev_t* bd) {
+    (void)bd;
+
+    int result = blockdev_cache_flush();
+    if (lower_dev->sync && lower_dev->sync(lower_dev) < 0) result = -1;
+    return result;
+}
+
+/* ========================================================================== */
+/*                          API                                               */
+/* ========================================================================== */
+
+const blockdev_t* blockdev_cache_wrap(const blockdev_t* lower) {
+    if (!lower || lower->block_size > BLOCKDEV_CACHE_BLOCK_SIZE) return NULL;
+
+    // El mismo puntero no garantiza el mismo medio (otra tarjeta en la
+    // ranura de la SD): no se reutiliza nada de lo retenido
+    blockdev_cache_invalidate();
+
+    lower_dev = lower;
+    cache_dev.block_size = lower->block_size;
+    cache_dev.block_count = lower->block_count;
+    cache_dev.read = cache_read;
+    cache_dev.prog = cache_prog;
+    cache_dev.erase = cache_erase;
+    cache_dev.sync = cache_sync;
+    cache_dev.read_blocks = lower->read_blocks ? cache_read_blocks : NULL;
+    cache_dev.prog_blocks = lower->prog_blocks ? cache_prog_blocks : NULL;
+    cache_dev.ctx = NULL;
+    return &cache_dev;
+}
+
+int blockdev_cache_invalidate(void) {
+    int result = lower_dev ? blockdev_cache_flush() : 0;
+
+    for (int i = 0; i < BLOCKDEV_CACHE_BLOCKS; i++) {
+        blocks[i].block = NO_BLOCK;
+        blocks[i].dirty = 0;
+    }
+    return result;
+}
+
+void blockdev_cache_get_stats(blockdev_cache_stats_t* out) {
+    *out = stats;
+    out->dirty = 0;
+    for (int i = 0; i < BLOCKDEV_CACHE_BLOCKS; i++) {
+        if (blocks[i].dirty) out->dirty++;
+    }
+}
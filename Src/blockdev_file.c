@@ -0,0 +1,175 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Dispositivo de bloques respaldado por archivo (host)
+ * ============================================================================
+ * Solo se compila con -DDAOS_HOST. Permite ejecutar los sistemas de
+ * archivos en Linux contra una imagen en disco, con la misma semántica de
+ * flash: prog solo puede pasar bits de 1 a 0 y erase deja el bloque en 0xFF.
+ * blockdev_file_open_disk abre en cambio una imagen de disco que se
+ * sobrescribe directamente, como una tarjeta SD.
+ * ============================================================================
+ */
+
+#ifdef DAOS_HOST
+
+#include "blockdev.h"
+#include <stdio.h>
+#include <string.h>
+
+static int file_check(const blockdev_t* bd, uint32_t block, uint32_t off, uint32_t len) {
+    return (block < bd->block_count && off + len <= bd->block_size) ? 0 : -1;
+}
+
+static long file_offset(const blockdev_t* bd, uint32_t block, uint32_t off) {
+    return (long)block * (long)bd->block_size + (long)off;
+}
+
+static int file_read(const blockdev_t* bd, uint32_t block, uint32_t off,
+                     void* buf, uint32_t len) {
+    FILE* f = (FILE*)bd->ctx;
+    if (file_check(bd, block, off, len) < 0) return -1;
+
+    if (fseek(f, file_offset(bd, block, off), SEEK_SET) != 0) return -1;
+    return (fread(buf, 1, len, f) == len) ? 0 : -1;
+}
+
+static int file_prog(const blockdev_t* bd, uint32_t block, uint32_t off,
+                     const void* buf, uint32_t len) {
+    FILE* f = (FILE*)bd->ctx;
+    const uint8_t* src = (const uint8_t*)buf;
+    uint8_t chunk[256];
+
+    if (file_check(bd, block, off, len) < 0) return -1;
+
+    // Emular flash: el valor final es (antiguo AND nuevo)
+    while (len > 0) {
+        uint32_t n = (len < sizeof(chunk)) ? len : sizeof(chunk);
+
+        if (file_read(bd, block, off, chunk, n) < 0) return -1;
+        for (uint32_t i = 0; i < n; i++) {
+            chunk[i] &= src[i];
+        }
+        if (fseek(f, file_offset(bd, block, off), SEEK_SET) != 0) return -1;
+        if (fwrite(chunk, 1, n, f) != n) return -1;
+
+        src += n;
+        off += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int file_write(const blockdev_t* bd, uint32_t block, uint32_t off,
+                      const void* buf, uint32_t len) {
+    FILE* f = (FILE*)bd->ctx;
+    if (file_check(bd, block, off, len) < 0) return -1;
+
+    if (fseek(f, file_offset(bd, block, off), SEEK_SET) != 0) return -1;
+    return (fwrite(buf, 1, len, f) == len) ? 0 : -1;
+}
+
+static int file_read_blocks(const blockdev_t* bd, uint32_t block, uint32_t count,
+                            void* buf) {
+    FILE* f = (FILE*)bd->ctx;
+    uint32_t len = count * bd->block_size;
+    if (count == 0 || block + count > bd->block_count) return -1;
+
+    if (fseek(f, file_offset(bd, block, 0), SEEK_SET) != 0) return -1;
+    return (fread(buf, 1, len, f) == len) ? 0 : -1;
+}
+
+static int file_write_blocks(const blockdev_t* bd, uint32_t block, uint32_t count,
+                             const void* buf) {
+    FILE* f = (FILE*)bd->ctx;
+    uint32_t len = count * bd->block_size;
+    if (count == 0 || block + count > bd->block_count) return -1;
+
+    if (fseek(f, file_offset(bd, block, 0), SEEK_SET) != 0) return -1;
+    return (fwrite(buf, 1, len, f) == len) ? 0 : -1;
+}
+
+static int file_erase(const blockdev_t* bd, uint32_t block) {
+    FILE* f = (FILE*)bd->ctx;
+    uint8_t chunk[256];
+
+    if (block >= bd->block_count) return -1;
+
+    memset(chunk, 0xFF, sizeof(chunk));
+    if (fseek(f, file_offset(bd, block, 0), SEEK_SET) != 0) return -1;
+    for (uint32_t done = 0; done < bd->block_size; done += sizeof(chunk)) {
+        uint32_t n = bd->block_size - done;
+        if (n > sizeof(chunk)) n = sizeof(chunk);
+        if (fwrite(chunk, 1, n, f) != n) return -1;
+    }
+    return 0;
+}
+
+static int file_sync(const blockdev_t* bd) {
+    return (fflush((FILE*)bd->ctx) == 0) ? 0 : -1;
+}
+
+int blockdev_file_open(blockdev_t* bd, const char* path,
+                       uint32_t block_size, uint32_t block_count) {
+    FILE* f = fopen(path, "r+b");
+    int fresh = 0;
+
+    if (!f) {
+        f = fopen(path, "w+b");
+        fresh = 1;
+    }
+    if (!f) return -1;
+
+    bd->block_size = block_size;
+    bd->block_count = block_count;
+    bd->read = file_read;
+    bd->prog = file_prog;
+    bd->erase = file_erase;
+    bd->sync = file_sync;
+    bd->read_blocks = NULL;
+    bd->prog_blocks = NULL;
+    bd->ctx = f;
+
+    if (fresh) {
+        for (uint32_t b = 0; b < block_count; b++) {
+            if (file_erase(bd, b) < 0) {
+                fclose(f);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+int blockdev_file_open_disk(blockdev_t* bd, const char* path, uint32_t block_size) {
+    FILE* f = fopen(path, "r+b");
+    if (!f || block_size == 0) {
+        if (f) fclose(f);
+        return -1;
+    }
+
+    if (fseek(f, 0, SEEK_END) != 0) {
+        fclose(f);
+        return -1;
+    }
+    long size = ftell(f);
+
+    bd->block_size = block_size;
+    bd->block_count = (size > 0) ? (uint32_t)(size / block_size) : 0;
+    bd->read = file_read;
+    bd->prog = file_write;
+    bd->erase = NULL;
+    bd->sync = file_sync;
+    bd->read_blocks = file_read_blocks;
+    bd->prog_blocks = file_write_blocks;
+    bd->ctx = f;
+    return 0;
+}
+
+void blockdev_file_close(blockdev_t* bd) {
+    if (bd && bd->ctx) {
+        fclose((FILE*)bd->ctx);
+        bd->ctx = NULL;
+    }
+}
+
+#endif /* DAOS_HOST */
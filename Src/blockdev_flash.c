@@ -0,0 +1,153 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Dispositivo de bloques sobre la flash interna
+ * ============================================================================
+ * Usa los sectores 6 y 7 (128 KB cada uno) del STM32F446RE como medio
+ * persistente. La programación se hace byte a byte (PSIZE x8), válida en
+ * todo el rango de voltaje de la Nucleo.
+ * ============================================================================
+ */
+
+#include "blockdev.h"
+#include <string.h>
+
+// Registros de la interfaz de flash
+#define FLASH_BASE_REG  0x40023C00
+#define FLASH_ACR       (*(volatile uint32_t*)(FLASH_BASE_REG + 0x00))
+#define FLASH_KEYR      (*(volatile uint32_t*)(FLASH_BASE_REG + 0x04))
+#define FLASH_SR        (*(volatile uint32_t*)(FLASH_BASE_REG + 0x0C))
+#define FLASH_CR        (*(volatile uint32_t*)(FLASH_BASE_REG + 0x10))
+
+#define FLASH_KEY1      0x45670123
+#define FLASH_KEY2      0xCDEF89AB
+
+#define FLASH_CR_PG     (1 << 0)
+#define FLASH_CR_SER    (1 << 1)
+#define FLASH_CR_SNB(n) ((uint32_t)(n) << 3)
+#define FLASH_CR_STRT   (1 << 16)
+#define FLASH_CR_LOCK   (1u << 31)
+
+#define FLASH_SR_BSY    (1 << 16)
+#define FLASH_SR_ERRORS 0xF2        // OPERR | WRPERR | PGAERR | PGPERR | PGSERR
+
+#define FLASH_ACR_DCEN  (1 << 10)
+#define FLASH_ACR_DCRST (1 << 12)
+
+// Región reservada: sectores 6 y 7
+#define FLASHDEV_FIRST_SECTOR 6
+#define FLASHDEV_BASE         0x08040000
+#define FLASHDEV_BLOCK_SIZE   (128 * 1024)
+#define FLASHDEV_BLOCKS       2
+
+/* ========================================================================== */
+/*                          FUNCIONES AUXILIARES                              */
+/* ========================================================================== */
+
+static void flash_wait(void) {
+    while (FLASH_SR & FLASH_SR_BSY);
+}
+
+static void flash_unlock(void) {
+    if (FLASH_CR & FLASH_CR_LOCK) {
+        FLASH_KEYR = FLASH_KEY1;
+        FLASH_KEYR = FLASH_KEY2;
+    }
+}
+
+static void flash_lock(void) {
+    FLASH_CR |= FLASH_CR_LOCK;
+}
+
+/**
+ * Invalidar la caché de datos de la flash tras borrar o programar
+ */
+static void flash_dcache_reset(void) {
+    if (FLASH_ACR & FLASH_ACR_DCEN) {
+        FLASH_ACR &= ~FLASH_ACR_DCEN;
+        FLASH_ACR |= FLASH_ACR_DCRST;
+        FLASH_ACR &= ~FLASH_ACR_DCRST;
+        FLASH_ACR |= FLASH_ACR_DCEN;
+    }
+}
+
+static uint32_t flash_addr(uint32_t block, uint32_t off) {
+    return FLASHDEV_BASE + block * FLASHDEV_BLOCK_SIZE + off;
+}
+
+static int flash_check(const blockdev_t* bd, uint32_t block, uint32_t off, uint32_t len) {
+    return (block < bd->block_count && off + len <= bd->block_size) ? 0 : -1;
+}
+
+/* ========================================================================== */
+/*                          OPERACIONES                                       */
+/* ========================================================================== */
+
+static int flash_read(const blockdev_t* bd, uint32_t block, uint32_t off,
+                      void* buf, uint32_t len) {
+    if (flash_check(bd, block, off, len) < 0) return -1;
+
+    memcpy(buf, (const void*)(uintptr_t)flash_addr(block, off), len);
+    return 0;
+}
+
+static int flash_prog(const blockdev_t* bd, uint32_t block, uint32_t off,
+                      const void* buf, uint32_t len) {
+    if (flash_check(bd, block, off, len) < 0) return -1;
+
+    const uint8_t* src = (const uint8_t*)buf;
+    volatile uint8_t* dst = (volatile uint8_t*)(uintptr_t)flash_addr(block, off);
+    int result = 0;
+
+    flash_unlock();
+    flash_wait();
+    FLASH_SR = FLASH_SR_ERRORS;  // Limpiar errores previos (write-1-to-clear)
+    FLASH_CR = FLASH_CR_PG;      // PSIZE = x8
+
+    for (uint32_t i = 0; i < len; i++) {
+        dst[i] = src[i];
+        flash_wait();
+        if (FLASH_SR & FLASH_SR_ERRORS) {
+            result = -1;
+            break;
+        }
+    }
+
+    FLASH_CR &= ~FLASH_CR_PG;
+    flash_lock();
+    flash_dcache_reset();
+    return result;
+}
+
+static int flash_erase(const blockdev_t* bd, uint32_t block) {
+    if (block >= bd->block_count) return -1;
+
+    flash_unlock();
+    flash_wait();
+    FLASH_SR = FLASH_SR_ERRORS;
+    FLASH_CR = FLASH_CR_SER | FLASH_CR_SNB(FLASHDEV_FIRST_SECTOR + block);
+    FLASH_CR |= FLASH_CR_STRT;
+    flash_wait();
+
+    int result = (FLASH_SR & FLASH_SR_ERRORS) ? -1 : 0;
+
+    FLASH_CR &= ~FLASH_CR_SER;
+    flash_lock();
+    flash_dcache_reset();
+    return result;
+}
+
+static const blockdev_t flash_dev = {
+    .block_size  = FLASHDEV_BLOCK_SIZE,
+    .block_count = FLASHDEV_BLOCKS,
+    .read        = flash_read,
+    .prog        = flash_prog,
+    .erase       = flash_erase,
+    .sync        = NULL,
+    .read_blocks = NULL,
+    .prog_blocks = NULL,
+    .ctx         = NULL,
+};
+
+const blockdev_t* blockdev_flash_get(void) {
+    return &flash_dev;
+}
@@ -0,0 +1,81 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Dispositivo de bloques sobre la tarjeta SD
+ * ============================================================================
+ * Un bloque es un sector de 512 bytes. La tarjeta no necesita borrado:
+ * prog sobrescribe. Las escrituras parciales hacen lectura-modificación-
+ * escritura del sector completo. Las transferencias de varios sectores
+ * usan las órdenes multibloque de la tarjeta.
+ * ============================================================================
+ */
+
+#include "blockdev.h"
+#include "sd.h"
+#include <string.h>
+
+// Sector intermedio para accesos parciales
+static uint8_t sd_scratch[SD_BLOCK_SIZE];
+
+static int sd_check(uint32_t off, uint32_t len) {
+    return (sd_is_ready() && off + len <= SD_BLOCK_SIZE) ? 0 : -1;
+}
+
+static int sd_bd_read(const blockdev_t* bd, uint32_t block, uint32_t off,
+                      void* buf, uint32_t len) {
+    (void)bd;
+    if (sd_check(off, len) < 0) return -1;
+
+    if (off == 0 && len == SD_BLOCK_SIZE) {
+        return sd_read_block(block, (uint8_t*)buf) ? 0 : -1;
+    }
+
+    if (!sd_read_block(block, sd_scratch)) return -1;
+    memcpy(buf, sd_scratch + off, len);
+    return 0;
+}
+
+static int sd_bd_prog(const blockdev_t* bd, uint32_t block, uint32_t off,
+                      const void* buf, uint32_t len) {
+    (void)bd;
+    if (sd_check(off, len) < 0) return -1;
+
+    if (off == 0 && len == SD_BLOCK_SIZE) {
+        return sd_write_block(block, (const uint8_t*)buf) ? 0 : -1;
+    }
+
+    if (!sd_read_block(block, sd_scratch)) return -1;
+    memcpy(sd_scratch + off, buf, len);
+    return sd_write_block(block, sd_scratch) ? 0 : -1;
+}
+
+static int sd_bd_read_blocks(const blockdev_t* bd, uint32_t block, uint32_t count,
+                             void* buf) {
+    (void)bd;
+    if (!sd_is_ready() || count == 0) return -1;
+
+    return sd_read_multi(block, count, (uint8_t*)buf) ? 0 : -1;
+}
+
+static int sd_bd_prog_blocks(const blockdev_t* bd, uint32_t block, uint32_t count,
+                             const void* buf) {
+    (void)bd;
+    if (!sd_is_ready() || count == 0) return -1;
+
+    return sd_write_multi(block, count, (const uint8_t*)buf) ? 0 : -1;
+}
+
+static const blockdev_t sd_dev = {
+    .block_size  = SD_BLOCK_SIZE,
+    .block_count = 0xFFFFFFFF,   // Sin leer el CSD: los límites los pone el BPB
+    .read        = sd_bd_read,
+    .prog        = sd_bd_prog,
+    .erase       = NULL,
+    .sync        = NULL,
+    .read_blocks = sd_bd_read_blocks,
+    .prog_blocks = sd_bd_prog_blocks,
+    .ctx         = NULL,
+};
+
+const blockdev_t* blockdev_sd_get(void) {
+    return &sd_dev;
+}
@@ -0,0 +1,673 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Compositor por tiles
+ * ============================================================================
+ * Ver compositor.h. Memoria: la franja (320 x 16 píxeles, 10 KB), la lista
+ * de primitivas (6 KB), los textos y un hash por tile (1.2 KB).
+ * ============================================================================
+ */
+
+#include "compositor.h"
+#include "raster.h"
+#include "glyph.h"
+#include "pantalla.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                          ESTADO                                            */
+/* ========================================================================== */
+
+#define T COMPOSITOR_TILE
+
+// Bytes que cuesta abrir una ventana (0x2A + 4, 0x2B + 4, 0x2C)
+#define WINDOW_BYTES 11
+
+// Formato de las filas de un sprite (daos_sprite_t en api.h)
+#define SPRITE_ROW_REPEAT 0x8000
+#define SPRITE_LITERAL    0x8000
+
+// Hash FNV-1a de 32 bits por píxel
+#define HASH_SEED  2166136261u
+#define HASH_PRIME 16777619u
+
+enum {
+    OP_FILL,
+    OP_TEXT,
+    OP_CIRCLE,
+    OP_DISC,
+    OP_ROUND_RECT,
+    OP_ROUND_FILL,
+    OP_LINE,
+    OP_TRIANGLE,
+    OP_TRIANGLE_FILL,
+    OP_BITMAP,
+    OP_BITMAP_KEY,
+    OP_SPRITE
+};
+
+typedef struct {
+    uint8_t kind;
+    uint8_t scale;            /** Texto: escala. */
+    uint8_t large;            /** Texto: semántica de pantalla_draw_string_large. */
+    int16_t x, y;             /** Línea y triángulo: primer vértice. */
+    uint16_t w, h;            /** Círculo: w es el radio. Triángulo: segundo vértice. */
+    int16_t top, bottom;      /** Filas que toca: [top, bottom). */
+    uint16_t color;
+    uint16_t bg;              /** Texto: fondo. Bitmap: color clave. */
+    uint16_t stride;          /** Rectángulo redondeado: radio. */
+    union {
+        const uint16_t* pixels;
+        const char* text;
+        int16_t pt[2];        /** Línea: segundo vértice. Triángulo: tercero. */
+    } src;
+} op_t;
+
+enum { FRAME_NONE, FRAME_OPEN, FRAME_SPILLED };
+
+static op_t ops[COMPOSITOR_MAX_OPS];
+static uint16_t op_count;
+static char text_pool[COMPOSITOR_TEXT_POOL];
+static uint16_t text_used;
+static uint8_t frame = FRAME_NONE;
+static uint16_t frame_bg;
+
+// Franja en curso y columnas de tiles que pintó alguna primitiva
+static uint16_t strip[T][SCREEN_WIDTH];
+static int16_t strip_y;
+static uint32_t touched;
+
+// Lo que muestra la pantalla: hash de cada tile y si se conoce
+static uint32_t tile_hash[COMPOSITOR_ROWS][COMPOSITOR_COLS];
+static uint8_t tile_known[COMPOSITOR_ROWS][COMPOSITOR_COLS];
+
+static compositor_stats_t stats;
+
+static void render(void);
+
+/* ========================================================================== */
+/*                          TILES                                             */
+/* ========================================================================== */
+
+/** Dibujado directo en [x0, x1) x [y0, y1): esos tiles ya no se conocen. */
+static void forget(int x0, int y0, int x1, int y1) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > SCREEN_WIDTH) x1 = SCREEN_WIDTH;
+    if (y1 > SCREEN_HEIGHT) y1 = SCREEN_HEIGHT;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int row = y0 / T; row <= (y1 - 1) / T; row++) {
+        for (int col = x0 / T; col <= (x1 - 1) / T; col++) {
+            tile_known[row][col] = 0;
+        }
+    }
+}
+
+static uint32_t hash_tile(uint8_t col) {
+    uint32_t h = HASH_SEED;
+
+    for (uint8_t r = 0; r < T; r++) {
+        const uint16_t* p = &strip[r][col * T];
+        for (uint8_t c = 0; c < T; c++) {
+            h = (h ^ p[c]) * HASH_PRIME;
+        }
+    }
+    return h;
+}
+
+/** Enviar los tiles de la franja que cambiaron; los vecinos van juntos. */
+static void flush_strip(uint8_t row, uint8_t painted, uint32_t bg_hash) {
+    uint8_t dirty[COMPOSITOR_COLS];
+    uint8_t col = 0;
+
+    for (uint8_t c = 0; c < COMPOSITOR_COLS; c++) {
+        uint32_t h = (touched & (1u << c)) ? hash_tile(c) : bg_hash;
+        dirty[c] = !tile_known[row][c] || tile_hash[row][c] != h;
+        tile_hash[row][c] = h;
+        tile_known[row][c] = 1;
+    }
+
+    while (col < COMPOSITOR_COLS) {
+        if (!dirty[col]) {
+            col++;
+            continue;
+        }
+
+        uint8_t start = col;
+        while (col < COMPOSITOR_COLS && dirty[col]) col++;
+
+        uint16_t x = start * T;
+        uint16_t w = (col - start) * T;
+
+        // Sin primitivas en la franja todo es fondo: basta un relleno
+        if (painted) {
+            pantalla_draw_bitmap(x, strip_y, &strip[0][x], w, T, SCREEN_WIDTH);
+        } else {
+            pantalla_fill_rect(x, strip_y, w, T, frame_bg);
+        }
+
+        stats.tiles += col - start;
+        stats.windows++;
+        stats.bytes += WINDOW_BYTES + (uint32_t)w * T * 2;
+    }
+}
+
+/* ========================================================================== */
+/*                          PINTADO EN LA FRANJA                              */
+/* ========================================================================== */
+
+/** Marcar las columnas de tiles de [x0, x1) como pintadas. */
+static void touch(int16_t x0, int16_t x1) {
+    uint32_t first = x0 / T;
+    uint32_t last = (x1 - 1) / T;
+
+    touched |= ((2u << last) - 1) & ~((1u << first) - 1);
+}
+
+/** Filas de [top, bottom) dentro de la franja, relativas a ella. */
+static uint8_t strip_rows(int16_t top, int16_t bottom, int16_t* r0, int16_t* r1) {
+    *r0 = (top > strip_y) ? top - strip_y : 0;
+    *r1 = (bottom < strip_y + T) ? bottom - strip_y : T;
+    return *r0 < *r1;
+}
+
+static void span(int16_t x0, int16_t x1, int16_t r, uint16_t color) {
+    if (x0 < 0) x0 = 0;
+    if (x1 > SCREEN_WIDTH) x1 = SCREEN_WIDTH;
+    if (x0 >= x1) return;
+
+    uint16_t* p = &strip[r][x0];
+    for (int16_t x = x0; x < x1; x++) *p++ = color;
+    touch(x0, x1);
+}
+
+static void plot(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || x >= SCREEN_WIDTH || y < strip_y || y >= strip_y + T) return;
+
+    strip[y - strip_y][x] = color;
+    touch(x, x + 1);
+}
+
+static void draw_fill(const op_t* op) {
+    int16_t r0, r1;
+
+    if (!strip_rows(op->top, op->bottom, &r0, &r1)) return;
+    for (int16_t r = r0; r < r1; r++) span(op->x, op->x + op->w, r, op->color);
+}
+
+// Igual que lcd_glyph en pantalla.c, limitado a la franja
+static void draw_glyph(uint16_t x, uint16_t y, char ch, const uint8_t* glyph, uint16_t color, uint16_t bg, uint8_t scale) {
+    uint16_t w = GLYPH_WIDTH * scale;
+    uint16_t h = GLYPH_HEIGHT * scale;
+    const uint16_t* cached;
+    int16_t r0, r1;
+
+    if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
+    if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+    if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+    if (!strip_rows(y, y + h, &r0, &r1)) return;
+
+    // Ya expandido: se copian sus filas. glyph_pixels puede reescribir el
+    // hueco que lcd_glyph sigue enviando por DMA
+    pantalla_glyph_wait();
+    cached = glyph_pixels(ch, color, bg, scale);
+
+    for (int16_t r = r0; r < r1; r++) {
+        uint8_t mask = 1 << ((strip_y + r - y) / scale);
+        uint16_t* p = &strip[r][x];
+
+        if (cached) {
+            memcpy(p, &cached[(strip_y + r - y) * GLYPH_WIDTH * scale], w * sizeof(uint16_t));
+            continue;
+        }
+        for (uint16_t c = 0; c < w; c++) {
+            *p++ = (glyph[c / scale] & mask) ? color : bg;
+        }
+    }
+    touch(x, x + w);
+}
+
+static void draw_text(const op_t* op) {
+    uint16_t pos_x = (uint16_t)op->x;
+
+    for (const char* s = op->src.text; *s; s++, pos_x += GLYPH_ADVANCE * op->scale) {
+        const uint8_t* glyph = glyph_bits(*s);
+
+        // El texto grande no pinta el fondo de los espacios
+        if (!glyph || (op->large && *s == ' ')) continue;
+        draw_glyph(pos_x, (uint16_t)op->y, *s, glyph, op->color, op->bg, op->scale);
+    }
+}
+
+/** Rectángulo de raster.h: sus filas dentro de la franja. */
+static void strip_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    int16_t r0, r1;
+
+    if (!strip_rows(y, y + h, &r0, &r1)) return;
+    for (int16_t r = r0; r < r1; r++) span(x, x + w, r, color);
+}
+
+// Las figuras se rasterizan igual que en pantalla.c y se quedan con las
+// filas de la franja
+static void draw_shape(const op_t* op) {
+    switch (op->kind) {
+        case OP_CIRCLE:
+        case OP_DISC:
+            raster_circle(op->x, op->y, (int16_t)op->w, op->color, op->kind == OP_DISC, strip_rect);
+            break;
+        case OP_ROUND_RECT:
+        case OP_ROUND_FILL:
+            raster_round_rect(op->x, op->y, (int16_t)op->w, (int16_t)op->h, (int16_t)op->stride,
+                              op->color, op->kind == OP_ROUND_FILL, strip_rect);
+            break;
+        case OP_LINE:
+            raster_line(op->x, op->y, op->src.pt[0], op->src.pt[1], op->color, strip_rect);
+            break;
+        default:
+            raster_triangle(op->x, op->y, (int16_t)op->w, (int16_t)op->h, op->src.pt[0], op->src.pt[1],
+                            op->color, op->kind == OP_TRIANGLE_FILL, strip_rect);
+            break;
+    }
+}
+
+static void draw_bitmap(const op_t* op) {
+    int16_t r0, r1;
+
+    if (!strip_rows(op->top, op->bottom, &r0, &r1)) return;
+
+    for (int16_t r = r0; r < r1; r++) {
+        const uint16_t* src = op->src.pixels + (uint32_t)(strip_y + r - op->y) * op->stride;
+        uint16_t* dst = &strip[r][op->x];
+
+        if (op->kind == OP_BITMAP) {
+            memcpy(dst, src, op->w * sizeof(uint16_t));
+        } else {
+            for (uint16_t c = 0; c < op->w; c++) {
+                if (src[c] != op->bg) dst[c] = src[c];
+            }
+        }
+    }
+    touch(op->x, op->x + op->w);
+}
+
+static uint16_t run_words(const uint16_t* run) {
+    return (run[1] & SPRITE_LITERAL) ? 2 + (run[1] & ~SPRITE_LITERAL) : 3;
+}
+
+static void sprite_row(int16_t x, int16_t r, const uint16_t* run, uint16_t n) {
+    for (; n > 0; n--, run += run_words(run)) {
+        uint16_t len = run[1] & ~SPRITE_LITERAL;
+
+        x += run[0];
+        if (run[1] & SPRITE_LITERAL) {
+            int16_t a = (x < 0) ? 0 : x;
+            int16_t b = (x + len > SCREEN_WIDTH) ? SCREEN_WIDTH : x + len;
+            if (a < b) {
+                memcpy(&strip[r][a], &run[2 + (a - x)], (b - a) * sizeof(uint16_t));
+                touch(a, b);
+            }
+        } else {
+            span(x, x + len, r, run[2]);
+        }
+        x += len;
+    }
+}
+
+static void draw_sprite(const op_t* op) {
+    const uint16_t* data = op->src.pixels;
+    const uint16_t* prev = data;
+    uint16_t prev_n = 0;
+
+    for (uint16_t row = 0; row < op->h; row++) {
+        int16_t py = op->y + row;
+
+        if (*data == SPRITE_ROW_REPEAT) {
+            data++;
+        } else {
+            prev_n = *data++;
+            prev = data;
+            for (uint16_t i = 0; i < prev_n; i++) data += run_words(data);
+        }
+
+        if (py >= strip_y + T) break;
+        if (py >= strip_y && prev_n > 0) sprite_row(op->x, py - strip_y, prev, prev_n);
+    }
+}
+
+static void draw_op(const op_t* op) {
+    switch (op->kind) {
+        case OP_FILL:       draw_fill(op); break;
+        case OP_TEXT:       draw_text(op); break;
+        case OP_CIRCLE:
+        case OP_DISC:
+        case OP_ROUND_RECT:
+        case OP_ROUND_FILL:
+        case OP_LINE:
+        case OP_TRIANGLE:
+        case OP_TRIANGLE_FILL: draw_shape(op); break;
+        case OP_BITMAP:
+        case OP_BITMAP_KEY: draw_bitmap(op); break;
+        case OP_SPRITE:     draw_sprite(op); break;
+        default: break;
+    }
+}
+
+/** Pintar cada franja con las primitivas que la cruzan y enviar lo que cambió. */
+static void render(void) {
+    uint32_t bg_hash = HASH_SEED;
+
+    for (uint16_t i = 0; i < T * T; i++) bg_hash = (bg_hash ^ frame_bg) * HASH_PRIME;
+
+    // Todas las ventanas del cuadro en una sola transacción
+    pantalla_batch_begin();
+    for (uint8_t row = 0; row < COMPOSITOR_ROWS; row++) {
+        uint8_t painted = 0;
+
+        strip_y = row * T;
+        touched = 0;
+
+        for (uint16_t i = 0; i < op_count; i++) {
+            const op_t* op = &ops[i];
+
+            if (op->top >= strip_y + T || op->bottom <= strip_y) continue;
+            if (!painted) {
+                for (uint16_t c = 0; c < SCREEN_WIDTH; c++) strip[0][c] = frame_bg;
+                for (uint8_t r = 1; r < T; r++) memcpy(strip[r], strip[0], sizeof(strip[0]));
+                painted = 1;
+            }
+            draw_op(op);
+        }
+
+        flush_strip(row, painted, bg_hash);
+    }
+    pantalla_batch_end();
+}
+
+/* ========================================================================== */
+/*                          CUADROS                                           */
+/* ========================================================================== */
+
+void compositor_begin(uint16_t bg) {
+    if (frame != FRAME_NONE) return;
+
+    frame = FRAME_OPEN;
+    frame_bg = bg;
+    op_count = 0;
+    text_used = 0;
+}
+
+void compositor_end(void) {
+    if (frame == FRAME_NONE) return;
+    if (frame == FRAME_OPEN) render();
+
+    frame = FRAME_NONE;
+    stats.frames++;
+}
+
+uint8_t compositor_active(void) {
+    return frame == FRAME_OPEN;
+}
+
+void compositor_invalidate(void) {
+    memset(tile_known, 0, sizeof(tile_known));
+}
+
+void compositor_get_stats(compositor_stats_t* out) {
+    if (out) *out = stats;
+}
+
+/**
+ * La lista se llenó: enviar ya lo anotado y dibujar el resto del cuadro
+ * directamente (marcando sus tiles como desconocidos).
+ */
+static void spill(void) {
+    render();
+    frame = FRAME_SPILLED;
+    stats.spills++;
+}
+
+/** Reservar una primitiva. @return NULL si no hay cuadro o no cabe. */
+static op_t* new_op(uint8_t kind, int16_t top, int16_t bottom) {
+    op_t* op;
+
+    if (frame != FRAME_OPEN) return NULL;
+    if (op_count == COMPOSITOR_MAX_OPS) {
+        spill();
+        return NULL;
+    }
+
+    op = &ops[op_count++];
+    op->kind = kind;
+    op->top = top;
+    op->bottom = bottom;
+    stats.ops++;
+    return op;
+}
+
+/** Extender el relleno anterior si el nuevo es contiguo y del mismo color. */
+static uint8_t merge_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    op_t* prev;
+
+    if (frame != FRAME_OPEN || op_count == 0) return 0;
+    prev = &ops[op_count - 1];
+    if (prev->kind != OP_FILL || prev->color != color) return 0;
+
+    if (prev->y == y && prev->h == h) {
+        if (prev->x + prev->w == x) {
+            prev->w += w;
+        } else if (x + w == prev->x) {
+            prev->x = x;
+            prev->w += w;
+        } else {
+            return 0;
+        }
+    } else if (prev->x == x && prev->w == w) {
+        if (prev->y + prev->h == y) {
+            prev->h += h;
+        } else if (y + h == prev->y) {
+            prev->y = y;
+            prev->h += h;
+        } else {
+            return 0;
+        }
+        prev->top = prev->y;
+        prev->bottom = prev->y + prev->h;
+    } else {
+        return 0;
+    }
+
+    stats.merged++;
+    return 1;
+}
+
+/* ========================================================================== */
+/*                          PRIMITIVAS                                        */
+/* ========================================================================== */
+
+int compositor_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    op_t* op;
+
+    if (w == 0 || h == 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return 0;
+    if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+    if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+
+    // Un relleno de toda la pantalla tapa todo lo anterior
+    if (frame == FRAME_OPEN && w == SCREEN_WIDTH && h == SCREEN_HEIGHT) {
+        frame_bg = color;
+        op_count = 0;
+        text_used = 0;
+        return 0;
+    }
+
+    if (merge_fill(x, y, w, h, color)) return 0;
+
+    op = new_op(OP_FILL, y, y + h);
+    if (op) {
+        op->x = x;
+        op->y = y;
+        op->w = w;
+        op->h = h;
+        op->color = color;
+        return 0;
+    }
+
+    forget(x, y, x + w, y + h);
+    return -1;
+}
+
+int compositor_text(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg, uint8_t scale, uint8_t large) {
+    uint16_t len;
+    op_t* op = NULL;
+
+    if (!str || scale == 0 || y >= SCREEN_HEIGHT) return 0;
+    len = strlen(str);
+    if (len == 0) return 0;
+
+    if (frame == FRAME_OPEN) {
+        if (text_used + len + 1 > COMPOSITOR_TEXT_POOL) {
+            spill();
+        } else {
+            op = new_op(OP_TEXT, y, y + 8 * scale);
+        }
+    }
+
+    if (op) {
+        op->x = x;
+        op->y = y;
+        op->scale = scale;
+        op->large = large;
+        op->color = color;
+        op->bg = bg;
+        op->src.text = &text_pool[text_used];
+        memcpy(&text_pool[text_used], str, len + 1);
+        text_used += len + 1;
+        return 0;
+    }
+
+    forget((int16_t)x, y, (int16_t)x + len * 6 * scale, y + 8 * scale);
+    return -1;
+}
+
+int compositor_circle(int16_t x0, int16_t y0, uint16_t radius, uint16_t color, uint8_t filled) {
+    op_t* op = new_op(filled ? OP_DISC : OP_CIRCLE, y0 - radius, y0 + radius + 1);
+
+    if (op) {
+        op->x = x0;
+        op->y = y0;
+        op->w = radius;
+        op->color = color;
+        return 0;
+    }
+
+    forget(x0 - radius, y0 - radius, x0 + radius + 1, y0 + radius + 1);
+    return -1;
+}
+
+int compositor_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color, uint8_t filled) {
+    op_t* op;
+
+    if (w <= 0 || h <= 0) return 0;
+
+    op = new_op(filled ? OP_ROUND_FILL : OP_ROUND_RECT, y, y + h);
+    if (op) {
+        op->x = x;
+        op->y = y;
+        op->w = w;
+        op->h = h;
+        op->stride = r;
+        op->color = color;
+        return 0;
+    }
+
+    forget(x, y, x + w, y + h);
+    return -1;
+}
+
+int compositor_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int16_t top = (y0 < y1) ? y0 : y1;
+    int16_t bottom = (y0 < y1) ? y1 : y0;
+    op_t* op = new_op(OP_LINE, top, bottom + 1);
+
+    if (op) {
+        op->x = x0;
+        op->y = y0;
+        op->src.pt[0] = x1;
+        op->src.pt[1] = y1;
+        op->color = color;
+        return 0;
+    }
+
+    forget((x0 < x1) ? x0 : x1, top, ((x0 < x1) ? x1 : x0) + 1, bottom + 1);
+    return -1;
+}
+
+int compositor_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color, uint8_t filled) {
+    int16_t left = x0, right = x0, top = y0, bottom = y0;
+    op_t* op;
+
+    if (x1 < left) left = x1;
+    if (x2 < left) left = x2;
+    if (x1 > right) right = x1;
+    if (x2 > right) right = x2;
+    if (y1 < top) top = y1;
+    if (y2 < top) top = y2;
+    if (y1 > bottom) bottom = y1;
+    if (y2 > bottom) bottom = y2;
+
+    op = new_op(filled ? OP_TRIANGLE_FILL : OP_TRIANGLE, top, bottom + 1);
+    if (op) {
+        op->x = x0;
+        op->y = y0;
+        op->w = x1;
+        op->h = y1;
+        op->src.pt[0] = x2;
+        op->src.pt[1] = y2;
+        op->color = color;
+        return 0;
+    }
+
+    forget(left, top, right + 1, bottom + 1);
+    return -1;
+}
+
+int compositor_bitmap(uint16_t x, uint16_t y, const uint16_t* src, uint16_t w, uint16_t h, uint16_t stride, uint8_t keyed, uint16_t key) {
+    op_t* op;
+
+    if (!src || w == 0 || h == 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return 0;
+    if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+    if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+
+    op = new_op(keyed ? OP_BITMAP_KEY : OP_BITMAP, y, y + h);
+    if (op) {
+        op->x = x;
+        op->y = y;
+        op->w = w;
+        op->h = h;
+        op->stride = stride;
+        op->bg = key;
+        op->src.pixels = src;
+        return 0;
+    }
+
+    forget(x, y, x + w, y + h);
+    return -1;
+}
+
+int compositor_sprite(int16_t x, int16_t y, const uint16_t* data, uint16_t w, uint16_t h) {
+    op_t* op;
+
+    if (!data) return 0;
+
+    op = new_op(OP_SPRITE, y, y + h);
+    if (op) {
+        op->x = x;
+        op->y = y;
+        op->w = w;
+        op->h = h;
+        op->src.pixels = data;
+        return 0;
+    }
+
+    forget(x, y, x + w, y + h);
+    return -1;
+}
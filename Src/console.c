@@ -0,0 +1,308 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Consola de texto en una región de la pantalla
+ * ============================================================================
+ * Ver console.h. Memoria: dos copias de la franja (texto y color por
+ * celda), 4.2 KB con 20 filas.
+ * Como en dlist.c, las tareas no se interrumpen entre sí a mitad de una
+ * función: escribir (tarea del shell) y dibujar (tarea del LCD) no
+ * necesitan sección crítica.
+ * ============================================================================
+ */
+
+#include "console.h"
+#include <string.h>
+
+/** Color de una celda que no se sabe qué muestra: se redibuja seguro. */
+#define UNKNOWN 0xFF
+
+/* ========================================================================== */
+/*                          ESTADO                                            */
+/* ========================================================================== */
+
+// Lo escrito, por líneas del anillo: la fila de pantalla r es la línea
+// (top + r) % rows
+static char text[CONSOLE_MAX_ROWS][CONSOLE_COLS];
+static uint8_t attr[CONSOLE_MAX_ROWS][CONSOLE_COLS];
+
+// Lo que muestra el panel, por filas de pantalla
+static char shown_text[CONSOLE_MAX_ROWS][CONSOLE_COLS];
+static uint8_t shown_attr[CONSOLE_MAX_ROWS][CONSOLE_COLS];
+
+static uint16_t palette_color[CONSOLE_COLORS];
+static uint16_t palette_bg[CONSOLE_COLORS];
+static uint8_t num_colors;
+static uint8_t next_replace;          // Pareja que se reemplaza con la paleta llena
+static uint8_t current;               // Color de lo que se escribe
+
+static uint16_t origin_y;
+static uint8_t rows;
+static uint8_t top;
+static uint8_t col, row;              // Cursor (col == CONSOLE_COLS: salta al escribir)
+static uint8_t cursor_on;
+
+// Secuencias: ESC [ n letra, y UTF-8 a medio leer
+static uint8_t esc;
+static uint8_t esc_param;
+static uint32_t utf8_code;
+static uint8_t utf8_left;
+
+static console_stats_t stats;
+
+#define LINE(r) ((top + (r)) % rows)
+
+static void blank_line(uint8_t line) {
+    memset(text[line], ' ', CONSOLE_COLS);
+    memset(attr[line], current, CONSOLE_COLS);
+}
+
+void console_init(uint16_t y, uint8_t num_rows) {
+    uint16_t fit = (y < SCREEN_HEIGHT) ? (SCREEN_HEIGHT - y) / CONSOLE_ROW_HEIGHT : 0;
+
+    if (num_rows > CONSOLE_MAX_ROWS) num_rows = CONSOLE_MAX_ROWS;
+    if (num_rows > fit) num_rows = (uint8_t)fit;
+
+    origin_y = y;
+    rows = num_rows;
+
+    palette_color[0] = COLOR_WHITE;
+    palette_bg[0] = COLOR_BLACK;
+    num_colors = 1;
+    next_replace = 0;
+    current = 0;
+
+    cursor_on = 0;
+    esc = 0;
+    utf8_left = 0;
+    memset(shown_attr, UNKNOWN, sizeof(shown_attr));
+    memset(&stats, 0, sizeof(stats));
+    console_clear();
+}
+
+void console_set_color(uint16_t color, uint16_t bg) {
+    uint8_t i;
+
+    for (i = 0; i < num_colors; i++) {
+        if (palette_color[i] == color && palette_bg[i] == bg) {
+            current = i;
+            return;
+        }
+    }
+
+    if (num_colors < CONSOLE_COLORS) {
+        i = num_colors++;
+    } else {
+        // Lo escrito con la pareja reemplazada cambia de color: redibujarlo
+        i = next_replace;
+        next_replace = (next_replace + 1) % CONSOLE_COLORS;
+        for (uint8_t r = 0; r < rows; r++) {
+            for (uint8_t c = 0; c < CONSOLE_COLS; c++) {
+                if (shown_attr[r][c] == i) shown_attr[r][c] = UNKNOWN;
+            }
+        }
+    }
+
+    palette_color[i] = color;
+    palette_bg[i] = bg;
+    current = i;
+}
+
+void console_clear(void) {
+    for (uint8_t line = 0; line < rows; line++) blank_line(line);
+    top = 0;
+    col = 0;
+    row = 0;
+}
+
+/* ========================================================================== */
+/*                          ESCRIBIR                                          */
+/* ========================================================================== */
+
+static void newline(void) {
+    col = 0;
+    if (row + 1 < rows) {
+        row++;
+        return;
+    }
+
+    // La línea de arriba pasa a ser la nueva de abajo
+    top = (top + 1) % rows;
+    blank_line(LINE(rows - 1));
+    stats.scrolls++;
+}
+
+static void put_cell(char c) {
+    if (rows == 0) return;
+    if (col >= CONSOLE_COLS) newline();
+
+    text[LINE(row)][col] = c;
+    attr[LINE(row)][col] = current;
+    col++;
+    stats.chars++;
+}
+
+/** Carácter de caja de UTF-8 (U+2500 a U+257F) en ASCII; 0 si no tiene. */
+static char box_char(uint32_t code) {
+    if (code < 0x2500 || code > 0x257F) return 0;
+    if (code == 0x2550) return '=';
+    if (code == 0x2500 || code == 0x2501) return '-';
+    if (code == 0x2502 || code == 0x2503 || code == 0x2551) return '|';
+    return '+';
+}
+
+static void put_utf8(uint8_t b) {
+    if ((b & 0xC0) == 0x80) {
+        if (utf8_left == 0) return;
+        utf8_code = (utf8_code << 6) | (b & 0x3F);
+        if (--utf8_left == 0 && box_char(utf8_code)) put_cell(box_char(utf8_code));
+        return;
+    }
+
+    if ((b & 0xE0) == 0xC0) {
+        utf8_code = b & 0x1F;
+        utf8_left = 1;
+    } else if ((b & 0xF0) == 0xE0) {
+        utf8_code = b & 0x0F;
+        utf8_left = 2;
+    } else {
+        utf8_code = b & 0x07;
+        utf8_left = 3;
+    }
+}
+
+/** ESC [ n letra: solo importan 2J (borrar) y H (cursor al principio). */
+static void put_escape(char c) {
+    if (esc == 1) {
+        esc = (c == '[') ? 2 : 0;
+        esc_param = 0;
+        return;
+    }
+
+    if (c >= '0' && c <= '9') {
+        esc_param = (uint8_t)(esc_param * 10 + (c - '0'));
+        return;
+    }
+    if (c == ';') {
+        esc_param = 0;
+        return;
+    }
+
+    if (c == 'J' && esc_param == 2) {
+        uint8_t keep_col = col, keep_row = row;
+
+        console_clear();
+        col = keep_col;
+        row = keep_row;
+    } else if (c == 'H') {
+        col = 0;
+        row = 0;
+    }
+    esc = 0;
+}
+
+void console_putc(char c) {
+    uint8_t b = (uint8_t)c;
+
+    if (esc) {
+        put_escape(c);
+        return;
+    }
+    if (b >= 0x80) {
+        put_utf8(b);
+        return;
+    }
+    utf8_left = 0;
+
+    switch (c) {
+        case '\n':
+            if (rows) newline();
+            break;
+        case '\r':
+            col = 0;
+            break;
+        case '\b':
+            if (col > 0) col--;
+            break;
+        case '\t':
+            do {
+                put_cell(' ');
+            } while (col % 8 != 0 && col < CONSOLE_COLS);
+            break;
+        case '\033':
+            esc = 1;
+            break;
+        default:
+            if (b >= 0x20 && b < 0x7F) put_cell(c);
+            break;
+    }
+}
+
+void console_puts(const char* str) {
+    if (!str) return;
+    while (*str) console_putc(*str++);
+}
+
+void console_write_at(uint8_t at_col, uint8_t at_row, const char* str) {
+    uint8_t line;
+
+    if (!str || at_row >= rows) return;
+    line = LINE(at_row);
+
+    for (uint8_t c = at_col; c < CONSOLE_COLS && *str; c++, str++) {
+        text[line][c] = (*str >= 0x20 && *str < 0x7F) ? *str : ' ';
+        attr[line][c] = current;
+    }
+}
+
+void console_cursor(uint8_t visible) {
+    cursor_on = visible;
+}
+
+/* ========================================================================== */
+/*                          DIBUJAR                                           */
+/* ========================================================================== */
+
+void console_flush(void) {
+    char want[CONSOLE_COLS];
+
+    if (rows == 0) return;
+
+    pantalla_batch_begin();
+    for (uint8_t r = 0; r < rows; r++) {
+        const uint8_t* a = attr[LINE(r)];
+        char* st = shown_text[r];
+        uint8_t* sa = shown_attr[r];
+        uint8_t c = 0;
+
+        memcpy(want, text[LINE(r)], CONSOLE_COLS);
+        if (cursor_on && r == row && col < CONSOLE_COLS && want[col] == ' ') want[col] = '_';
+
+        while (c < CONSOLE_COLS) {
+            uint8_t start = c;
+            uint8_t color = a[c];
+
+            if (want[c] == st[c] && color == sa[c]) {
+                c++;
+                continue;
+            }
+
+            // Tramo de celdas cambiadas seguidas, del mismo color
+            while (c < CONSOLE_COLS && a[c] == color && (want[c] != st[c] || a[c] != sa[c])) {
+                st[c] = want[c];
+                sa[c] = color;
+                c++;
+            }
+
+            pantalla_draw_text_cells(start * GLYPH_ADVANCE, origin_y + r * CONSOLE_ROW_HEIGHT,
+                                     &want[start], c - start, CONSOLE_ROW_HEIGHT,
+                                     palette_color[color], palette_bg[color]);
+            stats.cells += c - start;
+            stats.runs++;
+        }
+    }
+    pantalla_batch_end();
+}
+
+void console_get_stats(console_stats_t* out) {
+    if (out) *out = stats;
+}
@@ -1,97 +1,13 @@
 #include "disco.h"
 #include "api.h"
+#include "sprites_disco.h"  // Sprites generados desde assets/disco.sprites
 #include "sync.h"
 
 // ========================================================================
-// CONSTANTES Y ARRAYS DE SPRITES - 25x25
+// SPRITES - 25x25 (ver sprites_disco.h)
 // ========================================================================
 #define SPRITE_WIDTH 25
 #define SPRITE_HEIGHT 25
-#define SPRITE_SIZE (10 * 10)
-
-// Frame: Player 1 Idle 2 - AZUL
-static const uint32_t sprite_p1_idle2[100] = {
-    0x00000000, 0x00000000, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xff74e3e4, 0x00000000, 0x00000000,
-    0x00000000, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0xff1c1c1c, 0xffc8e4e4, 0xff1c1c1c, 0xffc8e4e4, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0x00000000, 0x00000000,
-    0x00000000, 0xff42bebf, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xff42bebf, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xff42bebf, 0xff42bebf, 0x00000000, 0xff42bebf, 0xff42bebf, 0x00000000, 0x00000000, 0x00000000
-};
-
-static const uint32_t sprite_p1_idle1[100] = {
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xff74e3e4, 0x00000000, 0x00000000,
-    0x00000000, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0xff1c1c1c, 0xffc8e4e4, 0xff1c1c1c, 0xffc8e4e4, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0x00000000, 0x00000000,
-    0x00000000, 0xff42bebf, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xff42bebf, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xff42bebf, 0xff42bebf, 0x00000000, 0xff42bebf, 0xff42bebf, 0x00000000, 0x00000000, 0x00000000
-};
-
-// Frame: Player 2 Idle 2 - NEGRO con ROJO
-static const uint32_t sprite_p2_idle2[100] = {
-    0x00000000, 0x00000000, 0x00000000, 0xff110000, 0xffff0000, 0xffff0000, 0xff110000, 0xff110000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xffff0000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xffff0000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xff110000, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff110000, 0xff110000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff222222, 0xff110000, 0xff222222, 0xff222222, 0xff222222, 0xff110000, 0x00000000,
-    0x00000000, 0x00000000, 0xff222222, 0xffff0000, 0xff222222, 0xffff0000, 0xff110000, 0xff110000, 0xff222222, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0xff110000, 0xffff0000, 0xff110000, 0xff110000, 0xff110000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0xff222222, 0xff222222, 0x00000000, 0xff222222, 0xff222222, 0x00000000, 0x00000000
-};
-
-static const uint32_t sprite_p2_idle1[100] = {
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0xff110000, 0xffff0000, 0xffff0000, 0xff110000, 0xff110000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xffff0000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xffff0000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xff110000, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff110000, 0xff110000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff222222, 0xff110000, 0xff222222, 0xff222222, 0xff222222, 0xff110000, 0x00000000,
-    0x00000000, 0x00000000, 0xff222222, 0xffff0000, 0xff222222, 0xffff0000, 0xff110000, 0xff110000, 0xff222222, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0xff110000, 0xffff0000, 0xff110000, 0xff110000, 0xff110000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0xff222222, 0xff222222, 0x00000000, 0xff222222, 0xff222222, 0x00000000, 0x00000000
-};
-
-// Frame: Player 1 Disparando
-static const uint32_t sprite_p1_shoot[100] = {
-    0x00000000, 0x00000000, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xff74e3e4, 0x00000000, 0x00000000,
-    0x00000000, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0xff1c1c1c, 0xffc8e4e4, 0xff1c1c1c, 0xffc8e4e4, 0x00000000, 0x00000000,
-    0x00000000, 0xff74e3e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0x00000000,
-    0x00000000, 0xffc8e4e4, 0xffc8e4e4, 0xff74e3e4, 0xff74e3e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0xffc8e4e4, 0x00000000,
-    0x00000000, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0x00000000,
-    0x00000000, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0xff74e3e4, 0xffc8e4e4, 0x00000000
-};
-
-// Frame: Player 2 Disparando
-static const uint32_t sprite_p2_shoot[100] = {
-    0x00000000, 0x00000000, 0x00000000, 0xff110000, 0xffff0000, 0xffff0000, 0xff110000, 0xff110000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xffff0000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xffff0000, 0x00000000,
-    0x00000000, 0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff110000, 0xff110000, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff110000, 0xff110000, 0x00000000, 0x00000000,
-    0x00000000, 0xff110000, 0xff110000, 0xff110000, 0xff110000, 0xff222222, 0xff110000, 0xff222222, 0x00000000, 0x00000000,
-    0x00000000, 0xff110000, 0xff110000, 0xffff0000, 0xffff0000, 0xff110000, 0xff110000, 0xff222222, 0x00000000, 0x00000000,
-    0x00000000, 0xff110000, 0xffff0000, 0xff110000, 0xff110000, 0xffff0000, 0xff222222, 0xff110000, 0x00000000, 0x00000000,
-    0x00000000, 0xff110000, 0xffff0000, 0xff110000, 0xff110000, 0xffff0000, 0xff222222, 0xff110000, 0x00000000, 0x00000000
-};
 
 // ========================================================================
 // CONSTANTES DE JUEGO
@@ -183,22 +99,6 @@ static uint32_t last_p2_down_count = 0;
 static uint32_t last_p2_shield_count = 0;
 static uint32_t last_d15_count = 0;
 
-// Tarea de Renderizado
-static uint8_t first_draw = 1;
-static int16_t last_p1_x = 0, last_p1_y = 0;
-static int16_t last_p2_x = 0, last_p2_y = 0;
-static uint8_t last_p1_lane = 1;
-static uint8_t last_p2_lane = 1;
-static uint8_t last_shield_p1 = 0;
-static uint8_t last_shield_p2 = 0;
-static uint8_t last_layers[6] = {3, 3, 3, 3, 3, 3};
-static int16_t last_shot_x_p1[MAX_SHOTS] = {-1, -1, -1};
-static int16_t last_shot_y_p1[MAX_SHOTS] = {-1, -1, -1};
-static int16_t last_shot_x_p2[MAX_SHOTS] = {-1, -1, -1};
-static int16_t last_shot_y_p2[MAX_SHOTS] = {-1, -1, -1};
-// VARIABLE PARA EL ESTADO DE LAS BOLAS DE TIEMPO
-static uint8_t last_time_ball_state = 3;
-
 
 /* ============================================================ */
 /* MUTEXES Y SEMÁFOROS PARA SINCRONIZACIÓN            */
@@ -259,133 +159,23 @@ static uint32_t get_simulated_time(void) {
 /* FUNCIONES AUXILIARES DE DIBUJO                              */
 /* ============================================================ */
 
-static void draw_sprite_at(int16_t x, int16_t y, const uint32_t* sprite_data) {
-    for (uint8_t row = 0; row < SPRITE_HEIGHT; row++) {
-        uint8_t data_row = (row * 10) / SPRITE_HEIGHT;
-        if (data_row >= 10) data_row = 9;
-
-        for (uint8_t col = 0; col < SPRITE_WIDTH; col++) {
-            uint8_t data_col = (col * 10) / SPRITE_WIDTH;
-            if (data_col >= 10) data_col = 9;
-
-            uint32_t color_32bit = sprite_data[data_row * 10 + data_col];
-
-            if ((color_32bit >> 24) != 0x00) {
-                uint8_t r = (color_32bit >> 16) & 0xFF;
-                uint8_t g = (color_32bit >> 8) & 0xFF;
-                uint8_t b = color_32bit & 0xFF;
-                uint16_t color_16bit = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-                daos_gfx_draw_pixel(x - 12 + col, y - 12 + row, color_16bit);
-            }
-        }
-    }
+// Sprite centrado en (x, y)
+static void draw_sprite_at(int16_t x, int16_t y, const daos_sprite_t* sprite) {
+    daos_gfx_draw_sprite(x - SPRITE_WIDTH / 2, y - SPRITE_HEIGHT / 2, sprite);
 }
 
-static void draw_platform(Platform* p) {
-    if (!p->exists) {
-        daos_gfx_draw_circle_filled(p->center_x, p->center_y, p->radius_outer + 2, COLOR_BLACK);
-        return;
-    }
+// Capas sobre el fondo negro del cuadro
+static void draw_platform(const Platform* p) {
+    if (!p->exists) return;
 
     if (p->layer >= 3) {
         daos_gfx_draw_circle_filled(p->center_x, p->center_y, p->radius_outer, COLOR_YELLOW);
-    } else {
-        daos_gfx_draw_circle_filled(p->center_x, p->center_y, p->radius_outer, COLOR_BLACK);
     }
-
     if (p->layer >= 2) {
         daos_gfx_draw_circle_filled(p->center_x, p->center_y, p->radius_middle, COLOR_ORANGE);
-    } else if (p->layer < 3) {
-        daos_gfx_draw_circle_filled(p->center_x, p->center_y, p->radius_middle, COLOR_BLACK);
     }
-
     if (p->layer >= 1) {
         daos_gfx_draw_circle_filled(p->center_x, p->center_y, p->radius_inner, COLOR_RED);
-    } else {
-        daos_gfx_draw_circle_filled(p->center_x, p->center_y, p->radius_inner, COLOR_BLACK);
-    }
-}
-
-static void erase_player_at(int16_t x, int16_t y, uint8_t lane_idx) {
-    int16_t erase_x_start = x - 15;
-    int16_t erase_y_start = y - 15;
-    int16_t erase_width = 31;
-    int16_t erase_height = 31;
-
-    if (lane_idx >= 6) return;
-
-    // PROTECCIÓN: Leer estado de escudos
-    mutex_lock(&disco_player_mutex);
-    uint8_t local_shield_p1 = shield_p1;
-    uint8_t local_shield_p2 = shield_p2;
-    mutex_unlock(&disco_player_mutex);
-
-    // Borrar escudo si estaba activo
-    if ((lane_idx < 3 && last_shield_p1) || (lane_idx >= 3 && last_shield_p2)) {
-        // PROTECCIÓN: Leer plataforma
-        mutex_lock(&disco_platform_mutex);
-        Platform p = platforms[lane_idx];
-        mutex_unlock(&disco_platform_mutex);
-
-        // Lógica de escudo: P1 defiende derecha, P2 defiende izquierda
-        int16_t line_x_center;
-        if (lane_idx < 3) { // P1
-             // P1 defiende derecha (lado del oponente)
-             line_x_center = p.center_x + p.radius_outer + 1;
-        } else { // P2
-             // P2 defiende izquierda (lado del oponente)
-             line_x_center = p.center_x - p.radius_outer - 1;
-        }
-
-        int16_t line_y_start = p.center_y - p.radius_outer - 1;
-        int16_t line_y_end = p.center_y + p.radius_outer + 1;
-        daos_gfx_fill_rect(line_x_center - 1, line_y_start, 3, line_y_end - line_y_start + 1, COLOR_BLACK);
-    }
-
-    // PROTECCIÓN: Leer estado de plataforma
-    mutex_lock(&disco_platform_mutex);
-    Platform p = platforms[lane_idx];
-    mutex_unlock(&disco_platform_mutex);
-
-    if (!p.exists) {
-        daos_gfx_fill_rect(erase_x_start, erase_y_start, erase_width, erase_height, COLOR_BLACK);
-        return;
-    }
-
-    // Redibujar área con color de plataforma
-    for (int dy = -15; dy <= 15; dy++) {
-        for (int dx = -15; dx <= 15; dx++) {
-            int16_t px = x + dx;
-            int16_t py = y + dy;
-
-            int16_t dist_x = px - p.center_x;
-            int16_t dist_y = py - p.center_y;
-            uint32_t dist_sq = (uint32_t)dist_x * dist_x + (uint32_t)dist_y * dist_y;
-
-            uint32_t r_outer_sq = (uint32_t)p.radius_outer * p.radius_outer;
-            uint32_t r_middle_sq = (uint32_t)p.radius_middle * p.radius_middle;
-            uint32_t r_inner_sq = (uint32_t)p.radius_inner * p.radius_inner;
-
-            if (p.layer >= 3 && dist_sq <= r_outer_sq) {
-                if (p.layer >= 1 && dist_sq <= r_inner_sq) {
-                    daos_gfx_draw_pixel(px, py, COLOR_RED);
-                } else if (p.layer >= 2 && dist_sq <= r_middle_sq) {
-                    daos_gfx_draw_pixel(px, py, COLOR_ORANGE);
-                } else {
-                    daos_gfx_draw_pixel(px, py, COLOR_YELLOW);
-                }
-            } else if (p.layer == 2 && dist_sq <= r_middle_sq) {
-                if (p.layer >= 1 && dist_sq <= r_inner_sq) {
-                    daos_gfx_draw_pixel(px, py, COLOR_RED);
-                } else {
-                    daos_gfx_draw_pixel(px, py, COLOR_ORANGE);
-                }
-            } else if (p.layer == 1 && dist_sq <= r_inner_sq) {
-                daos_gfx_draw_pixel(px, py, COLOR_RED);
-            } else {
-                daos_gfx_draw_pixel(px, py, COLOR_BLACK);
-            }
-        }
     }
 }
 
@@ -845,91 +635,34 @@ void disco_render_task(void) {
         return;
     }
 
-    if (first_draw) {
-        daos_gfx_clear(COLOR_BLACK);
-
-        mutex_lock(&disco_platform_mutex);
-        for (uint8_t i = 0; i < 6; i++) {
-            draw_platform(&platforms[i]);
-            last_layers[i] = platforms[i].layer;
-        }
-        mutex_unlock(&disco_platform_mutex);
-
-        // INICIALIZAR ÁREA DE LAS BOLAS DE TIEMPO
-        daos_gfx_fill_rect(120, 0, 80, 20, COLOR_BLACK);
-        last_time_ball_state = 3;
-        // FIN DE INICIALIZACIÓN
-
-        mutex_lock(&disco_player_mutex);
-        mutex_lock(&disco_platform_mutex);
-        Platform p1 = platforms[player1_lane];
-        last_p1_x = p1.center_x;
-        last_p1_y = p1.center_y;
-
-        Platform p2 = platforms[player2_lane + 3];
-        last_p2_x = p2.center_x;
-        last_p2_y = p2.center_y;
-
-        last_p1_lane = player1_lane;
-        last_p2_lane = player2_lane;
-        last_shield_p1 = shield_p1;
-        last_shield_p2 = shield_p2;
-        mutex_unlock(&disco_platform_mutex);
-        mutex_unlock(&disco_player_mutex);
-
-        for (uint8_t i = 0; i < MAX_SHOTS; i++) {
-            last_shot_x_p1[i] = -1;
-            last_shot_y_p1[i] = -1;
-            last_shot_x_p2[i] = -1;
-            last_shot_y_p2[i] = -1;
-        }
-
-        first_draw = 0;
-    }
-
-    // Marcadores superiores
-    char buffer[10];
+    // Cada cuadro dibuja la escena completa sobre negro; el compositor solo
+    // envía los tiles que cambiaron, así no hay que borrar lo anterior
+    daos_gfx_frame_begin(COLOR_BLACK);
 
+    // Plataformas
     mutex_lock(&disco_platform_mutex);
+    for (uint8_t i = 0; i < 6; i++) {
+        draw_platform(&platforms[i]);
+    }
     uint8_t p1_count = platforms[0].exists + platforms[1].exists + platforms[2].exists;
     uint8_t p2_count = platforms[3].exists + platforms[4].exists + platforms[5].exists;
     mutex_unlock(&disco_platform_mutex);
 
-    // P1 Score y Escudo
+    // Marcadores superiores
+    char buffer[10];
+
     daos_gfx_draw_text(5, 5, "P1:", COLOR_P1, COLOR_BLACK);
     integer_to_string(p1_count, buffer);
     daos_gfx_draw_text(35, 5, buffer, COLOR_WHITE, COLOR_BLACK);
 
-    mutex_lock(&disco_player_mutex);
-    // Texto SHIELD eliminado aquí
-    if (shield_p1) {
-        daos_gfx_fill_rect(60, 5, 50, 8, COLOR_BLACK); // Limpiar área del texto SHIELD
-    } else {
-        daos_gfx_fill_rect(60, 5, 50, 8, COLOR_BLACK);
-    }
-    mutex_unlock(&disco_player_mutex);
-
-    // P2 Score y Escudo
     daos_gfx_draw_text(240, 5, "P2:", COLOR_P2, COLOR_BLACK);
     integer_to_string(p2_count, buffer);
     daos_gfx_draw_text(270, 5, buffer, COLOR_WHITE, COLOR_BLACK);
 
-    mutex_lock(&disco_player_mutex);
-    // Texto SHIELD eliminado aquí
-    if (shield_p2) {
-        daos_gfx_fill_rect(180, 5, 50, 8, COLOR_BLACK); // Limpiar área del texto SHIELD
-    } else {
-        daos_gfx_fill_rect(180, 5, 50, 8, COLOR_BLACK);
-    }
-    mutex_unlock(&disco_player_mutex);
-
-    // **LÓGICA DEL CRONÓMETRO DE CÍRCULOS MODIFICADA PARA 15 SEGUNDOS**
+    // **CRONÓMETRO DE CÍRCULOS PARA 15 SEGUNDOS**
     uint32_t elapsed_ms = simulated_time_ms - start_time_ms;
     uint32_t remaining_s = (MAX_GAME_TIME_MS > elapsed_ms) ? (MAX_GAME_TIME_MS - elapsed_ms) / 1000 : 0;
 
-    // El área central donde se dibujan los círculos es (120, 0) a (200, 20)
-    daos_gfx_fill_rect(120, 0, 80, 20, COLOR_BLACK);
-
     // Posiciones de las bolas (centradas en y=10)
     int16_t x_a = 145; // Bola 1 (15s -> 10s restantes)
     int16_t x_b = 160; // Bola 2 (10s -> 5s restantes)
@@ -937,74 +670,20 @@ void disco_render_task(void) {
     int16_t y_center = 10;
 
     // Bola 1 (Verde, desaparece cuando quedan <= 10s)
-    if (remaining_s > 10) {
-        draw_time_ball(x_a, y_center, COLOR_P2);
-    } else {
-        draw_time_ball(x_a, y_center, COLOR_BLACK);
-    }
-
+    if (remaining_s > 10) draw_time_ball(x_a, y_center, COLOR_P2);
     // Bola 2 (Amarilla, desaparece cuando quedan <= 5s)
-    if (remaining_s > 5) {
-        draw_time_ball(x_b, y_center, COLOR_YELLOW);
-    } else {
-        draw_time_ball(x_b, y_center, COLOR_BLACK);
-    }
-
+    if (remaining_s > 5) draw_time_ball(x_b, y_center, COLOR_YELLOW);
     // Bola 3 (Roja, desaparece cuando se acaba el tiempo)
-    if (remaining_s > 0) {
-        draw_time_ball(x_c, y_center, COLOR_RED);
-    } else {
-        draw_time_ball(x_c, y_center, COLOR_BLACK);
-    }
-
-    // Actualizar estado anterior (Mantenemos la variable aunque su utilidad principal se redujo)
-    if (remaining_s > 10) last_time_ball_state = 3;
-    else if (remaining_s > 5) last_time_ball_state = 2;
-    else if (remaining_s > 0) last_time_ball_state = 1;
-    else last_time_ball_state = 0;
-    // **FIN DE LÓGICA DEL CRONÓMETRO DE CÍRCULOS**
-
-
-    // Redibujar plataformas dañadas
-    mutex_lock(&disco_platform_mutex);
-    for (uint8_t i = 0; i < 6; i++) {
-        if (platforms[i].layer != last_layers[i] || platforms[i].exists != (last_layers[i] > 0)) {
-            draw_platform(&platforms[i]);
-            last_layers[i] = platforms[i].layer;
-        }
-    }
-    mutex_unlock(&disco_platform_mutex);
+    if (remaining_s > 0) draw_time_ball(x_c, y_center, COLOR_RED);
 
-    // Actualizar disparos P1
+    // Disparos
     mutex_lock(&disco_shot_mutex);
     for (uint8_t i = 0; i < MAX_SHOTS; i++) {
-        if (last_shot_x_p1[i] >= 0) {
-            daos_gfx_draw_circle_filled(last_shot_x_p1[i], last_shot_y_p1[i], 3, COLOR_BLACK);
-        }
-
         if (shots_p1[i].active) {
             daos_gfx_draw_circle_filled(shots_p1[i].x, shots_p1[i].y, 3, COLOR_P1);
-            last_shot_x_p1[i] = shots_p1[i].x;
-            last_shot_y_p1[i] = shots_p1[i].y;
-        } else {
-            last_shot_x_p1[i] = -1;
-        }
-    }
-    mutex_unlock(&disco_shot_mutex);
-
-    // Actualizar disparos P2
-    mutex_lock(&disco_shot_mutex);
-    for (uint8_t i = 0; i < MAX_SHOTS; i++) {
-        if (last_shot_x_p2[i] >= 0) {
-            daos_gfx_draw_circle_filled(last_shot_x_p2[i], last_shot_y_p2[i], 3, COLOR_BLACK);
         }
-
         if (shots_p2[i].active) {
             daos_gfx_draw_circle_filled(shots_p2[i].x, shots_p2[i].y, 3, COLOR_P2);
-            last_shot_x_p2[i] = shots_p2[i].x;
-            last_shot_y_p2[i] = shots_p2[i].y;
-        } else {
-            last_shot_x_p2[i] = -1;
         }
     }
     mutex_unlock(&disco_shot_mutex);
@@ -1033,7 +712,7 @@ void disco_render_task(void) {
     if (p1_shooting_frame_timer > 0) p1_shooting_frame_timer--;
     if (p2_shooting_frame_timer > 0) p2_shooting_frame_timer--;
 
-    // Borrar P1
+    // Estado de los jugadores
     mutex_lock(&disco_player_mutex);
     uint8_t local_p1_lane = player1_lane;
     uint8_t local_p2_lane = player2_lane;
@@ -1041,19 +720,6 @@ void disco_render_task(void) {
     uint8_t local_shield_p2 = shield_p2;
     mutex_unlock(&disco_player_mutex);
 
-    if (last_p1_x != p1_x || last_p1_y != p1_y ||
-        last_p1_lane != local_p1_lane || last_shield_p1 != local_shield_p1 ||
-        animation_frame_counter == 0 || animation_frame_counter == 8) {
-        erase_player_at(last_p1_x, last_p1_y, last_p1_lane);
-    }
-
-    // Borrar P2
-    if (last_p2_x != p2_x || last_p2_y != p2_y ||
-        last_p2_lane != local_p2_lane || last_shield_p2 != local_shield_p2 ||
-        animation_frame_counter == 0 || animation_frame_counter == 8) {
-        erase_player_at(last_p2_x, last_p2_y, last_p2_lane + 3);
-    }
-
     // Escudo P1 (P1 defiende derecha)
     if (local_shield_p1) {
         mutex_lock(&disco_platform_mutex);
@@ -1086,12 +752,12 @@ void disco_render_task(void) {
     mutex_unlock(&disco_platform_mutex);
 
     if (p1_exists) {
-        const uint32_t* p1_sprite;
+        const daos_sprite_t* p1_sprite;
 
         if (p1_shooting_frame_timer > 0) {
-            p1_sprite = sprite_p1_shoot;
+            p1_sprite = &sprite_p1_shoot;
         } else {
-            p1_sprite = (current_frame == 0) ? sprite_p1_idle1 : sprite_p1_idle2;
+            p1_sprite = (current_frame == 0) ? &sprite_p1_idle1 : &sprite_p1_idle2;
         }
 
         draw_sprite_at(p1_x, p1_y, p1_sprite);
@@ -1103,26 +769,18 @@ void disco_render_task(void) {
     mutex_unlock(&disco_platform_mutex);
 
     if (p2_exists) {
-        const uint32_t* p2_sprite;
+        const daos_sprite_t* p2_sprite;
 
         if (p2_shooting_frame_timer > 0) {
-            p2_sprite = sprite_p2_shoot;
+            p2_sprite = &sprite_p2_shoot;
         } else {
-            p2_sprite = (current_frame == 0) ? sprite_p2_idle1 : sprite_p2_idle2;
+            p2_sprite = (current_frame == 0) ? &sprite_p2_idle1 : &sprite_p2_idle2;
         }
 
         draw_sprite_at(p2_x, p2_y, p2_sprite);
     }
 
-    // Actualizar variables de estado anterior
-    last_p1_x = p1_x;
-    last_p1_y = p1_y;
-    last_p2_x = p2_x;
-    last_p2_y = p2_y;
-    last_p1_lane = local_p1_lane;
-    last_p2_lane = local_p2_lane;
-    last_shield_p1 = local_shield_p1;
-    last_shield_p2 = local_shield_p2;
+    daos_gfx_frame_end();
 
     daos_sleep_ms(30);
 }
@@ -1160,28 +818,10 @@ void disco_init(void) {
 
     // Reinicio de estados estáticos
     initialized_input = 0;
-    first_draw = 1;
     animation_frame_counter = 0;
     p1_shooting_frame_timer = 0;
     p2_shooting_frame_timer = 0;
 
-    // Inicialización del estado de la bola de tiempo
-    last_time_ball_state = 3;
-
-    // Resetear variables de renderizado
-    last_p1_x = 0;
-    last_p1_y = 0;
-    last_p2_x = 0;
-    last_p2_y = 0;
-    last_p1_lane = 1;
-    last_p2_lane = 1;
-    last_shield_p1 = 0;
-    last_shield_p2 = 0;
-
-    for (uint8_t i = 0; i < 6; i++) {
-        last_layers[i] = 3;
-    }
-
     // Reinicio de disparos
     mutex_lock(&disco_shot_mutex);
     for (uint8_t i = 0; i < MAX_SHOTS; i++) {
@@ -1194,11 +834,6 @@ void disco_init(void) {
         shots_p2[i].x = 0;
         shots_p2[i].y = 0;
         shots_p2[i].vx = 0;
-
-        last_shot_x_p1[i] = -1;
-        last_shot_y_p1[i] = -1;
-        last_shot_x_p2[i] = -1;
-        last_shot_y_p2[i] = -1;
     }
     mutex_unlock(&disco_shot_mutex);
 
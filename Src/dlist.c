@@ -0,0 +1,432 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Lista de dibujo diferida
+ * ============================================================================
+ * Ver dlist.h. Memoria: el anillo (64 primitivas, 1.3 KB), los textos y
+ * los rellenos que se miran al descartar (0.5 KB).
+ * Las tareas no se interrumpen entre sí a mitad de una función, así que
+ * anotar y dibujar no necesitan sección crítica.
+ * ============================================================================
+ */
+
+#include "dlist.h"
+#include "sched.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                          ESTADO                                            */
+/* ========================================================================== */
+
+enum {
+    OP_FILL,
+    OP_TEXT,
+    OP_CIRCLE,
+    OP_DISC,
+    OP_ROUND_RECT,
+    OP_ROUND_FILL,
+    OP_LINE,
+    OP_TRIANGLE,
+    OP_TRIANGLE_FILL,
+    OP_SPRITE
+};
+
+typedef struct {
+    uint8_t kind;
+    uint8_t scale;            /** Texto: escala. */
+    uint8_t large;            /** Texto: semántica de pantalla_draw_string_large. */
+    uint8_t culled;           /** Tapada por un relleno posterior. */
+    uint16_t x, y;            /** Sprite y figuras: coordenadas con signo. */
+    uint16_t w, h;            /** Círculo: w es el radio. Triángulo: segundo vértice. */
+    uint16_t color;
+    uint16_t bg;              /** Texto: fondo. Rectángulo redondeado: radio. */
+    union {
+        const uint16_t* pixels;
+        const char* text;
+        int16_t pt[2];        /** Línea: segundo vértice. Triángulo: tercero. */
+    } src;
+} op_t;
+
+/** Rectángulo de pantalla [x0, x1) x [y0, y1). */
+typedef struct {
+    int16_t x0, y0, x1, y1;
+} rect_t;
+
+static op_t ring[DLIST_MAX_OPS];
+static uint16_t ring_head;            // Primitiva más antigua
+static uint16_t ring_count;
+static char text_pool[DLIST_TEXT_POOL];
+static uint16_t text_used;
+static uint8_t active;
+static dlist_stats_t stats;
+
+#define RING_AT(i) (&ring[(ring_head + (i)) % DLIST_MAX_OPS])
+
+/* ========================================================================== */
+/*                          DESCARTE                                          */
+/* ========================================================================== */
+
+/**
+ * Columnas (o filas) que puede tocar algo dibujado desde pos hasta
+ * pos + len con la aritmética de 16 bits de pantalla.c: si la suma da la
+ * vuelta, lo de más allá de 65535 cae al principio de la pantalla.
+ */
+static void span(int32_t pos, int32_t len, int16_t limit, int16_t* a, int16_t* b) {
+    if (pos < 0 || pos + len > 0x10000) {
+        *a = 0;
+        *b = limit;
+        return;
+    }
+    *a = (pos < limit) ? pos : limit;
+    *b = (pos + len < limit) ? pos + len : limit;
+}
+
+/** Caja [x0, x1) x [y0, y1) en coordenadas con signo, recortada. */
+static rect_t clip_box(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    rect_t r;
+
+    r.x0 = (x0 < 0) ? 0 : (x0 > SCREEN_WIDTH) ? SCREEN_WIDTH : x0;
+    r.y0 = (y0 < 0) ? 0 : (y0 > SCREEN_HEIGHT) ? SCREEN_HEIGHT : y0;
+    r.x1 = (x1 > SCREEN_WIDTH) ? SCREEN_WIDTH : (x1 < 0) ? 0 : x1;
+    r.y1 = (y1 > SCREEN_HEIGHT) ? SCREEN_HEIGHT : (y1 < 0) ? 0 : y1;
+    return r;
+}
+
+static int32_t min3(int32_t a, int32_t b, int32_t c) {
+    return (a < b) ? ((a < c) ? a : c) : ((b < c) ? b : c);
+}
+
+static int32_t max3(int32_t a, int32_t b, int32_t c) {
+    return (a > b) ? ((a > c) ? a : c) : ((b > c) ? b : c);
+}
+
+/** Rectángulo que contiene todo lo que la primitiva puede pintar. */
+static rect_t op_bounds(const op_t* op) {
+    rect_t r;
+    int32_t len, d;
+    int16_t x = (int16_t)op->x, y = (int16_t)op->y;
+    int16_t w = (int16_t)op->w, h = (int16_t)op->h;
+
+    switch (op->kind) {
+    case OP_FILL:
+        r.x0 = op->x;
+        r.y0 = op->y;
+        r.x1 = op->x + op->w;
+        r.y1 = op->y + op->h;
+        break;
+    case OP_TEXT:
+        len = (int32_t)strlen(op->src.text) * 6 * op->scale;
+        span(op->x, len, SCREEN_WIDTH, &r.x0, &r.x1);
+        span(op->y, 8 * op->scale, SCREEN_HEIGHT, &r.y0, &r.y1);
+        break;
+    case OP_CIRCLE:
+    case OP_DISC:
+        d = (op->w > 0x7FFF) ? 0x10000 : 2 * op->w + 1;
+        span((int32_t)op->x - op->w, d, SCREEN_WIDTH, &r.x0, &r.x1);
+        span((int32_t)op->y - op->w, d, SCREEN_HEIGHT, &r.y0, &r.y1);
+        break;
+    case OP_ROUND_RECT:
+    case OP_ROUND_FILL:
+        r = clip_box(x, y, (int32_t)x + w, (int32_t)y + h);
+        break;
+    case OP_LINE:
+        r = clip_box((x < op->src.pt[0]) ? x : op->src.pt[0], (y < op->src.pt[1]) ? y : op->src.pt[1],
+                     ((x > op->src.pt[0]) ? x : op->src.pt[0]) + 1, ((y > op->src.pt[1]) ? y : op->src.pt[1]) + 1);
+        break;
+    case OP_TRIANGLE:
+    case OP_TRIANGLE_FILL:
+        r = clip_box(min3(x, w, op->src.pt[0]), min3(y, h, op->src.pt[1]),
+                     max3(x, w, op->src.pt[0]) + 1, max3(y, h, op->src.pt[1]) + 1);
+        break;
+    default:
+        // Sprite: w y h son el tamaño, sin signo
+        r = clip_box(x, y, (int32_t)x + op->w, (int32_t)y + op->h);
+        break;
+    }
+    return r;
+}
+
+static uint8_t covers(const rect_t* outer, const rect_t* inner) {
+    return outer->x0 <= inner->x0 && outer->y0 <= inner->y0 &&
+           outer->x1 >= inner->x1 && outer->y1 >= inner->y1;
+}
+
+/**
+ * Recorrer la tanda de la más nueva a la más vieja, guardando los
+ * rellenos vistos: lo que uno de ellos tapa (o lo que no toca la
+ * pantalla) no se dibuja.
+ */
+static void cull(void) {
+    static rect_t fills[DLIST_MAX_OPS];
+    uint16_t num_fills = 0;
+
+    for (uint16_t i = ring_count; i-- > 0;) {
+        op_t* op = RING_AT(i);
+        rect_t r = op_bounds(op);
+
+        op->culled = (r.x0 >= r.x1 || r.y0 >= r.y1);
+        for (uint16_t f = 0; f < num_fills && !op->culled; f++) {
+            op->culled = covers(&fills[f], &r);
+        }
+
+        if (op->culled) {
+            stats.culled++;
+        } else if (op->kind == OP_FILL) {
+            fills[num_fills++] = r;
+        }
+    }
+}
+
+/* ========================================================================== */
+/*                          DIBUJO                                            */
+/* ========================================================================== */
+
+static void draw(const op_t* op) {
+    switch (op->kind) {
+    case OP_FILL:
+        pantalla_fill_rect(op->x, op->y, op->w, op->h, op->color);
+        break;
+    case OP_TEXT:
+        if (op->large) {
+            pantalla_draw_string_large(op->x, op->y, op->src.text, op->color, op->bg, op->scale);
+        } else {
+            pantalla_draw_string(op->x, op->y, op->src.text, op->color, op->bg);
+        }
+        break;
+    case OP_CIRCLE:
+        pantalla_draw_circle(op->x, op->y, op->w, op->color);
+        break;
+    case OP_DISC:
+        pantalla_draw_circle_filled(op->x, op->y, op->w, op->color);
+        break;
+    case OP_ROUND_RECT:
+        pantalla_draw_round_rect((int16_t)op->x, (int16_t)op->y, (int16_t)op->w, (int16_t)op->h, (int16_t)op->bg, op->color);
+        break;
+    case OP_ROUND_FILL:
+        pantalla_fill_round_rect((int16_t)op->x, (int16_t)op->y, (int16_t)op->w, (int16_t)op->h, (int16_t)op->bg, op->color);
+        break;
+    case OP_LINE:
+        pantalla_draw_line((int16_t)op->x, (int16_t)op->y, op->src.pt[0], op->src.pt[1], op->color);
+        break;
+    case OP_TRIANGLE:
+        pantalla_draw_triangle((int16_t)op->x, (int16_t)op->y, (int16_t)op->w, (int16_t)op->h, op->src.pt[0], op->src.pt[1], op->color);
+        break;
+    case OP_TRIANGLE_FILL:
+        pantalla_fill_triangle((int16_t)op->x, (int16_t)op->y, (int16_t)op->w, (int16_t)op->h, op->src.pt[0], op->src.pt[1], op->color);
+        break;
+    case OP_SPRITE:
+        pantalla_draw_sprite((int16_t)op->x, (int16_t)op->y, op->src.pixels, op->h);
+        break;
+    }
+}
+
+void dlist_flush(void) {
+    if (ring_count == 0) return;
+
+    cull();
+
+    pantalla_batch_begin();
+    for (uint16_t i = 0; i < ring_count; i++) {
+        const op_t* op = RING_AT(i);
+        if (!op->culled) draw(op);
+    }
+    pantalla_batch_end();
+
+    ring_head = (ring_head + ring_count) % DLIST_MAX_OPS;
+    ring_count = 0;
+    text_used = 0;
+    stats.batches++;
+}
+
+void dlist_sync(void) {
+    dlist_flush();
+    active = 0;
+}
+
+void dlist_task(void) {
+    active = 1;
+    dlist_flush();
+    task_delay(DLIST_PERIOD_MS);
+}
+
+uint8_t dlist_active(void) {
+    return active;
+}
+
+uint16_t dlist_pending(void) {
+    return ring_count;
+}
+
+void dlist_get_stats(dlist_stats_t* out) {
+    if (out) *out = stats;
+}
+
+/* ========================================================================== */
+/*                          ANOTAR                                            */
+/* ========================================================================== */
+
+/**
+ * Reservar una primitiva. Con el anillo (o los textos) lleno, quien dibuja
+ * vacía la tanda. @return NULL si la lista no está activa.
+ */
+static op_t* new_op(uint8_t kind, uint16_t text_len) {
+    op_t* op;
+
+    if (!active) return NULL;
+    if (ring_count == DLIST_MAX_OPS || text_used + text_len > DLIST_TEXT_POOL) {
+        dlist_flush();
+        stats.overflows++;
+    }
+
+    op = RING_AT(ring_count++);
+    op->kind = kind;
+    stats.ops++;
+    return op;
+}
+
+/** Extender el relleno anterior si el nuevo es contiguo y del mismo color. */
+static uint8_t merge_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    op_t* prev;
+
+    if (ring_count == 0) return 0;
+    prev = RING_AT(ring_count - 1);
+    if (prev->kind != OP_FILL || prev->color != color) return 0;
+
+    if (prev->y == y && prev->h == h) {
+        if (prev->x + prev->w == x) {
+            prev->w += w;
+        } else if (x + w == prev->x) {
+            prev->x = x;
+            prev->w += w;
+        } else {
+            return 0;
+        }
+    } else if (prev->x == x && prev->w == w) {
+        if (prev->y + prev->h == y) {
+            prev->h += h;
+        } else if (y + h == prev->y) {
+            prev->y = y;
+            prev->h += h;
+        } else {
+            return 0;
+        }
+    } else {
+        return 0;
+    }
+
+    stats.merged++;
+    return 1;
+}
+
+int dlist_fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    op_t* op;
+
+    if (!active) return -1;
+    if (w == 0 || h == 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return 0;
+    if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+    if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+
+    // Un relleno de toda la pantalla tapa todo lo anterior
+    if (w == SCREEN_WIDTH && h == SCREEN_HEIGHT) {
+        stats.culled += ring_count;
+        ring_head = (ring_head + ring_count) % DLIST_MAX_OPS;
+        ring_count = 0;
+        text_used = 0;
+    } else if (merge_fill(x, y, w, h, color)) {
+        return 0;
+    }
+
+    op = new_op(OP_FILL, 0);
+    op->x = x;
+    op->y = y;
+    op->w = w;
+    op->h = h;
+    op->color = color;
+    return 0;
+}
+
+int dlist_text(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg, uint8_t scale, uint8_t large) {
+    uint16_t len;
+    op_t* op;
+
+    if (!active) return -1;
+    if (!str || y >= SCREEN_HEIGHT || (large && scale == 0)) return 0;
+    len = strlen(str);
+    if (len == 0) return 0;
+    if (len + 1 > DLIST_TEXT_POOL) return -1;
+
+    op = new_op(OP_TEXT, len + 1);
+    op->x = x;
+    op->y = y;
+    op->scale = large ? scale : 1;
+    op->large = large;
+    op->color = color;
+    op->bg = bg;
+    op->src.text = &text_pool[text_used];
+    memcpy(&text_pool[text_used], str, len + 1);
+    text_used += len + 1;
+    return 0;
+}
+
+int dlist_circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t color, uint8_t filled) {
+    op_t* op = new_op(filled ? OP_DISC : OP_CIRCLE, 0);
+
+    if (!op) return -1;
+    op->x = x0;
+    op->y = y0;
+    op->w = radius;
+    op->color = color;
+    return 0;
+}
+
+int dlist_sprite(int16_t x, int16_t y, const uint16_t* data, uint16_t w, uint16_t h) {
+    op_t* op;
+
+    if (!data) return 0;
+    op = new_op(OP_SPRITE, 0);
+    if (!op) return -1;
+    op->x = (uint16_t)x;
+    op->y = (uint16_t)y;
+    op->w = w;
+    op->h = h;
+    op->src.pixels = data;
+    return 0;
+}
+
+int dlist_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color, uint8_t filled) {
+    op_t* op = new_op(filled ? OP_ROUND_FILL : OP_ROUND_RECT, 0);
+
+    if (!op) return -1;
+    op->x = (uint16_t)x;
+    op->y = (uint16_t)y;
+    op->w = (uint16_t)w;
+    op->h = (uint16_t)h;
+    op->bg = (uint16_t)r;
+    op->color = color;
+    return 0;
+}
+
+int dlist_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    op_t* op = new_op(OP_LINE, 0);
+
+    if (!op) return -1;
+    op->x = (uint16_t)x0;
+    op->y = (uint16_t)y0;
+    op->src.pt[0] = x1;
+    op->src.pt[1] = y1;
+    op->color = color;
+    return 0;
+}
+
+int dlist_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color, uint8_t filled) {
+    op_t* op = new_op(filled ? OP_TRIANGLE_FILL : OP_TRIANGLE, 0);
+
+    if (!op) return -1;
+    op->x = (uint16_t)x0;
+    op->y = (uint16_t)y0;
+    op->w = (uint16_t)x1;
+    op->h = (uint16_t)y1;
+    op->src.pt[0] = x2;
+    op->src.pt[1] = y2;
+    op->color = color;
+    return 0;
+}
@@ -1,528 +1,1680 @@
-// fat.c - Implementación SD con múltiples métodos
+/**
+ * ============================================================================
+ * DaOS v2.0 - FAT32 - Implementación
+ * ============================================================================
+ */
+
 #include "fat.h"
-#include "uart.h"
 #include <string.h>
 
-// Registros SPI1 y GPIO
-#define RCC_BASE        0x40023800
-#define GPIOA_BASE      0x40020000
-#define GPIOB_BASE      0x40020400
-#define SPI1_BASE       0x40013000
+/* ========================================================================== */
+/*                          CONSTANTES DEL FORMATO                            */
+/* ========================================================================== */
+
+#define ATTR_READ_ONLY  0x01
+#define ATTR_HIDDEN     0x02
+#define ATTR_SYSTEM     0x04
+#define ATTR_VOLUME_ID  0x08
+#define ATTR_DIRECTORY  0x10
+#define ATTR_ARCHIVE    0x20
+#define ATTR_LFN        0x0F         // RO | HIDDEN | SYSTEM | VOLUME_ID
+#define ATTR_LFN_MASK   0x3F
+
+#define NT_LOWER_BASE   0x08         // Byte NTRes: base en minúsculas
+#define NT_LOWER_EXT    0x10         // Byte NTRes: extensión en minúsculas
+
+#define ENTRY_SIZE      32
+#define ENTRIES_PER_SEC (FAT_SECTOR_SIZE / ENTRY_SIZE)
+#define ENTRY_FREE      0xE5
+#define ENTRY_END       0x00
+#define LFN_LAST        0x40
+#define LFN_CHARS       13
+#define LFN_MAX_ENTRIES ((FAT_MAX_NAME + LFN_CHARS - 1) / LFN_CHARS)
+
+#define FAT_ENTRY_MASK  0x0FFFFFFF
+#define FAT_EOC         0x0FFFFFFF
+#define FAT_EOC_MIN     0x0FFFFFF8
+#define FAT_BAD         0x0FFFFFF7
+#define FAT_ERROR       0xFFFFFFFF      // fat_get sin leer: fuera de los 28 bits
+#define FAT_PER_SECTOR  (FAT_SECTOR_SIZE / 4)
+
+#define FSI_LEAD_SIG    0x41615252
+#define FSI_STRUC_SIG   0x61417272
+#define FREE_UNKNOWN    0xFFFFFFFF
+
+#define NO_SECTOR       0xFFFFFFFF
+
+// Sin RTC: fecha y hora fijas (2025-01-01 00:00) en las entradas nuevas
+#define FAT_DEFAULT_DATE ((uint16_t)(((2025 - 1980) << 9) | (1 << 5) | 1))
+#define FAT_DEFAULT_TIME 0
+
+#define DCACHE_NAME     32           // Nombres más largos no se cachean
+
+/* ========================================================================== */
+/*                          ESTRUCTURAS INTERNAS                              */
+/* ========================================================================== */
+
+/** Geometría del volumen montado (sectores absolutos en el dispositivo). */
+typedef struct {
+    const blockdev_t* bd;
+    uint8_t mounted;
+    uint8_t sec_per_clus;
+    uint8_t num_fats;
+    uint8_t fsinfo_dirty;
+    uint32_t fat_lba;                // Primer sector de la primera FAT
+    uint32_t fat_size;               // Sectores por FAT
+    uint32_t data_lba;               // Primer sector del cluster 2
+    uint32_t root_cluster;
+    uint32_t total_clusters;         // Clusters válidos: 2 .. total + 1
+    uint32_t cluster_bytes;
+    uint32_t fsinfo_lba;             // 0 si el volumen no tiene FSInfo
+    uint32_t free_count;
+    uint32_t next_free;
+} fat_volume_t;
+
+/** Posición de una entrada: cluster del directorio + índice dentro de él. */
+typedef struct {
+    uint32_t cluster;
+    uint32_t index;
+} dir_pos_t;
+
+/** Entrada de directorio ya decodificada. */
+typedef struct {
+    dir_pos_t start;                 // Primera entrada (LFN o la corta)
+    dir_pos_t pos;                   // Entrada corta
+    uint8_t count;                   // Entradas que ocupa; 0 = raíz
+    uint8_t attr;
+    uint32_t cluster;                // Primer cluster (0 = archivo vacío)
+    uint32_t size;
+    char sname[13];                  // Alias 8.3 ("HOLAMU~1.TXT")
+} fat_entry_t;
+
+/** Recorrido de un directorio. */
+typedef struct {
+    dir_pos_t pos;
+    uint8_t end;
+} dir_iter_t;
+
+/** Archivo o directorio abierto. */
+typedef struct {
+    uint8_t in_use;
+    uint8_t is_dir;
+    uint8_t flags;
+    uint8_t dirty;                   // Tamaño o cluster inicial pendientes
+    fat_entry_t ent;
+    uint32_t pos;
+    uint32_t cur_cluster;            // Último cluster visitado de la cadena
+    uint32_t cur_index;              // Su índice dentro del archivo
+    dir_iter_t it;                   // Solo directorios
+} fat_file_t;
+
+/** Sector de FAT retenido. */
+typedef struct {
+    uint32_t lba;
+    uint32_t stamp;
+    uint8_t valid;
+    uint8_t dirty;
+    uint8_t data[FAT_SECTOR_SIZE];
+} fat_cache_t;
+
+/** Búsqueda (directorio, nombre) ya resuelta. */
+typedef struct {
+    uint8_t valid;
+    uint32_t dir;
+    uint32_t stamp;
+    char name[DCACHE_NAME];
+    fat_entry_t ent;
+} fat_dcache_t;
+
+static fat_volume_t vol;
+static fat_file_t files[FAT_MAX_OPEN];
+
+// Ventana de datos: un sector de datos o de directorio
+static uint8_t win[FAT_SECTOR_SIZE];
+static uint32_t win_lba = NO_SECTOR;
+static uint8_t win_dirty = 0;
+
+static fat_cache_t fcache[FAT_FAT_CACHE];
+static fat_dcache_t dcache[FAT_DCACHE_SIZE];
+static uint32_t cache_clock = 0;
+
+static uint32_t fat_hits = 0;
+static uint32_t fat_misses = 0;
+static uint32_t dcache_hits = 0;
+static uint32_t dcache_misses = 0;
+
+/* ========================================================================== */
+/*                          FUNCIONES AUXILIARES                              */
+/* ========================================================================== */
+
+static uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
 
-#define RCC_AHB1ENR     (*(volatile uint32_t*)(RCC_BASE + 0x30))
-#define RCC_APB2ENR     (*(volatile uint32_t*)(RCC_BASE + 0x44))
+static uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
 
-#define GPIOA_MODER     (*(volatile uint32_t*)(GPIOA_BASE + 0x00))
-#define GPIOA_OSPEEDR   (*(volatile uint32_t*)(GPIOA_BASE + 0x08))
-#define GPIOA_ODR       (*(volatile uint32_t*)(GPIOA_BASE + 0x14))
+static void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
 
-#define GPIOB_MODER     (*(volatile uint32_t*)(GPIOB_BASE + 0x00))
-#define GPIOB_OSPEEDR   (*(volatile uint32_t*)(GPIOB_BASE + 0x08))
-#define GPIOB_PUPDR     (*(volatile uint32_t*)(GPIOB_BASE + 0x0C))
-#define GPIOB_AFRL      (*(volatile uint32_t*)(GPIOB_BASE + 0x20))
+static void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
 
-#define SPI1_CR1        (*(volatile uint32_t*)(SPI1_BASE + 0x00))
-#define SPI1_SR         (*(volatile uint32_t*)(SPI1_BASE + 0x08))
-#define SPI1_DR         (*(volatile uint32_t*)(SPI1_BASE + 0x0C))
+static char to_upper(char c) {
+    return (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+}
 
-// Variables privadas
-static uint8_t sd_ready = 0;
-static uint8_t is_sdhc = 0;
-static uint8_t sector_buffer[SECTOR_SIZE];
+static char to_lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
 
-// Funciones privadas
-static void delay_ms(uint32_t ms);
-static void cs_high(void);
-static void cs_low(void);
-static uint8_t spi_transfer(uint8_t data);
-static void spi_init(void);
-static void spi_set_speed(uint8_t divisor);
-static uint8_t sd_command(uint8_t cmd, uint32_t arg);
-static uint8_t sd_init_method_1(void);  // Método estándar
-static uint8_t sd_init_method_2(void);  // Método alternativo 1
-static uint8_t sd_init_method_3(void);  // Método alternativo 2
+/** Comparar nombres sin distinguir mayúsculas (FAT no las distingue). */
+static int name_eq(const char* a, const char* b) {
+    while (*a && to_upper(*a) == to_upper(*b)) {
+        a++;
+        b++;
+    }
+    return to_upper(*a) == to_upper(*b);
+}
 
-// ==================== FUNCIONES AUXILIARES ====================
+static int dev_read(uint32_t lba, void* buf) {
+    return vol.bd->read(vol.bd, lba, 0, buf, FAT_SECTOR_SIZE);
+}
 
-static void delay_ms(uint32_t ms) {
-    for(volatile uint32_t i = 0; i < ms * 8000; i++);
+static int dev_write(uint32_t lba, const void* buf) {
+    return vol.bd->prog(vol.bd, lba, 0, buf, FAT_SECTOR_SIZE);
 }
 
-static void cs_high(void) {
-    GPIOA_ODR |= (1 << SD_CS_PIN);
+/**
+ * Leer o escribir sectores consecutivos; con más de uno usa la
+ * transferencia multibloque del dispositivo si la tiene
+ */
+static int dev_read_run(uint32_t lba, uint32_t count, uint8_t* buf) {
+    if (count > 1 && vol.bd->read_blocks) {
+        return vol.bd->read_blocks(vol.bd, lba, count, buf);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (dev_read(lba + i, buf + i * FAT_SECTOR_SIZE) < 0) return -1;
+    }
+    return 0;
 }
 
-static void cs_low(void) {
-    GPIOA_ODR &= ~(1 << SD_CS_PIN);
+static int dev_write_run(uint32_t lba, uint32_t count, const uint8_t* buf) {
+    if (count > 1 && vol.bd->prog_blocks) {
+        return vol.bd->prog_blocks(vol.bd, lba, count, buf);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (dev_write(lba + i, buf + i * FAT_SECTOR_SIZE) < 0) return -1;
+    }
+    return 0;
 }
 
-static uint8_t spi_transfer(uint8_t data) {
-    while(!(SPI1_SR & (1 << 1)));
-    SPI1_DR = data;
-    while(!(SPI1_SR & (1 << 0)));
-    return SPI1_DR;
+static int valid_cluster(uint32_t c) {
+    return c >= 2 && c < vol.total_clusters + 2;
 }
 
-static void spi_init(void) {
-    // Habilitar clocks
-    RCC_AHB1ENR |= (1 << 0) | (1 << 1);
-    RCC_APB2ENR |= (1 << 12);
+static uint32_t cluster_lba(uint32_t c) {
+    return vol.data_lba + (c - 2) * vol.sec_per_clus;
+}
 
-    // PB3 - SCK, PB4 - MISO, PB5 - MOSI
-    GPIOB_MODER &= ~((3 << 6) | (3 << 8) | (3 << 10));
-    GPIOB_MODER |= (2 << 6) | (2 << 8) | (2 << 10);
-    GPIOB_AFRL &= ~((0xF << 12) | (0xF << 16) | (0xF << 20));
-    GPIOB_AFRL |= (5 << 12) | (5 << 16) | (5 << 20);
-    GPIOB_OSPEEDR |= (3 << 6) | (3 << 10);
-    GPIOB_PUPDR &= ~(3 << 8);
-    GPIOB_PUPDR |= (1 << 8);
+/* ========================================================================== */
+/*                          VENTANA DE DATOS                                  */
+/* ========================================================================== */
 
-    // PA10 - CS
-    GPIOA_MODER &= ~(3 << (SD_CS_PIN * 2));
-    GPIOA_MODER |= (1 << (SD_CS_PIN * 2));
-    GPIOA_OSPEEDR |= (3 << (SD_CS_PIN * 2));
-    cs_high();
+static int win_flush(void) {
+    if (win_dirty) {
+        if (dev_write(win_lba, win) < 0) return -1;
+        win_dirty = 0;
+    }
+    return 0;
+}
 
-    // SPI1 configuración inicial (velocidad lenta)
-    SPI1_CR1 = 0;
-    SPI1_CR1 |= (7 << 3);   // /256
-    SPI1_CR1 |= (1 << 2);   // Master
-    SPI1_CR1 |= (1 << 9);   // SSM
-    SPI1_CR1 |= (1 << 8);   // SSI
-    SPI1_CR1 |= (1 << 6);   // Enable
+static int win_load(uint32_t lba) {
+    if (lba == win_lba) return 0;
+    if (win_flush() < 0) return -1;
 
-    delay_ms(100);
+    if (dev_read(lba, win) < 0) {
+        win_lba = NO_SECTOR;
+        return -1;
+    }
+    win_lba = lba;
+    return 0;
 }
 
-static void spi_set_speed(uint8_t divisor) {
-    SPI1_CR1 &= ~(1 << 6);
-    SPI1_CR1 &= ~(7 << 3);
-    SPI1_CR1 |= (divisor << 3);
-    SPI1_CR1 |= (1 << 6);
-    delay_ms(10);
+/* ========================================================================== */
+/*                          CACHÉ DE LA FAT                                   */
+/* ========================================================================== */
+
+/**
+ * Escribir un sector de FAT sucio en todas las copias de la tabla
+ */
+static int fcache_flush(int i) {
+    if (!fcache[i].valid || !fcache[i].dirty) return 0;
+
+    for (uint32_t k = 0; k < vol.num_fats; k++) {
+        if (dev_write(fcache[i].lba + k * vol.fat_size, fcache[i].data) < 0) return -1;
+    }
+    fcache[i].dirty = 0;
+    return 0;
 }
 
-static uint8_t sd_command(uint8_t cmd, uint32_t arg) {
-    uint8_t response, crc = 0xFF;
+/**
+ * Obtener un sector de FAT (desaloja el menos usado)
+ * @return Índice en la caché o -1 si error.
+ */
+static int fcache_get(uint32_t lba) {
+    int slot = 0;
+
+    for (int i = 0; i < FAT_FAT_CACHE; i++) {
+        if (fcache[i].valid && fcache[i].lba == lba) {
+            fcache[i].stamp = ++cache_clock;
+            fat_hits++;
+            return i;
+        }
+        if (!fcache[i].valid) {
+            slot = i;
+        } else if (fcache[slot].valid && fcache[i].stamp < fcache[slot].stamp) {
+            slot = i;
+        }
+    }
 
-    if(cmd == 0) crc = 0x95;
-    if(cmd == 8) crc = 0x87;
+    fat_misses++;
+    if (fcache_flush(slot) < 0) return -1;
 
-    // Esperar SD lista
-    for(int i = 0; i < 10; i++) spi_transfer(0xFF);
+    fcache[slot].valid = 0;
+    if (dev_read(lba, fcache[slot].data) < 0) return -1;
 
-    spi_transfer(cmd | 0x40);
-    spi_transfer((arg >> 24) & 0xFF);
-    spi_transfer((arg >> 16) & 0xFF);
-    spi_transfer((arg >> 8) & 0xFF);
-    spi_transfer(arg & 0xFF);
-    spi_transfer(crc);
+    fcache[slot].lba = lba;
+    fcache[slot].dirty = 0;
+    fcache[slot].valid = 1;
+    fcache[slot].stamp = ++cache_clock;
+    return slot;
+}
 
-    // Esperar respuesta
-    for(int i = 0; i < 10; i++) {
-        response = spi_transfer(0xFF);
-        if(!(response & 0x80)) return response;
-    }
+/**
+ * @return Valor de la entrada de FAT, o FAT_ERROR si no se pudo leer
+ * (FAT_BAD es un valor del disco: un cluster defectuoso).
+ */
+static uint32_t fat_get(uint32_t c) {
+    int i = fcache_get(vol.fat_lba + c / FAT_PER_SECTOR);
+    if (i < 0) return FAT_ERROR;
+    return get32(fcache[i].data + (c % FAT_PER_SECTOR) * 4) & FAT_ENTRY_MASK;
+}
 
-    return 0xFF;
+static int fat_set(uint32_t c, uint32_t value) {
+    int i = fcache_get(vol.fat_lba + c / FAT_PER_SECTOR);
+    if (i < 0) return -1;
+
+    uint8_t* p = fcache[i].data + (c % FAT_PER_SECTOR) * 4;
+    put32(p, (get32(p) & ~FAT_ENTRY_MASK) | (value & FAT_ENTRY_MASK));
+    fcache[i].dirty = 1;
+    return 0;
 }
 
-// ==================== MÉTODOS DE INICIALIZACIÓN ====================
+/* ========================================================================== */
+/*                          CLUSTERS                                          */
+/* ========================================================================== */
 
-// MÉTODO 1: Estándar con timeouts cortos
-static uint8_t sd_init_method_1(void) {
-    uint8_t response;
+/**
+ * Reservar un cluster libre y encadenarlo detrás de prev (0 = cadena nueva)
+ * @return Cluster reservado o 0 si el volumen está lleno.
+ */
+static uint32_t alloc_cluster(uint32_t prev) {
+    uint32_t c = vol.next_free;
 
-    uart_puts("[M1] Init rapido...\r\n");
+    for (uint32_t n = 0; n < vol.total_clusters; n++, c++) {
+        if (!valid_cluster(c)) c = 2;
 
-    cs_high();
-    for(int i = 0; i < 20; i++) spi_transfer(0xFF);
+        uint32_t v = fat_get(c);
+        if (v == FAT_ERROR) return 0;
+        if (v != 0) continue;         // Ocupado o defectuoso (FAT_BAD)
 
-    cs_low();
-    delay_ms(1);
-    response = sd_command(0, 0);
-    cs_high();
-    spi_transfer(0xFF);
+        if (fat_set(c, FAT_EOC) < 0) return 0;
+        if (prev && fat_set(prev, c) < 0) return 0;
 
-    if(response != 0x01) {
-        uart_puts("[M1] CMD0 fallo\r\n");
-        return 0;
+        if (vol.free_count != FREE_UNKNOWN && vol.free_count > 0) vol.free_count--;
+        vol.next_free = c + 1;
+        vol.fsinfo_dirty = 1;
+        return c;
     }
+    return 0;
+}
 
-    cs_low();
-    delay_ms(1);
-    response = sd_command(8, 0x1AA);
-    if(response == 0x01) {
-        for(int i = 0; i < 4; i++) spi_transfer(0xFF);
+static int free_chain(uint32_t c) {
+    while (valid_cluster(c)) {
+        uint32_t next = fat_get(c);
+        if (next == FAT_ERROR || fat_set(c, 0) < 0) return -1;
+
+        if (vol.free_count != FREE_UNKNOWN) vol.free_count++;
+        if (c < vol.next_free) vol.next_free = c;
+        vol.fsinfo_dirty = 1;
+        c = next;
     }
-    cs_high();
-    spi_transfer(0xFF);
+    return 0;
+}
 
-    // ACMD41 rápido (50 intentos)
-    for(int i = 0; i < 50; i++) {
-        delay_ms(10);
-        cs_low();
-        sd_command(55, 0);
-        cs_high();
-        spi_transfer(0xFF);
+/**
+ * Llenar un cluster de ceros (directorios nuevos)
+ */
+static int zero_cluster(uint32_t c) {
+    uint32_t lba = cluster_lba(c);
 
-        cs_low();
-        response = sd_command(41, 0x40000000);
-        cs_high();
-        spi_transfer(0xFF);
+    if (win_flush() < 0) return -1;
+    memset(win, 0, sizeof(win));
+    win_lba = NO_SECTOR;
 
-        if(response == 0x00) {
-            uart_puts("[M1] OK!\r\n");
-            return 1;
-        }
+    for (uint32_t s = 0; s < vol.sec_per_clus; s++) {
+        if (dev_write(lba + s, win) < 0) return -1;
     }
-
-    uart_puts("[M1] Timeout\r\n");
+    win_lba = lba;  // La ventana ya refleja el primer sector
     return 0;
 }
 
-// MÉTODO 2: Con delays largos
-static uint8_t sd_init_method_2(void) {
-    uint8_t response;
+/* ========================================================================== */
+/*                          ENTRADAS DE DIRECTORIO                            */
+/* ========================================================================== */
+
+/**
+ * Cargar la entrada en la ventana
+ * @return Puntero a sus 32 bytes (válido hasta el próximo acceso) o NULL.
+ */
+static uint8_t* dir_entry(const dir_pos_t* p) {
+    uint32_t lba = cluster_lba(p->cluster) + p->index / ENTRIES_PER_SEC;
+    if (win_load(lba) < 0) return NULL;
+    return win + (p->index % ENTRIES_PER_SEC) * ENTRY_SIZE;
+}
 
-    uart_puts("[M2] Init con delays largos...\r\n");
+/**
+ * Avanzar a la siguiente entrada, siguiendo la cadena del directorio
+ * @param extend Si es 1, añade un cluster vacío al final de la cadena.
+ * @return 0 si OK, 1 al final del directorio, -1 si error.
+ */
+static int dir_advance(dir_pos_t* p, int extend) {
+    if (++p->index < vol.cluster_bytes / ENTRY_SIZE) return 0;
+
+    uint32_t next = fat_get(p->cluster);
+    if (next == FAT_ERROR) return -1;
+
+    if (next >= FAT_EOC_MIN) {
+        if (!extend) return 1;
+        next = alloc_cluster(p->cluster);
+        if (next == 0 || zero_cluster(next) < 0) return -1;
+    }
+    if (!valid_cluster(next)) return -1;
+
+    p->cluster = next;
+    p->index = 0;
+    return 0;
+}
+
+static uint8_t sfn_checksum(const uint8_t* sfn) {
+    uint8_t sum = 0;
+    for (int i = 0; i < 11; i++) {
+        sum = (uint8_t)(((sum & 1) << 7) + (sum >> 1) + sfn[i]);
+    }
+    return sum;
+}
 
-    cs_high();
-    for(int i = 0; i < 50; i++) spi_transfer(0xFF);
-    delay_ms(50);
+/** Offsets de los 13 caracteres UCS-2 dentro de una entrada LFN. */
+static const uint8_t lfn_offsets[LFN_CHARS] = { 1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30 };
 
-    cs_low();
-    delay_ms(10);
-    response = sd_command(0, 0);
-    cs_high();
-    delay_ms(10);
+/**
+ * Copiar los caracteres de una entrada LFN a su lugar en el nombre
+ * Los caracteres fuera de ASCII se muestran como '?'.
+ */
+static void lfn_store(const uint8_t* e, uint8_t ord, char* name) {
+    for (int k = 0; k < LFN_CHARS; k++) {
+        int idx = (ord - 1) * LFN_CHARS + k;
+        uint16_t c = get16(e + lfn_offsets[k]);
 
-    if(response != 0x01) {
-        uart_puts("[M2] CMD0 fallo\r\n");
-        return 0;
+        if (c == 0x0000 || c == 0xFFFF) break;
+        if (idx < FAT_MAX_NAME - 1) name[idx] = (c < 0x80) ? (char)c : '?';
     }
+}
+
+/**
+ * Convertir el nombre 8.3 de una entrada a texto, respetando NTRes
+ */
+static void sfn_to_text(const uint8_t* e, char* out) {
+    int n = 0;
 
-    cs_low();
-    delay_ms(10);
-    response = sd_command(8, 0x1AA);
-    if(response == 0x01) {
-        for(int i = 0; i < 4; i++) spi_transfer(0xFF);
+    for (int i = 0; i < 8 && e[i] != ' '; i++) {
+        char c = (i == 0 && e[0] == 0x05) ? (char)0xE5 : (char)e[i];
+        out[n++] = (e[12] & NT_LOWER_BASE) ? to_lower(c) : c;
+    }
+    if (e[8] != ' ') {
+        out[n++] = '.';
+        for (int i = 8; i < 11 && e[i] != ' '; i++) {
+            out[n++] = (e[12] & NT_LOWER_EXT) ? to_lower((char)e[i]) : (char)e[i];
+        }
     }
-    cs_high();
-    delay_ms(10);
+    out[n] = '\0';
+}
 
-    // ACMD41 con delays largos
-    for(int i = 0; i < 100; i++) {
-        delay_ms(50);
-        cs_low();
-        delay_ms(5);
-        sd_command(55, 0);
-        cs_high();
-        delay_ms(5);
+static void iter_start(dir_iter_t* it, uint32_t dir_cluster) {
+    it->pos.cluster = dir_cluster;
+    it->pos.index = 0;
+    it->end = 0;
+}
 
-        cs_low();
-        delay_ms(5);
-        response = sd_command(41, 0x40000000);
-        cs_high();
-        delay_ms(5);
+/**
+ * Leer la siguiente entrada válida del directorio, juntando su nombre largo
+ * @param name Salida: nombre largo o corto (FAT_MAX_NAME bytes).
+ * @return 1 si hay entrada, 0 al final, -1 si error.
+ */
+static int iter_next(dir_iter_t* it, fat_entry_t* ent, char* name) {
+    uint8_t lfn_expect = 0;   // Siguiente ordinal LFN esperado
+    uint8_t lfn_done = 0;     // Secuencia LFN completa
+    uint8_t lfn_sum = 0;
+    uint8_t lfn_count = 0;
+    dir_pos_t lfn_start = it->pos;
+
+    while (!it->end) {
+        uint8_t* e = dir_entry(&it->pos);
+        if (!e) return -1;
+
+        if (e[0] == ENTRY_END) {
+            it->end = 1;
+            break;
+        }
 
-        if(response == 0x00) {
-            uart_puts("[M2] OK!\r\n");
-            return 1;
+        dir_pos_t here = it->pos;
+        int found = 0;
+
+        if (e[0] == ENTRY_FREE) {
+            lfn_expect = 0;
+            lfn_done = 0;
+        } else if ((e[11] & ATTR_LFN_MASK) == ATTR_LFN) {
+            uint8_t ord = e[0] & 0x1F;
+
+            if (e[0] & LFN_LAST) {
+                lfn_expect = (ord > 0 && ord <= 20) ? ord : 0;
+                lfn_count = ord;
+                lfn_sum = e[13];
+                lfn_start = here;
+                lfn_done = 0;
+                memset(name, 0, FAT_MAX_NAME);
+            }
+
+            if (lfn_expect != 0 && ord == lfn_expect && e[13] == lfn_sum) {
+                lfn_store(e, ord, name);
+                if (--lfn_expect == 0) lfn_done = 1;
+            } else {
+                lfn_expect = 0;
+                lfn_done = 0;
+            }
+        } else if ((e[11] & (ATTR_VOLUME_ID | ATTR_DIRECTORY)) == ATTR_VOLUME_ID) {
+            lfn_expect = 0;   // Etiqueta del volumen
+            lfn_done = 0;
+        } else {
+            sfn_to_text(e, ent->sname);
+
+            if (lfn_done && sfn_checksum(e) == lfn_sum) {
+                ent->start = lfn_start;
+                ent->count = (uint8_t)(lfn_count + 1);
+            } else {
+                strcpy(name, ent->sname);
+                ent->start = here;
+                ent->count = 1;
+            }
+
+            ent->pos = here;
+            ent->attr = e[11];
+            ent->cluster = ((uint32_t)get16(e + 20) << 16) | get16(e + 26);
+            ent->size = (e[11] & ATTR_DIRECTORY) ? 0 : get32(e + 28);
+            if ((e[11] & ATTR_DIRECTORY) && ent->cluster == 0) {
+                ent->cluster = vol.root_cluster;  // ".." que apunta a la raíz
+            }
+            found = 1;
         }
+
+        int r = dir_advance(&it->pos, 0);
+        if (r < 0) return -1;
+        if (r == 1) it->end = 1;
+        if (found) return 1;
     }
+    return 0;
+}
 
-    uart_puts("[M2] Timeout\r\n");
+/**
+ * Escribir tamaño y cluster inicial de una entrada corta
+ */
+static int entry_update(const fat_entry_t* ent) {
+    uint8_t* e = dir_entry(&ent->pos);
+    if (!e) return -1;
+
+    put16(e + 20, (uint16_t)(ent->cluster >> 16));
+    put16(e + 26, (uint16_t)ent->cluster);
+    put32(e + 28, ent->size);
+    put16(e + 22, FAT_DEFAULT_TIME);
+    put16(e + 24, FAT_DEFAULT_DATE);
+    e[11] |= ATTR_ARCHIVE;
+    win_dirty = 1;
     return 0;
 }
 
-// MÉTODO 3: Modo compatibilidad (sin HCS, como SDv1)
-static uint8_t sd_init_method_3(void) {
-    uint8_t response;
+/**
+ * Marcar como borradas todas las entradas (LFN + corta) de un archivo
+ */
+static int entry_delete(const fat_entry_t* ent) {
+    dir_pos_t p = ent->start;
+
+    for (int i = 0; i < ent->count; i++) {
+        uint8_t* e = dir_entry(&p);
+        if (!e) return -1;
+        e[0] = ENTRY_FREE;
+        win_dirty = 1;
+        if (i + 1 < ent->count && dir_advance(&p, 0) != 0) return -1;
+    }
+    return 0;
+}
 
-    uart_puts("[M3] Modo compatibilidad SDv1...\r\n");
+/* ========================================================================== */
+/*                          NOMBRES CORTOS Y LARGOS                           */
+/* ========================================================================== */
 
-    cs_high();
-    for(int i = 0; i < 30; i++) spi_transfer(0xFF);
-    delay_ms(20);
+static int sfn_char_ok(char c) {
+    if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) return 1;
+    return c != '\0' && strchr("$%'-_@~`!(){}^#&", c) != NULL;
+}
+
+/**
+ * Validar un nombre para crear una entrada
+ */
+static int name_valid(const char* name) {
+    int len = (int)strlen(name);
 
-    cs_low();
-    delay_ms(2);
-    response = sd_command(0, 0);
-    cs_high();
-    delay_ms(2);
+    if (len == 0 || len >= FAT_MAX_NAME) return 0;
+    if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) return 0;
+    if (name[len - 1] == '.' || name[len - 1] == ' ') return 0;
 
-    if(response != 0x01) {
-        uart_puts("[M3] CMD0 fallo\r\n");
-        return 0;
+    for (int i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)name[i];
+        if (c < 0x20 || c >= 0x80 || strchr("\"*/:<>?\\|", c)) return 0;
     }
+    return 1;
+}
 
-    // Sin CMD8 (modo SDv1)
-    // ACMD41 sin HCS bit
-    for(int i = 0; i < 200; i++) {
-        delay_ms(20);
-        cs_low();
-        delay_ms(2);
-        sd_command(55, 0);
-        cs_high();
-        delay_ms(2);
+/**
+ * Intentar representar el nombre como 8.3 sin pérdida
+ * @param ntres Salida: bits de minúsculas de NTRes.
+ * @return 1 si cabe (no hace falta LFN), 0 si no.
+ */
+static int make_sfn(const char* name, uint8_t* sfn, uint8_t* ntres) {
+    const char* dot = strchr(name, '.');
+    int base_len = dot ? (int)(dot - name) : (int)strlen(name);
+    int ext_len = dot ? (int)strlen(dot + 1) : 0;
+
+    if (base_len < 1 || base_len > 8 || ext_len > 3) return 0;
+    if (dot && (ext_len == 0 || strchr(dot + 1, '.'))) return 0;
+
+    memset(sfn, ' ', 11);
+    *ntres = 0;
+
+    for (int part = 0; part < 2; part++) {
+        const char* s = part ? dot + 1 : name;
+        int n = part ? ext_len : base_len;
+        int lower = 0;
+        int upper = 0;
+
+        for (int i = 0; i < n; i++) {
+            char c = to_upper(s[i]);
+            if (!sfn_char_ok(c)) return 0;
+            if (s[i] >= 'a' && s[i] <= 'z') lower = 1;
+            if (s[i] >= 'A' && s[i] <= 'Z') upper = 1;
+            sfn[(part ? 8 : 0) + i] = (uint8_t)c;
+        }
+        if (lower && upper) return 0;  // Mezcla: solo un LFN la conserva
+        if (lower) *ntres |= part ? NT_LOWER_EXT : NT_LOWER_BASE;
+    }
+    return 1;
+}
+
+/**
+ * Generar la base de un alias 8.3 para un nombre que necesita LFN
+ */
+static void make_sfn_basis(const char* name, uint8_t* sfn) {
+    const char* dot = strrchr(name, '.');
+    int n = 0;
 
-        cs_low();
-        delay_ms(2);
-        response = sd_command(41, 0x00000000);  // Sin HCS
-        cs_high();
-        delay_ms(2);
+    memset(sfn, ' ', 11);
+
+    for (const char* s = name; *s && s != dot && n < 8; s++) {
+        if (*s == '.' || *s == ' ') continue;
+        char c = to_upper(*s);
+        sfn[n++] = sfn_char_ok(c) ? (uint8_t)c : '_';
+    }
+    if (n == 0) sfn[n++] = '_';
+
+    if (dot) {
+        n = 0;
+        for (const char* s = dot + 1; *s && n < 3; s++) {
+            if (*s == ' ') continue;
+            char c = to_upper(*s);
+            sfn[8 + n++] = sfn_char_ok(c) ? (uint8_t)c : '_';
+        }
+    }
+}
 
-        if(response == 0x00) {
-            uart_puts("[M3] OK!\r\n");
-            is_sdhc = 0;  // Modo byte addressing
+/**
+ * Buscar un nombre 8.3 exacto entre las entradas del directorio
+ * @return 1 si existe, 0 si no, -1 si error.
+ */
+static int sfn_exists(uint32_t dir_cluster, const uint8_t* sfn) {
+    dir_pos_t p = { dir_cluster, 0 };
+
+    while (1) {
+        uint8_t* e = dir_entry(&p);
+        if (!e) return -1;
+        if (e[0] == ENTRY_END) return 0;
+        if (e[0] != ENTRY_FREE && (e[11] & ATTR_LFN_MASK) != ATTR_LFN &&
+            memcmp(e, sfn, 11) == 0) {
             return 1;
         }
+
+        int r = dir_advance(&p, 0);
+        if (r != 0) return (r < 0) ? -1 : 0;
     }
+}
 
-    uart_puts("[M3] Timeout\r\n");
-    return 0;
+/** Alias de la forma prefijo~N: sufijos que admite cada forma. */
+#define SFN_TAIL_MAX 99
+#define SFN_HASH_TAIL_MAX 9
+
+/**
+ * Escribir prefijo~N en el alias (el resto de la base en blanco)
+ */
+static void sfn_put_tail(uint8_t* sfn, const uint8_t* prefix, int len, int num) {
+    memset(sfn, ' ', 8);
+    memcpy(sfn, prefix, len);
+    sfn[len++] = '~';
+    if (num >= 10) sfn[len++] = (uint8_t)('0' + num / 10);
+    sfn[len] = (uint8_t)('0' + num % 10);
+}
+
+/**
+ * Sufijo de una entrada prefijo~N con digits cifras y la misma extensión
+ * @return N, o 0 si la entrada no tiene esa forma.
+ */
+static int sfn_tail(const uint8_t* e, const uint8_t* sfn, const uint8_t* prefix,
+                    int len, int digits) {
+    int num = 0;
+
+    if (memcmp(e + 8, sfn + 8, 3) != 0 || memcmp(e, prefix, len) != 0) return 0;
+    if (e[len] != '~') return 0;
+
+    for (int i = 1; i <= digits; i++) {
+        uint8_t c = e[len + i];
+        if (c < '0' || c > '9') return 0;
+        num = num * 10 + (c - '0');
+    }
+    for (int i = len + 1 + digits; i < 8; i++) {
+        if (e[i] != ' ') return 0;
+    }
+    return (digits == 2 && num < 10) ? 0 : num;
 }
 
-// ==================== FUNCIONES PÚBLICAS ====================
+/**
+ * Añadir el sufijo ~N a la base para que el alias sea único
+ * Una sola pasada por el directorio anota los sufijos ocupados. Si los
+ * 99 de la base están en uso, como Windows, se prueba con una base de
+ * dos letras y cuatro cifras hexadecimales de un hash del nombre largo
+ * (AB1F2C~1 a AB1F2C~9).
+ * @return 0 si OK, -1 si no hay alias libre.
+ */
+static int make_sfn_unique(uint32_t dir_cluster, const char* name, uint8_t* sfn) {
+    static const char hex[] = "0123456789ABCDEF";
+    uint8_t used[(SFN_TAIL_MAX + 1 + 7) / 8];
+    uint16_t used_hash = 0;           // Bit N: hash~N ocupado
+    uint8_t basis[8];
+    uint8_t hashed[6];
+    uint16_t h = 0;
+    int base_len = 8;
+    int hash_len;
+
+    memcpy(basis, sfn, 8);
+    while (base_len > 0 && basis[base_len - 1] == ' ') base_len--;
+
+    // Base con hash: hasta dos letras de la base y el hash en hexadecimal
+    for (const char* s = name; *s; s++) h = (uint16_t)(h * 37 + (uint8_t)*s);
+    hash_len = (base_len < 2) ? base_len : 2;
+    memcpy(hashed, basis, hash_len);
+    for (int i = 0; i < 4; i++) hashed[hash_len++] = (uint8_t)hex[(h >> (12 - 4 * i)) & 0xF];
+
+    // ~1 a ~9 dejan 6 letras de la base; ~10 a ~99, 5
+    int keep1 = (base_len > 6) ? 6 : base_len;
+    int keep2 = (base_len > 5) ? 5 : base_len;
+
+    memset(used, 0, sizeof(used));
+    dir_pos_t p = { dir_cluster, 0 };
+
+    while (1) {
+        uint8_t* e = dir_entry(&p);
+        if (!e) return -1;
+        if (e[0] == ENTRY_END) break;
+
+        if (e[0] != ENTRY_FREE && (e[11] & ATTR_LFN_MASK) != ATTR_LFN) {
+            int num = sfn_tail(e, sfn, basis, keep1, 1);
+            if (!num) num = sfn_tail(e, sfn, basis, keep2, 2);
+            if (num) used[num / 8] |= (uint8_t)(1 << (num % 8));
+
+            num = sfn_tail(e, sfn, hashed, hash_len, 1);
+            if (num) used_hash |= (uint16_t)(1 << num);
+        }
 
-uint8_t fat_init(void) {
-    uart_puts("\r\n=== INICIALIZANDO SD ===\r\n");
+        int r = dir_advance(&p, 0);
+        if (r < 0) return -1;
+        if (r > 0) break;
+    }
 
-    spi_init();
-    sd_ready = 0;
+    for (int num = 1; num <= SFN_TAIL_MAX; num++) {
+        if (!(used[num / 8] & (1 << (num % 8)))) {
+            sfn_put_tail(sfn, basis, (num < 10) ? keep1 : keep2, num);
+            return 0;
+        }
+    }
+    for (int num = 1; num <= SFN_HASH_TAIL_MAX; num++) {
+        if (!(used_hash & (1 << num))) {
+            sfn_put_tail(sfn, hashed, hash_len, num);
+            return 0;
+        }
+    }
+    return -1;
+}
 
-    // Probar método 1
-    if(sd_init_method_1()) {
-        is_sdhc = 1;
-        spi_set_speed(2);  // /8 = 2MHz
-        uart_puts("Metodo 1 exitoso! (SDHC)\r\n");
-        sd_ready = 1;
-        return 1;
+static void lfn_fill(uint8_t* e, const char* name, uint8_t ord, int last, uint8_t sum) {
+    int len = (int)strlen(name);
+
+    memset(e, 0, ENTRY_SIZE);
+    e[0] = (uint8_t)(ord | (last ? LFN_LAST : 0));
+    e[11] = ATTR_LFN;
+    e[13] = sum;
+
+    for (int k = 0; k < LFN_CHARS; k++) {
+        int idx = (ord - 1) * LFN_CHARS + k;
+        uint16_t c = (idx < len) ? (uint16_t)name[idx] : (idx == len) ? 0x0000 : 0xFFFF;
+        put16(e + lfn_offsets[k], c);
     }
+}
 
-    delay_ms(100);
+static void sfn_fill(uint8_t* e, const uint8_t* sfn, uint8_t ntres, uint8_t attr,
+                     uint32_t cluster, uint32_t size) {
+    memset(e, 0, ENTRY_SIZE);
+    memcpy(e, sfn, 11);
+    e[11] = attr;
+    e[12] = ntres;
+    put16(e + 14, FAT_DEFAULT_TIME);
+    put16(e + 16, FAT_DEFAULT_DATE);
+    put16(e + 18, FAT_DEFAULT_DATE);
+    put16(e + 20, (uint16_t)(cluster >> 16));
+    put16(e + 22, FAT_DEFAULT_TIME);
+    put16(e + 24, FAT_DEFAULT_DATE);
+    put16(e + 26, (uint16_t)cluster);
+    put32(e + 28, size);
+}
 
-    // Probar método 2
-    if(sd_init_method_2()) {
-        is_sdhc = 1;
-        spi_set_speed(3);  // /16 = 1MHz (más lento)
-        uart_puts("Metodo 2 exitoso! (SDHC)\r\n");
-        sd_ready = 1;
-        return 1;
+/**
+ * Crear las entradas (LFN si hace falta + corta) de un nombre en un directorio
+ * Busca un hueco de entradas libres consecutivas y, si no lo hay, agranda
+ * el directorio con un cluster nuevo.
+ * @return 0 si OK, -1 si error.
+ */
+static int dir_add(uint32_t dir_cluster, const char* name, uint8_t attr,
+                   uint32_t cluster, uint32_t size, fat_entry_t* out) {
+    uint8_t sfn[11];
+    uint8_t ntres = 0;
+    int lfn_n = 0;
+
+    if (!make_sfn(name, sfn, &ntres)) {
+        make_sfn_basis(name, sfn);
+        if (make_sfn_unique(dir_cluster, name, sfn) < 0) return -1;
+        lfn_n = ((int)strlen(name) + LFN_CHARS - 1) / LFN_CHARS;
+        ntres = 0;
+    } else if (sfn_exists(dir_cluster, sfn) != 0) {
+        return -1;
     }
 
-    delay_ms(100);
+    // Buscar (lfn_n + 1) entradas libres seguidas
+    int need = lfn_n + 1;
+    int run = 0;
+    dir_pos_t p = { dir_cluster, 0 };
+    dir_pos_t run_start = p;
+
+    while (1) {
+        uint8_t* e = dir_entry(&p);
+        if (!e) return -1;
+
+        if (e[0] == ENTRY_FREE || e[0] == ENTRY_END) {
+            if (run == 0) run_start = p;
+            if (++run == need) break;
+        } else {
+            run = 0;
+        }
+        if (dir_advance(&p, 1) < 0) return -1;
+    }
 
-    // Probar método 3
-    if(sd_init_method_3()) {
-        is_sdhc = 0;
-        spi_set_speed(4);  // /32 = 500kHz (muy lento)
-        uart_puts("Metodo 3 exitoso! (SDSC)\r\n");
-        sd_ready = 1;
-        return 1;
+    // Escribir las entradas LFN (de la última a la primera) y la corta
+    uint8_t sum = sfn_checksum(sfn);
+    p = run_start;
+    out->start = run_start;
+
+    for (int ord = lfn_n; ord >= 1; ord--) {
+        uint8_t* e = dir_entry(&p);
+        if (!e) return -1;
+        lfn_fill(e, name, (uint8_t)ord, ord == lfn_n, sum);
+        win_dirty = 1;
+        if (dir_advance(&p, 0) != 0) return -1;
     }
 
-    uart_puts("ERROR: Todos los metodos fallaron\r\n");
+    uint8_t* e = dir_entry(&p);
+    if (!e) return -1;
+    sfn_fill(e, sfn, ntres, attr, cluster, size);
+    win_dirty = 1;
+
+    out->pos = p;
+    out->count = (uint8_t)need;
+    out->attr = attr;
+    out->cluster = cluster;
+    out->size = size;
+    sfn_to_text(e, out->sname);
     return 0;
 }
 
-uint8_t fat_read_sector(uint32_t sector, uint8_t *buffer) {
-    if(!sd_ready) return 0;
+/* ========================================================================== */
+/*                          CACHÉ DE DIRECTORIO                               */
+/* ========================================================================== */
+
+static void dcache_clear(void) {
+    for (int i = 0; i < FAT_DCACHE_SIZE; i++) dcache[i].valid = 0;
+}
 
-    uint32_t addr = is_sdhc ? sector : (sector * 512);
-    uint8_t response;
+static void dcache_put(uint32_t dir, const char* name, const fat_entry_t* ent) {
+    int slot = 0;
 
-    cs_low();
-    delay_ms(1);
-    response = sd_command(17, addr);
+    if (strlen(name) >= DCACHE_NAME) return;
 
-    if(response != 0x00) {
-        cs_high();
-        return 0;
+    for (int i = 0; i < FAT_DCACHE_SIZE; i++) {
+        if (!dcache[i].valid) {
+            slot = i;
+            break;
+        }
+        if (dcache[i].stamp < dcache[slot].stamp) slot = i;
     }
 
-    // Esperar token 0xFE
-    for(int i = 0; i < 10000; i++) {
-        response = spi_transfer(0xFF);
-        if(response == 0xFE) break;
+    dcache[slot].dir = dir;
+    strcpy(dcache[slot].name, name);
+    dcache[slot].ent = *ent;
+    dcache[slot].stamp = ++cache_clock;
+    dcache[slot].valid = 1;
+}
+
+/**
+ * Mantener el tamaño y el cluster cacheados al actualizar una entrada
+ */
+static void dcache_refresh(const fat_entry_t* ent) {
+    for (int i = 0; i < FAT_DCACHE_SIZE; i++) {
+        if (dcache[i].valid && dcache[i].ent.pos.cluster == ent->pos.cluster &&
+            dcache[i].ent.pos.index == ent->pos.index) {
+            dcache[i].ent.cluster = ent->cluster;
+            dcache[i].ent.size = ent->size;
+        }
     }
+}
+
+/* ========================================================================== */
+/*                          RESOLUCIÓN DE RUTAS                               */
+/* ========================================================================== */
 
-    if(response != 0xFE) {
-        cs_high();
-        return 0;
+static void root_entry(fat_entry_t* ent) {
+    memset(ent, 0, sizeof(*ent));
+    ent->attr = ATTR_DIRECTORY;
+    ent->cluster = vol.root_cluster;
+    ent->count = 0;
+    strcpy(ent->sname, "/");
+}
+
+static int is_root(const fat_entry_t* ent) {
+    return ent->count == 0;
+}
+
+/**
+ * Buscar un nombre en un directorio (caché primero)
+ * @return 0 si existe, -1 si no o si hubo error.
+ */
+static int lookup(uint32_t dir, const char* name, fat_entry_t* out) {
+    char found[FAT_MAX_NAME];
+    dir_iter_t it;
+
+    for (int i = 0; i < FAT_DCACHE_SIZE; i++) {
+        if (dcache[i].valid && dcache[i].dir == dir && name_eq(dcache[i].name, name)) {
+            dcache[i].stamp = ++cache_clock;
+            *out = dcache[i].ent;
+            dcache_hits++;
+            return 0;
+        }
     }
 
-    // Leer 512 bytes
-    for(int i = 0; i < SECTOR_SIZE; i++) {
-        buffer[i] = spi_transfer(0xFF);
+    dcache_misses++;
+    iter_start(&it, dir);
+    while (iter_next(&it, out, found) == 1) {
+        if (name_eq(found, name) || name_eq(out->sname, name)) {
+            dcache_put(dir, name, out);
+            return 0;
+        }
     }
+    return -1;
+}
 
-    spi_transfer(0xFF);  // CRC
-    spi_transfer(0xFF);
+/**
+ * Extraer el siguiente componente de una ruta
+ * @return 1 si hay componente, 0 al final, -1 si es demasiado largo.
+ */
+static int next_component(const char** path, char* out) {
+    const char* p = *path;
+    int n = 0;
 
-    cs_high();
-    spi_transfer(0xFF);
+    while (*p == '/') p++;
+    if (*p == '\0') return 0;
 
+    while (*p && *p != '/') {
+        if (n >= FAT_MAX_NAME - 1) return -1;
+        out[n++] = *p++;
+    }
+    out[n] = '\0';
+    *path = p;
     return 1;
 }
 
-uint8_t fat_write_sector(uint32_t sector, uint8_t *buffer) {
-    if(!sd_ready) return 0;
+static int resolve(const char* path, fat_entry_t* out) {
+    char comp[FAT_MAX_NAME];
+    int r;
 
-    uint32_t addr = is_sdhc ? sector : (sector * 512);
-    uint8_t response;
+    root_entry(out);
+    while ((r = next_component(&path, comp)) > 0) {
+        if (!(out->attr & ATTR_DIRECTORY)) return -1;
+        if (strcmp(comp, ".") == 0) continue;
+        if (lookup(out->cluster, comp, out) < 0) return -1;
 
-    cs_low();
-    delay_ms(1);
-    response = sd_command(24, addr);
+        if ((out->attr & ATTR_DIRECTORY) && out->cluster == vol.root_cluster) {
+            root_entry(out);  // ".." hasta la raíz
+        }
+    }
+    return (r < 0) ? -1 : 0;
+}
 
-    if(response != 0x00) {
-        cs_high();
-        return 0;
+/**
+ * Resolver el directorio padre de una ruta y validar el nombre final
+ * @return 0 si OK, -1 si error.
+ */
+static int resolve_parent(const char* path, fat_entry_t* parent, char* leaf) {
+    char buf[FAT_MAX_PATH];
+    int len = (int)strlen(path);
+
+    if (len >= FAT_MAX_PATH) return -1;
+    memcpy(buf, path, len + 1);
+    while (len > 1 && buf[len - 1] == '/') buf[--len] = '\0';
+
+    char* slash = strrchr(buf, '/');
+    const char* name = slash ? slash + 1 : buf;
+    if (strlen(name) >= FAT_MAX_NAME || !name_valid(name)) return -1;
+    strcpy(leaf, name);
+
+    if (slash) {
+        *slash = '\0';
+    } else {
+        buf[0] = '\0';
     }
 
-    delay_ms(1);
-    spi_transfer(0xFF);
-    spi_transfer(0xFE);  // Token
+    if (resolve(buf, parent) < 0) return -1;
+    return (parent->attr & ATTR_DIRECTORY) ? 0 : -1;
+}
+
+/* ========================================================================== */
+/*                          FLUSH Y FSINFO                                    */
+/* ========================================================================== */
 
-    for(int i = 0; i < SECTOR_SIZE; i++) {
-        spi_transfer(buffer[i]);
+static int fsinfo_write(void) {
+    if (!vol.fsinfo_dirty || vol.fsinfo_lba == 0) return 0;
+    if (win_load(vol.fsinfo_lba) < 0) return -1;
+
+    if (get32(win) == FSI_LEAD_SIG && get32(win + 484) == FSI_STRUC_SIG) {
+        put32(win + 488, vol.free_count);
+        put32(win + 492, vol.next_free);
+        win_dirty = 1;
     }
+    vol.fsinfo_dirty = 0;
+    return 0;
+}
 
-    spi_transfer(0xFF);  // CRC
-    spi_transfer(0xFF);
+/**
+ * Entregar ventana, FAT y FSInfo al dispositivo
+ * Si el dispositivo tiene caché de escritura diferida, los sectores
+ * quedan en ella: ver flush_durable.
+ */
+static int flush_all(void) {
+    int result = 0;
+
+    if (fsinfo_write() < 0) result = -1;
+    if (win_flush() < 0) result = -1;
+    for (int i = 0; i < FAT_FAT_CACHE; i++) {
+        if (fcache_flush(i) < 0) result = -1;
+    }
+    return result;
+}
 
-    response = spi_transfer(0xFF);
+/**
+ * Como flush_all, y además vaciar la caché del dispositivo: al terminar
+ * una operación que cambia el volumen (cerrar un archivo escrito, crear,
+ * borrar, renombrar) lo hecho queda en el medio aunque se saque la
+ * tarjeta. Mientras el archivo sigue abierto las escrituras se acumulan
+ * en la caché.
+ */
+static int flush_durable(void) {
+    int result = flush_all();
+
+    if (vol.bd->sync && vol.bd->sync(vol.bd) < 0) result = -1;
+    return result;
+}
+
+static int file_commit(fat_file_t* f) {
+    if (!f->dirty) return 0;
+    if (entry_update(&f->ent) < 0) return -1;
+    dcache_refresh(&f->ent);
+    f->dirty = 0;
+    return 0;
+}
 
-    if((response & 0x1F) != 0x05) {
-        cs_high();
-        return 0;
+int fat_sync(void) {
+    int result = 0;
+
+    if (!vol.mounted) return -1;
+
+    for (int i = 0; i < FAT_MAX_OPEN; i++) {
+        if (files[i].in_use && !files[i].is_dir && file_commit(&files[i]) < 0) result = -1;
     }
+    if (flush_durable() < 0) result = -1;
+    return result;
+}
+
+/* ========================================================================== */
+/*                          MONTAJE                                           */
+/* ========================================================================== */
+
+/**
+ * Verificar que el sector contiene un BPB de FAT32 soportado
+ */
+static int bpb_is_fat32(const uint8_t* b) {
+    uint8_t spc = b[13];
+
+    return get16(b + 510) == 0xAA55 &&
+           get16(b + 11) == FAT_SECTOR_SIZE &&
+           spc != 0 && (spc & (spc - 1)) == 0 &&
+           get16(b + 14) != 0 &&
+           b[16] >= 1 && b[16] <= 2 &&
+           get16(b + 17) == 0 &&            // Sin raíz fija: FAT32
+           get16(b + 22) == 0 &&
+           get32(b + 36) != 0;
+}
+
+int fat_mount(const blockdev_t* bd) {
+    uint32_t part_lba = 0;
+
+    if (!bd || bd->block_size != FAT_SECTOR_SIZE) return -1;
+
+    memset(&vol, 0, sizeof(vol));
+    memset(files, 0, sizeof(files));
+    memset(fcache, 0, sizeof(fcache));
+    dcache_clear();
+    vol.bd = bd;
+    win_lba = NO_SECTOR;
+    win_dirty = 0;
+
+    if (win_load(0) < 0) return -1;
+
+    // Sin BPB en el sector 0: buscar la primera partición FAT32 del MBR
+    if (!bpb_is_fat32(win)) {
+        if (get16(win + 510) != 0xAA55) return -1;
 
-    // Esperar fin de escritura
-    for(int i = 0; i < 10000; i++) {
-        if(spi_transfer(0xFF) != 0x00) break;
+        for (int i = 0; i < 4 && part_lba == 0; i++) {
+            const uint8_t* pe = win + 446 + i * 16;
+            if (pe[4] == 0x0B || pe[4] == 0x0C) part_lba = get32(pe + 8);
+        }
+        if (part_lba == 0 || win_load(part_lba) < 0 || !bpb_is_fat32(win)) return -1;
     }
 
-    cs_high();
-    spi_transfer(0xFF);
+    uint32_t reserved = get16(win + 14);
+    uint32_t total = get16(win + 19) ? get16(win + 19) : get32(win + 32);
+
+    vol.sec_per_clus = win[13];
+    vol.num_fats = win[16];
+    vol.fat_size = get32(win + 36);
+    vol.fat_lba = part_lba + reserved;
+    vol.data_lba = vol.fat_lba + vol.num_fats * vol.fat_size;
+    vol.root_cluster = get32(win + 44);
+    vol.cluster_bytes = (uint32_t)vol.sec_per_clus * FAT_SECTOR_SIZE;
+
+    uint32_t meta = reserved + vol.num_fats * vol.fat_size;
+    if (total <= meta) return -1;
+    vol.total_clusters = (total - meta) / vol.sec_per_clus;
+    if (vol.total_clusters > vol.fat_size * FAT_PER_SECTOR - 2) {
+        vol.total_clusters = vol.fat_size * FAT_PER_SECTOR - 2;
+    }
+    if (!valid_cluster(vol.root_cluster)) return -1;
+
+    // FSInfo: contador de libres y pista para la próxima reserva
+    vol.free_count = FREE_UNKNOWN;
+    vol.next_free = 2;
+    uint16_t fsinfo = get16(win + 48);
+    if (fsinfo != 0 && fsinfo != 0xFFFF && fsinfo < reserved &&
+        win_load(part_lba + fsinfo) == 0 &&
+        get32(win) == FSI_LEAD_SIG && get32(win + 484) == FSI_STRUC_SIG) {
+        vol.fsinfo_lba = part_lba + fsinfo;
+        if (get32(win + 488) <= vol.total_clusters) vol.free_count = get32(win + 488);
+        if (valid_cluster(get32(win + 492))) vol.next_free = get32(win + 492);
+    }
 
-    return 1;
+    vol.mounted = 1;
+    return 0;
 }
 
-uint8_t fat_is_ready(void) {
-    return sd_ready;
+void fat_umount(void) {
+    if (!vol.mounted) return;
+
+    fat_sync();
+    memset(files, 0, sizeof(files));
+    vol.mounted = 0;
 }
 
-// ==================== COMANDOS DE ARCHIVOS ====================
+int fat_is_mounted(void) {
+    return vol.mounted;
+}
 
-uint8_t fat_crear_archivo(const char *nombre, const char *contenido) {
-    if(!sd_ready) return 0;
+/* ========================================================================== */
+/*                          ARCHIVOS                                          */
+/* ========================================================================== */
 
-    if(!fat_read_sector(SECTOR_START, sector_buffer)) {
-        uart_puts("Error: No se puede leer sector\r\n");
-        return 0;
+static fat_file_t* get_file(int h, int is_dir) {
+    if (h < 0 || h >= FAT_MAX_OPEN || !files[h].in_use || files[h].is_dir != is_dir) {
+        return NULL;
     }
+    return &files[h];
+}
 
-    Archivo *archivos = (Archivo*)sector_buffer;
-    int slot = -1;
+static int alloc_handle(void) {
+    for (int i = 0; i < FAT_MAX_OPEN; i++) {
+        if (!files[i].in_use) return i;
+    }
+    return -1;
+}
 
-    for(int i = 0; i < MAX_FILES; i++) {
-        if(!archivos[i].usado) {
-            if(slot == -1) slot = i;
-        } else if(strcmp(archivos[i].nombre, nombre) == 0) {
-            slot = i;
-            break;
+/** @return 1 si algún handle abierto apunta a esa entrada o directorio. */
+static int entry_is_open(const fat_entry_t* ent) {
+    for (int i = 0; i < FAT_MAX_OPEN; i++) {
+        if (!files[i].in_use) continue;
+        if (files[i].is_dir) {
+            if ((ent->attr & ATTR_DIRECTORY) && files[i].ent.cluster == ent->cluster) return 1;
+        } else if (files[i].ent.pos.cluster == ent->pos.cluster &&
+                   files[i].ent.pos.index == ent->pos.index) {
+            return 1;
         }
     }
+    return 0;
+}
 
-    if(slot == -1) {
-        uart_puts("Error: No hay espacio\r\n");
-        return 0;
+/**
+ * Obtener el cluster número index del archivo
+ * Parte del último cluster visitado, así el acceso secuencial sigue una
+ * sola entrada de FAT por cluster.
+ * @param alloc Si es 1, alarga la cadena cuando hace falta.
+ * @return Cluster o 0 si no existe / no hay espacio.
+ */
+static uint32_t file_cluster(fat_file_t* f, uint32_t index, int alloc) {
+    if (f->ent.cluster == 0) {
+        if (!alloc) return 0;
+        f->ent.cluster = alloc_cluster(0);
+        if (f->ent.cluster == 0) return 0;
+        f->dirty = 1;
+        f->cur_cluster = 0;
     }
 
-    archivos[slot].usado = 1;
-    strncpy(archivos[slot].nombre, nombre, 31);
-    archivos[slot].nombre[31] = '\0';
-    strncpy(archivos[slot].contenido, contenido, 199);
-    archivos[slot].contenido[199] = '\0';
+    if (f->cur_cluster == 0 || index < f->cur_index) {
+        f->cur_cluster = f->ent.cluster;
+        f->cur_index = 0;
+    }
 
-    if(fat_write_sector(SECTOR_START, sector_buffer)) {
-        uart_puts("Archivo '");
-        uart_puts(nombre);
-        uart_puts("' guardado.\r\n");
-        return 1;
+    while (f->cur_index < index) {
+        uint32_t next = fat_get(f->cur_cluster);
+        if (next == FAT_ERROR) return 0;
+
+        if (next >= FAT_EOC_MIN) {
+            if (!alloc) return 0;
+            next = alloc_cluster(f->cur_cluster);
+            if (next == 0) return 0;
+        }
+        if (!valid_cluster(next)) return 0;
+
+        f->cur_cluster = next;
+        f->cur_index++;
     }
+    return f->cur_cluster;
+}
 
-    uart_puts("Error al escribir\r\n");
-    return 0;
+/**
+ * Alargar una transferencia de sectores completos a los clusters siguientes
+ * mientras la cadena sea contigua en el disco, para pedirla en una sola
+ * orden multibloque. Deja el cursor del archivo en el último cluster usado.
+ * @param sec Sector de partida dentro de f->cur_cluster.
+ * @param want Sectores pedidos.
+ * @param alloc Si es 1, reserva clusters al final de la cadena.
+ * @return Sectores consecutivos a transferir (1..want).
+ */
+static uint32_t file_run(fat_file_t* f, uint32_t sec, uint32_t want, int alloc) {
+    uint32_t run = vol.sec_per_clus - sec;
+
+    while (run < want) {
+        uint32_t next = fat_get(f->cur_cluster);
+        if (next == FAT_ERROR) break;
+
+        if (next >= FAT_EOC_MIN) {
+            if (!alloc) break;
+            // Queda encadenado aunque no sea contiguo: lo usa la próxima vuelta
+            next = alloc_cluster(f->cur_cluster);
+            if (next == 0) break;
+        }
+        if (next != f->cur_cluster + 1 || !valid_cluster(next)) break;
+
+        f->cur_cluster = next;
+        f->cur_index++;
+        run += vol.sec_per_clus;
+    }
+    return (run < want) ? run : want;
 }
 
-void fat_listar_archivos(void) {
-    if(!sd_ready) {
-        uart_puts("SD no lista\r\n");
-        return;
+int fat_open(const char* path, int flags) {
+    fat_entry_t ent;
+    int writable = (flags & FAT_O_WRONLY) != 0;
+
+    if (!vol.mounted || !path) return -1;
+
+    int h = alloc_handle();
+    if (h < 0) return -1;
+
+    if (resolve(path, &ent) < 0) {
+        fat_entry_t parent;
+        char leaf[FAT_MAX_NAME];
+
+        if (!(flags & FAT_O_CREAT) || !writable) return -1;
+        if (resolve_parent(path, &parent, leaf) < 0) return -1;
+        if (dir_add(parent.cluster, leaf, ATTR_ARCHIVE, 0, 0, &ent) < 0) return -1;
+        dcache_clear();
+    } else {
+        if (ent.attr & ATTR_DIRECTORY) return -1;
+        if (writable && (ent.attr & ATTR_READ_ONLY)) return -1;
     }
 
-    if(!fat_read_sector(SECTOR_START, sector_buffer)) {
-        uart_puts("Error al leer\r\n");
-        return;
+    fat_file_t* f = &files[h];
+    memset(f, 0, sizeof(*f));
+    f->ent = ent;
+    f->flags = (uint8_t)flags;
+    f->in_use = 1;
+
+    if (writable && (flags & FAT_O_TRUNC) && ent.cluster != 0) {
+        if (free_chain(ent.cluster) < 0) {
+            f->in_use = 0;
+            return -1;
+        }
+        f->ent.cluster = 0;
+        f->ent.size = 0;
+        f->dirty = 1;
     }
 
-    Archivo *archivos = (Archivo*)sector_buffer;
-    uint8_t count = 0;
+    if (flags & FAT_O_APPEND) f->pos = f->ent.size;
+    return h;
+}
+
+int fat_read(int h, void* buf, uint32_t n) {
+    fat_file_t* f = get_file(h, 0);
+    uint8_t* dst = (uint8_t*)buf;
+    uint32_t done = 0;
+
+    if (!f || !(f->flags & FAT_O_RDONLY)) return -1;
+    if (f->pos >= f->ent.size) return 0;
+    if (n > f->ent.size - f->pos) n = f->ent.size - f->pos;
+
+    while (done < n) {
+        uint32_t c = file_cluster(f, f->pos / vol.cluster_bytes, 0);
+        if (c == 0) break;
+
+        uint32_t sec = (f->pos % vol.cluster_bytes) / FAT_SECTOR_SIZE;
+        uint32_t off = f->pos % FAT_SECTOR_SIZE;
+        uint32_t lba = cluster_lba(c) + sec;
+        uint32_t chunk;
+
+        if (off == 0 && n - done >= FAT_SECTOR_SIZE) {
+            // Sectores completos: directo al buffer del usuario, en una
+            // sola transferencia mientras los clusters sean contiguos
+            uint32_t count = file_run(f, sec, (n - done) / FAT_SECTOR_SIZE, 0);
+            uint8_t* out = dst + done;
+
+            if (dev_read_run(lba, count, out) < 0) return done ? (int)done : -1;
+            if (win_lba != NO_SECTOR && win_lba >= lba && win_lba - lba < count) {
+                // La ventana puede tener cambios aún no escritos
+                memcpy(out + (win_lba - lba) * FAT_SECTOR_SIZE, win, FAT_SECTOR_SIZE);
+            }
+            chunk = count * FAT_SECTOR_SIZE;
+        } else {
+            if (win_load(lba) < 0) return done ? (int)done : -1;
+            chunk = FAT_SECTOR_SIZE - off;
+            if (chunk > n - done) chunk = n - done;
+            memcpy(dst + done, win + off, chunk);
+        }
 
-    uart_puts("\r\n=== ARCHIVOS ===\r\n");
+        done += chunk;
+        f->pos += chunk;
+    }
+    return (int)done;
+}
 
-    for(int i = 0; i < MAX_FILES; i++) {
-        if(archivos[i].usado) {
-            uart_puts("- ");
-            uart_puts(archivos[i].nombre);
-            uart_puts(": ");
-            uart_puts(archivos[i].contenido);
-            uart_puts("\r\n");
-            count++;
+int fat_write(int h, const void* buf, uint32_t n) {
+    fat_file_t* f = get_file(h, 0);
+    const uint8_t* src = (const uint8_t*)buf;
+    uint32_t done = 0;
+
+    if (!f || !(f->flags & FAT_O_WRONLY)) return -1;
+    if (f->flags & FAT_O_APPEND) f->pos = f->ent.size;
+
+    while (done < n) {
+        uint32_t c = file_cluster(f, f->pos / vol.cluster_bytes, 1);
+        if (c == 0) break;  // Volumen lleno
+
+        uint32_t sec = (f->pos % vol.cluster_bytes) / FAT_SECTOR_SIZE;
+        uint32_t off = f->pos % FAT_SECTOR_SIZE;
+        uint32_t lba = cluster_lba(c) + sec;
+        uint32_t chunk;
+
+        if (off == 0 && n - done >= FAT_SECTOR_SIZE) {
+            uint32_t count = file_run(f, sec, (n - done) / FAT_SECTOR_SIZE, 1);
+
+            if (win_lba != NO_SECTOR && win_lba >= lba && win_lba - lba < count) {
+                win_lba = NO_SECTOR;  // La copia de la ventana queda obsoleta
+                win_dirty = 0;
+            }
+            if (dev_write_run(lba, count, src + done) < 0) {
+                return done ? (int)done : -1;
+            }
+            chunk = count * FAT_SECTOR_SIZE;
+        } else {
+            // Un sector que empieza en o después del final no hace falta leerlo
+            if (f->pos - off >= f->ent.size && lba != win_lba) {
+                if (win_flush() < 0) return done ? (int)done : -1;
+                memset(win, 0, sizeof(win));
+                win_lba = lba;
+            } else if (win_load(lba) < 0) {
+                return done ? (int)done : -1;
+            }
+
+            chunk = FAT_SECTOR_SIZE - off;
+            if (chunk > n - done) chunk = n - done;
+            memcpy(win + off, src + done, chunk);
+            win_dirty = 1;
         }
+
+        done += chunk;
+        f->pos += chunk;
+        if (f->pos > f->ent.size) f->ent.size = f->pos;
+        f->dirty = 1;
     }
 
-    if(count == 0) {
-        uart_puts("(vacio)\r\n");
+    if (done == 0 && n > 0) return -1;
+    return (int)done;
+}
+
+int fat_seek(int h, int offset, int whence) {
+    fat_file_t* f = get_file(h, 0);
+    int pos;
+
+    if (!f) return -1;
+
+    switch (whence) {
+        case FAT_SEEK_SET: pos = offset; break;
+        case FAT_SEEK_CUR: pos = (int)f->pos + offset; break;
+        case FAT_SEEK_END: pos = (int)f->ent.size + offset; break;
+        default: return -1;
     }
 
-    uart_puts("================\r\n");
+    if (pos < 0) pos = 0;
+    if (pos > (int)f->ent.size) pos = (int)f->ent.size;
+    f->pos = (uint32_t)pos;
+    return pos;
 }
 
-uint8_t fat_leer_archivo(const char *nombre, char *buffer) {
-    if(!sd_ready) return 0;
+int fat_close(int h) {
+    if (h < 0 || h >= FAT_MAX_OPEN || !files[h].in_use) return -1;
 
-    if(!fat_read_sector(SECTOR_START, sector_buffer)) return 0;
+    fat_file_t* f = &files[h];
+    int result = 0;
 
-    Archivo *archivos = (Archivo*)sector_buffer;
+    // Solo las escrituras tocan el medio al cerrar
+    if (!f->is_dir && (f->flags & FAT_O_WRONLY)) {
+        if (file_commit(f) < 0) result = -1;
+        if (flush_durable() < 0) result = -1;
+    }
 
-    for(int i = 0; i < MAX_FILES; i++) {
-        if(archivos[i].usado && strcmp(archivos[i].nombre, nombre) == 0) {
-            strcpy(buffer, archivos[i].contenido);
-            return 1;
+    f->in_use = 0;
+    return result;
+}
+
+/* ========================================================================== */
+/*                          DIRECTORIOS Y RUTAS                               */
+/* ========================================================================== */
+
+int fat_opendir(const char* path) {
+    fat_entry_t ent;
+
+    if (!vol.mounted || !path) return -1;
+    if (resolve(path, &ent) < 0 || !(ent.attr & ATTR_DIRECTORY)) return -1;
+
+    int h = alloc_handle();
+    if (h < 0) return -1;
+
+    fat_file_t* f = &files[h];
+    memset(f, 0, sizeof(*f));
+    f->ent = ent;
+    f->is_dir = 1;
+    f->in_use = 1;
+    iter_start(&f->it, ent.cluster);
+    return h;
+}
+
+int fat_readdir(int h, fat_dirent_t* out) {
+    fat_file_t* f = get_file(h, 1);
+    fat_entry_t ent;
+    int r;
+
+    if (!f) return -1;
+
+    while ((r = iter_next(&f->it, &ent, out->name)) == 1) {
+        if (strcmp(ent.sname, ".") == 0 || strcmp(ent.sname, "..") == 0) continue;
+        if (ent.attr & (ATTR_HIDDEN | ATTR_SYSTEM)) continue;
+
+        out->is_dir = (ent.attr & ATTR_DIRECTORY) ? 1 : 0;
+        out->size = ent.size;
+        return 1;
+    }
+    return r;
+}
+
+int fat_stat(const char* path, uint8_t* is_dir) {
+    fat_entry_t ent;
+
+    if (!vol.mounted || !path || resolve(path, &ent) < 0) return -1;
+    if (is_dir) *is_dir = (ent.attr & ATTR_DIRECTORY) ? 1 : 0;
+    if (ent.attr & ATTR_DIRECTORY) return 0;
+
+    // Un archivo abierto puede tener un tamaño aún no escrito en su entrada
+    for (int i = 0; i < FAT_MAX_OPEN; i++) {
+        if (files[i].in_use && !files[i].is_dir &&
+            files[i].ent.pos.cluster == ent.pos.cluster &&
+            files[i].ent.pos.index == ent.pos.index) {
+            return (int)files[i].ent.size;
         }
     }
+    return (int)ent.size;
+}
 
-    return 0;
+int fat_unlink(const char* path) {
+    fat_entry_t ent;
+
+    if (!vol.mounted || !path || resolve(path, &ent) < 0) return -1;
+    if ((ent.attr & (ATTR_DIRECTORY | ATTR_READ_ONLY)) || entry_is_open(&ent)) return -1;
+
+    dcache_clear();
+    if (entry_delete(&ent) < 0 || free_chain(ent.cluster) < 0) return -1;
+    return flush_durable();
 }
 
-uint8_t fat_borrar_archivo(const char *nombre) {
-    if(!sd_ready) return 0;
+int fat_mkdir(const char* path) {
+    fat_entry_t parent;
+    fat_entry_t ent;
+    char leaf[FAT_MAX_NAME];
 
-    if(!fat_read_sector(SECTOR_START, sector_buffer)) return 0;
+    if (!vol.mounted || !path) return -1;
+    if (resolve(path, &ent) == 0) return -1;  // Ya existe
+    if (resolve_parent(path, &parent, leaf) < 0) return -1;
+
+    uint32_t c = alloc_cluster(0);
+    if (c == 0) return -1;
+    if (zero_cluster(c) < 0) {
+        free_chain(c);
+        return -1;
+    }
+
+    // "." y ".." (la raíz se referencia con cluster 0)
+    uint8_t dot[11];
+    uint32_t up = (parent.cluster == vol.root_cluster) ? 0 : parent.cluster;
+    if (win_load(cluster_lba(c)) < 0) return -1;
+
+    memset(dot, ' ', sizeof(dot));
+    dot[0] = '.';
+    sfn_fill(win, dot, 0, ATTR_DIRECTORY, c, 0);
+    dot[1] = '.';
+    sfn_fill(win + ENTRY_SIZE, dot, 0, ATTR_DIRECTORY, up, 0);
+    win_dirty = 1;
+
+    dcache_clear();
+    if (dir_add(parent.cluster, leaf, ATTR_DIRECTORY, c, 0, &ent) < 0) {
+        free_chain(c);
+        flush_all();
+        return -1;
+    }
+    return flush_durable();
+}
+
+/** @return 1 si el directorio solo contiene "." y "..", 0 si no, -1 si error. */
+static int dir_is_empty(uint32_t cluster) {
+    char name[FAT_MAX_NAME];
+    fat_entry_t ent;
+    dir_iter_t it;
+    int r;
+
+    iter_start(&it, cluster);
+    while ((r = iter_next(&it, &ent, name)) == 1) {
+        if (strcmp(ent.sname, ".") != 0 && strcmp(ent.sname, "..") != 0) return 0;
+    }
+    return (r < 0) ? -1 : 1;
+}
 
-    Archivo *archivos = (Archivo*)sector_buffer;
+int fat_rmdir(const char* path) {
+    fat_entry_t ent;
 
-    for(int i = 0; i < MAX_FILES; i++) {
-        if(archivos[i].usado && strcmp(archivos[i].nombre, nombre) == 0) {
-            archivos[i].usado = 0;
-            return fat_write_sector(SECTOR_START, sector_buffer);
+    if (!vol.mounted || !path || resolve(path, &ent) < 0) return -1;
+    if (!(ent.attr & ATTR_DIRECTORY) || is_root(&ent) || entry_is_open(&ent)) return -1;
+    if (dir_is_empty(ent.cluster) != 1) return -1;
+
+    dcache_clear();
+    if (entry_delete(&ent) < 0 || free_chain(ent.cluster) < 0) return -1;
+    return flush_durable();
+}
+
+/**
+ * Obtener el padre de un directorio leyendo su entrada ".."
+ */
+static uint32_t dir_parent(uint32_t cluster) {
+    dir_pos_t p = { cluster, 1 };
+    uint8_t* e = dir_entry(&p);
+    if (!e || e[0] != '.' || e[1] != '.') return 0;
+
+    uint32_t up = ((uint32_t)get16(e + 20) << 16) | get16(e + 26);
+    return up ? up : vol.root_cluster;
+}
+
+int fat_rename(const char* old_path, const char* new_path) {
+    fat_entry_t ent;
+    fat_entry_t parent;
+    fat_entry_t moved;
+    char leaf[FAT_MAX_NAME];
+
+    if (!vol.mounted || !old_path || !new_path) return -1;
+    if (resolve(old_path, &ent) < 0 || is_root(&ent)) return -1;
+    if (resolve(new_path, &moved) == 0) return -1;  // El destino existe
+    if (resolve_parent(new_path, &parent, leaf) < 0) return -1;
+
+    // Un directorio no puede moverse dentro de sí mismo
+    if (ent.attr & ATTR_DIRECTORY) {
+        uint32_t c = parent.cluster;
+        for (uint32_t depth = 0; c != vol.root_cluster; depth++) {
+            if (c == ent.cluster || c == 0 || depth > 64) return -1;
+            c = dir_parent(c);
         }
     }
 
-    return 0;
+    dcache_clear();
+    if (dir_add(parent.cluster, leaf, ent.attr, ent.cluster, ent.size, &moved) < 0) return -1;
+    if (entry_delete(&ent) < 0) return -1;
+
+    // Los handles abiertos siguen a su nueva entrada
+    for (int i = 0; i < FAT_MAX_OPEN; i++) {
+        if (files[i].in_use && !files[i].is_dir &&
+            files[i].ent.pos.cluster == ent.pos.cluster &&
+            files[i].ent.pos.index == ent.pos.index) {
+            files[i].ent.start = moved.start;
+            files[i].ent.pos = moved.pos;
+            files[i].ent.count = moved.count;
+        }
+    }
+
+    // Actualizar ".." si el directorio cambió de padre
+    if ((ent.attr & ATTR_DIRECTORY) && dir_parent(ent.cluster) != parent.cluster) {
+        dir_pos_t p = { ent.cluster, 1 };
+        uint8_t* e = dir_entry(&p);
+        if (!e) return -1;
+
+        uint32_t up = (parent.cluster == vol.root_cluster) ? 0 : parent.cluster;
+        put16(e + 20, (uint16_t)(up >> 16));
+        put16(e + 26, (uint16_t)up);
+        win_dirty = 1;
+    }
+    return flush_durable();
+}
+
+/* ========================================================================== */
+/*                          DIAGNÓSTICO                                       */
+/* ========================================================================== */
+
+void fat_get_stats(fat_stats_t* stats) {
+    stats->cluster_size = vol.cluster_bytes;
+    stats->total_clusters = vol.total_clusters;
+    stats->free_clusters = vol.free_count;
+    stats->fat_hits = fat_hits;
+    stats->fat_misses = fat_misses;
+    stats->dcache_hits = dcache_hits;
+    stats->dcache_misses = dcache_misses;
 }
@@ -1,167 +1,174 @@
 #include "fs.h"
+#include "ramfs.h"
 #include "uart.h"
 #include <string.h>
 
-/* Estructuras internas */
-static FSInode inodes[FS_MAX_FILES];
-static uint8_t data_blocks[FS_MAX_BLOCKS][FS_BLOCK_SIZE];
-static uint8_t block_used[FS_MAX_BLOCKS];
-static FSFile open_files[FS_MAX_FILES];
+/* Los archivos se guardan en RAMFS bajo FS_DIR: no hay almacén propio.
+ * Los abiertos salen de un pool con lista de libres (abrir y cerrar son
+ * O(1)) y se identifican por un handle con generación. */
+
+#define FS_SLOT_BITS 4
+#define FS_SLOT_MASK ((1 << FS_SLOT_BITS) - 1)
+#define FS_GEN_MASK  0x7F   // El handle queda en 11 bits, siempre positivo
+#define FS_PATH_MAX  (sizeof(FS_DIR) + FS_MAX_FILENAME)
+
+_Static_assert(FS_MAX_OPEN <= (1 << FS_SLOT_BITS), "FS_MAX_OPEN no cabe en el handle");
+_Static_assert(FS_MAX_FILES == RAMFS_MAX_FILES, "fs_name_at recorre la tabla de RAMFS");
+
+/* Ranura del pool */
+typedef struct {
+    FSFile file;                 // Parte visible (fs_open retorna &file)
+    char path[FS_PATH_MAX];      // Ruta en RAMFS
+    uint8_t generation;
+    int8_t next_free;            // Siguiente ranura libre, -1 al final
+} fs_slot_t;
+
+static fs_slot_t pool[FS_MAX_OPEN];
+static int8_t free_head;
 
 /* Inicializar filesystem */
 void fs_init(void) {
-    // Limpiar inodos
-    for (int i = 0; i < FS_MAX_FILES; i++) {
-        inodes[i].in_use = 0;
-        inodes[i].name[0] = '\0';
-        inodes[i].size = 0;
-        inodes[i].start_block = 0;
-        open_files[i].fd = -1;
-    }
-
-    // Limpiar bloques
-    for (int i = 0; i < FS_MAX_BLOCKS; i++) {
-        block_used[i] = 0;
+    for (int i = 0; i < FS_MAX_OPEN; i++) {
+        pool[i].file.fd = -1;
+        pool[i].next_free = (i + 1 < FS_MAX_OPEN) ? i + 1 : -1;
     }
+    free_head = 0;
 }
 
-/* Encontrar inodo libre */
-static int find_free_inode(void) {
-    for (int i = 0; i < FS_MAX_FILES; i++) {
-        if (!inodes[i].in_use) {
-            return i;
-        }
+/* "nombre" -> "/rom/nombre"; rechaza nombres vacíos, largos o con '/' */
+static int fs_path(const char *name, char *path) {
+    size_t len = name ? strlen(name) : 0;
+
+    if (len == 0 || len >= FS_MAX_FILENAME || strchr(name, '/')) {
+        return -1;
     }
-    return -1;
+    memcpy(path, FS_DIR "/", sizeof(FS_DIR));
+    memcpy(path + sizeof(FS_DIR), name, len + 1);
+    return 0;
 }
 
-/* Encontrar bloques contiguos libres */
-static int find_free_blocks(uint32_t num_blocks) {
-    for (int i = 0; i <= FS_MAX_BLOCKS - num_blocks; i++) {
-        int found = 1;
-        for (uint32_t j = 0; j < num_blocks; j++) {
-            if (block_used[i + j]) {
-                found = 0;
-                break;
-            }
-        }
-        if (found) {
-            return i;
-        }
+/* Handle -> archivo abierto, o NULL si está cerrado o es de otra generación */
+static fs_slot_t* fs_lookup(int fd) {
+    if (fd < 0 || (fd & FS_SLOT_MASK) >= FS_MAX_OPEN) {
+        return NULL;
     }
-    return -1;
+
+    fs_slot_t *slot = &pool[fd & FS_SLOT_MASK];
+    return (slot->file.fd == fd) ? slot : NULL;
 }
 
 /* Crear archivo */
 int fs_create(const char *name, const void *data, uint32_t size) {
-    // Validar nombre
-    if (!name || strlen(name) >= FS_MAX_FILENAME) {
-        return -1;
-    }
+    char path[FS_PATH_MAX];
 
-    // Verificar si ya existe
-    for (int i = 0; i < FS_MAX_FILES; i++) {
-        if (inodes[i].in_use && strcmp(inodes[i].name, name) == 0) {
-            return -1; // Ya existe
-        }
+    if (fs_path(name, path) < 0 || ramfs_exists(path)) {
+        return -1;
     }
 
-    // Encontrar inodo libre
-    int inode_idx = find_free_inode();
-    if (inode_idx < 0) {
-        return -1; // No hay inodos libres
+    if (!ramfs_is_dir(FS_DIR) && ramfs_mkdir(FS_DIR) < 0) {
+        return -1;
     }
 
-    // Calcular bloques necesarios
-    uint32_t num_blocks = (size + FS_BLOCK_SIZE - 1) / FS_BLOCK_SIZE;
-    if (num_blocks > FS_MAX_BLOCKS) {
-        return -1; // Archivo demasiado grande
-    }
+    return ramfs_create(path, data, size);
+}
 
-    // Encontrar bloques libres
-    int start_block = find_free_blocks(num_blocks);
-    if (start_block < 0) {
-        return -1; // No hay espacio
-    }
+/* Abrir archivo */
+int fs_open_fd(const char *name) {
+    char path[FS_PATH_MAX];
+    int size;
 
-    // Marcar bloques como usados
-    for (uint32_t i = 0; i < num_blocks; i++) {
-        block_used[start_block + i] = 1;
+    if (fs_path(name, path) < 0 || ramfs_is_dir(path)) {
+        return -1;
     }
 
-    // Copiar datos
-    const uint8_t *src = (const uint8_t *)data;
-    for (uint32_t i = 0; i < size; i++) {
-        uint32_t block = start_block + (i / FS_BLOCK_SIZE);
-        uint32_t offset = i % FS_BLOCK_SIZE;
-        data_blocks[block][offset] = src[i];
+    size = ramfs_get_size(path);
+    if (size < 0 || free_head < 0) {
+        return -1; // No existe o no hay descriptores libres
     }
 
-    // Crear inodo
-    strcpy(inodes[inode_idx].name, name);
-    inodes[inode_idx].size = size;
-    inodes[inode_idx].start_block = start_block;
-    inodes[inode_idx].in_use = 1;
+    int idx = free_head;
+    fs_slot_t *slot = &pool[idx];
+    free_head = slot->next_free;
 
-    return 0; // Éxito
+    strcpy(slot->path, path);
+    slot->file.fd = (slot->generation << FS_SLOT_BITS) | idx;
+    slot->file.position = 0;
+    slot->file.size = (uint32_t)size;
+    return slot->file.fd;
 }
 
-/* Abrir archivo */
 FSFile* fs_open(const char *name) {
-    // Buscar archivo
-    FSInode *inode = NULL;
-    for (int i = 0; i < FS_MAX_FILES; i++) {
-        if (inodes[i].in_use && strcmp(inodes[i].name, name) == 0) {
-            inode = &inodes[i];
-            break;
-        }
-    }
+    int fd = fs_open_fd(name);
+    return (fd < 0) ? NULL : &pool[fd & FS_SLOT_MASK].file;
+}
 
-    if (!inode) {
-        return NULL; // Archivo no existe
+/* Leer desde archivo */
+int fs_read_fd(int fd, void *buffer, uint32_t size) {
+    fs_slot_t *slot = fs_lookup(fd);
+    if (!slot) {
+        return -1;
     }
 
-    // Buscar descriptor libre
-    for (int i = 0; i < FS_MAX_FILES; i++) {
-        if (open_files[i].fd < 0) {
-            open_files[i].fd = i;
-            open_files[i].position = 0;
-            open_files[i].inode = inode;
-            return &open_files[i];
-        }
+    // RAMFS copia el extent de una vez
+    int n = ramfs_pread(slot->path, slot->file.position, buffer, size);
+    if (n > 0) {
+        slot->file.position += (uint32_t)n;
     }
-
-    return NULL; // No hay descriptores libres
+    return n;
 }
 
-/* Leer desde archivo */
 int fs_read(FSFile *file, void *buffer, uint32_t size) {
-    if (!file || file->fd < 0) {
+    return file ? fs_read_fd(file->fd, buffer, size) : -1;
+}
+
+int fs_seek_fd(int fd, int offset, int whence) {
+    fs_slot_t *slot = fs_lookup(fd);
+    int size, pos;
+
+    if (!slot) {
         return -1;
     }
 
-    FSInode *inode = file->inode;
-    uint32_t remaining = inode->size - file->position;
-    uint32_t to_read = (size < remaining) ? size : remaining;
+    // El tamaño de RAMFS, no el de la apertura: el archivo pudo cambiar
+    // por /ram/rom o por fs_create/fs_delete mientras seguía abierto
+    size = ramfs_get_size(slot->path);
+    if (size < 0) {
+        return -1;
+    }
+    slot->file.size = (uint32_t)size;
 
-    uint8_t *dst = (uint8_t *)buffer;
-    for (uint32_t i = 0; i < to_read; i++) {
-        uint32_t pos = file->position + i;
-        uint32_t block = inode->start_block + (pos / FS_BLOCK_SIZE);
-        uint32_t offset = pos % FS_BLOCK_SIZE;
-        dst[i] = data_blocks[block][offset];
+    switch (whence) {
+        case FS_SEEK_SET: pos = offset; break;
+        case FS_SEEK_CUR: pos = (int)slot->file.position + offset; break;
+        case FS_SEEK_END: pos = size + offset; break;
+        default: return -1;
     }
 
-    file->position += to_read;
-    return to_read;
+    if (pos < 0) pos = 0;
+    if (pos > size) pos = size;
+    slot->file.position = (uint32_t)pos;
+    return pos;
 }
 
 /* Cerrar archivo */
+int fs_close_fd(int fd) {
+    fs_slot_t *slot = fs_lookup(fd);
+    if (!slot) {
+        return -1;
+    }
+
+    int idx = fd & FS_SLOT_MASK;
+    slot->file.fd = -1;
+    slot->file.position = 0;
+    slot->generation = (slot->generation + 1) & FS_GEN_MASK;
+    slot->next_free = free_head;
+    free_head = idx;
+    return 0;
+}
+
 void fs_close(FSFile *file) {
     if (file) {
-        file->fd = -1;
-        file->position = 0;
-        file->inode = NULL;
+        fs_close_fd(file->fd);
     }
 }
 
@@ -170,11 +177,12 @@ void fs_list(void) {
     uart_puts("=== RAMFS Files ===\r\n");
     int count = 0;
     for (int i = 0; i < FS_MAX_FILES; i++) {
-        if (inodes[i].in_use) {
+        const char *name = fs_name_at(i);
+        if (name) {
             uart_puts("  ");
-            uart_puts(inodes[i].name);
+            uart_puts(name);
             uart_puts(" (");
-            uart_putint(inodes[i].size);
+            uart_putint(fs_get_size(name));
             uart_puts(" bytes)\r\n");
             count++;
         }
@@ -186,28 +194,35 @@ void fs_list(void) {
 
 /* Obtener tamaño */
 int fs_get_size(const char *name) {
-    for (int i = 0; i < FS_MAX_FILES; i++) {
-        if (inodes[i].in_use && strcmp(inodes[i].name, name) == 0) {
-            return inodes[i].size;
-        }
+    char path[FS_PATH_MAX];
+
+    if (fs_path(name, path) < 0 || ramfs_is_dir(path)) {
+        return -1;
     }
-    return -1;
+    return ramfs_get_size(path);
 }
 
 /* Eliminar archivo */
 int fs_delete(const char *name) {
-    for (int i = 0; i < FS_MAX_FILES; i++) {
-        if (inodes[i].in_use && strcmp(inodes[i].name, name) == 0) {
-            // Liberar bloques
-            uint32_t num_blocks = (inodes[i].size + FS_BLOCK_SIZE - 1) / FS_BLOCK_SIZE;
-            for (uint32_t j = 0; j < num_blocks; j++) {
-                block_used[inodes[i].start_block + j] = 0;
-            }
-
-            // Liberar inodo
-            inodes[i].in_use = 0;
-            return 0;
-        }
+    char path[FS_PATH_MAX];
+
+    if (fs_path(name, path) < 0 || ramfs_is_dir(path)) {
+        return -1;
+    }
+    return ramfs_delete(path);
+}
+
+/* Obtener nombre por índice */
+const char* fs_name_at(int idx) {
+    static char path[RAMFS_MAX_PATH];
+
+    if (ramfs_path_at(idx, path) != RAMFS_TYPE_FILE) {
+        return NULL;
+    }
+
+    // Solo los archivos directamente dentro de FS_DIR
+    if (strncmp(path, FS_DIR "/", sizeof(FS_DIR)) != 0 || strchr(path + sizeof(FS_DIR), '/')) {
+        return NULL;
     }
-    return -1;
+    return path + sizeof(FS_DIR);
 }
@@ -0,0 +1,210 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Fuente 5x8 y caché de glifos
+ * ============================================================================
+ * Ver glyph.h. Memoria: 2.5 KB de glifos de escala 1 y 1.25 KB de escala 2.
+ * ============================================================================
+ */
+
+#include "glyph.h"
+
+/* ========================================================================== */
+/*                          FUENTE                                            */
+/* ========================================================================== */
+
+#define FIRST_CHAR 0x20
+#define LAST_CHAR  0x7E
+
+static const uint8_t font5x8[LAST_CHAR - FIRST_CHAR + 1][GLYPH_WIDTH] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00},   // ' '
+    {0x00, 0x00, 0x5F, 0x00, 0x00},   // !
+    {0x00, 0x07, 0x00, 0x07, 0x00},   // "
+    {0x14, 0x7F, 0x14, 0x7F, 0x14},   // #
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12},   // $
+    {0x23, 0x13, 0x08, 0x64, 0x62},   // %
+    {0x36, 0x49, 0x55, 0x22, 0x50},   // &
+    {0x00, 0x05, 0x03, 0x00, 0x00},   // '
+    {0x00, 0x1C, 0x22, 0x41, 0x00},   // (
+    {0x00, 0x41, 0x22, 0x1C, 0x00},   // )
+    {0x14, 0x08, 0x3E, 0x08, 0x14},   // *
+    {0x08, 0x08, 0x3E, 0x08, 0x08},   // +
+    {0x00, 0x50, 0x30, 0x00, 0x00},   // ,
+    {0x08, 0x08, 0x08, 0x08, 0x08},   // -
+    {0x00, 0x60, 0x60, 0x00, 0x00},   // .
+    {0x20, 0x10, 0x08, 0x04, 0x02},   // /
+    {0x3E, 0x51, 0x49, 0x45, 0x3E},   // 0
+    {0x00, 0x42, 0x7F, 0x40, 0x00},   // 1
+    {0x42, 0x61, 0x51, 0x49, 0x46},   // 2
+    {0x21, 0x41, 0x45, 0x4B, 0x31},   // 3
+    {0x18, 0x14, 0x12, 0x7F, 0x10},   // 4
+    {0x27, 0x45, 0x45, 0x45, 0x39},   // 5
+    {0x3C, 0x4A, 0x49, 0x49, 0x30},   // 6
+    {0x01, 0x71, 0x09, 0x05, 0x03},   // 7
+    {0x36, 0x49, 0x49, 0x49, 0x36},   // 8
+    {0x06, 0x49, 0x49, 0x29, 0x1E},   // 9
+    {0x00, 0x36, 0x36, 0x00, 0x00},   // :
+    {0x00, 0x56, 0x36, 0x00, 0x00},   // ;
+    {0x08, 0x14, 0x22, 0x41, 0x00},   // <
+    {0x14, 0x14, 0x14, 0x14, 0x14},   // =
+    {0x00, 0x41, 0x22, 0x14, 0x08},   // >
+    {0x02, 0x01, 0x51, 0x09, 0x06},   // ?
+    {0x32, 0x49, 0x79, 0x41, 0x3E},   // @
+    {0x7E, 0x11, 0x11, 0x11, 0x7E},   // A
+    {0x7F, 0x49, 0x49, 0x49, 0x36},   // B
+    {0x3E, 0x41, 0x41, 0x41, 0x22},   // C
+    {0x7F, 0x41, 0x41, 0x22, 0x1C},   // D
+    {0x7F, 0x49, 0x49, 0x49, 0x41},   // E
+    {0x7F, 0x09, 0x09, 0x09, 0x01},   // F
+    {0x3E, 0x41, 0x49, 0x49, 0x7A},   // G
+    {0x7F, 0x08, 0x08, 0x08, 0x7F},   // H
+    {0x00, 0x41, 0x7F, 0x41, 0x00},   // I
+    {0x20, 0x40, 0x41, 0x3F, 0x01},   // J
+    {0x7F, 0x08, 0x14, 0x22, 0x41},   // K
+    {0x7F, 0x40, 0x40, 0x40, 0x40},   // L
+    {0x7F, 0x02, 0x0C, 0x02, 0x7F},   // M
+    {0x7F, 0x04, 0x08, 0x10, 0x7F},   // N
+    {0x3E, 0x41, 0x41, 0x41, 0x3E},   // O
+    {0x7F, 0x09, 0x09, 0x09, 0x06},   // P
+    {0x3E, 0x41, 0x51, 0x21, 0x5E},   // Q
+    {0x7F, 0x09, 0x19, 0x29, 0x46},   // R
+    {0x46, 0x49, 0x49, 0x49, 0x31},   // S
+    {0x01, 0x01, 0x7F, 0x01, 0x01},   // T
+    {0x3F, 0x40, 0x40, 0x40, 0x3F},   // U
+    {0x1F, 0x20, 0x40, 0x20, 0x1F},   // V
+    {0x3F, 0x40, 0x38, 0x40, 0x3F},   // W
+    {0x63, 0x14, 0x08, 0x14, 0x63},   // X
+    {0x07, 0x08, 0x70, 0x08, 0x07},   // Y
+    {0x61, 0x51, 0x49, 0x45, 0x43},   // Z
+    {0x00, 0x7F, 0x41, 0x41, 0x00},   // [
+    {0x02, 0x04, 0x08, 0x10, 0x20},   // barra invertida
+    {0x00, 0x41, 0x41, 0x7F, 0x00},   // ]
+    {0x04, 0x02, 0x01, 0x02, 0x04},   // ^
+    {0x40, 0x40, 0x40, 0x40, 0x40},   // _
+    {0x00, 0x01, 0x02, 0x04, 0x00},   // `
+    {0x20, 0x54, 0x54, 0x54, 0x78},   // a
+    {0x7F, 0x48, 0x44, 0x44, 0x38},   // b
+    {0x38, 0x44, 0x44, 0x44, 0x20},   // c
+    {0x38, 0x44, 0x44, 0x48, 0x7F},   // d
+    {0x38, 0x54, 0x54, 0x54, 0x18},   // e
+    {0x08, 0x7E, 0x09, 0x01, 0x02},   // f
+    {0x0C, 0x52, 0x52, 0x52, 0x3E},   // g
+    {0x7F, 0x08, 0x04, 0x04, 0x78},   // h
+    {0x00, 0x44, 0x7D, 0x40, 0x00},   // i
+    {0x20, 0x40, 0x44, 0x3D, 0x00},   // j
+    {0x7F, 0x10, 0x28, 0x44, 0x00},   // k
+    {0x00, 0x41, 0x7F, 0x40, 0x00},   // l
+    {0x7C, 0x04, 0x18, 0x04, 0x78},   // m
+    {0x7C, 0x08, 0x04, 0x04, 0x78},   // n
+    {0x38, 0x44, 0x44, 0x44, 0x38},   // o
+    {0x7C, 0x14, 0x14, 0x14, 0x08},   // p
+    {0x08, 0x14, 0x14, 0x18, 0x7C},   // q
+    {0x7C, 0x08, 0x04, 0x04, 0x08},   // r
+    {0x48, 0x54, 0x54, 0x54, 0x20},   // s
+    {0x04, 0x3F, 0x44, 0x40, 0x20},   // t
+    {0x3C, 0x40, 0x40, 0x20, 0x7C},   // u
+    {0x1C, 0x20, 0x40, 0x20, 0x1C},   // v
+    {0x3C, 0x40, 0x30, 0x40, 0x3C},   // w
+    {0x44, 0x28, 0x10, 0x28, 0x44},   // x
+    {0x0C, 0x50, 0x50, 0x50, 0x3C},   // y
+    {0x44, 0x64, 0x54, 0x4C, 0x44},   // z
+    {0x00, 0x08, 0x36, 0x41, 0x00},   // {
+    {0x00, 0x00, 0x7F, 0x00, 0x00},   // |
+    {0x00, 0x41, 0x36, 0x08, 0x00},   // }
+    {0x10, 0x08, 0x08, 0x10, 0x08},   // ~
+};
+
+const uint8_t* glyph_bits(char c) {
+    if ((unsigned char)c < FIRST_CHAR || (unsigned char)c > LAST_CHAR) return 0;
+    return font5x8[(unsigned char)c - FIRST_CHAR];
+}
+
+/* ========================================================================== */
+/*                          CACHÉ                                             */
+/* ========================================================================== */
+
+typedef struct {
+    uint16_t color;
+    uint16_t bg;
+    char c;                   /** 0 = vía libre. */
+    uint32_t used;            /** Último uso (reloj de la caché). */
+} slot_t;
+
+/** Una tabla por escala: vías y píxeles de cada glifo. */
+typedef struct {
+    slot_t* slots;
+    uint16_t* pixels;
+    uint16_t count;
+    uint8_t scale;
+} table_t;
+
+#define SMALL_PIXELS (GLYPH_WIDTH * GLYPH_HEIGHT)
+#define LARGE_PIXELS (GLYPH_WIDTH * GLYPH_HEIGHT * 4)
+
+static slot_t small_slots[GLYPH_CACHE_SLOTS];
+static uint16_t small_pixels[GLYPH_CACHE_SLOTS][SMALL_PIXELS];
+static slot_t large_slots[GLYPH_CACHE_LARGE_SLOTS];
+static uint16_t large_pixels[GLYPH_CACHE_LARGE_SLOTS][LARGE_PIXELS];
+
+static const table_t tables[2] = {
+    {small_slots, &small_pixels[0][0], GLYPH_CACHE_SLOTS, 1},
+    {large_slots, &large_pixels[0][0], GLYPH_CACHE_LARGE_SLOTS, 2},
+};
+
+static uint32_t now;
+static glyph_stats_t stats;
+
+/** Expandir el glifo a (5 * scale) x (8 * scale) píxeles por filas. */
+static void expand(uint16_t* p, const uint8_t* bits, uint16_t color, uint16_t bg, uint8_t scale) {
+    uint16_t w = GLYPH_WIDTH * scale;
+    uint16_t h = GLYPH_HEIGHT * scale;
+
+    for (uint16_t r = 0; r < h; r++) {
+        uint8_t mask = 1 << (r / scale);
+        for (uint16_t c = 0; c < w; c++) {
+            *p++ = (bits[c / scale] & mask) ? color : bg;
+        }
+    }
+}
+
+const uint16_t* glyph_pixels(char c, uint16_t color, uint16_t bg, uint8_t scale) {
+    const uint8_t* bits = glyph_bits(c);
+    const table_t* t;
+    uint16_t npx, first, victim;
+
+    if (!bits) return 0;
+    if (scale < 1 || scale > 2) {
+        stats.uncached++;
+        return 0;
+    }
+
+    t = &tables[scale - 1];
+    npx = GLYPH_WIDTH * GLYPH_HEIGHT * scale * scale;
+
+    // Conjunto por carácter y colores
+    first = (uint16_t)(((uint8_t)c * 31u + color * 7u + bg) % (t->count / GLYPH_CACHE_WAYS)) * GLYPH_CACHE_WAYS;
+    victim = first;
+    now++;
+
+    for (uint16_t i = first; i < first + GLYPH_CACHE_WAYS; i++) {
+        slot_t* s = &t->slots[i];
+
+        if (s->c == c && s->color == color && s->bg == bg) {
+            s->used = now;
+            stats.hits++;
+            return &t->pixels[i * npx];
+        }
+        if (s->used < t->slots[victim].used) victim = i;
+    }
+
+    stats.misses++;
+    t->slots[victim].c = c;
+    t->slots[victim].color = color;
+    t->slots[victim].bg = bg;
+    t->slots[victim].used = now;
+    expand(&t->pixels[victim * npx], bits, color, bg, scale);
+    return &t->pixels[victim * npx];
+}
+
+void glyph_get_stats(glyph_stats_t* out) {
+    if (out) *out = stats;
+}
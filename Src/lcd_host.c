@@ -0,0 +1,355 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Panel ILI9341 emulado (host)
+ * ============================================================================
+ * Ver lcd_host.h. Solo se compila con -DDAOS_HOST.
+ * ============================================================================
+ */
+
+#ifdef DAOS_HOST
+
+#include "lcd_host.h"
+#include "spi_dma.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================== */
+/*                          ESTADO                                            */
+/* ========================================================================== */
+
+static uint16_t fb[SCREEN_HEIGHT][SCREEN_WIDTH];
+
+static uint8_t selected;
+static uint8_t dc;
+static uint8_t in_reset;
+
+static uint8_t cmd;                   // Último comando
+static uint8_t params[4];
+static uint8_t nparams;
+static uint16_t col_start, col_end = SCREEN_WIDTH - 1;
+static uint16_t page_start, page_end = SCREEN_HEIGHT - 1;
+static uint16_t col, page;            // Próximo píxel de 0x2C
+static uint8_t pixel_hi;
+static uint8_t have_hi;
+
+static lcd_host_stats_t stats;
+static lcd_host_stats_t frame_start;
+
+// Tramo de DMA lanzado y aún sin salir: sus bytes llegan al panel cuando
+// la CPU espera (spi_dma_host_idle), con las líneas CS y DC de ese momento
+static const spi_dma_xfer_t* pending;
+static uint32_t pending_first;
+static uint32_t pending_frames;
+
+/* ========================================================================== */
+/*                          DECODIFICACIÓN                                    */
+/* ========================================================================== */
+
+static void restart(void) {
+    cmd = 0;
+    nparams = 0;
+    col_start = 0;
+    col_end = SCREEN_WIDTH - 1;
+    page_start = 0;
+    page_end = SCREEN_HEIGHT - 1;
+    have_hi = 0;
+}
+
+/** Un píxel de 0x2C: la memoria avanza por la ventana y vuelve al principio. */
+static void write_pixel(uint16_t color) {
+    if (col < SCREEN_WIDTH && page < SCREEN_HEIGHT) fb[page][col] = color;
+    stats.pixels++;
+
+    if (col++ >= col_end) {
+        col = col_start;
+        if (page++ >= page_end) page = page_start;
+    }
+}
+
+static void command(uint8_t c) {
+    stats.commands++;
+    cmd = c;
+    nparams = 0;
+    have_hi = 0;
+
+    if (c == 0x2C) {
+        stats.windows++;
+        col = col_start;
+        page = page_start;
+    } else if (c == 0x01) {
+        restart();
+    }
+}
+
+static void data(uint8_t b) {
+    switch (cmd) {
+        case 0x2A:
+        case 0x2B:
+            if (nparams >= 4) return;
+            params[nparams++] = b;
+            if (nparams == 4) {
+                uint16_t start = (uint16_t)((params[0] << 8) | params[1]);
+                uint16_t end = (uint16_t)((params[2] << 8) | params[3]);
+
+                if (cmd == 0x2A) {
+                    col_start = start;
+                    col_end = end;
+                } else {
+                    page_start = start;
+                    page_end = end;
+                }
+            }
+            break;
+        case 0x2C:
+            if (!have_hi) {
+                pixel_hi = b;
+                have_hi = 1;
+            } else {
+                have_hi = 0;
+                write_pixel((uint16_t)((pixel_hi << 8) | b));
+            }
+            break;
+        default:
+            break;     // Configuración (MADCTL, COLMOD...): no se emula
+    }
+}
+
+/** Un byte por el bus: el panel solo lo ve con el CS bajo. */
+static uint8_t receive(uint8_t b) {
+    if (!selected || in_reset) return 0xFF;
+
+    stats.bytes++;
+    if (dc) {
+        data(b);
+    } else {
+        command(b);
+    }
+    return 0xFF;
+}
+
+/* ========================================================================== */
+/*                          LÍNEAS Y BUS                                      */
+/* ========================================================================== */
+
+void lcd_host_select(uint8_t active) {
+    if (active && !selected) stats.selects++;
+    selected = active;
+}
+
+void lcd_host_dc(uint8_t level) {
+    dc = level;
+}
+
+void lcd_host_reset(uint8_t active) {
+    if (in_reset && !active) restart();
+    in_reset = active;
+}
+
+uint8_t spi_dma_host_exchange(uint8_t data) {
+    return receive(data);
+}
+
+void spi_dma_host_start(const spi_dma_xfer_t* x, uint32_t first, uint32_t frames) {
+    // Como el DMA, el tramo sale mientras la CPU sigue: no se completa aquí
+    pending = x;
+    pending_first = first;
+    pending_frames = frames;
+}
+
+void spi_dma_host_idle(void) {
+    const spi_dma_xfer_t* x = pending;
+
+    if (!x) return;
+    pending = NULL;
+
+    for (uint32_t i = pending_first; i < pending_first + pending_frames; i++) {
+        uint32_t at = (x->flags & SPI_DMA_REPEAT) ? 0 : i;
+
+        if (x->flags & SPI_DMA_16BIT) {
+            uint16_t v = x->tx ? ((const uint16_t*)x->tx)[at] : 0xFFFF;
+            uint8_t hi = receive((uint8_t)(v >> 8));
+            uint8_t lo = receive((uint8_t)v);
+
+            if (x->rx) ((uint16_t*)x->rx)[i] = (uint16_t)((hi << 8) | lo);
+        } else {
+            uint8_t r = receive(x->tx ? ((const uint8_t*)x->tx)[at] : 0xFF);
+
+            if (x->rx) ((uint8_t*)x->rx)[i] = r;
+        }
+    }
+
+    // El tramo ya salió: la interrupción puede lanzar el siguiente
+    spi_dma_host_irq();
+}
+
+/* ========================================================================== */
+/*                          INSPECCIÓN                                        */
+/* ========================================================================== */
+
+const uint16_t* lcd_host_framebuffer(void) {
+    spi_dma_flush();
+    return &fb[0][0];
+}
+
+uint16_t lcd_host_pixel(uint16_t x, uint16_t y) {
+    spi_dma_flush();
+    if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return 0;
+    return fb[y][x];
+}
+
+void lcd_host_get_stats(lcd_host_stats_t* out) {
+    spi_dma_flush();
+    if (out) *out = stats;
+}
+
+void lcd_host_frame(lcd_host_stats_t* out) {
+    spi_dma_flush();
+    if (out) {
+        out->bytes = stats.bytes - frame_start.bytes;
+        out->selects = stats.selects - frame_start.selects;
+        out->windows = stats.windows - frame_start.windows;
+        out->commands = stats.commands - frame_start.commands;
+        out->pixels = stats.pixels - frame_start.pixels;
+    }
+    frame_start = stats;
+}
+
+/* ========================================================================== */
+/*                          IMÁGENES                                          */
+/* ========================================================================== */
+
+/** RGB565 a 8 bits por canal (se repiten los bits altos en los bajos). */
+static void to_rgb(uint16_t c, uint8_t* rgb) {
+    uint8_t r = (c >> 11) & 0x1F;
+    uint8_t g = (c >> 5) & 0x3F;
+    uint8_t b = c & 0x1F;
+
+    rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+    rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+    rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+int lcd_host_save_ppm(const char* path) {
+    FILE* f;
+    uint8_t row[SCREEN_WIDTH * 3];
+    int ok = 1;
+
+    spi_dma_flush();
+    f = fopen(path, "wb");
+    if (!f) return -1;
+
+    fprintf(f, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (int y = 0; y < SCREEN_HEIGHT && ok; y++) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) to_rgb(fb[y][x], &row[x * 3]);
+        ok = fwrite(row, 1, sizeof(row), f) == sizeof(row);
+    }
+    if (fclose(f) != 0) ok = 0;
+    return ok ? 0 : -1;
+}
+
+static uint32_t crc_table[256];
+
+static uint32_t crc32(uint32_t crc, const uint8_t* p, uint32_t len) {
+    if (!crc_table[1]) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            crc_table[n] = c;
+        }
+    }
+
+    crc = ~crc;
+    while (len--) crc = crc_table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+/** Un chunk de PNG: longitud, tipo, datos y CRC de tipo y datos. */
+static int chunk(FILE* f, const char* type, const uint8_t* body, uint32_t len) {
+    uint8_t head[8];
+    uint8_t tail[4];
+    uint32_t crc;
+
+    put32(head, len);
+    memcpy(&head[4], type, 4);
+    crc = crc32(0, &head[4], 4);
+    crc = crc32(crc, body, len);
+    put32(tail, crc);
+
+    return fwrite(head, 1, 8, f) == 8 &&
+           fwrite(body, 1, len, f) == len &&
+           fwrite(tail, 1, 4, f) == 4;
+}
+
+// Filas con su byte de filtro (0), en un flujo zlib de bloques almacenados
+#define PNG_ROW   (1 + SCREEN_WIDTH * 3)
+#define PNG_RAW   (PNG_ROW * SCREEN_HEIGHT)
+#define PNG_BLOCK 65535
+#define PNG_ZLIB  (2 + PNG_RAW + 5 * ((PNG_RAW + PNG_BLOCK - 1) / PNG_BLOCK) + 4)
+
+static uint8_t png_raw[PNG_RAW];
+static uint8_t png_zlib[PNG_ZLIB];
+
+int lcd_host_save_png(const char* path) {
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint8_t ihdr[13];
+    uint32_t a = 1, b = 0;
+    uint32_t pos = 0;
+    FILE* f;
+    int ok;
+
+    spi_dma_flush();
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        uint8_t* row = &png_raw[y * PNG_ROW];
+
+        row[0] = 0;
+        for (int x = 0; x < SCREEN_WIDTH; x++) to_rgb(fb[y][x], &row[1 + x * 3]);
+    }
+
+    png_zlib[pos++] = 0x78;     // Deflate, ventana de 32 KB
+    png_zlib[pos++] = 0x01;
+    for (uint32_t off = 0; off < PNG_RAW; off += PNG_BLOCK) {
+        uint32_t len = PNG_RAW - off;
+
+        if (len > PNG_BLOCK) len = PNG_BLOCK;
+        png_zlib[pos++] = (off + len == PNG_RAW) ? 1 : 0;   // Último bloque
+        png_zlib[pos++] = (uint8_t)len;
+        png_zlib[pos++] = (uint8_t)(len >> 8);
+        png_zlib[pos++] = (uint8_t)~len;
+        png_zlib[pos++] = (uint8_t)(~len >> 8);
+        memcpy(&png_zlib[pos], &png_raw[off], len);
+        pos += len;
+    }
+    for (uint32_t i = 0; i < PNG_RAW; i++) {
+        a = (a + png_raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32(&png_zlib[pos], (b << 16) | a);
+    pos += 4;
+
+    put32(&ihdr[0], SCREEN_WIDTH);
+    put32(&ihdr[4], SCREEN_HEIGHT);
+    ihdr[8] = 8;                // Bits por canal
+    ihdr[9] = 2;                // RGB
+    ihdr[10] = 0;
+    ihdr[11] = 0;
+    ihdr[12] = 0;
+
+    f = fopen(path, "wb");
+    if (!f) return -1;
+    ok = fwrite(signature, 1, 8, f) == 8 &&
+         chunk(f, "IHDR", ihdr, sizeof(ihdr)) &&
+         chunk(f, "IDAT", png_zlib, pos) &&
+         chunk(f, "IEND", ihdr, 0);
+    if (fclose(f) != 0) ok = 0;
+    return ok ? 0 : -1;
+}
+
+#endif /* DAOS_HOST */
@@ -0,0 +1,146 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Compresor LZ de ventana pequeña - Implementación
+ * ============================================================================
+ */
+
+#include "lz.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                          CONFIGURACIÓN INTERNA                             */
+/* ========================================================================== */
+
+#define LZ_HASH_BITS   7
+#define LZ_HASH_SIZE   (1 << LZ_HASH_BITS)
+#define LZ_MAX_CHAIN   16          // Candidatos revisados por posición
+#define LZ_MAX_LITERAL 128
+
+// Cadenas de hash (posición + 1; 0 = vacío). Solo las usa el compresor.
+static uint16_t hash_head[LZ_HASH_SIZE];
+static uint16_t hash_prev[LZ_WINDOW];
+
+/* ========================================================================== */
+/*                          FUNCIONES AUXILIARES                              */
+/* ========================================================================== */
+
+static uint32_t lz_hash(const uint8_t* p) {
+    uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static void lz_insert(const uint8_t* src, uint32_t pos) {
+    uint32_t h = lz_hash(src + pos);
+    hash_prev[pos % LZ_WINDOW] = hash_head[h];
+    hash_head[h] = (uint16_t)(pos + 1);
+}
+
+/**
+ * Emitir literales pendientes en tokens de hasta LZ_MAX_LITERAL bytes
+ */
+static int lz_flush_literals(const uint8_t* lit, uint32_t count,
+                             uint8_t* dst, uint32_t* out, uint32_t cap) {
+    while (count > 0) {
+        uint32_t n = (count > LZ_MAX_LITERAL) ? LZ_MAX_LITERAL : count;
+        if (*out + 1 + n > cap) return -1;
+
+        dst[(*out)++] = (uint8_t)(n - 1);
+        memcpy(dst + *out, lit, n);
+        *out += n;
+        lit += n;
+        count -= n;
+    }
+    return 0;
+}
+
+/* ========================================================================== */
+/*                          API                                               */
+/* ========================================================================== */
+
+int lz_compress(const uint8_t* src, uint32_t len, uint8_t* dst, uint32_t cap) {
+    uint32_t out = 0;
+    uint32_t pos = 0;
+    uint32_t lit_start = 0;
+
+    if (len > 0xFFFF) return -1;
+
+    memset(hash_head, 0, sizeof(hash_head));
+
+    while (pos + LZ_MIN_MATCH <= len) {
+        uint32_t best_len = 0;
+        uint32_t best_dist = 0;
+        uint32_t limit = len - pos;
+        if (limit > LZ_MAX_MATCH) limit = LZ_MAX_MATCH;
+
+        // Recorrer la cadena de candidatos con el mismo hash
+        uint32_t cand = hash_head[lz_hash(src + pos)];
+        for (int chain = 0; cand != 0 && chain < LZ_MAX_CHAIN; chain++) {
+            uint32_t c = cand - 1;
+            uint32_t dist = pos - c;
+            if (dist > LZ_WINDOW) break;
+
+            uint32_t n = 0;
+            while (n < limit && src[c + n] == src[pos + n]) n++;
+            if (n > best_len) {
+                best_len = n;
+                best_dist = dist;
+                if (n == limit) break;
+            }
+            cand = hash_prev[c % LZ_WINDOW];
+        }
+
+        if (best_len >= LZ_MIN_MATCH) {
+            if (lz_flush_literals(src + lit_start, pos - lit_start, dst, &out, cap) < 0) {
+                return -1;
+            }
+            if (out + 2 > cap) return -1;
+            dst[out++] = (uint8_t)(0x80 | (best_len - LZ_MIN_MATCH));
+            dst[out++] = (uint8_t)(best_dist - 1);
+
+            // Indexar las posiciones cubiertas por la copia
+            uint32_t end = pos + best_len;
+            for (; pos < end; pos++) {
+                if (pos + LZ_MIN_MATCH <= len) lz_insert(src, pos);
+            }
+            lit_start = pos;
+        } else {
+            lz_insert(src, pos);
+            pos++;
+        }
+    }
+
+    if (lz_flush_literals(src + lit_start, len - lit_start, dst, &out, cap) < 0) {
+        return -1;
+    }
+    return (int)out;
+}
+
+int lz_decompress(const uint8_t* src, uint32_t len, uint8_t* dst, uint32_t cap) {
+    uint32_t in = 0;
+    uint32_t out = 0;
+
+    while (in < len) {
+        uint8_t c = src[in++];
+
+        if (c < 0x80) {
+            uint32_t n = (uint32_t)c + 1;
+            if (in + n > len || out + n > cap) return -1;
+            memcpy(dst + out, src + in, n);
+            in += n;
+            out += n;
+        } else {
+            if (in >= len) return -1;
+            uint32_t n = (uint32_t)(c & 0x7F) + LZ_MIN_MATCH;
+            uint32_t dist = (uint32_t)src[in++] + 1;
+            if (dist > out || out + n > cap) return -1;
+
+            // Copia byte a byte: la fuente puede solaparse con el destino
+            const uint8_t* from = dst + out - dist;
+            for (uint32_t i = 0; i < n; i++) {
+                dst[out + i] = from[i];
+            }
+            out += n;
+        }
+    }
+    return (int)out;
+}
@@ -9,152 +9,9 @@
 #include "demo_scheduler_rr.h"
 #include "herenciaprioridad.h"
 #include "demo_prem.h"
+#include "sprites_banners.h"  // Banners 32x20 a escala 3, desde assets/banners.sprites
 #include <string.h>
 
-// Definiciones de banners para cada juego
-#define BANNER_WIDTH 32
-#define BANNER_HEIGHT 20
-
-// Banners vacíos - tú los llenarás con imágenes distintas
-static const uint32_t banner_tron4p_data[640] = {
-0xff7abbe9, 0xff7abbe9, 0xff7abbe9, 0xff7abbe9, 0xff269df3, 0xff269df3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc42f14, 0xffc42f14, 0xfffc694e, 0xfffc694e, 0xfffc694e, 0xfffc694e,
-0xff7abbe9, 0xff7abbe9, 0xff7abbe9, 0xff269df3, 0xff151617, 0xff7abbe9, 0xff269df3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc42f14, 0xfffc694e, 0xff151617, 0xffc42f14, 0xfffc694e, 0xfffc694e, 0xfffc694e,
-0xff7abbe9, 0xff7abbe9, 0xff151617, 0xff2c2f32, 0xff151617, 0xff151617, 0xff2c2f32, 0xff269df3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd7e3eb, 0xffd7e3eb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc42f14, 0xff2c2f32, 0xff151617, 0xff151617, 0xff2c2f32, 0xff151617, 0xfffc694e, 0xfffc694e,
-0xff7abbe9, 0xff7abbe9, 0xff2c2f32, 0xff5d6164, 0xff2c2f32, 0xff2c2f32, 0xff5d6164, 0xff2c2f32, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd7e3eb, 0xff060614, 0xff2a2a34, 0xffd7e3eb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff2c2f32, 0xff5d6164, 0xff2c2f32, 0xff2c2f32, 0xff5d6164, 0xff2c2f32, 0xfffc694e, 0xfffc694e,
-0xff7abbe9, 0xff7abbe9, 0xff7abbe9, 0xff2c2f32, 0x00000000, 0x00000000, 0xff2c2f32, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd7e3eb, 0xffc7dded, 0xff060614, 0xff060614, 0xff060614, 0xffd7e3eb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff2c2f32, 0x00000000, 0x00000000, 0xff2c2f32, 0xfffc694e, 0xfffc694e, 0xfffc694e,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc7dded, 0xff060614, 0xff060614, 0xff2a2a34, 0xff060614, 0xff2a2a34, 0xffc7dded, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff269df3, 0xff269df3, 0xff269df3, 0xff269df3, 0x00000000, 0xff269df3, 0xff269df3, 0xff269df3, 0xffd7e3eb, 0xffd7e3eb, 0xff269df3, 0xff269df3, 0xff269df3, 0x00000000, 0xff269df3, 0x00000000, 0x00000000, 0xff269df3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff269df3, 0xff269df3, 0xff269df3, 0xff269df3, 0xffc7dded, 0xff269df3, 0xffd7e3eb, 0xff269df3, 0x00000000, 0x00000000, 0xff269df3, 0xff2a2a34, 0xff269df3, 0x00000000, 0xff269df3, 0xff269df3, 0x00000000, 0xff269df3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff55b6fc, 0xff55b6fc, 0xffc7dded, 0xff2a2a34, 0xff55b6fc, 0xff55b6fc, 0xff55b6fc, 0xffd7e3eb, 0xffd7e3eb, 0xff55b6fc, 0xff2a2a34, 0xff55b6fc, 0x00000000, 0xff55b6fc, 0xff55b6fc, 0xff55b6fc, 0xff55b6fc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff55b6fc, 0xff55b6fc, 0x00000000, 0xffc7dded, 0xff55b6fc, 0xff2a2a34, 0xff55b6fc, 0xff55b6fc, 0xff2a2a34, 0xff55b6fc, 0xff2a2a34, 0xff55b6fc, 0x00000000, 0xff55b6fc, 0x00000000, 0xff55b6fc, 0xff55b6fc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa7d5f7, 0xffa7d5f7, 0x00000000, 0x00000000, 0xffa7d5f7, 0xffc7dded, 0xffa7d5f7, 0xffa7d5f7, 0xffd7e3eb, 0xffa7d5f7, 0xffa7d5f7, 0xff269df3, 0x00000000, 0xffa7d5f7, 0x00000000, 0xffa7d5f7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc7dded, 0xff2a2a34, 0xff060614, 0xffc7dded, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd7e3eb, 0xff0f0f19, 0xff2a2a34, 0xffd7e3eb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc7dded, 0xff0f0f19, 0xff2a2a34, 0xffc7dded, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd7e3eb, 0xffd7e3eb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffa0da18, 0xffa0da18, 0xffa0da18, 0xffa0da18, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff28a606, 0xff28a606, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047,
-0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffa0da18, 0xffa0da18, 0xff151617, 0xffbeef4c, 0xffa0da18, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff28a606, 0xff67e047, 0xff151617, 0xff28a606, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047,
-0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xff151617, 0xff2c2f32, 0xff151617, 0xff151617, 0xff2c2f32, 0xffa0da18, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff28a606, 0xff2c2f32, 0xff151617, 0xff151617, 0xff2c2f32, 0xff151617, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047,
-0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xff2c2f32, 0xff5d6164, 0xff2c2f32, 0xff2c2f32, 0xff5d6164, 0xff2c2f32, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff2c2f32, 0xff5d6164, 0xff2c2f32, 0xff2c2f32, 0xff5d6164, 0xff2c2f32, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047,
-0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffbeef4c, 0xffa0da18, 0xff2c2f32, 0x00000000, 0x00000000, 0xff2c2f32, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff2c2f32, 0x00000000, 0x00000000, 0xff2c2f32, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047, 0xff67e047
-};
-
-static const uint32_t banner_tanque_data[640] = {
-    0x00000000, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff8783e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff5779ed, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff8783e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff5779ed, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff8783e8, 0xff8783e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff5779ed, 0x00000000, 0x00000000, 0xff5779ed, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff5779ed, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b1f3, 0x00000000, 0x00000000, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0xff5779ed, 0x00000000, 0x00000000, 0xff5779ed, 0xff5779ed, 0x00000000, 0x00000000, 0xff8783e8, 0xff8783e8, 0xff8783e8, 0xff8783e8, 0x00000000, 0xff5779ed, 0x00000000, 0x00000000, 0xff5779ed, 0x00000000, 0xff8783e8, 0xff8783e8, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b1f3, 0x00000000, 0x00000000, 0xff8783e8, 0x00000000, 0x00000000, 0xff8783e8, 0x00000000, 0xff8783e8, 0x00000000, 0xff8783e8, 0xff8783e8, 0x00000000, 0x00000000, 0x00000000, 0xffb3b1f3, 0xffb3b1f3, 0x00000000, 0xff8783e8, 0x00000000, 0x00000000, 0xff8783e8, 0x00000000, 0xff8783e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc6c4f7, 0x00000000, 0x00000000, 0xffb3b1f3, 0xffb3b1f3, 0xffb3b1f3, 0x00000000, 0x00000000, 0xffb3b1f3, 0x00000000, 0x00000000, 0xffb3b1f3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b1f3, 0x00000000, 0x00000000, 0xff8783e8, 0xffb3b1f3, 0x00000000, 0x00000000, 0xffb3b1f3, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc6c4f7, 0x00000000, 0x00000000, 0xffc6c4f7, 0x00000000, 0x00000000, 0xffc6c4f7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc6c4f7, 0x00000000, 0x00000000, 0xffc6c4f7, 0xffc6c4f7, 0x00000000, 0x00000000, 0xffc6c4f7, 0xffc6c4f7, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc4c2f5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff16060, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc4c2f5, 0x00000000, 0x00000000, 0x00000000, 0xfff16060, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc4c2f5, 0xffc4c2f5, 0x00000000, 0xfff8d9d9, 0x00000000, 0xfff16060, 0xfff16060, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff050419, 0xff232328, 0x00000000, 0xff232328, 0xff232328, 0xffaeabeb, 0xffaeabeb, 0xff050419, 0x00000000, 0x00000000, 0xffc4c2f5, 0xfff8d9d9, 0xfff16060, 0xfff16060, 0xff232328, 0xffd71919, 0xffd71919, 0xff232328, 0xff232328, 0xff232328, 0x00000000, 0xff232328, 0xff232328, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff050419, 0xff232328, 0xff050419, 0xff232328, 0xff050419, 0x00000000, 0x00000000, 0x00000000, 0xffc4c2f5, 0xffc4c2f5, 0x00000000, 0xfff8d9d9, 0x00000000, 0xfff16060, 0xfff16060, 0x00000000, 0x00000000, 0xff232328, 0xff0e0e0e, 0xff232328, 0xff0e0e0e, 0xff0e0e0e, 0xff0e0e0e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff050419, 0xff232328, 0xff232328, 0xff050419, 0xffaeabeb, 0xff050419, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc4c2f5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff16060, 0x00000000, 0x00000000, 0xff0e0e0e, 0xffd71919, 0xff0e0e0e, 0xff0e0e0e, 0xff232328, 0xff0e0e0e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0xff050419, 0xff232328, 0xff050419, 0xff232328, 0xff050419, 0xffaeabeb, 0xffaeabeb, 0xff050419, 0x00000000, 0x00000000, 0xffc4c2f5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff16060, 0x00000000, 0xff0e0e0e, 0xffd71919, 0xffd71919, 0xff232328, 0xff0e0e0e, 0xff232328, 0xff232328, 0xff232328, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffaeabeb, 0xffaeabeb, 0xffaeabeb, 0xffaeabeb, 0x00000000, 0xffaeabeb, 0xffaeabeb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd71919, 0xffd71919, 0x00000000, 0xffd71919, 0xffd71919, 0xffd71919, 0xffd71919, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
-};
-
-static const uint32_t banner_tron2p_data[640] = {
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0xff4979cf, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0xff4979cf, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0x00000000, 0xff4979cf, 0xff4979cf, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6695e8, 0x00000000, 0xff6695e8, 0x00000000, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0xff6695e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff59090, 0xfff59090,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6695e8, 0x00000000, 0xff6695e8, 0x00000000, 0xff6695e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6695e8, 0x00000000, 0xff6695e8, 0xff6695e8, 0xff6695e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff59090, 0xfff59090, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff9fc2ff, 0x00000000, 0xff9fc2ff, 0x00000000, 0xff6695e8, 0x00000000, 0x00000000, 0xff9fc2ff, 0xff6695e8, 0xff6695e8, 0x00000000, 0xff6695e8, 0xff9fc2ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe66565, 0xfff59090, 0x00000000, 0x00000000,
-0x00000000, 0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff9fc2ff, 0xff9fc2ff, 0x00000000, 0x00000000, 0xff9fc2ff, 0x00000000, 0xff9fc2ff, 0xff9fc2ff, 0x00000000, 0x00000000, 0x00000000, 0xff9fc2ff, 0x00000000, 0xff9fc2ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe66565, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0xffd8dee9, 0xffd8dee9, 0xffbfcde6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd71919, 0xffe66565, 0xffe66565, 0xffe66565, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbfcde6, 0x00000000, 0xff232528, 0xff060607, 0xff060607, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xff060607, 0xff060607, 0xff232528, 0xffd71919, 0xffd71919, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xffbfcde6, 0xffbfcde6, 0xff060607, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xffd71919, 0xffd71919, 0xff060607, 0xff232528, 0x00000000, 0x00000000, 0xffd71919, 0xffe66565, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0xffd8dee9, 0xffbfcde6, 0x00000000, 0xff232528, 0xff060607, 0xffbfcde6, 0xff000000, 0xff000000, 0xffbfcde6, 0xff232528, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xff060607, 0xffd71919, 0xff000000, 0xff000000, 0xffd71919, 0xff232528, 0xff060607, 0xffd71919, 0x00000000, 0xffe66565, 0xffe66565, 0xffe66565, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff232528, 0xffbfcde6, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xffbfcde6, 0xff232528, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff232528, 0xffd71919, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xffd71919, 0xff232528, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0xffe66565, 0xfff59090,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xffbfcde6, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xffd71919, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xffd71919, 0xff060607, 0xffd71919, 0xffd71919, 0x00000000, 0x00000000, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0xffbfcde6, 0xff232528, 0xffbfcde6, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xffbfcde6, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xffd71919, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xffd71919, 0xff232528, 0x00000000, 0xffe66565, 0xffe66565, 0xfff59090, 0xfff59090,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffd71919, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffd71919, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0xffd8dee9, 0xffbfcde6, 0x00000000, 0xff060607, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0xff060607, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffd71919, 0xff060607, 0x00000000, 0x00000000, 0xff060607, 0xffd71919, 0xff060607, 0xffd71919, 0xffe66565, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xffbfcde6, 0xff232528, 0xff232528, 0xffbfcde6, 0xff060607, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xffd71919, 0xff232528, 0xff232528, 0xffd71919, 0xff060607, 0xff232528, 0x00000000, 0xffe66565, 0xffe66565, 0xffe66565, 0xfff59090, 0xfff59090,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbfcde6, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xff232528, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xff232528, 0xff060607, 0xffd71919, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0xffbfcde6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe66565, 0xffe66565, 0xffe66565, 0xffe66565, 0xffe66565, 0xffe66565, 0xfff59090, 0xfff59090
-
-};
-
-static const uint32_t banner_reconocedor_data[640] = {
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0x00000000, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0x00000000, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff989be0, 0x00000000, 0xff989be0, 0xff6581fa, 0xff989be0, 0x00000000, 0x00000000, 0xff989be0, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0xff989be0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff989be0, 0x00000000, 0xff989be0, 0xff989be0, 0xff989be0, 0x00000000, 0x00000000, 0xff989be0, 0xff989be0, 0xff989be0, 0x00000000, 0x00000000, 0xff989be0, 0xff989be0, 0xff989be0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0xffcecff1, 0xffcecff1, 0xffcecff1, 0xffcecff1, 0xffcecff1, 0x00000000, 0xffcecff1, 0x00000000, 0xffcecff1, 0x00000000, 0xffcecff1, 0xffcecff1, 0x00000000, 0xffcecff1, 0x00000000, 0x00000000, 0xffcecff1, 0x00000000, 0xffcecff1, 0x00000000, 0x00000000, 0xffcecff1, 0x00000000, 0xffcecff1, 0x00000000, 0xffcecff1, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecff1, 0xffcecff1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa4b5fe, 0xff6581fa, 0xff000007, 0xff0d0d12, 0xff6581fa, 0xffa4b5fe, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0xff000007, 0xff0d0d12, 0xff0d0d12, 0xff000007, 0xff0d0d12, 0xff000007, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xffa4b5fe, 0xffa4b5fe, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xffa4b5fe, 0xffa4b5fe, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa4b5fe, 0xff6581fa, 0xff000007, 0xff000007, 0xffa4b5fe, 0xffa4b5fe, 0xff000007, 0xff000007, 0xff6581fa, 0xffa4b5fe, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa4b5fe, 0xff6581fa, 0xff6581fa, 0xff0d0d12, 0xff000007, 0xff000007, 0xff0d0d12, 0xff0d0d12, 0xff0d0d12, 0xff6581fa, 0xff6581fa, 0xffa4b5fe, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0xff000007, 0xff000007, 0xff0d0d12, 0xff000007, 0xff000007, 0xff000007, 0xff000007, 0xff0d0d12, 0xff000007, 0xff000007, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6581fa, 0xffa4b5fe, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xff6581fa, 0xffa4b5fe, 0xff6581fa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
-};
-
-static const uint32_t banner_snake_data[640] = {
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa6bfd9, 0xff1d7cde, 0xff1d7cde, 0xff1d7cde, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff1d7cde, 0xff1d7cde, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa6bfd9, 0xffa6bfd9, 0xff1d7cde, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0xff000810, 0xffa6bfd9, 0x00000000, 0x00000000, 0xff1d7cde, 0xff1d7cde, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0xff000810, 0xffa6bfd9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff1d7cde, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0xff000810, 0xff000810, 0xffa6bfd9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff1d7cde, 0x00000000, 0xff1d7cde, 0x00000000, 0xff1d7cde, 0xff1d7cde, 0xff1d7cde, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0xff000810, 0xffa6bfd9, 0x00000000, 0x00000000, 0xff75b2f1, 0xff75b2f1, 0x00000000, 0x00000000, 0x00000000, 0xff5ca4ed, 0x00000000, 0xff1d7cde, 0xff1d7cde, 0x00000000, 0x00000000, 0xff1d7cde, 0xff1d7cde, 0xff1d7cde, 0xff1d7cde, 0x00000000, 0xff1d7cde, 0xff1d7cde, 0x00000000, 0x00000000, 0xff5ca4ed, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0xffa6bfd9, 0x00000000, 0x00000000, 0x00000000, 0xff75b2f1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff5ca4ed, 0x00000000, 0xff5ca4ed, 0xff5ca4ed, 0xff5ca4ed, 0x00000000, 0xff5ca4ed, 0x00000000, 0x00000000, 0xff5ca4ed, 0x00000000, 0xff5ca4ed, 0xff5ca4ed, 0xff5ca4ed, 0x00000000, 0xff5ca4ed, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0xff000810, 0xffa6bfd9, 0x00000000, 0x00000000, 0xff75b2f1, 0xff75b2f1, 0x00000000, 0xffb8cee4, 0xffb8cee4, 0xff75b2f1, 0x00000000, 0xff75b2f1, 0x00000000, 0xff75b2f1, 0x00000000, 0xff75b2f1, 0xff75b2f1, 0xff75b2f1, 0xff75b2f1, 0x00000000, 0xff75b2f1, 0x00000000, 0xff75b2f1, 0x00000000, 0xff75b2f1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0xff000810, 0xffa6bfd9, 0x00000000, 0x00000000, 0x00000000, 0xffb8cee4, 0xffb8cee4, 0xffb8cee4, 0x00000000, 0x00000000, 0x00000000, 0xff75b2f1, 0x00000000, 0xffb8cee4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb8cee4, 0x00000000, 0xff75b2f1, 0x00000000, 0xffb8cee4, 0x00000000, 0xff75b2f1, 0xffb8cee4, 0xffb8cee4, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0xff000810, 0xff000810, 0xffa6bfd9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000810, 0xff000810, 0xff000810, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0xff000810, 0xff000810, 0xffa6bfd9, 0xffa6bfd9, 0xffa6bfd9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa6bfd9, 0xffa6bfd9, 0x00000000, 0x00000000, 0xffa6bfd9, 0xffa6bfd9, 0xffa6bfd9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffa6bfd9, 0xff000810, 0xffd7e0e9, 0xffd1a037, 0xff191b1d, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0xff000810, 0xff000810, 0xff000810, 0xff000810, 0xffa6bfd9, 0xffa6bfd9, 0x00000000, 0x00000000, 0xffa6bfd9, 0xff000810, 0xffa6bfd9, 0x00000000, 0xffa6bfd9, 0xff000810, 0xff000810, 0xff000810, 0xffa6bfd9, 0x00000000, 0x00000000, 0xffa6bfd9, 0xff000810, 0xff191b1d, 0xff000810, 0xff191b1d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000810, 0xff000810, 0xff000810, 0xff191b1d, 0xff000810, 0xffa6bfd9, 0x00000000, 0xffa6bfd9, 0xff000810, 0xffa6bfd9, 0x00000000, 0xffa6bfd9, 0xff000810, 0xff000810, 0xff000810, 0xffa6bfd9, 0x00000000, 0xffa6bfd9, 0xffa6bfd9, 0xff000810, 0xff000810, 0xff191b1d, 0xff191b1d, 0xffa6bfd9, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000810, 0xff000810, 0xff000810, 0xffa6bfd9, 0x00000000, 0xffa6bfd9, 0xff000810, 0xffa6bfd9, 0x00000000, 0xffa6bfd9, 0xff000810, 0x00000000, 0xff000810, 0xffa6bfd9, 0xffa6bfd9, 0xff000810, 0xff000810, 0xffa6bfd9, 0xff000810, 0xffa6bfd9, 0xffa6bfd9, 0xffa6bfd9, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff191b1d, 0xff000810, 0xffa6bfd9, 0x00000000, 0xffa6bfd9, 0xff000810, 0xffa6bfd9, 0xffa6bfd9, 0xffa6bfd9, 0xff000810, 0x00000000, 0xff000810, 0xff000810, 0xff191b1d, 0xff000810, 0xff191b1d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff191b1d, 0xff000810, 0xffa6bfd9, 0x00000000, 0xffa6bfd9, 0xff000810, 0x00000000, 0xff000810, 0xff191b1d, 0xff000810, 0x00000000, 0xff000810, 0xff191b1d, 0xff191b1d, 0xff000810, 0xff000810, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000810, 0xff191b1d, 0xffa6bfd9, 0x00000000, 0xffa6bfd9, 0xff000810, 0x00000000, 0xff191b1d, 0xff191b1d, 0xff191b1d, 0x00000000, 0x00000000, 0x00000000, 0xff000810, 0xff000810, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000810, 0xff000810, 0xffa6bfd9, 0xff000810, 0xff000810, 0x00000000, 0xff000810, 0xff191b1d, 0xff000810, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000810, 0xff000810, 0xff000810, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
-};
-
-static const uint32_t banner_disco_data[640] = {
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0xff4979cf, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0xff4979cf, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0x00000000, 0xff4979cf, 0xff4979cf, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6695e8, 0x00000000, 0xff6695e8, 0x00000000, 0xff4979cf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff4979cf, 0x00000000, 0xff4979cf, 0x00000000, 0xff6695e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff59090, 0xfff59090,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6695e8, 0x00000000, 0xff6695e8, 0x00000000, 0xff6695e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff6695e8, 0x00000000, 0xff6695e8, 0xff6695e8, 0xff6695e8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff59090, 0xfff59090, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff9fc2ff, 0x00000000, 0xff9fc2ff, 0x00000000, 0xff6695e8, 0x00000000, 0x00000000, 0xff9fc2ff, 0xff6695e8, 0xff6695e8, 0x00000000, 0xff6695e8, 0xff9fc2ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe66565, 0xfff59090, 0x00000000, 0x00000000,
-0x00000000, 0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff9fc2ff, 0xff9fc2ff, 0x00000000, 0x00000000, 0xff9fc2ff, 0x00000000, 0xff9fc2ff, 0xff9fc2ff, 0x00000000, 0x00000000, 0x00000000, 0xff9fc2ff, 0x00000000, 0xff9fc2ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe66565, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0xffd8dee9, 0xffd8dee9, 0xffbfcde6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffd71919, 0xffe66565, 0xffe66565, 0xffe66565, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbfcde6, 0x00000000, 0xff232528, 0xff060607, 0xff060607, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xff060607, 0xff060607, 0xff232528, 0xffd71919, 0xffd71919, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xffbfcde6, 0xffbfcde6, 0xff060607, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xffd71919, 0xffd71919, 0xff060607, 0xff232528, 0x00000000, 0x00000000, 0xffd71919, 0xffe66565, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0xffd8dee9, 0xffbfcde6, 0x00000000, 0xff232528, 0xff060607, 0xffbfcde6, 0xff000000, 0xff000000, 0xffbfcde6, 0xff232528, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xff060607, 0xffd71919, 0xff000000, 0xff000000, 0xffd71919, 0xff232528, 0xff060607, 0xffd71919, 0x00000000, 0xffe66565, 0xffe66565, 0xffe66565, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff232528, 0xffbfcde6, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xffbfcde6, 0xff232528, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff232528, 0xffd71919, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xffd71919, 0xff232528, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0xffe66565, 0xfff59090,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xffbfcde6, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xffd71919, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xffd71919, 0xff060607, 0xffd71919, 0xffd71919, 0x00000000, 0x00000000, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0xffbfcde6, 0xff232528, 0xffbfcde6, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xffbfcde6, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0xff232528, 0xffd71919, 0xff000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff000000, 0xffd71919, 0xff232528, 0x00000000, 0xffe66565, 0xffe66565, 0xfff59090, 0xfff59090,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffd71919, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffd71919, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0xffd8dee9, 0xffbfcde6, 0x00000000, 0xff060607, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0xff060607, 0xffbfcde6, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xffd71919, 0xff060607, 0x00000000, 0x00000000, 0xff060607, 0xffd71919, 0xff060607, 0xffd71919, 0xffe66565, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xffbfcde6, 0xff232528, 0xff232528, 0xffbfcde6, 0xff060607, 0xff232528, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xffd71919, 0xff232528, 0xff232528, 0xffd71919, 0xff060607, 0xff232528, 0x00000000, 0xffe66565, 0xffe66565, 0xffe66565, 0xfff59090, 0xfff59090,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffbfcde6, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xff232528, 0xff060607, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff060607, 0xff060607, 0xff232528, 0xff060607, 0xffd71919, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0xffd8dee9, 0xffbfcde6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe66565, 0xffe66565, 0xffe66565, 0xffe66565, 0xffe66565, 0xffe66565, 0xfff59090, 0xfff59090
-};
-
 void software_reset(void) {
     *((volatile uint32_t*)0xE000ED0C) = 0x05FA0004;
     while(1);
@@ -234,6 +91,7 @@ void button_update_task(void) {
         daos_gfx_clear(DAOS_COLOR_BLACK);
         daos_gfx_draw_text_large(50, 100, "RETURNING", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 2);
         daos_gfx_draw_text_large(65, 130, "TO MENU", DAOS_COLOR_YELLOW, DAOS_COLOR_BLACK, 2);
+        daos_gfx_sync();   // La tarea de pantalla ya no va a correr
 
         for (volatile int i = 0; i < 2000000; i++);
 
@@ -252,6 +110,7 @@ void button_update_task(void) {
 
         daos_gfx_clear(DAOS_COLOR_BLACK);
         daos_gfx_draw_text_large(50, 110, "RESTARTING", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 2);
+        daos_gfx_sync();
 
         for (volatile int i = 0; i < 300000; i++);
 
@@ -270,6 +129,7 @@ void button_update_task(void) {
             daos_task_create(binario_actual->input_task, DAOS_PRIO_NORMAL);
             daos_task_create(binario_actual->logic_task, DAOS_PRIO_NORMAL);
             daos_task_create(binario_actual->render_task, DAOS_PRIO_NORMAL);
+            daos_task_create(daos_gfx_task, DAOS_PRIO_NORMAL);
 
             daos_task_create(button_update_task, DAOS_PRIO_CRITICAL);
             daos_task_create(system_monitor, DAOS_PRIO_LOW);
@@ -334,7 +194,7 @@ void show_boot_animation(void) {
 }
 
 // FUNCIÓN GENERAL PARA MOSTRAR BANNER PERSONALIZADO
-void show_game_banner(const char* game_name, uint16_t color, const uint32_t* banner_data) {
+void show_game_banner(const char* game_name, uint16_t color, const daos_sprite_t* banner) {
     daos_gfx_clear(DAOS_COLOR_BLACK);
 
     // Dibujar título del juego
@@ -342,21 +202,10 @@ void show_game_banner(const char* game_name, uint16_t color, const uint32_t* ban
     daos_gfx_fill_rect(60, 50, 200, 3, color);
 
     // Dibujar banner personalizado
-    uint16_t base_x = (320 - BANNER_WIDTH * 3) / 2;
+    uint16_t base_x = (320 - banner->w) / 2;
     uint16_t base_y = 80;
 
-    for (uint8_t y = 0; y < BANNER_HEIGHT; y++) {
-        for (uint8_t x = 0; x < BANNER_WIDTH; x++) {
-            uint32_t color_pixel = banner_data[y * BANNER_WIDTH + x];
-            if (color_pixel != 0x00000000) {
-                uint8_t r = (color_pixel >> 16) & 0xFF;
-                uint8_t g = (color_pixel >> 8) & 0xFF;
-                uint8_t b = color_pixel & 0xFF;
-                uint16_t rgb565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-                daos_gfx_fill_rect(base_x + x * 3, base_y + y * 3, 3, 3, rgb565);
-            }
-        }
-    }
+    daos_gfx_draw_sprite(base_x, base_y, banner);
 
     daos_gfx_draw_text_large(40, 180, "PRESS ANY KEY", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 2);
     daos_gfx_draw_text_large(70, 205, "TO START", DAOS_COLOR_YELLOW, DAOS_COLOR_BLACK, 2);
@@ -397,14 +246,12 @@ void shell_lcd_display_task(void) {
 
         if (blink_counter % 10 == 0) {
             cursor_visible = !cursor_visible;
-
-            if (cursor_visible) {
-                daos_gfx_draw_text_large(5, 210, "_", DAOS_COLOR_GREEN, DAOS_COLOR_BLACK, 1);
-            } else {
-                daos_gfx_draw_text_large(5, 210, " ", DAOS_COLOR_BLACK, DAOS_COLOR_BLACK, 1);
-            }
+            daos_console_cursor(cursor_visible);
         }
 
+        // Solo las celdas que cambiaron desde la última vez
+        daos_console_flush();
+
         daos_sleep_ms(50);
     }
 }
@@ -414,13 +261,22 @@ int main(void) {
     extern void button_init(void);
     extern void buttons_init(void);
     extern void fs_init(void);
+    extern void vfs_init(void);
     extern void ctx_init(void);
+    extern void spi_dma_init(void);
 
     uart_init();
     button_init();
     buttons_init();
     fs_init();
+    vfs_init();
     ctx_init();
+    spi_dma_init();   // Antes de la pantalla y la SD, que comparten SPI1
+
+    // Recuperar los archivos de RAMFS guardados en flash
+    if (daos_fs_mount_persistent() != 0) {
+        daos_uart_puts("[BOOT] RAMFS persistence unavailable\r\n");
+    }
 
     counter_mutex = (daos_mutex_t)mutex_storage;
     daos_mutex_init(counter_mutex);
@@ -441,6 +297,7 @@ int main(void) {
     while(1) {
         binario_actual = NULL;
         shell_mode_active = 0;
+        daos_console_echo(0);
 
         int selected_index = 0;
         int selected_option = 0;
@@ -596,7 +453,7 @@ int main(void) {
             daos_gfx_draw_text_large(60, 135, "TRON 4P...", DAOS_COLOR_CYAN, DAOS_COLOR_BLACK, 2);
 
             // BANNER PERSONALIZADO PARA TRON 4P
-            show_game_banner("TRON 4P", DAOS_COLOR_CYAN, banner_tron4p_data);
+            show_game_banner("TRON 4P", DAOS_COLOR_CYAN, &banner_tron4p);
             wait_for_game_start();
 
             binario_actual = daos_binario_crear(
@@ -615,7 +472,7 @@ int main(void) {
             daos_gfx_draw_text_large(70, 135, "TANQUE...", DAOS_COLOR_GREEN, DAOS_COLOR_BLACK, 2);
 
             // BANNER PERSONALIZADO PARA TANQUE
-            show_game_banner("TANQUE", DAOS_COLOR_GREEN, banner_tanque_data);
+            show_game_banner("TANQUE", DAOS_COLOR_GREEN, &banner_tanque);
             wait_for_game_start();
 
             binario_actual = daos_binario_crear(
@@ -634,7 +491,7 @@ int main(void) {
             daos_gfx_draw_text_large(60, 135, "TRON 2P...", 0xFC18, DAOS_COLOR_BLACK, 2);
 
             // BANNER PERSONALIZADO PARA TRON 2P
-            show_game_banner("TRON 2P", 0xFC18, banner_tron2p_data);
+            show_game_banner("TRON 2P", 0xFC18, &banner_tron2p);
             wait_for_game_start();
 
             binario_actual = daos_binario_crear(
@@ -653,7 +510,7 @@ int main(void) {
             daos_gfx_draw_text_large(40, 135, "RECONOCEDOR...", DAOS_COLOR_BLUE, DAOS_COLOR_BLACK, 2);
 
             // BANNER PERSONALIZADO PARA RECONOCEDOR
-            show_game_banner("RECONOCEDOR", DAOS_COLOR_BLUE, banner_reconocedor_data);
+            show_game_banner("RECONOCEDOR", DAOS_COLOR_BLUE, &banner_reconocedor);
             wait_for_game_start();
 
             binario_actual = daos_binario_crear(
@@ -672,7 +529,7 @@ int main(void) {
             daos_gfx_draw_text_large(70, 135, "SNAKE...", DAOS_COLOR_YELLOW, DAOS_COLOR_BLACK, 2);
 
             // BANNER PERSONALIZADO PARA SNAKE
-            show_game_banner("SNAKE", DAOS_COLOR_YELLOW, banner_snake_data);
+            show_game_banner("SNAKE", DAOS_COLOR_YELLOW, &banner_snake);
             wait_for_game_start();
 
             binario_actual = snake_get_binario();
@@ -681,7 +538,7 @@ int main(void) {
             daos_gfx_draw_text_large(70, 135, "DISCO...", DAOS_COLOR_MAGENTA, DAOS_COLOR_BLACK, 2);
 
             // BANNER PERSONALIZADO PARA DISCO
-            show_game_banner("DISCO", DAOS_COLOR_MAGENTA, banner_disco_data);
+            show_game_banner("DISCO", DAOS_COLOR_MAGENTA, &banner_disco);
             wait_for_game_start();
 
             binario_actual = daos_binario_crear(
@@ -764,20 +621,20 @@ int main(void) {
             daos_gfx_clear(DAOS_COLOR_BLACK);
             daos_gfx_draw_text_large(5, 5, "DELLA OS SHELL", 0xF81F, DAOS_COLOR_BLACK, 2);
             daos_gfx_fill_rect(5, 25, 310, 2, 0xF81F);
-            daos_gfx_draw_text_large(5, 35, "Status: ACTIVE", DAOS_COLOR_GREEN, DAOS_COLOR_BLACK, 1);
-            daos_gfx_draw_text_large(5, 50, "Interface: UART/PuTTY", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 1);
-            daos_gfx_fill_rect(5, 70, 310, 2, DAOS_COLOR_GRAY);
-            daos_gfx_draw_text_large(5, 80, "Use your terminal to", DAOS_COLOR_YELLOW, DAOS_COLOR_BLACK, 1);
-            daos_gfx_draw_text_large(5, 95, "interact with DaOS", DAOS_COLOR_YELLOW, DAOS_COLOR_BLACK, 1);
-            daos_gfx_draw_text_large(5, 120, "Commands:", DAOS_COLOR_CYAN, DAOS_COLOR_BLACK, 1);
-            daos_gfx_draw_text_large(5, 135, "help, library, invoke", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 1);
-            daos_gfx_draw_text_large(5, 150, "touch, edit, append", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 1);
-            daos_gfx_draw_text_large(5, 165, "remove, rename, hexdump", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 1);
-            daos_gfx_fill_rect(5, 200, 310, 2, DAOS_COLOR_GRAY);
-            daos_gfx_draw_text_large(5, 210, "Type 'exit' to quit", DAOS_COLOR_CYAN, DAOS_COLOR_BLACK, 1);
+
+            // Debajo de la cabecera, lo que el shell manda por la UART
+            daos_console_init(32, 20);
+            daos_console_color(DAOS_COLOR_CYAN, DAOS_COLOR_BLACK);
+            daos_console_puts("Interface: UART/PuTTY - type 'exit' to quit\n");
+            daos_console_color(DAOS_COLOR_GREEN, DAOS_COLOR_BLACK);
+            daos_console_echo(1);
 
             daos_task_create(button_update_task, DAOS_PRIO_CRITICAL);
             daos_task_create(system_monitor, DAOS_PRIO_LOW);
+            daos_task_create(daos_fs_compact_task, DAOS_PRIO_LOW);
+            daos_task_create(daos_sd_mount_task, DAOS_PRIO_LOW);
+            daos_task_create(daos_aio_task, DAOS_PRIO_LOW);
+            daos_task_create(daos_gfx_task, DAOS_PRIO_NORMAL);
             daos_task_create(shell_lcd_display_task, DAOS_PRIO_LOW);
             daos_task_create(shell_task, DAOS_PRIO_NORMAL);
 
@@ -799,6 +656,8 @@ int main(void) {
             daos_uart_puts("[CONTROLS] D14:Menu  D15:Reset\r\n\r\n");
 
             daos_task_create(button_update_task, DAOS_PRIO_CRITICAL);
+            daos_task_create(daos_aio_task, DAOS_PRIO_LOW);
+            daos_task_create(daos_gfx_task, DAOS_PRIO_NORMAL);
 
             if (selected_option != 7 && selected_option != 9 && selected_option != 10) {
                 daos_task_create(system_monitor, DAOS_PRIO_LOW);
@@ -808,6 +667,9 @@ int main(void) {
             sched_start();
         }
 
+        // Lo que quedó encolado, y el menú se dibuja directamente
+        daos_gfx_sync();
+
         daos_uart_puts("\r\n[SYSTEM] Returned to menu\r\n\r\n");
         for (volatile int i = 0; i < 1000000; i++);
     }
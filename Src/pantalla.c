@@ -1,9 +1,13 @@
 #include "pantalla.h"
+#include "spi_dma.h"
+#include "raster.h"
+#include "vsync.h"
+#include "glyph.h"
 
+#ifndef DAOS_HOST
 #define RCC_BASE      0x40023800
 #define GPIOA_BASE    0x40020000
 #define GPIOB_BASE    0x40020400
-#define SPI1_BASE     0x40013000
 
 #define RCC_AHB1ENR   ((volatile uint32_t*)(RCC_BASE + 0x30))
 #define RCC_APB2ENR   ((volatile uint32_t*)(RCC_BASE + 0x44))
@@ -16,10 +20,18 @@
 #define GPIOB_MODER   ((volatile uint32_t*)(GPIOB_BASE + 0x00))
 #define GPIOB_BSRR    ((volatile uint32_t*)(GPIOB_BASE + 0x18))
 
-#define SPI1_CR1      ((volatile uint32_t*)(SPI1_BASE + 0x00))
-#define SPI1_CR2      ((volatile uint32_t*)(SPI1_BASE + 0x04))
-#define SPI1_SR       ((volatile uint32_t*)(SPI1_BASE + 0x08))
-#define SPI1_DR       ((volatile uint32_t*)(SPI1_BASE + 0x0C))
+#ifdef PANTALLA_TE_PIN
+#if PANTALLA_TE_PIN < 5 || PANTALLA_TE_PIN > 9
+#error "PANTALLA_TE_PIN debe ser PA5 a PA9 (EXTI9_5)"
+#endif
+#define SYSCFG_EXTICR ((volatile uint32_t*)(0x40013800 + 0x08))
+#define EXTI_IMR      ((volatile uint32_t*)(0x40013C00 + 0x00))
+#define EXTI_RTSR     ((volatile uint32_t*)(0x40013C00 + 0x08))
+#define EXTI_PR       ((volatile uint32_t*)(0x40013C00 + 0x14))
+#define NVIC_ISER0    ((volatile uint32_t*)0xE000E100)
+#define EXTI9_5_IRQN  23
+#endif
+
 
 #define CS_LOW()    *GPIOB_BSRR = (1<<22)
 #define CS_HIGH()   *GPIOB_BSRR = (1<<6)
@@ -27,83 +39,191 @@
 #define DC_HIGH()   *GPIOA_BSRR = (1<<0)
 #define RST_LOW()   *GPIOA_BSRR = (1<<17)
 #define RST_HIGH()  *GPIOA_BSRR = (1<<1)
-
-static const uint8_t font5x8[][5] = {
-    {0x00, 0x00, 0x00, 0x00, 0x00},
-    {0x3E, 0x51, 0x49, 0x45, 0x3E},
-    {0x00, 0x42, 0x7F, 0x40, 0x00},
-    {0x42, 0x61, 0x51, 0x49, 0x46},
-    {0x21, 0x41, 0x45, 0x4B, 0x31},
-    {0x18, 0x14, 0x12, 0x7F, 0x10},
-    {0x27, 0x45, 0x45, 0x45, 0x39},
-    {0x3C, 0x4A, 0x49, 0x49, 0x30},
-    {0x01, 0x71, 0x09, 0x05, 0x03},
-    {0x36, 0x49, 0x49, 0x49, 0x36},
-    {0x06, 0x49, 0x49, 0x29, 0x1E},
-    {0x00, 0x36, 0x36, 0x00, 0x00},
-    {0x7E, 0x11, 0x11, 0x11, 0x7E},
-    {0x7F, 0x49, 0x49, 0x49, 0x36},
-    {0x3E, 0x41, 0x41, 0x41, 0x22},
-    {0x7F, 0x41, 0x41, 0x22, 0x1C},
-    {0x7F, 0x49, 0x49, 0x49, 0x41},
-    {0x7F, 0x09, 0x09, 0x09, 0x01},
-    {0x3E, 0x41, 0x49, 0x49, 0x7A},
-    {0x7F, 0x08, 0x08, 0x08, 0x7F},
-    {0x00, 0x41, 0x7F, 0x41, 0x00},
-    {0x20, 0x40, 0x41, 0x3F, 0x01},
-    {0x7F, 0x08, 0x14, 0x22, 0x41},
-    {0x7F, 0x40, 0x40, 0x40, 0x40},
-    {0x7F, 0x02, 0x0C, 0x02, 0x7F},
-    {0x7F, 0x04, 0x08, 0x10, 0x7F},
-    {0x3E, 0x41, 0x41, 0x41, 0x3E},
-    {0x7F, 0x09, 0x09, 0x09, 0x06},
-    {0x3E, 0x41, 0x51, 0x21, 0x5E},
-    {0x7F, 0x09, 0x19, 0x29, 0x46},
-    {0x46, 0x49, 0x49, 0x49, 0x31},
-    {0x01, 0x01, 0x7F, 0x01, 0x01},
-    {0x3F, 0x40, 0x40, 0x40, 0x3F},
-    {0x1F, 0x20, 0x40, 0x20, 0x1F},
-    {0x3F, 0x40, 0x38, 0x40, 0x3F},
-    {0x63, 0x14, 0x08, 0x14, 0x63},
-    {0x07, 0x08, 0x70, 0x08, 0x07},
-    {0x61, 0x51, 0x49, 0x45, 0x43},
-};
+#else
+// En el host las líneas van al panel emulado (lcd_host.c), que también
+// recibe los bytes de SPI1
+#include "lcd_host.h"
+#undef PANTALLA_TE_PIN
+
+#define CS_LOW()    lcd_host_select(1)
+#define CS_HIGH()   lcd_host_select(0)
+#define DC_LOW()    lcd_host_dc(0)
+#define DC_HIGH()   lcd_host_dc(1)
+#define RST_LOW()   lcd_host_reset(1)
+#define RST_HIGH()  lcd_host_reset(0)
+#endif
 
 static void delay_ms(uint32_t ms) {
     for(volatile uint32_t i = 0; i < ms * 8000; i++);
 }
 
+// Bytes sueltos (comandos, ventana) por sondeo
 static void spi_write(uint8_t data) {
-    while(!(*SPI1_SR & (1<<1)));
-    *SPI1_DR = data;
-    while(!(*SPI1_SR & (1<<0)));
-    (void)*SPI1_DR;
+    (void)spi_dma_exchange(data);
+}
+
+static void lcd_select(uint8_t active) {
+    if(active) {
+        CS_LOW();
+    } else {
+        CS_HIGH();
+    }
 }
 
+// La pantalla usa el reloj más rápido de SPI1: PCLK2 / 2
+static const spi_bus_device_t lcd_device = {
+    .name = "lcd",
+    .prescaler = 0,
+    .mode = SPI_MODE0,
+    .select = lcd_select,
+};
+static int lcd_bus = -1;
+
+// spi_bus_add identifica cada dispositivo por su CS: con lcd_select, la
+// lectura reemplazaría a lcd_device y toda la pantalla iría a PCLK2 / 4
+static void lcd_read_select(uint8_t active) {
+    lcd_select(active);
+}
+
+// Las lecturas del panel no pasan de 6.6 MHz: PCLK2 / 4
+static const spi_bus_device_t lcd_read_device = {
+    .name = "lcd-rd",
+    .prescaler = 1,
+    .mode = SPI_MODE0,
+    .select = lcd_read_select,
+};
+static int lcd_read_bus = -1;
+
+// Relleno en curso por DMA (el color debe seguir vivo hasta terminar)
+static spi_dma_xfer_t pixel_xfer;
+static uint16_t fill_color;
+
+// Glifo expandido a píxeles (con la escala aplicada) antes de enviarlo en
+// una ráfaga. Caben dos filas de pantalla: los glifos más grandes salen en
+// bandas de filas, y pantalla_draw_text_cells compone una fila mientras la
+// otra sale por DMA
+#define GLYPH_BUF_PIXELS (2 * SCREEN_WIDTH)
+static uint16_t glyph_buf[GLYPH_BUF_PIXELS];
+static spi_dma_xfer_t glyph_xfer;
+static spi_dma_xfer_t line_xfer[2];
+
+// Filas de un bitmap en cola a la vez (cada una necesita su descriptor)
+#define BLIT_XFERS 4
+static spi_dma_xfer_t blit_xfer[BLIT_XFERS];
+
+// Tanda abierta (pantalla_batch_begin): las primitivas no abren ni cierran
+// su propia transacción
+static uint8_t lcd_batch = 0;
+
+static void lcd_begin(void) {
+    if(!lcd_batch) spi_bus_begin(lcd_bus);
+}
+
+static void lcd_end(void) {
+    if(!lcd_batch) spi_bus_end(lcd_bus);
+}
+
+// Dentro de una transacción (spi_bus_begin): el CS ya está bajo. Los
+// píxeles encolados por DMA deben salir antes de bajar el DC, o el panel
+// los leería como comandos
 static void lcd_cmd(uint8_t cmd) {
+    spi_dma_flush();
     DC_LOW();
-    CS_LOW();
     spi_write(cmd);
-    CS_HIGH();
 }
 
 static void lcd_data(uint8_t data) {
     DC_HIGH();
-    CS_LOW();
     spi_write(data);
-    CS_HIGH();
 }
 
-static int get_font_index(char c) {
-    if(c >= '0' && c <= '9') return c - '0' + 1;
-    if(c >= 'A' && c <= 'Z') return c - 'A' + 12;
-    if(c >= 'a' && c <= 'z') return c - 'a' + 12;
-    if(c == ' ') return 0;
-    if(c == ':') return 11;
-    return -1;
+static void lcd_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    lcd_cmd(0x2A);
+    lcd_data(x0 >> 8);
+    lcd_data(x0 & 0xFF);
+    lcd_data(x1 >> 8);
+    lcd_data(x1 & 0xFF);
+
+    lcd_cmd(0x2B);
+    lcd_data(y0 >> 8);
+    lcd_data(y0 & 0xFF);
+    lcd_data(y1 >> 8);
+    lcd_data(y1 & 0xFF);
+
+    lcd_cmd(0x2C);
+    DC_HIGH();  // Lo que sigue son píxeles
+}
+
+/**
+ * Dibujar un glifo 5x8 escalado: una ventana y los píxeles seguidos, en vez
+ * de una ventana por píxel. Lo que queda fuera de la pantalla se recorta.
+ * Si el glifo está en la caché (glyph.h) sale de ella en una sola ráfaga.
+ */
+static void lcd_glyph(uint16_t x, uint16_t y, char ch, uint16_t color, uint16_t bg, uint8_t scale) {
+    const uint8_t* glyph = glyph_bits(ch);
+    const uint16_t* cached;
+    uint16_t w = GLYPH_WIDTH * scale;
+    uint16_t h = GLYPH_HEIGHT * scale;
+
+    if(!glyph || scale == 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
+    if(x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+    if(y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+
+    // El glifo anterior puede seguir saliendo de la caché
+    spi_dma_wait(&glyph_xfer);
+    cached = glyph_pixels(ch, color, bg, scale);
+
+    lcd_begin();
+    lcd_window(x, y, x + w - 1, y + h - 1);
+
+    // Sin recorte a la derecha las filas van seguidas en la caché
+    if(cached && w == GLYPH_WIDTH * scale) {
+        glyph_xfer.tx = cached;
+        glyph_xfer.count = (uint32_t)w * h;
+        glyph_xfer.flags = SPI_DMA_16BIT;
+        spi_dma_submit(&glyph_xfer);
+        lcd_end();
+        return;
+    }
+
+    uint16_t band = GLYPH_BUF_PIXELS / w;  // Filas por ráfaga
+
+    // Las filas de texto de pantalla_draw_text_cells usan el mismo buffer
+    spi_dma_wait(&line_xfer[0]);
+    spi_dma_wait(&line_xfer[1]);
+
+    for(uint16_t r0 = 0; r0 < h; r0 += band) {
+        uint16_t rows = (h - r0 < band) ? (h - r0) : band;
+        uint16_t* p = glyph_buf;
+
+        // La banda anterior puede seguir saliendo del buffer
+        spi_dma_wait(&glyph_xfer);
+
+        for(uint16_t r = r0; r < r0 + rows; r++) {
+            uint8_t mask = 1 << (r / scale);
+            for(uint16_t c = 0; c < w; c++) {
+                *p++ = (glyph[c / scale] & mask) ? color : bg;
+            }
+        }
+
+        glyph_xfer.tx = glyph_buf;
+        glyph_xfer.count = (uint32_t)rows * w;
+        glyph_xfer.flags = SPI_DMA_16BIT;
+        spi_dma_submit(&glyph_xfer);
+    }
+    lcd_end();
+}
+
+const uint8_t* pantalla_get_glyph(char c) {
+    return glyph_bits(c);
+}
+
+void pantalla_glyph_wait(void) {
+    spi_dma_wait(&glyph_xfer);
 }
 
 void pantalla_init(void) {
+#ifndef DAOS_HOST
     *RCC_AHB1ENR |= (1<<0) | (1<<1);
     *RCC_APB2ENR |= (1<<12);
 
@@ -117,15 +237,14 @@ void pantalla_init(void) {
 
     *GPIOB_MODER &= ~(3<<12);
     *GPIOB_MODER |= (1<<12);
+#endif
 
     CS_HIGH();
     DC_HIGH();
     RST_HIGH();
 
-    *SPI1_CR1 = 0;
-    *SPI1_CR1 = (1<<2) | (1<<8) | (1<<9) | (1<<3);
-    *SPI1_CR2 = 0;
-    *SPI1_CR1 |= (1<<6);
+    lcd_bus = spi_bus_add(&lcd_device);
+    lcd_read_bus = spi_bus_add(&lcd_read_device);
 
     delay_ms(100);
 
@@ -134,6 +253,8 @@ void pantalla_init(void) {
     RST_HIGH();
     delay_ms(150);
 
+    spi_bus_begin(lcd_bus);
+
     lcd_cmd(0x01);
     delay_ms(150);
 
@@ -146,24 +267,67 @@ void pantalla_init(void) {
     lcd_cmd(0x3A);
     lcd_data(0x55);
 
+#ifdef PANTALLA_TE_PIN
+    lcd_cmd(0x35);          // TE solo en el blanking vertical
+    lcd_data(0x00);
+#endif
+
     lcd_cmd(0x29);
     delay_ms(150);
+
+    spi_bus_end(lcd_bus);
+
+#ifdef PANTALLA_TE_PIN
+    // TE como entrada con interrupción en el flanco de subida
+    *RCC_APB2ENR |= (1<<14);
+    *GPIOA_MODER &= ~(3 << (PANTALLA_TE_PIN * 2));
+    SYSCFG_EXTICR[PANTALLA_TE_PIN / 4] &= ~(0xF << ((PANTALLA_TE_PIN % 4) * 4));
+    *EXTI_RTSR |= (1 << PANTALLA_TE_PIN);
+    *EXTI_IMR |= (1 << PANTALLA_TE_PIN);
+    *NVIC_ISER0 = (1 << EXTI9_5_IRQN);
+#endif
 }
 
-void pantalla_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
-    lcd_cmd(0x2A);
-    lcd_data(x0 >> 8);
-    lcd_data(x0 & 0xFF);
-    lcd_data(x1 >> 8);
-    lcd_data(x1 & 0xFF);
+#ifdef PANTALLA_TE_PIN
+void EXTI9_5_IRQHandler(void) {
+    if(*EXTI_PR & (1 << PANTALLA_TE_PIN)) {
+        *EXTI_PR = (1 << PANTALLA_TE_PIN);
+        vsync_te_edge(vsync_clock());
+    }
+}
+#endif
 
-    lcd_cmd(0x2B);
-    lcd_data(y0 >> 8);
-    lcd_data(y0 & 0xFF);
-    lcd_data(y1 >> 8);
-    lcd_data(y1 & 0xFF);
+int pantalla_get_scanline(void) {
+    uint8_t hi, lo;
 
-    lcd_cmd(0x2C);
+    if(lcd_read_bus < 0) return -1;
+
+    spi_bus_begin(lcd_read_bus);
+    lcd_cmd(0x45);
+    DC_HIGH();
+    (void)spi_dma_exchange(0xFF);   // Parámetro de relleno
+    hi = spi_dma_exchange(0xFF);
+    lo = spi_dma_exchange(0xFF);
+    spi_bus_end(lcd_read_bus);
+
+    if(hi > 0x03) return -1;
+    if(((hi << 8) | lo) >= VSYNC_LINES) return -1;
+    return (hi << 8) | lo;
+}
+
+void pantalla_batch_begin(void) {
+    if(lcd_batch++ == 0) spi_bus_begin(lcd_bus);
+}
+
+void pantalla_batch_end(void) {
+    if(lcd_batch == 0) return;
+    if(--lcd_batch == 0) spi_bus_end(lcd_bus);
+}
+
+void pantalla_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    lcd_begin();
+    lcd_window(x0, y0, x1, y1);
+    lcd_end();
 }
 
 void pantalla_clear(uint16_t color) {
@@ -173,12 +337,24 @@ void pantalla_clear(uint16_t color) {
 void pantalla_draw_pixel(uint16_t x, uint16_t y, uint16_t color) {
     if(x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
 
-    pantalla_set_window(x, y, x, y);
-    DC_HIGH();
-    CS_LOW();
+    lcd_begin();
+    lcd_window(x, y, x, y);
     spi_write(color >> 8);
     spi_write(color & 0xFF);
-    CS_HIGH();
+    lcd_end();
+}
+
+// Un rectángulo ya recortado, dentro de una transacción abierta. El DMA
+// repite el color en tramas de 16 bits y la función retorna ya: la próxima
+// ventana espera (por sondeo) a que termine
+static void lcd_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    lcd_window(x, y, x + w - 1, y + h - 1);
+
+    fill_color = color;
+    pixel_xfer.tx = &fill_color;
+    pixel_xfer.count = (uint32_t)w * h;
+    pixel_xfer.flags = SPI_DMA_16BIT | SPI_DMA_REPEAT;
+    spi_dma_submit(&pixel_xfer);
 }
 
 void pantalla_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
@@ -186,103 +362,302 @@ void pantalla_fill_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t
     if(x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
     if(y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
 
-    pantalla_set_window(x, y, x + w - 1, y + h - 1);
-
-    DC_HIGH();
-    CS_LOW();
-    for(uint32_t i = 0; i < (w * h); i++) {
-        spi_write(color >> 8);
-        spi_write(color & 0xFF);
-    }
-    CS_HIGH();
+    // El CS lo suelta la interrupción cuando termina el relleno
+    lcd_begin();
+    lcd_rect(x, y, w, h, color);
+    lcd_end();
 }
 
+// Las figuras salen como tramos (ver raster.h), todas en una transacción.
+// Las coordenadas sin signo de los círculos se leen con signo: un centro
+// "negativo" da la vuelta igual que al sumar en 16 bits
+
 void pantalla_draw_circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t color) {
-    int16_t x = radius;
-    int16_t y = 0;
-    int16_t err = 0;
-
-    while(x >= y) {
-        pantalla_draw_pixel(x0 + x, y0 + y, color);
-        pantalla_draw_pixel(x0 + y, y0 + x, color);
-        pantalla_draw_pixel(x0 - y, y0 + x, color);
-        pantalla_draw_pixel(x0 - x, y0 + y, color);
-        pantalla_draw_pixel(x0 - x, y0 - y, color);
-        pantalla_draw_pixel(x0 - y, y0 - x, color);
-        pantalla_draw_pixel(x0 + y, y0 - x, color);
-        pantalla_draw_pixel(x0 + x, y0 - y, color);
-
-        if(err <= 0) {
-            y += 1;
-            err += 2*y + 1;
-        }
-        if(err > 0) {
-            x -= 1;
-            err -= 2*x + 1;
-        }
-    }
+    lcd_begin();
+    raster_circle((int16_t)x0, (int16_t)y0, (int16_t)radius, color, 0, lcd_rect);
+    lcd_end();
 }
 
 void pantalla_draw_circle_filled(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t color) {
-    for(int16_t y = -radius; y <= radius; y++) {
-        for(int16_t x = -radius; x <= radius; x++) {
-            if(x*x + y*y <= radius*radius) {
-                pantalla_draw_pixel(x0 + x, y0 + y, color);
-            }
-        }
-    }
+    lcd_begin();
+    raster_circle((int16_t)x0, (int16_t)y0, (int16_t)radius, color, 1, lcd_rect);
+    lcd_end();
+}
+
+void pantalla_draw_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    lcd_begin();
+    raster_round_rect(x, y, w, h, r, color, 0, lcd_rect);
+    lcd_end();
+}
+
+void pantalla_fill_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    lcd_begin();
+    raster_round_rect(x, y, w, h, r, color, 1, lcd_rect);
+    lcd_end();
+}
+
+void pantalla_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    lcd_begin();
+    raster_line(x0, y0, x1, y1, color, lcd_rect);
+    lcd_end();
+}
+
+void pantalla_draw_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    lcd_begin();
+    raster_triangle(x0, y0, x1, y1, x2, y2, color, 0, lcd_rect);
+    lcd_end();
+}
+
+void pantalla_fill_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    lcd_begin();
+    raster_triangle(x0, y0, x1, y1, x2, y2, color, 1, lcd_rect);
+    lcd_end();
 }
 
 void pantalla_draw_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg) {
-    int idx = get_font_index(c);
-    if(idx < 0) return;
-
-    for(int col = 0; col < 5; col++) {
-        uint8_t line = font5x8[idx][col];
-        for(int row = 0; row < 8; row++) {
-            if(line & (1 << row)) {
-                pantalla_draw_pixel(x + col, y + row, color);
-            } else {
-                pantalla_draw_pixel(x + col, y + row, bg);
-            }
-        }
-    }
+    lcd_glyph(x, y, c, color, bg, 1);
 }
 
 void pantalla_draw_string(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg) {
     uint16_t pos_x = x;
+
+    // Todo el texto en una transacción
+    pantalla_batch_begin();
     while(*str) {
         pantalla_draw_char(pos_x, y, *str, color, bg);
-        pos_x += 6;
+        pos_x += GLYPH_ADVANCE;
         str++;
     }
+    pantalla_batch_end();
 }
 
 void pantalla_draw_string_large(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg, uint8_t scale) {
     uint16_t pos_x = x;
 
+    pantalla_batch_begin();
     while(*str) {
-        int idx = get_font_index(*str);
+        if(*str != ' ') lcd_glyph(pos_x, y, *str, color, bg, scale);
+
+        pos_x += GLYPH_ADVANCE * scale;
+        str++;
+    }
+    pantalla_batch_end();
+}
+
+// Recorta el rectángulo a la pantalla. @return 0 si queda fuera del todo
+static uint8_t clip_rect(uint16_t x, uint16_t y, uint16_t* w, uint16_t* h) {
+    if(*w == 0 || *h == 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return 0;
+    if(x + *w > SCREEN_WIDTH) *w = SCREEN_WIDTH - x;
+    if(y + *h > SCREEN_HEIGHT) *h = SCREEN_HEIGHT - y;
+    return 1;
+}
+
+void pantalla_draw_text_cells(uint16_t x, uint16_t y, const char* str, uint16_t n, uint16_t h, uint16_t color, uint16_t bg) {
+    uint16_t w;
+
+    if(!str) return;
+    if(n > SCREEN_WIDTH / GLYPH_ADVANCE + 1) n = SCREEN_WIDTH / GLYPH_ADVANCE + 1;
+    w = n * GLYPH_ADVANCE;
+    if(!clip_rect(x, y, &w, &h)) return;
+
+    // La banda de un glifo puede seguir saliendo de glyph_buf
+    spi_dma_wait(&glyph_xfer);
+
+    lcd_begin();
+    lcd_window(x, y, x + w - 1, y + h - 1);
+
+    for(uint16_t r = 0; r < h; r++) {
+        spi_dma_xfer_t* xfer = &line_xfer[r & 1];
+        uint16_t* p = &glyph_buf[(r & 1) * SCREEN_WIDTH];
+        uint16_t left = w;
+
+        // Esta mitad del buffer es la de hace dos filas
+        spi_dma_wait(xfer);
+
+        for(uint16_t i = 0; left > 0; i++) {
+            const uint8_t* glyph = glyph_bits(str[i]);
+            uint8_t lit = glyph && r < GLYPH_HEIGHT;
+            uint16_t cols = (left < GLYPH_ADVANCE) ? left : GLYPH_ADVANCE;
+
+            // La columna de separación y las filas bajo el glifo son fondo
+            for(uint16_t c = 0; c < cols; c++) {
+                *p++ = (lit && c < GLYPH_WIDTH && (glyph[c] >> r) & 1) ? color : bg;
+            }
+            left -= cols;
+        }
+
+        xfer->tx = &glyph_buf[(r & 1) * SCREEN_WIDTH];
+        xfer->count = w;
+        xfer->flags = SPI_DMA_16BIT;
+        spi_dma_submit(xfer);
+    }
+    lcd_end();
+}
+
+// Encola un tramo de píxeles de src en el descriptor indicado
+static void blit_submit_flags(uint8_t slot, const uint16_t* src, uint32_t count, uint8_t flags) {
+    spi_dma_xfer_t* xfer = &blit_xfer[slot];
 
-        if(idx < 0 || *str == ' ') {
-            pos_x += 6 * scale;
-            str++;
+    spi_dma_wait(xfer);
+    xfer->tx = src;
+    xfer->count = count;
+    xfer->flags = SPI_DMA_16BIT | flags;
+    spi_dma_submit(xfer);
+}
+
+static void blit_submit(uint8_t slot, const uint16_t* src, uint32_t count) {
+    blit_submit_flags(slot, src, count, 0);
+}
+
+// El bitmap es del llamador: no se retorna hasta que salió por el bus
+static void blit_wait(void) {
+    for(uint8_t i = 0; i < BLIT_XFERS; i++) {
+        spi_dma_wait(&blit_xfer[i]);
+    }
+}
+
+void pantalla_draw_bitmap(uint16_t x, uint16_t y, const uint16_t* src, uint16_t w, uint16_t h, uint16_t stride) {
+    if(!src || !clip_rect(x, y, &w, &h)) return;
+
+    lcd_begin();
+    lcd_window(x, y, x + w - 1, y + h - 1);
+
+    if(stride == w) {
+        // Filas contiguas en memoria: una sola ráfaga
+        blit_submit(0, src, (uint32_t)w * h);
+    } else {
+        for(uint16_t row = 0; row < h; row++) {
+            blit_submit(row % BLIT_XFERS, src + (uint32_t)row * stride, w);
+        }
+    }
+
+    blit_wait();
+    lcd_end();
+}
+
+static uint8_t row_opaque(const uint16_t* line, uint16_t w, uint16_t key) {
+    for(uint16_t col = 0; col < w; col++) {
+        if(line[col] == key) return 0;
+    }
+    return 1;
+}
+
+void pantalla_draw_bitmap_key(uint16_t x, uint16_t y, const uint16_t* src, uint16_t w, uint16_t h, uint16_t stride, uint16_t key) {
+    if(!src || !clip_rect(x, y, &w, &h)) return;
+
+    lcd_begin();
+
+    // Cada tramo opaco de una fila lleva su propia ventana; los bytes de
+    // la ventana esperan (por sondeo) a que salga el tramo anterior. Las
+    // filas enteras opacas seguidas comparten una ventana
+    for(uint16_t row = 0; row < h; row++) {
+        const uint16_t* line = src + (uint32_t)row * stride;
+        uint16_t col = 0;
+        uint16_t full = 0;
+
+        while(row + full < h && row_opaque(line + (uint32_t)full * stride, w, key)) full++;
+        if(full > 0) {
+            lcd_window(x, y + row, x + w - 1, y + row + full - 1);
+            for(uint16_t i = 0; i < full; i++) {
+                blit_submit(i % BLIT_XFERS, line + (uint32_t)i * stride, w);
+            }
+            row += full - 1;
             continue;
         }
 
-        for(int col = 0; col < 5; col++) {
-            uint8_t line = font5x8[idx][col];
-            for(int row = 0; row < 8; row++) {
-                uint16_t pixel_color = (line & (1 << row)) ? color : bg;
-                for(uint8_t sx = 0; sx < scale; sx++) {
-                    for(uint8_t sy = 0; sy < scale; sy++) {
-                        pantalla_draw_pixel(pos_x + col*scale + sx, y + row*scale + sy, pixel_color);
-                    }
+        while(col < w) {
+            while(col < w && line[col] == key) col++;
+            uint16_t start = col;
+            while(col < w && line[col] != key) col++;
+
+            if(col > start) {
+                lcd_window(x + start, y + row, x + col - 1, y + row);
+                blit_submit(0, line + start, col - start);
+            }
+        }
+    }
+
+    blit_wait();
+    lcd_end();
+}
+
+// Formato de las filas de un sprite (daos_sprite_t en api.h)
+#define SPRITE_ROW_REPEAT 0x8000
+#define SPRITE_LITERAL    0x8000
+
+// Palabras que ocupa una corrida
+static uint16_t run_words(const uint16_t* run) {
+    return (run[1] & SPRITE_LITERAL) ? 2 + (run[1] & ~SPRITE_LITERAL) : 3;
+}
+
+// Dibuja las corridas de una fila; cada tramo opaco lleva su ventana
+static void lcd_sprite_row(int16_t x, uint16_t y, const uint16_t* run, uint16_t n) {
+    static uint8_t slot = 0;
+    int16_t cx = x;
+
+    while(n > 0) {
+        // El tramo sigue mientras las corridas no tengan salto
+        const uint16_t* first = run;
+        uint16_t count = 0;
+        int16_t start = cx + run[0];
+        int16_t end = start;
+
+        do {
+            end += run[1] & ~SPRITE_LITERAL;
+            run += run_words(run);
+            count++;
+        } while(count < n && run[0] == 0);
+        n -= count;
+        cx = end;
+
+        int16_t x0 = (start < 0) ? 0 : start;
+        int16_t x1 = (end > SCREEN_WIDTH) ? SCREEN_WIDTH : end;
+        if(x0 >= x1) continue;
+
+        lcd_window(x0, y, x1 - 1, y);
+
+        int16_t px = start;
+        for(const uint16_t* r = first; count > 0; count--, r += run_words(r)) {
+            uint16_t len = r[1] & ~SPRITE_LITERAL;
+            int16_t a = (px < x0) ? x0 : px;
+            int16_t b = (px + len > x1) ? x1 : px + len;
+
+            if(a < b) {
+                if(r[1] & SPRITE_LITERAL) {
+                    blit_submit_flags(slot, &r[2 + (a - px)], b - a, 0);
+                } else {
+                    blit_submit_flags(slot, &r[2], b - a, SPI_DMA_REPEAT);
                 }
+                slot = (slot + 1) % BLIT_XFERS;
             }
+            px += len;
         }
+    }
+}
 
-        pos_x += 6 * scale;
-        str++;
+void pantalla_draw_sprite(int16_t x, int16_t y, const uint16_t* data, uint16_t h) {
+    const uint16_t* prev = data;
+    uint16_t prev_n = 0;
+
+    if(!data) return;
+
+    lcd_begin();
+
+    for(uint16_t row = 0; row < h; row++) {
+        int16_t py = y + row;
+
+        if(*data == SPRITE_ROW_REPEAT) {
+            data++;
+        } else {
+            prev_n = *data++;
+            prev = data;
+            for(uint16_t i = 0; i < prev_n; i++) data += run_words(data);
+        }
+
+        if(py >= SCREEN_HEIGHT) break;
+        if(py >= 0 && prev_n > 0) lcd_sprite_row(x, py, prev, prev_n);
     }
+
+    blit_wait();
+    lcd_end();
 }
@@ -6,6 +6,8 @@
 
 #include "ramfs.h"
 #include "uart.h"
+#include "sched.h"
+#include "lz.h"
 #include <string.h>
 
 /* ========================================================================== */
@@ -24,6 +26,33 @@ static uint8_t block_bitmap[RAMFS_MAX_BLOCKS];
 // Tabla de file descriptors
 static ramfs_fd_t fd_table[RAMFS_MAX_OPEN];
 
+// Journal activo (NULL si el contenido solo vive en RAM)
+static const ramfs_journal_t* journal = NULL;
+
+// Último trozo descomprimido (también sirve de buffer al comprimir)
+static uint8_t zbuf[RAMFS_BLOCK_SIZE];
+static int zbuf_inode = -1;
+static uint32_t zbuf_chunk = 0;
+static uint32_t zbuf_len = 0;
+
+// Caché de componentes de ruta: (padre, nombre) -> inodo. Cada entrada se
+// valida contra el inodo al usarla, así que no hace falta invalidarla.
+static int8_t dcache[RAMFS_DCACHE_SIZE];
+static uint32_t dcache_hits = 0;
+static uint32_t dcache_misses = 0;
+
+// Resultados de la resolución de rutas
+#define ROOT_DIR  (-1)
+#define NOT_FOUND (-2)
+
+// Marca de descriptor de directorio (en ramfs_fd_t.mode)
+#define FD_DIR    0x80
+
+// Cabecera de trozo comprimido
+#define ZCHUNK_HDR      2
+#define ZCHUNK_STORED   0x8000  // Trozo guardado sin comprimir
+#define ZCHUNK_LEN_MASK 0x7FFF
+
 /* ========================================================================== */
 /*                          FUNCIONES AUXILIARES                              */
 /* ========================================================================== */
@@ -40,16 +69,153 @@ static int find_free_inode(void) {
     return -1;
 }
 
+/* ========================================================================== */
+/*                          RESOLUCIÓN DE RUTAS                               */
+/* ========================================================================== */
+
+static uint32_t dcache_slot(int parent, const char* name) {
+    uint32_t h = 2166136261u ^ (uint8_t)parent;  // FNV-1a
+    while (*name) {
+        h = (h ^ (uint8_t)*name++) * 16777619u;
+    }
+    return h & (RAMFS_DCACHE_SIZE - 1);
+}
+
 /**
- * Encontrar inodo por nombre
+ * Buscar una entrada dentro de un directorio
+ * @return Índice del inodo o NOT_FOUND.
  */
-static int find_inode_by_name(const char* name) {
+static int lookup(int parent, const char* name) {
+    uint32_t slot = dcache_slot(parent, name);
+    int cached = dcache[slot];
+
+    if (cached >= 0 && inodes[cached].in_use && inodes[cached].parent == parent &&
+        strcmp(inodes[cached].name, name) == 0) {
+        dcache_hits++;
+        return cached;
+    }
+
+    dcache_misses++;
     for (int i = 0; i < RAMFS_MAX_FILES; i++) {
-        if (inodes[i].in_use && strcmp(inodes[i].name, name) == 0) {
+        if (inodes[i].in_use && inodes[i].parent == parent &&
+            strcmp(inodes[i].name, name) == 0) {
+            dcache[slot] = (int8_t)i;
             return i;
         }
     }
-    return -1;
+    return NOT_FOUND;
+}
+
+/**
+ * Copiar el siguiente componente de una ruta
+ * @return Puntero tras el componente, o NULL si es demasiado largo.
+ */
+static const char* next_component(const char* p, char* comp) {
+    int len = 0;
+    while (*p == '/') p++;
+    while (*p && *p != '/') {
+        if (len >= RAMFS_MAX_FILENAME - 1) return NULL;
+        comp[len++] = *p++;
+    }
+    comp[len] = '\0';
+    return p;
+}
+
+/**
+ * Resolver una ruta ("/a/b", "a/b" o "/") a un inodo
+ * @return Índice del inodo, ROOT_DIR para la raíz, o NOT_FOUND.
+ */
+static int resolve_path(const char* path) {
+    char comp[RAMFS_MAX_FILENAME];
+    int cur = ROOT_DIR;
+
+    if (!path || strlen(path) >= RAMFS_MAX_PATH) return NOT_FOUND;
+
+    while (1) {
+        path = next_component(path, comp);
+        if (!path) return NOT_FOUND;
+        if (comp[0] == '\0') return cur;
+
+        if (cur != ROOT_DIR && inodes[cur].type != RAMFS_TYPE_DIR) return NOT_FOUND;
+        cur = lookup(cur, comp);
+        if (cur == NOT_FOUND) return NOT_FOUND;
+    }
+}
+
+/**
+ * Resolver el directorio padre de una ruta y extraer el último componente
+ * @return Inodo del padre (o ROOT_DIR), o NOT_FOUND.
+ */
+static int resolve_parent(const char* path, char* leaf) {
+    char dir[RAMFS_MAX_PATH];
+
+    if (!path || strlen(path) >= RAMFS_MAX_PATH) return NOT_FOUND;
+
+    // Ignorar '/' finales ("logs/" == "logs")
+    int len = (int)strlen(path);
+    while (len > 0 && path[len - 1] == '/') len--;
+
+    int cut = len;
+    while (cut > 0 && path[cut - 1] != '/') cut--;
+
+    int leaf_len = len - cut;
+    if (leaf_len == 0 || leaf_len >= RAMFS_MAX_FILENAME) return NOT_FOUND;
+    memcpy(leaf, path + cut, leaf_len);
+    leaf[leaf_len] = '\0';
+
+    memcpy(dir, path, cut);
+    dir[cut] = '\0';
+
+    int parent = resolve_path(dir);
+    if (parent >= 0 && inodes[parent].type != RAMFS_TYPE_DIR) return NOT_FOUND;
+    return parent;
+}
+
+/**
+ * Encontrar un archivo regular por ruta
+ * @return Índice del inodo o -1.
+ */
+static int find_file(const char* path) {
+    int idx = resolve_path(path);
+    if (idx < 0 || inodes[idx].type != RAMFS_TYPE_FILE) return -1;
+    return idx;
+}
+
+/**
+ * Construir la ruta completa de un inodo
+ */
+static void inode_path(int idx, char* out) {
+    int chain[RAMFS_MAX_FILES];
+    int depth = 0;
+    int len = 0;
+
+    while (idx >= 0 && depth < RAMFS_MAX_FILES) {
+        chain[depth++] = idx;
+        idx = inodes[idx].parent;
+    }
+
+    out[0] = '\0';
+    while (depth > 0) {
+        const char* name = inodes[chain[--depth]].name;
+        int n = (int)strlen(name);
+        if (len + n + 2 > RAMFS_MAX_PATH) break;
+        out[len++] = '/';
+        memcpy(out + len, name, n);
+        len += n;
+        out[len] = '\0';
+    }
+    if (len == 0) strcpy(out, "/");
+}
+
+/**
+ * Verificar si 'idx' está dentro del subárbol de 'dir'
+ */
+static int is_descendant(int idx, int dir) {
+    for (int depth = 0; idx >= 0 && depth < RAMFS_MAX_FILES; depth++) {
+        if (idx == dir) return 1;
+        idx = inodes[idx].parent;
+    }
+    return 0;
 }
 
 /**
@@ -94,6 +260,32 @@ static void free_blocks(int start, int count) {
     }
 }
 
+/**
+ * Contar todos los bloques libres (contiguos o no)
+ */
+static int count_total_free_blocks(void) {
+    int count = 0;
+    for (int i = 0; i < RAMFS_MAX_BLOCKS; i++) {
+        if (!block_bitmap[i]) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * Encontrar el inodo cuyo extent empieza en un bloque
+ */
+static int find_inode_by_block(int block) {
+    for (int i = 0; i < RAMFS_MAX_FILES; i++) {
+        if (inodes[i].in_use && inodes[i].num_blocks > 0 &&
+            inodes[i].start_block == block) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 /**
  * Encontrar FD libre
  */
@@ -106,6 +298,187 @@ static int find_free_fd(void) {
     return -1;
 }
 
+/* ========================================================================== */
+/*                          COMPRESIÓN POR TROZOS                             */
+/* ========================================================================== */
+
+static uint8_t* extent_ptr(const ramfs_inode_t* inode) {
+    return (uint8_t*)data_blocks + inode->start_block * RAMFS_BLOCK_SIZE;
+}
+
+static uint32_t chunk_raw_len(const ramfs_inode_t* inode, uint32_t chunk) {
+    uint32_t left = inode->size - chunk * RAMFS_BLOCK_SIZE;
+    return (left < RAMFS_BLOCK_SIZE) ? left : RAMFS_BLOCK_SIZE;
+}
+
+/**
+ * Comprimir un trozo en zbuf.
+ * @return Longitud comprimida, o -1 si no ahorra espacio.
+ */
+static int chunk_compress(const uint8_t* raw, uint32_t len) {
+    if (len <= ZCHUNK_HDR) return -1;
+    return lz_compress(raw, len, zbuf, len - 1);
+}
+
+/**
+ * Descomprimir el trozo 'chunk' de un archivo comprimido en zbuf
+ * @return Bytes del trozo, o -1 si los datos están dañados.
+ */
+static int chunk_load(int idx, uint32_t chunk) {
+    ramfs_inode_t* inode = &inodes[idx];
+
+    if (zbuf_inode == idx && zbuf_chunk == chunk) {
+        return (int)zbuf_len;
+    }
+
+    // Saltar cabeceras hasta el trozo pedido
+    const uint8_t* base = extent_ptr(inode);
+    uint32_t off = 0;
+    for (uint32_t i = 0; i < chunk; i++) {
+        uint16_t hdr = base[off] | (base[off + 1] << 8);
+        off += ZCHUNK_HDR + (hdr & ZCHUNK_LEN_MASK);
+    }
+
+    uint16_t hdr = base[off] | (base[off + 1] << 8);
+    uint32_t plen = hdr & ZCHUNK_LEN_MASK;
+    uint32_t raw_len = chunk_raw_len(inode, chunk);
+
+    zbuf_inode = -1;
+    if (hdr & ZCHUNK_STORED) {
+        memcpy(zbuf, base + off + ZCHUNK_HDR, plen);
+    } else if (lz_decompress(base + off + ZCHUNK_HDR, plen, zbuf, RAMFS_BLOCK_SIZE) != (int)raw_len) {
+        return -1;
+    }
+
+    zbuf_inode = idx;
+    zbuf_chunk = chunk;
+    zbuf_len = raw_len;
+    return (int)raw_len;
+}
+
+/**
+ * Leer de un archivo comprimido trozo a trozo (sin buffer del archivo completo)
+ */
+static int packed_read(int idx, uint32_t pos, uint8_t* dst, uint32_t count) {
+    uint32_t done = 0;
+
+    while (done < count) {
+        uint32_t chunk = (pos + done) / RAMFS_BLOCK_SIZE;
+        uint32_t in_chunk = (pos + done) % RAMFS_BLOCK_SIZE;
+
+        int len = chunk_load(idx, chunk);
+        if (len < 0) return -1;
+
+        uint32_t n = (uint32_t)len - in_chunk;
+        if (n > count - done) n = count - done;
+        memcpy(dst + done, zbuf + in_chunk, n);
+        done += n;
+    }
+    return (int)done;
+}
+
+/**
+ * Comprimir el extent de un archivo en su sitio y liberar los bloques sobrantes.
+ * Una primera pasada solo mide: la salida del trozo i nunca debe pisar el
+ * trozo i+1 todavía sin comprimir, y el resultado debe liberar un bloque.
+ * @return 0 si se comprimió, -1 si no conviene o no es posible.
+ */
+static int pack_inode(int idx) {
+    ramfs_inode_t* inode = &inodes[idx];
+    if (inode->packed || inode->num_blocks == 0) return -1;
+
+    uint8_t* base = extent_ptr(inode);
+    uint32_t chunks = (inode->size + RAMFS_BLOCK_SIZE - 1) / RAMFS_BLOCK_SIZE;
+    uint32_t out = 0;
+
+    zbuf_inode = -1;
+
+    for (uint32_t i = 0; i < chunks; i++) {
+        uint32_t raw_len = chunk_raw_len(inode, i);
+        int c = chunk_compress(base + i * RAMFS_BLOCK_SIZE, raw_len);
+        out += ZCHUNK_HDR + ((c < 0) ? raw_len : (uint32_t)c);
+        if (out > (i + 1) * RAMFS_BLOCK_SIZE) return -1;
+    }
+
+    uint32_t blocks = (out + RAMFS_BLOCK_SIZE - 1) / RAMFS_BLOCK_SIZE;
+    if (blocks >= inode->num_blocks) return -1;
+
+    out = 0;
+    for (uint32_t i = 0; i < chunks; i++) {
+        uint32_t raw_len = chunk_raw_len(inode, i);
+        int c = chunk_compress(base + i * RAMFS_BLOCK_SIZE, raw_len);
+        uint16_t hdr;
+
+        if (c < 0) {
+            // Mover primero: la cabecera puede caer sobre el inicio del trozo
+            memmove(base + out + ZCHUNK_HDR, base + i * RAMFS_BLOCK_SIZE, raw_len);
+            hdr = (uint16_t)(ZCHUNK_STORED | raw_len);
+            c = (int)raw_len;
+        } else {
+            memcpy(base + out + ZCHUNK_HDR, zbuf, (uint32_t)c);
+            hdr = (uint16_t)c;
+        }
+        base[out] = (uint8_t)(hdr & 0xFF);
+        base[out + 1] = (uint8_t)(hdr >> 8);
+        out += ZCHUNK_HDR + (uint32_t)c;
+    }
+
+    free_blocks(inode->start_block + blocks, inode->num_blocks - blocks);
+    inode->num_blocks = blocks;
+    inode->capacity = blocks * RAMFS_BLOCK_SIZE;
+    inode->stored_size = out;
+    inode->packed = 1;
+    return 0;
+}
+
+/**
+ * Expandir un archivo comprimido a un extent nuevo sin comprimir
+ * @return 0 si OK, -1 si no hay bloques libres suficientes.
+ */
+static int unpack_inode(int idx) {
+    ramfs_inode_t* inode = &inodes[idx];
+    if (!inode->packed) return 0;
+
+    int needed = (int)((inode->size + RAMFS_BLOCK_SIZE - 1) / RAMFS_BLOCK_SIZE);
+    int new_start = find_free_blocks(needed);
+
+    if (new_start < 0 && count_total_free_blocks() >= needed) {
+        ramfs_compact();  // Puede mover este mismo extent: se relee abajo
+        new_start = find_free_blocks(needed);
+    }
+    if (new_start < 0) return -1;
+
+    mark_blocks_used(new_start, needed);
+
+    const uint8_t* src = extent_ptr(inode);
+    uint8_t* dst = data_blocks[new_start];
+    uint32_t off = 0;
+
+    for (uint32_t i = 0; i < (uint32_t)needed; i++) {
+        uint16_t hdr = src[off] | (src[off + 1] << 8);
+        uint32_t plen = hdr & ZCHUNK_LEN_MASK;
+        uint32_t raw_len = chunk_raw_len(inode, i);
+
+        if (hdr & ZCHUNK_STORED) {
+            memcpy(dst + i * RAMFS_BLOCK_SIZE, src + off + ZCHUNK_HDR, plen);
+        } else if (lz_decompress(src + off + ZCHUNK_HDR, plen,
+                                 dst + i * RAMFS_BLOCK_SIZE, raw_len) != (int)raw_len) {
+            free_blocks(new_start, needed);
+            return -1;
+        }
+        off += ZCHUNK_HDR + plen;
+    }
+
+    free_blocks(inode->start_block, inode->num_blocks);
+    inode->start_block = new_start;
+    inode->num_blocks = needed;
+    inode->capacity = needed * RAMFS_BLOCK_SIZE;
+    inode->stored_size = 0;
+    inode->packed = 0;
+    if (zbuf_inode == idx) zbuf_inode = -1;
+    return 0;
+}
+
 /* ========================================================================== */
 /*                          INICIALIZACIÓN                                    */
 /* ========================================================================== */
@@ -119,6 +492,16 @@ void ramfs_init(void) {
         inodes[i].capacity = 0;
         inodes[i].start_block = 0;
         inodes[i].num_blocks = 0;
+        inodes[i].attr = 0;
+        inodes[i].packed = 0;
+        inodes[i].stored_size = 0;
+        inodes[i].type = RAMFS_TYPE_FILE;
+        inodes[i].parent = ROOT_DIR;
+    }
+    zbuf_inode = -1;
+
+    for (int i = 0; i < RAMFS_DCACHE_SIZE; i++) {
+        dcache[i] = -1;
     }
 
     // Limpiar bitmap de bloques
@@ -132,6 +515,7 @@ void ramfs_init(void) {
         fd_table[i].inode_idx = -1;
         fd_table[i].position = 0;
         fd_table[i].mode = 0;
+        fd_table[i].dirty = 0;
     }
 
     uart_puts("[RAMFS] Initialized: ");
@@ -148,27 +532,46 @@ void ramfs_init(void) {
 /* ========================================================================== */
 
 int ramfs_open(const char* path, int flags) {
-    if (!path || strlen(path) >= RAMFS_MAX_FILENAME) {
+    if (!path || strlen(path) >= RAMFS_MAX_PATH) {
         return -1;
     }
 
     // Buscar si el archivo existe
-    int inode_idx = find_inode_by_name(path);
+    int inode_idx = resolve_path(path);
+    if (inode_idx == ROOT_DIR || (inode_idx >= 0 && inodes[inode_idx].type == RAMFS_TYPE_DIR)) {
+        return -1; // Los directorios se abren con ramfs_opendir
+    }
 
     // Si no existe y tiene flag CREAT, crear
     if (inode_idx < 0 && (flags & RAMFS_O_CREAT)) {
+        char leaf[RAMFS_MAX_FILENAME];
+        int parent = resolve_parent(path, leaf);
+        if (parent == NOT_FOUND) {
+            return -1; // El directorio padre no existe
+        }
+
         inode_idx = find_free_inode();
         if (inode_idx < 0) {
             return -1; // No hay inodos libres
         }
 
         // Crear inodo vacío
-        strcpy(inodes[inode_idx].name, path);
+        strcpy(inodes[inode_idx].name, leaf);
+        inodes[inode_idx].type = RAMFS_TYPE_FILE;
+        inodes[inode_idx].parent = (int8_t)parent;
         inodes[inode_idx].size = 0;
         inodes[inode_idx].capacity = 0;
         inodes[inode_idx].start_block = 0;
         inodes[inode_idx].num_blocks = 0;
         inodes[inode_idx].in_use = 1;
+        inodes[inode_idx].attr = 0;
+        inodes[inode_idx].packed = 0;
+        inodes[inode_idx].stored_size = 0;
+        memset(inodes[inode_idx].inline_data, 0, RAMFS_INLINE_MAX);
+
+        if (journal && journal->on_truncate && !(flags & RAMFS_O_TRUNC)) {
+            journal->on_truncate(path, 0);
+        }
     }
 
     // Si no existe y NO tiene CREAT, error
@@ -184,6 +587,13 @@ int ramfs_open(const char* path, int flags) {
         inodes[inode_idx].size = 0;
         inodes[inode_idx].capacity = 0;
         inodes[inode_idx].num_blocks = 0;
+        inodes[inode_idx].packed = 0;
+        inodes[inode_idx].stored_size = 0;
+        if (zbuf_inode == inode_idx) zbuf_inode = -1;
+
+        if (journal && journal->on_truncate) {
+            journal->on_truncate(path, 0);
+        }
     }
 
     // Buscar FD libre
@@ -196,6 +606,7 @@ int ramfs_open(const char* path, int flags) {
     fd_table[fd].inode_idx = inode_idx;
     fd_table[fd].is_open = 1;
     fd_table[fd].mode = flags & 0xFF;
+    fd_table[fd].dirty = 0;
 
     // Posición inicial
     if (flags & RAMFS_O_APPEND) {
@@ -235,6 +646,20 @@ int ramfs_read(int fd, void* buf, size_t count) {
         return 0; // EOF
     }
 
+    // Archivo inline: una sola copia desde el inodo
+    if (inode->num_blocks == 0) {
+        memcpy(buf, inode->inline_data + pos, to_read);
+        fd_table[fd].position += to_read;
+        return (int)to_read;
+    }
+
+    // Archivo comprimido: descomprimir solo los trozos pedidos
+    if (inode->packed) {
+        if (packed_read(inode_idx, pos, (uint8_t*)buf, to_read) < 0) return -1;
+        fd_table[fd].position += to_read;
+        return (int)to_read;
+    }
+
     // Leer datos bloque por bloque
     uint8_t* dst = (uint8_t*)buf;
     uint32_t bytes_read = 0;
@@ -282,13 +707,35 @@ int ramfs_write(int fd, const void* buf, size_t count) {
     int inode_idx = fd_table[fd].inode_idx;
     ramfs_inode_t* inode = &inodes[inode_idx];
 
+    // Un archivo comprimido se expande antes de modificarlo
+    if (inode->packed && unpack_inode(inode_idx) < 0) {
+        return -1;
+    }
+    fd_table[fd].dirty = 1;
+
     uint32_t pos = fd_table[fd].position;
     uint32_t new_size = pos + count;
 
+    // Archivo pequeño: escribir directo en el inodo
+    if (inode->num_blocks == 0 && new_size <= RAMFS_INLINE_MAX) {
+        memcpy(inode->inline_data + pos, buf, count);
+        if (new_size > inode->size) {
+            inode->size = new_size;
+        }
+        fd_table[fd].position += count;
+
+        if (journal && journal->on_write) {
+            char path[RAMFS_MAX_PATH];
+            inode_path(inode_idx, path);
+            journal->on_write(path, pos, buf, count);
+        }
+        return (int)count;
+    }
+
     // Calcular bloques necesarios
     uint32_t blocks_needed = (new_size + RAMFS_BLOCK_SIZE - 1) / RAMFS_BLOCK_SIZE;
 
-    // Si necesitamos más bloques, reasignar
+    // Si necesitamos más bloques, reasignar (o promover desde inline)
     if (blocks_needed > inode->num_blocks) {
         // Liberar bloques viejos
         if (inode->num_blocks > 0) {
@@ -297,17 +744,33 @@ int ramfs_write(int fd, const void* buf, size_t count) {
 
         // Buscar nuevos bloques
         int new_start = find_free_blocks(blocks_needed);
+
+        // Hay espacio suficiente pero fragmentado: compactar y reintentar
+        if (new_start < 0 && count_total_free_blocks() >= (int)blocks_needed) {
+            if (inode->num_blocks > 0) {
+                mark_blocks_used(inode->start_block, inode->num_blocks);
+            }
+            ramfs_compact();
+            if (inode->num_blocks > 0) {
+                free_blocks(inode->start_block, inode->num_blocks);
+            }
+            new_start = find_free_blocks(blocks_needed);
+        }
+
         if (new_start < 0) {
+            // Devolver los bloques originales para no perder el contenido
+            if (inode->num_blocks > 0) {
+                mark_blocks_used(inode->start_block, inode->num_blocks);
+            }
             return -1; // No hay espacio
         }
 
-        // Copiar datos viejos si existen
+        // Copiar datos viejos si existen (los extents pueden solaparse)
         if (inode->size > 0) {
-            for (uint32_t i = 0; i < inode->size; i++) {
-                uint32_t old_block = inode->start_block + (i / RAMFS_BLOCK_SIZE);
-                uint32_t new_block = new_start + (i / RAMFS_BLOCK_SIZE);
-                uint32_t offset = i % RAMFS_BLOCK_SIZE;
-                data_blocks[new_block][offset] = data_blocks[old_block][offset];
+            if (inode->num_blocks == 0) {
+                memcpy(data_blocks[new_start], inode->inline_data, inode->size);
+            } else {
+                memmove(data_blocks[new_start], data_blocks[inode->start_block], inode->size);
             }
         }
 
@@ -347,6 +810,12 @@ int ramfs_write(int fd, const void* buf, size_t count) {
     // Actualizar posición
     fd_table[fd].position += bytes_written;
 
+    if (journal && journal->on_write) {
+        char path[RAMFS_MAX_PATH];
+        inode_path(inode_idx, path);
+        journal->on_write(path, pos, buf, bytes_written);
+    }
+
     return (int)bytes_written;
 }
 
@@ -355,7 +824,8 @@ int ramfs_write(int fd, const void* buf, size_t count) {
 /* ========================================================================== */
 
 int ramfs_seek(int fd, int offset, int whence) {
-    if (fd < 0 || fd >= RAMFS_MAX_OPEN || !fd_table[fd].is_open) {
+    if (fd < 0 || fd >= RAMFS_MAX_OPEN || !fd_table[fd].is_open ||
+        (fd_table[fd].mode & FD_DIR)) {
         return -1;
     }
 
@@ -399,10 +869,17 @@ int ramfs_close(int fd) {
         return -1;
     }
 
+    // Volver a comprimir los archivos con el atributo tras modificarlos
+    int idx = fd_table[fd].inode_idx;
+    if (fd_table[fd].dirty && (inodes[idx].attr & RAMFS_ATTR_COMPRESS)) {
+        pack_inode(idx);
+    }
+
     fd_table[fd].is_open = 0;
     fd_table[fd].inode_idx = -1;
     fd_table[fd].position = 0;
     fd_table[fd].mode = 0;
+    fd_table[fd].dirty = 0;
 
     return 0;
 }
@@ -422,7 +899,7 @@ int ramfs_create(const char* name, const void* data, uint32_t size) {
 }
 
 int ramfs_delete(const char* name) {
-    int idx = find_inode_by_name(name);
+    int idx = find_file(name);
     if (idx < 0) return -1;
 
     // Liberar bloques
@@ -432,27 +909,34 @@ int ramfs_delete(const char* name) {
 
     // Liberar inodo
     inodes[idx].in_use = 0;
+    inodes[idx].packed = 0;
+    if (zbuf_inode == idx) zbuf_inode = -1;
+
+    if (journal && journal->on_delete) {
+        journal->on_delete(name);
+    }
     return 0;
 }
 
 int ramfs_exists(const char* name) {
-    return find_inode_by_name(name) >= 0 ? 1 : 0;
+    return resolve_path(name) != NOT_FOUND ? 1 : 0;
 }
 
 int ramfs_get_size(const char* name) {
-    int idx = find_inode_by_name(name);
+    int idx = find_file(name);
     return (idx >= 0) ? (int)inodes[idx].size : -1;
 }
 
 int ramfs_listdir(char* out, int max) {
     int used = 0;
     for (int i = 0; i < RAMFS_MAX_FILES; i++) {
-        if (inodes[i].in_use) {
+        if (inodes[i].in_use && inodes[i].parent == ROOT_DIR) {
             int len = strlen(inodes[i].name);
-            if (used + len + 2 >= max) break;
+            if (used + len + 3 >= max) break;
 
             strcpy(out + used, inodes[i].name);
             used += len;
+            if (inodes[i].type == RAMFS_TYPE_DIR) out[used++] = '/';
             out[used++] = '\n';
         }
     }
@@ -460,22 +944,48 @@ int ramfs_listdir(char* out, int max) {
     return used;
 }
 
-void ramfs_listdir_uart(void) {
-    uart_puts("\r\n📂 RAMFS Files:\r\n");
-    uart_puts("==================\r\n");
+/**
+ * Imprimir un directorio y sus subdirectorios con sangría
+ */
+static int listdir_uart_tree(int parent, int depth) {
     int count = 0;
     for (int i = 0; i < RAMFS_MAX_FILES; i++) {
-        if (inodes[i].in_use) {
-            uart_puts("  ");
+        if (inodes[i].in_use && inodes[i].parent == parent) {
+            for (int d = 0; d <= depth; d++) uart_puts("  ");
             uart_puts(inodes[i].name);
+
+            if (inodes[i].type == RAMFS_TYPE_DIR) {
+                uart_puts("/\r\n");
+                if (depth < RAMFS_MAX_FILES) {
+                    count += listdir_uart_tree(i, depth + 1);
+                }
+                continue;
+            }
+
             uart_puts(" (");
             uart_putint(inodes[i].size);
             uart_puts(" bytes, ");
-            uart_putint(inodes[i].num_blocks);
-            uart_puts(" blocks)\r\n");
+            if (inodes[i].num_blocks == 0) {
+                uart_puts("inline)\r\n");
+            } else if (inodes[i].packed) {
+                uart_putint(inodes[i].num_blocks);
+                uart_puts(" blocks, packed ");
+                uart_putint(inodes[i].stored_size);
+                uart_puts(" bytes)\r\n");
+            } else {
+                uart_putint(inodes[i].num_blocks);
+                uart_puts(" blocks)\r\n");
+            }
             count++;
         }
     }
+    return count;
+}
+
+void ramfs_listdir_uart(void) {
+    uart_puts("\r\n📂 RAMFS Files:\r\n");
+    uart_puts("==================\r\n");
+    int count = listdir_uart_tree(ROOT_DIR, 0);
     uart_puts("------------------\r\n");
     uart_puts("Total: ");
     uart_putint(count);
@@ -487,7 +997,7 @@ void ramfs_stats(int* total_files, int* used_blocks, int* free_blocks) {
     int blocks = 0;
 
     for (int i = 0; i < RAMFS_MAX_FILES; i++) {
-        if (inodes[i].in_use) {
+        if (inodes[i].in_use && inodes[i].type == RAMFS_TYPE_FILE) {
             files++;
         }
     }
@@ -503,8 +1013,57 @@ void ramfs_stats(int* total_files, int* used_blocks, int* free_blocks) {
     if (free_blocks) *free_blocks = RAMFS_MAX_BLOCKS - blocks;
 }
 
+int ramfs_inline_count(void) {
+    int count = 0;
+    for (int i = 0; i < RAMFS_MAX_FILES; i++) {
+        if (inodes[i].in_use && inodes[i].num_blocks == 0 && inodes[i].size > 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+int ramfs_set_compress(const char* name, int enable) {
+    int idx = find_file(name);
+    if (idx < 0) return -1;
+
+    ramfs_inode_t* inode = &inodes[idx];
+
+    if (enable) {
+        inode->attr |= RAMFS_ATTR_COMPRESS;
+        pack_inode(idx);  // Si no ahorra un bloque se queda sin comprimir
+    } else {
+        if (unpack_inode(idx) < 0) return -1;
+        inode->attr &= ~RAMFS_ATTR_COMPRESS;
+    }
+
+    if (journal && journal->on_attr) {
+        journal->on_attr(name, inode->attr);
+    }
+    return 0;
+}
+
+int ramfs_get_attr(const char* name) {
+    int idx = find_file(name);
+    return (idx >= 0) ? inodes[idx].attr : -1;
+}
+
+void ramfs_compression_stats(int* files, uint32_t* raw_bytes, uint32_t* stored_bytes) {
+    *files = 0;
+    *raw_bytes = 0;
+    *stored_bytes = 0;
+
+    for (int i = 0; i < RAMFS_MAX_FILES; i++) {
+        if (inodes[i].in_use && inodes[i].packed) {
+            (*files)++;
+            *raw_bytes += inodes[i].size;
+            *stored_bytes += inodes[i].stored_size;
+        }
+    }
+}
+
 int ramfs_truncate(const char* name, uint32_t new_size) {
-    int idx = find_inode_by_name(name);
+    int idx = find_file(name);
     if (idx < 0) return -1;
 
     ramfs_inode_t* inode = &inodes[idx];
@@ -513,23 +1072,47 @@ int ramfs_truncate(const char* name, uint32_t new_size) {
         return 0; // No hay que truncar
     }
 
+    int repack = inode->packed;
+    if (repack && unpack_inode(idx) < 0) {
+        return -1;
+    }
+
     inode->size = new_size;
+    if (repack) {
+        pack_inode(idx);
+    }
+
+    if (journal && journal->on_truncate) {
+        journal->on_truncate(name, new_size);
+    }
     return 0;
 }
 
 int ramfs_rename(const char* old_name, const char* new_name) {
-    int idx = find_inode_by_name(old_name);
+    char leaf[RAMFS_MAX_FILENAME];
+
+    int idx = resolve_path(old_name);
     if (idx < 0) return -1;
 
-    if (find_inode_by_name(new_name) >= 0) {
+    // El destino puede estar en otro directorio
+    int parent = resolve_parent(new_name, leaf);
+    if (parent == NOT_FOUND) return -1;
+
+    if (lookup(parent, leaf) != NOT_FOUND) {
         return -1; // El nuevo nombre ya existe
     }
 
-    if (strlen(new_name) >= RAMFS_MAX_FILENAME) {
+    // Un directorio no puede moverse dentro de sí mismo
+    if (inodes[idx].type == RAMFS_TYPE_DIR && is_descendant(parent, idx)) {
         return -1;
     }
 
-    strcpy(inodes[idx].name, new_name);
+    strcpy(inodes[idx].name, leaf);
+    inodes[idx].parent = (int8_t)parent;
+
+    if (journal && journal->on_rename) {
+        journal->on_rename(old_name, new_name);
+    }
     return 0;
 }
 
@@ -542,3 +1125,217 @@ int ramfs_append(const char* name, const void* data, uint32_t size) {
 
     return (written == (int)size) ? 0 : -1;
 }
+
+int ramfs_pread(const char* name, uint32_t offset, void* buf, uint32_t count) {
+    int idx = find_file(name);
+    if (idx < 0) return -1;
+
+    ramfs_inode_t* inode = &inodes[idx];
+    if (offset >= inode->size) return 0;
+    if (count > inode->size - offset) count = inode->size - offset;
+
+    if (inode->num_blocks == 0) {
+        memcpy(buf, inode->inline_data + offset, count);
+        return (int)count;
+    }
+
+    if (inode->packed) {
+        return packed_read(idx, offset, (uint8_t*)buf, count);
+    }
+
+    // El extent es contiguo: una sola copia
+    memcpy(buf, (uint8_t*)data_blocks + inode->start_block * RAMFS_BLOCK_SIZE + offset, count);
+    return (int)count;
+}
+
+int ramfs_path_at(int idx, char* path) {
+    if (idx < 0 || idx >= RAMFS_MAX_FILES || !inodes[idx].in_use) {
+        return -1;
+    }
+    inode_path(idx, path);
+    return inodes[idx].type;
+}
+
+/* ========================================================================== */
+/*                          DIRECTORIOS                                       */
+/* ========================================================================== */
+
+int ramfs_mkdir(const char* path) {
+    char leaf[RAMFS_MAX_FILENAME];
+
+    int parent = resolve_parent(path, leaf);
+    if (parent == NOT_FOUND) return -1;
+    if (lookup(parent, leaf) != NOT_FOUND) return -1; // Ya existe
+
+    int idx = find_free_inode();
+    if (idx < 0) return -1;
+
+    strcpy(inodes[idx].name, leaf);
+    inodes[idx].type = RAMFS_TYPE_DIR;
+    inodes[idx].parent = (int8_t)parent;
+    inodes[idx].size = 0;
+    inodes[idx].capacity = 0;
+    inodes[idx].start_block = 0;
+    inodes[idx].num_blocks = 0;
+    inodes[idx].attr = 0;
+    inodes[idx].packed = 0;
+    inodes[idx].stored_size = 0;
+    inodes[idx].in_use = 1;
+
+    if (journal && journal->on_mkdir) {
+        journal->on_mkdir(path);
+    }
+    return 0;
+}
+
+int ramfs_rmdir(const char* path) {
+    int idx = resolve_path(path);
+    if (idx < 0 || inodes[idx].type != RAMFS_TYPE_DIR) return -1;
+
+    for (int i = 0; i < RAMFS_MAX_FILES; i++) {
+        if (inodes[i].in_use && inodes[i].parent == idx) {
+            return -1; // No está vacío
+        }
+    }
+
+    // Un descriptor abierto sobre el directorio quedaría colgando
+    for (int fd = 0; fd < RAMFS_MAX_OPEN; fd++) {
+        if (fd_table[fd].is_open && fd_table[fd].inode_idx == idx) {
+            return -1;
+        }
+    }
+
+    inodes[idx].in_use = 0;
+
+    if (journal && journal->on_delete) {
+        journal->on_delete(path);
+    }
+    return 0;
+}
+
+int ramfs_opendir(const char* path) {
+    int idx = resolve_path(path);
+    if (idx == NOT_FOUND || (idx >= 0 && inodes[idx].type != RAMFS_TYPE_DIR)) {
+        return -1;
+    }
+
+    int fd = find_free_fd();
+    if (fd < 0) return -1;
+
+    fd_table[fd].inode_idx = idx;
+    fd_table[fd].is_open = 1;
+    fd_table[fd].mode = FD_DIR;   // Sin permisos de lectura/escritura de datos
+    fd_table[fd].dirty = 0;
+    fd_table[fd].position = 0;    // Siguiente ranura de inodo a examinar
+    return fd;
+}
+
+int ramfs_readdir(int fd, ramfs_dirent_t* ent) {
+    if (fd < 0 || fd >= RAMFS_MAX_OPEN || !fd_table[fd].is_open ||
+        !(fd_table[fd].mode & FD_DIR)) {
+        return -1;
+    }
+
+    int dir = fd_table[fd].inode_idx;
+    while (fd_table[fd].position < RAMFS_MAX_FILES) {
+        ramfs_inode_t* inode = &inodes[fd_table[fd].position++];
+        if (inode->in_use && inode->parent == dir) {
+            strcpy(ent->name, inode->name);
+            ent->type = inode->type;
+            ent->size = inode->size;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int ramfs_is_dir(const char* path) {
+    int idx = resolve_path(path);
+    return (idx == ROOT_DIR || (idx >= 0 && inodes[idx].type == RAMFS_TYPE_DIR)) ? 1 : 0;
+}
+
+void ramfs_dcache_stats(uint32_t* hits, uint32_t* misses) {
+    *hits = dcache_hits;
+    *misses = dcache_misses;
+}
+
+void ramfs_set_journal(const ramfs_journal_t* j) {
+    journal = j;
+}
+
+/* ========================================================================== */
+/*                          COMPACTACIÓN                                      */
+/* ========================================================================== */
+
+int ramfs_fragmentation(void) {
+    int free_total = 0;
+    int largest = 0;
+    int run = 0;
+
+    for (int i = 0; i < RAMFS_MAX_BLOCKS; i++) {
+        if (!block_bitmap[i]) {
+            free_total++;
+            run++;
+            if (run > largest) largest = run;
+        } else {
+            run = 0;
+        }
+    }
+
+    if (free_total == 0) return 0;
+    return 100 - (largest * 100) / free_total;
+}
+
+int ramfs_compact_step(int max_blocks) {
+    int moved = 0;
+    int gap = 0;
+
+    while (1) {
+        // Primer hueco libre
+        while (gap < RAMFS_MAX_BLOCKS && block_bitmap[gap]) gap++;
+
+        // Siguiente extent ocupado después del hueco
+        int src = gap;
+        while (src < RAMFS_MAX_BLOCKS && !block_bitmap[src]) src++;
+        if (src >= RAMFS_MAX_BLOCKS) break; // Ya no hay huecos intermedios
+
+        int idx = find_inode_by_block(src);
+        if (idx < 0) {
+            // Bloque sin dueño (no debería ocurrir): recuperarlo
+            block_bitmap[src] = 0;
+            continue;
+        }
+
+        int n = inodes[idx].num_blocks;
+        if (moved > 0 && moved + n > max_blocks) break; // Rebanada agotada
+
+        // Los FDs guardan el índice de inodo, no el bloque físico: basta con
+        // mover los datos y actualizar start_block antes de ceder la CPU.
+        memmove(data_blocks[gap], data_blocks[src], (size_t)n * RAMFS_BLOCK_SIZE);
+        free_blocks(src, n);
+        mark_blocks_used(gap, n);
+        inodes[idx].start_block = gap;
+
+        moved += n;
+        gap += n;
+    }
+
+    return moved;
+}
+
+int ramfs_compact(void) {
+    int total = 0;
+    int moved;
+
+    while ((moved = ramfs_compact_step(RAMFS_COMPACT_SLICE_BLOCKS)) > 0) {
+        total += moved;
+    }
+    return total;
+}
+
+void ramfs_compact_task(void) {
+    if (ramfs_fragmentation() >= RAMFS_COMPACT_THRESHOLD) {
+        ramfs_compact_step(RAMFS_COMPACT_SLICE_BLOCKS);
+    }
+    task_delay(RAMFS_COMPACT_PERIOD_MS);
+}
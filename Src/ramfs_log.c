@@ -0,0 +1,641 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Persistencia de RAMFS en log estructurado - Implementación
+ * ============================================================================
+ */
+
+#include "ramfs_log.h"
+#include "ramfs.h"
+#include "sched.h"
+#include "uart.h"
+#include <string.h>
+#ifdef DAOS_HOST
+#include <time.h>
+#endif
+
+/* ========================================================================== */
+/*                          FORMATO EN EL MEDIO                               */
+/* ========================================================================== */
+
+#define LOG_REGION_MAGIC  0x32474C44  // "DLG2" (rutas completas)
+#define LOG_REC_MAGIC     0x4C52      // "RL"
+#define LOG_COMMITTED     0x00000000
+
+/** Tipos de registro. */
+#define LOG_REC_FILE      1   // Instantánea: nombre + contenido completo
+#define LOG_REC_WRITE     2   // nombre + offset + datos
+#define LOG_REC_TRUNC     3   // nombre + nuevo tamaño (0 = crear/vaciar)
+#define LOG_REC_DELETE    4   // nombre
+#define LOG_REC_RENAME    5   // nombre viejo + nombre nuevo
+#define LOG_REC_CKPT      6   // Fin de instantánea (número de archivos)
+#define LOG_REC_ATTR      7   // nombre + atributos (RAMFS_ATTR_*)
+#define LOG_REC_MKDIR     8   // ruta del directorio
+
+/** Los nombres se guardan como rutas completas de longitud fija. */
+#define LOG_NAME_LEN      RAMFS_MAX_PATH
+
+/** Cabecera de región (inicio de cada bloque). */
+typedef struct {
+    uint32_t magic;
+    uint32_t generation;
+    uint32_t crc;              // CRC de magic + generation
+} log_region_hdr_t;
+
+/** Cabecera de registro. */
+typedef struct {
+    uint16_t magic;
+    uint8_t type;
+    uint8_t reserved;
+    uint32_t len;              // Longitud del payload
+    uint32_t data_crc;         // CRC del payload
+    uint32_t hdr_crc;          // CRC de los 12 bytes anteriores
+    uint32_t commit;           // 0xFFFFFFFF pendiente, 0 confirmado
+} log_rec_hdr_t;
+
+#define LOG_ALIGN(n)      (((n) + 3u) & ~3u)
+#define LOG_DATA_START    LOG_ALIGN(sizeof(log_region_hdr_t))
+#define LOG_CHUNK         128
+
+// El montaje corre antes de sched_start, cuando millis() todavía no avanza:
+// se mide con el contador de ciclos (DWT, habilitado en spi_dma_init)
+#define CYCLES_US         16
+#ifndef DAOS_HOST
+#define DWT_CYCCNT        (*(volatile uint32_t*)0xE0001004)
+#endif
+
+/* ========================================================================== */
+/*                          ESTADO                                            */
+/* ========================================================================== */
+
+static const blockdev_t* dev = NULL;
+static uint32_t active_block = 0;
+static uint32_t generation = 0;
+static uint32_t write_pos = 0;     // Siguiente offset libre en el bloque activo
+static uint32_t ckpt_end = 0;      // Offset tras el CKPT del bloque activo
+static uint8_t mounted = 0;
+static uint8_t replaying = 0;
+static uint8_t compact_pending = 0; // La tarea de fondo debe escribir un checkpoint
+static uint8_t append_blocked = 0;  // Registro dañado al final: no agregar detrás
+static ramfs_log_stats_t stats;
+
+// Buffer de trabajo para copiar payloads entre RAMFS y el medio
+static uint8_t chunk[LOG_CHUNK];
+
+/* ========================================================================== */
+/*                          CRC32                                             */
+/* ========================================================================== */
+
+/**
+ * CRC-32 (polinomio reflejado 0xEDB88320) con tabla de nibbles
+ */
+static uint32_t crc32_update(uint32_t crc, const void* data, uint32_t len) {
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+        0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+        0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    const uint8_t* p = (const uint8_t*)data;
+
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc = table[(crc ^ p[i]) & 0x0F] ^ (crc >> 4);
+        crc = table[(crc ^ (p[i] >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
+/* ========================================================================== */
+/*                          ESCRITURA DE REGISTROS                            */
+/* ========================================================================== */
+
+static void pad_name(char* out, const char* name) {
+    memset(out, 0, LOG_NAME_LEN);
+    strncpy(out, name, LOG_NAME_LEN - 1);
+}
+
+static int path_depth(const char* path) {
+    int depth = 0;
+    for (; *path; path++) {
+        if (*path == '/') depth++;
+    }
+    return depth;
+}
+
+static uint32_t record_size(uint32_t len) {
+    return sizeof(log_rec_hdr_t) + LOG_ALIGN(len);
+}
+
+/**
+ * Programar cabecera (sin commit). El payload se programa después y el
+ * commit al final: ese es el punto de confirmación atómico.
+ */
+static int write_header(uint32_t block, uint32_t pos, uint8_t type,
+                        uint32_t len, uint32_t data_crc) {
+    log_rec_hdr_t hdr;
+
+    hdr.magic = LOG_REC_MAGIC;
+    hdr.type = type;
+    hdr.reserved = 0xFF;
+    hdr.len = len;
+    hdr.data_crc = data_crc;
+    hdr.hdr_crc = crc32_update(0, &hdr, 12);
+    hdr.commit = 0xFFFFFFFF;
+
+    return dev->prog(dev, block, pos, &hdr, 16);
+}
+
+static int write_commit(uint32_t block, uint32_t pos) {
+    uint32_t commit = LOG_COMMITTED;
+    return dev->prog(dev, block, pos + 16, &commit, sizeof(commit));
+}
+
+/**
+ * Escribir un registro con payload formado por dos trozos (p1 || p2)
+ */
+static int write_record(uint32_t block, uint32_t* pos, uint8_t type,
+                        const void* p1, uint32_t l1, const void* p2, uint32_t l2) {
+    uint32_t len = l1 + l2;
+    uint32_t at = *pos;
+
+    if (at + record_size(len) > dev->block_size) return -1;
+
+    uint32_t crc = crc32_update(0, p1, l1);
+    crc = crc32_update(crc, p2, l2);
+
+    if (write_header(block, at, type, len, crc) < 0) return -1;
+    if (l1 > 0 && dev->prog(dev, block, at + sizeof(log_rec_hdr_t), p1, l1) < 0) return -1;
+    if (l2 > 0 && dev->prog(dev, block, at + sizeof(log_rec_hdr_t) + l1, p2, l2) < 0) return -1;
+    if (write_commit(block, at) < 0) return -1;
+
+    *pos = at + record_size(len);
+    return 0;
+}
+
+/**
+ * Escribir un registro FILE leyendo el contenido directamente de RAMFS
+ */
+static int write_file_record(uint32_t block, uint32_t* pos, const char* name) {
+    char padded[LOG_NAME_LEN];
+    int size = ramfs_get_size(name);
+    if (size < 0) return -1;
+
+    uint32_t len = LOG_NAME_LEN + (uint32_t)size;
+    uint32_t at = *pos;
+    if (at + record_size(len) > dev->block_size) return -1;
+
+    memset(padded, 0, sizeof(padded));
+    strncpy(padded, name, LOG_NAME_LEN - 1);
+
+    // Primera pasada: CRC del payload
+    uint32_t crc = crc32_update(0, padded, sizeof(padded));
+    for (uint32_t off = 0; off < (uint32_t)size; off += LOG_CHUNK) {
+        int n = ramfs_pread(name, off, chunk, LOG_CHUNK);
+        if (n <= 0) return -1;
+        crc = crc32_update(crc, chunk, (uint32_t)n);
+    }
+
+    // Segunda pasada: programar
+    uint32_t data_pos = at + sizeof(log_rec_hdr_t);
+    if (write_header(block, at, LOG_REC_FILE, len, crc) < 0) return -1;
+    if (dev->prog(dev, block, data_pos, padded, sizeof(padded)) < 0) return -1;
+    data_pos += sizeof(padded);
+
+    for (uint32_t off = 0; off < (uint32_t)size; off += LOG_CHUNK) {
+        int n = ramfs_pread(name, off, chunk, LOG_CHUNK);
+        if (n <= 0) return -1;
+        if (dev->prog(dev, block, data_pos, chunk, (uint32_t)n) < 0) return -1;
+        data_pos += (uint32_t)n;
+    }
+
+    if (write_commit(block, at) < 0) return -1;
+
+    *pos = at + record_size(len);
+    return 0;
+}
+
+/* ========================================================================== */
+/*                          COMPACTACIÓN (CHECKPOINT)                         */
+/* ========================================================================== */
+
+static int write_checkpoint(uint32_t block, uint32_t gen) {
+    log_region_hdr_t region;
+    uint32_t pos = LOG_DATA_START;
+    uint32_t files = 0;
+
+    if (dev->erase && dev->erase(dev, block) < 0) return -1;
+
+    region.magic = LOG_REGION_MAGIC;
+    region.generation = gen;
+    region.crc = crc32_update(0, &region, 8);
+    if (dev->prog(dev, block, 0, &region, sizeof(region)) < 0) return -1;
+
+    char name[RAMFS_MAX_PATH];
+
+    // Directorios primero y por profundidad: al reproducir, el padre ya existe
+    for (int depth = 1, found = 1; found; depth++) {
+        found = 0;
+        for (int i = 0; i < RAMFS_MAX_FILES; i++) {
+            if (ramfs_path_at(i, name) != RAMFS_TYPE_DIR) continue;
+            if (path_depth(name) != depth) continue;
+
+            found = 1;
+            char padded[LOG_NAME_LEN];
+            pad_name(padded, name);
+            if (write_record(block, &pos, LOG_REC_MKDIR, padded, sizeof(padded), NULL, 0) < 0) {
+                return -1;
+            }
+        }
+    }
+
+    for (int i = 0; i < RAMFS_MAX_FILES; i++) {
+        if (ramfs_path_at(i, name) != RAMFS_TYPE_FILE) continue;
+        if (write_file_record(block, &pos, name) < 0) return -1;
+        files++;
+
+        // Los atributos van detrás del contenido (al reproducir, comprime)
+        int attr = ramfs_get_attr(name);
+        if (attr > 0) {
+            uint8_t payload[LOG_NAME_LEN + 4];
+            uint32_t value = (uint32_t)attr;
+            pad_name((char*)payload, name);
+            memcpy(payload + LOG_NAME_LEN, &value, 4);
+            if (write_record(block, &pos, LOG_REC_ATTR, payload, sizeof(payload), NULL, 0) < 0) {
+                return -1;
+            }
+        }
+    }
+
+    if (write_record(block, &pos, LOG_REC_CKPT, &files, sizeof(files), NULL, 0) < 0) {
+        return -1;
+    }
+    if (dev->sync && dev->sync(dev) < 0) return -1;
+
+    // La nueva región ya es válida: pasar a usarla
+    active_block = block;
+    generation = gen;
+    write_pos = pos;
+    ckpt_end = pos;
+    return 0;
+}
+
+int ramfs_log_compact(void) {
+    if (!dev) return -1;
+
+    uint32_t target = mounted ? (active_block + 1) % 2 : 0;
+    if (write_checkpoint(target, generation + 1) < 0) {
+        stats.errors++;
+        uart_puts("[RAMFS-LOG] Compaction failed\r\n");
+        return -1;
+    }
+
+    compact_pending = 0;
+    append_blocked = 0;
+    stats.compactions++;
+    return 0;
+}
+
+int ramfs_log_maintain(void) {
+    if (!mounted || !compact_pending) return 0;
+    return ramfs_log_compact() < 0 ? -1 : 1;
+}
+
+/* ========================================================================== */
+/*                          JOURNAL                                           */
+/* ========================================================================== */
+
+static void log_append(uint8_t type, const void* p1, uint32_t l1, const void* p2, uint32_t l2) {
+    if (!mounted || replaying) return;
+
+    // Sin espacio: el checkpoint ya incluye esta operación (aplicada en RAM).
+    // Es el único caso que no puede esperar a la tarea de fondo.
+    if (write_pos + record_size(l1 + l2) > dev->block_size) {
+        ramfs_log_compact();
+        return;
+    }
+
+    // El checkpoint pendiente recogerá la operación desde RAM
+    if (append_blocked) return;
+
+    if (write_record(active_block, &write_pos, type, p1, l1, p2, l2) < 0) {
+        stats.errors++;
+        append_blocked = 1;
+        compact_pending = 1;
+        return;
+    }
+
+    // Acotar el tiempo de montaje: la cola de operaciones no crece sin
+    // límite. Borrar un bloque de flash tarda segundos, así que aquí solo se
+    // pide el checkpoint y lo escribe ramfs_log_maintain() en segundo plano.
+    if (write_pos - ckpt_end > RAMFS_LOG_MAX_TAIL) {
+        compact_pending = 1;
+    }
+}
+
+static void journal_write(const char* name, uint32_t offset, const void* data, uint32_t len) {
+    uint8_t head[LOG_NAME_LEN + 4];
+    pad_name((char*)head, name);
+    memcpy(head + LOG_NAME_LEN, &offset, 4);
+    log_append(LOG_REC_WRITE, head, sizeof(head), data, len);
+}
+
+static void journal_truncate(const char* name, uint32_t new_size) {
+    uint8_t payload[LOG_NAME_LEN + 4];
+    pad_name((char*)payload, name);
+    memcpy(payload + LOG_NAME_LEN, &new_size, 4);
+    log_append(LOG_REC_TRUNC, payload, sizeof(payload), NULL, 0);
+}
+
+static void journal_delete(const char* name) {
+    char payload[LOG_NAME_LEN];
+    pad_name(payload, name);
+    log_append(LOG_REC_DELETE, payload, sizeof(payload), NULL, 0);
+}
+
+static void journal_rename(const char* old_name, const char* new_name) {
+    char payload[2 * LOG_NAME_LEN];
+    pad_name(payload, old_name);
+    pad_name(payload + LOG_NAME_LEN, new_name);
+    log_append(LOG_REC_RENAME, payload, sizeof(payload), NULL, 0);
+}
+
+static void journal_attr(const char* name, uint8_t attr) {
+    uint8_t payload[LOG_NAME_LEN + 4];
+    uint32_t value = attr;
+    pad_name((char*)payload, name);
+    memcpy(payload + LOG_NAME_LEN, &value, 4);
+    log_append(LOG_REC_ATTR, payload, sizeof(payload), NULL, 0);
+}
+
+static void journal_mkdir(const char* path) {
+    char payload[LOG_NAME_LEN];
+    pad_name(payload, path);
+    log_append(LOG_REC_MKDIR, payload, sizeof(payload), NULL, 0);
+}
+
+static const ramfs_journal_t log_journal = {
+    .on_write    = journal_write,
+    .on_truncate = journal_truncate,
+    .on_delete   = journal_delete,
+    .on_rename   = journal_rename,
+    .on_attr     = journal_attr,
+    .on_mkdir    = journal_mkdir,
+};
+
+/* ========================================================================== */
+/*                          REPRODUCCIÓN (MONTAJE)                            */
+/* ========================================================================== */
+
+static int payload_crc_ok(uint32_t block, uint32_t data_pos, const log_rec_hdr_t* hdr) {
+    uint32_t crc = 0;
+    for (uint32_t off = 0; off < hdr->len; off += LOG_CHUNK) {
+        uint32_t n = hdr->len - off;
+        if (n > LOG_CHUNK) n = LOG_CHUNK;
+        if (dev->read(dev, block, data_pos + off, chunk, n) < 0) return 0;
+        crc = crc32_update(crc, chunk, n);
+    }
+    return crc == hdr->data_crc;
+}
+
+/**
+ * Copiar datos del medio a un archivo RAMFS a partir de un offset
+ */
+static int replay_data(uint32_t block, uint32_t data_pos, const char* name,
+                       uint32_t offset, uint32_t len, int flags) {
+    int fd = ramfs_open(name, RAMFS_O_CREAT | RAMFS_O_WRONLY | flags);
+    if (fd < 0) return -1;
+    ramfs_seek(fd, (int)offset, SEEK_SET);
+
+    for (uint32_t done = 0; done < len; done += LOG_CHUNK) {
+        uint32_t n = len - done;
+        if (n > LOG_CHUNK) n = LOG_CHUNK;
+        if (dev->read(dev, block, data_pos + done, chunk, n) < 0 ||
+            ramfs_write(fd, chunk, n) != (int)n) {
+            ramfs_close(fd);
+            return -1;
+        }
+    }
+
+    ramfs_close(fd);
+    return 0;
+}
+
+static void replay_record(uint32_t block, uint32_t data_pos, const log_rec_hdr_t* hdr) {
+    char name[LOG_NAME_LEN];
+    char name2[LOG_NAME_LEN];
+    uint32_t value;
+
+    if (hdr->len < LOG_NAME_LEN) return;
+    dev->read(dev, block, data_pos, name, LOG_NAME_LEN);
+    name[LOG_NAME_LEN - 1] = '\0';
+
+    switch (hdr->type) {
+        case LOG_REC_FILE:
+            replay_data(block, data_pos + LOG_NAME_LEN, name, 0,
+                        hdr->len - LOG_NAME_LEN, RAMFS_O_TRUNC);
+            break;
+        case LOG_REC_WRITE:
+            dev->read(dev, block, data_pos + LOG_NAME_LEN, &value, 4);
+            replay_data(block, data_pos + LOG_NAME_LEN + 4, name, value,
+                        hdr->len - LOG_NAME_LEN - 4, 0);
+            break;
+        case LOG_REC_TRUNC:
+            dev->read(dev, block, data_pos + LOG_NAME_LEN, &value, 4);
+            if (value == 0) {
+                int fd = ramfs_open(name, RAMFS_O_CREAT | RAMFS_O_WRONLY | RAMFS_O_TRUNC);
+                if (fd >= 0) ramfs_close(fd);
+            } else {
+                ramfs_truncate(name, value);
+            }
+            break;
+        case LOG_REC_DELETE:
+            if (ramfs_delete(name) < 0) {
+                ramfs_rmdir(name);
+            }
+            break;
+        case LOG_REC_RENAME:
+            dev->read(dev, block, data_pos + LOG_NAME_LEN, name2, LOG_NAME_LEN);
+            name2[LOG_NAME_LEN - 1] = '\0';
+            ramfs_rename(name, name2);
+            break;
+        case LOG_REC_MKDIR:
+            ramfs_mkdir(name);
+            break;
+        case LOG_REC_ATTR:
+            dev->read(dev, block, data_pos + LOG_NAME_LEN, &value, 4);
+            ramfs_set_compress(name, (value & RAMFS_ATTR_COMPRESS) ? 1 : 0);
+            break;
+        default:
+            break;
+    }
+}
+
+static int is_erased(const void* data, uint32_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (uint32_t i = 0; i < len; i++) {
+        if (p[i] != 0xFF) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Recorrer una región.
+ * @param apply 1 para aplicar los registros a RAMFS, 0 solo para validar.
+ * @param end Offset del primer byte libre (salida).
+ * @param clean 0 si se encontró una cabecera dañada (salida).
+ * @return 1 si la región tiene un CKPT confirmado, 0 si no.
+ */
+static int scan_region(uint32_t block, int apply, uint32_t* end, uint32_t* snapshot_end, int* clean) {
+    log_rec_hdr_t hdr;
+    uint32_t pos = LOG_DATA_START;
+    int has_ckpt = 0;
+
+    *clean = 1;
+    *snapshot_end = 0;
+
+    while (pos + sizeof(hdr) <= dev->block_size) {
+        if (dev->read(dev, block, pos, &hdr, sizeof(hdr)) < 0) {
+            *clean = 0;
+            break;
+        }
+
+        // Fin del log: cabecera todavía borrada
+        if (is_erased(&hdr, sizeof(hdr))) break;
+
+        if (hdr.magic != LOG_REC_MAGIC ||
+            hdr.hdr_crc != crc32_update(0, &hdr, 12) ||
+            pos + record_size(hdr.len) > dev->block_size) {
+            *clean = 0;  // Cabecera a medio programar
+            break;
+        }
+
+        uint32_t data_pos = pos + sizeof(hdr);
+
+        if (hdr.commit == LOG_COMMITTED && payload_crc_ok(block, data_pos, &hdr)) {
+            if (hdr.type == LOG_REC_CKPT) {
+                has_ckpt = 1;
+                *snapshot_end = pos + record_size(hdr.len);
+            } else if (apply) {
+                replay_record(block, data_pos, &hdr);
+                stats.records_replayed++;
+            }
+        } else if (apply) {
+            stats.records_skipped++;  // Corte antes del commit: se ignora
+        }
+
+        pos += record_size(hdr.len);
+    }
+
+    *end = pos;
+    return has_ckpt;
+}
+
+static int read_region(uint32_t block, uint32_t* gen) {
+    log_region_hdr_t region;
+    if (dev->read(dev, block, 0, &region, sizeof(region)) < 0) return 0;
+    if (region.magic != LOG_REGION_MAGIC) return 0;
+    if (region.crc != crc32_update(0, &region, 8)) return 0;
+    *gen = region.generation;
+    return 1;
+}
+
+/* ========================================================================== */
+/*                          API PÚBLICA                                       */
+/* ========================================================================== */
+
+static uint32_t cycles(void) {
+#ifdef DAOS_HOST
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000ull * CYCLES_US + ts.tv_nsec * CYCLES_US / 1000);
+#else
+    return DWT_CYCCNT;
+#endif
+}
+
+int ramfs_log_mount(const blockdev_t* bd) {
+    uint32_t start = cycles();
+    uint32_t gens[2];
+    int valid[2];
+    uint32_t end, snap_end;
+    int clean;
+
+    if (!bd || bd->block_count < 2) return -1;
+
+    dev = bd;
+    mounted = 0;
+    compact_pending = 0;
+    append_blocked = 0;
+    memset(&stats, 0, sizeof(stats));
+
+    // Elegir la región de mayor generación que tenga un checkpoint completo
+    for (uint32_t b = 0; b < 2; b++) {
+        valid[b] = read_region(b, &gens[b]) && scan_region(b, 0, &end, &snap_end, &clean);
+    }
+
+    int chosen = -1;
+    if (valid[0] && valid[1]) {
+        chosen = ((int32_t)(gens[1] - gens[0]) > 0) ? 1 : 0;
+    } else if (valid[0]) {
+        chosen = 0;
+    } else if (valid[1]) {
+        chosen = 1;
+    }
+
+    if (chosen < 0) {
+        // Medio vacío o sin región válida: formatear con el contenido actual
+        uart_puts("[RAMFS-LOG] No valid log, formatting\r\n");
+        generation = 0;
+        if (write_checkpoint(0, 1) < 0) {
+            dev = NULL;
+            return -1;
+        }
+    } else {
+        active_block = (uint32_t)chosen;
+        generation = gens[chosen];
+
+        ramfs_set_journal(NULL);
+        ramfs_init();
+        replaying = 1;
+        scan_region(active_block, 1, &write_pos, &ckpt_end, &clean);
+        replaying = 0;
+
+        mounted = 1;
+        if (!clean) {
+            // Cabecera dañada al final: no se puede seguir agregando detrás
+            ramfs_log_compact();
+        }
+    }
+
+    mounted = 1;
+    ramfs_set_journal(&log_journal);
+
+    stats.mount_us = (cycles() - start) / CYCLES_US;
+
+    uart_puts("[RAMFS-LOG] Mounted gen ");
+    uart_putint(generation);
+    uart_puts(", ");
+    uart_putint(stats.records_replayed);
+    uart_puts(" records replayed\r\n");
+    return 0;
+}
+
+void ramfs_log_unmount(void) {
+    if (!mounted) return;
+    ramfs_set_journal(NULL);
+    if (dev->sync) dev->sync(dev);
+    mounted = 0;
+}
+
+int ramfs_log_is_mounted(void) {
+    return mounted;
+}
+
+void ramfs_log_get_stats(ramfs_log_stats_t* out) {
+    if (!out) return;
+    *out = stats;
+    out->generation = generation;
+    out->active_block = active_block;
+    out->used_bytes = mounted ? write_pos : 0;
+    out->snapshot_bytes = mounted ? ckpt_end : 0;
+}
@@ -0,0 +1,254 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Rasterizado por tramos
+ * ============================================================================
+ * Ver raster.h. Las cuentas van en 32 bits: las coordenadas de 16 bits con
+ * signo más un radio no desbordan.
+ * ============================================================================
+ */
+
+#include "raster.h"
+
+/* ========================================================================== */
+/*                          RECORTE                                           */
+/* ========================================================================== */
+
+/** Enviar el rectángulo de esquinas (x0, y0) y (x1, y1), incluidas. */
+static void emit(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, raster_fn fn) {
+    int32_t t;
+
+    if (x0 > x1) { t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { t = y0; y0 = y1; y1 = t; }
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= SCREEN_WIDTH) x1 = SCREEN_WIDTH - 1;
+    if (y1 >= SCREEN_HEIGHT) y1 = SCREEN_HEIGHT - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    fn(x0, y0, x1 - x0 + 1, y1 - y0 + 1, color);
+}
+
+/* ========================================================================== */
+/*                          ARCOS                                             */
+/* ========================================================================== */
+
+/*
+ * Un círculo es un rectángulo redondeado sin lados: los cuatro cuartos se
+ * dibujan alrededor de centros distintos (cxl/cxr a izquierda y derecha,
+ * cyt/cyb arriba y abajo) y los tramos que tocan el eje unen los cuartos,
+ * así que los lados rectos salen solos.
+ */
+
+/**
+ * Contorno: el recorrido de punto medio de pantalla_draw_circle. Los pasos
+ * seguidos con la misma x forman un tramo vertical en cuatro octantes y uno
+ * horizontal en los otros cuatro.
+ */
+static void arcs(int32_t cxl, int32_t cxr, int32_t cyt, int32_t cyb, int32_t r, uint16_t color, raster_fn fn) {
+    int32_t x = r;
+    int32_t y = 0;
+    int32_t err = 0;
+
+    while (x >= y) {
+        int32_t rx = x;
+        int32_t ys = y;
+        int32_t ye;
+
+        do {
+            ye = y;
+            if (err <= 0) {
+                y += 1;
+                err += 2*y + 1;
+            }
+            if (err > 0) {
+                x -= 1;
+                err -= 2*x + 1;
+            }
+        } while (x == rx && x >= y);
+
+        if (ys == 0) {
+            // Sobre el eje: arriba y abajo (o izquierda y derecha) en uno
+            emit(cxr + rx, cyt - ye, cxr + rx, cyb + ye, color, fn);
+            emit(cxl - rx, cyt - ye, cxl - rx, cyb + ye, color, fn);
+            emit(cxl - ye, cyb + rx, cxr + ye, cyb + rx, color, fn);
+            emit(cxl - ye, cyt - rx, cxr + ye, cyt - rx, color, fn);
+        } else {
+            emit(cxr + rx, cyb + ys, cxr + rx, cyb + ye, color, fn);
+            emit(cxl - rx, cyb + ys, cxl - rx, cyb + ye, color, fn);
+            emit(cxl - rx, cyt - ye, cxl - rx, cyt - ys, color, fn);
+            emit(cxr + rx, cyt - ye, cxr + rx, cyt - ys, color, fn);
+            emit(cxr + ys, cyb + rx, cxr + ye, cyb + rx, color, fn);
+            emit(cxl - ye, cyb + rx, cxl - ys, cyb + rx, color, fn);
+            emit(cxl - ye, cyt - rx, cxl - ys, cyt - rx, color, fn);
+            emit(cxr + ys, cyt - rx, cxr + ye, cyt - rx, color, fn);
+        }
+    }
+}
+
+/**
+ * Relleno: en la fila dy, los dx con dx*dx + dy*dy <= r*r. Las filas
+ * seguidas con el mismo dx van en un solo rectángulo.
+ */
+static void discs(int32_t cxl, int32_t cxr, int32_t cyt, int32_t cyb, int32_t r, uint16_t color, raster_fn fn) {
+    int32_t rr = r * r;
+    int32_t dx = r;
+    int32_t dy = 0;
+
+    while (dy <= r) {
+        int32_t first = dy;
+
+        while (dx * dx + dy * dy > rr) dx--;
+        while (dy < r && dx * dx + (dy + 1) * (dy + 1) <= rr) dy++;
+
+        if (first == 0) {
+            // La banda del centro (y el rectángulo entre los centros)
+            emit(cxl - dx, cyt - dy, cxr + dx, cyb + dy, color, fn);
+        } else {
+            emit(cxl - dx, cyb + first, cxr + dx, cyb + dy, color, fn);
+            emit(cxl - dx, cyt - dy, cxr + dx, cyt - first, color, fn);
+        }
+        dy++;
+    }
+}
+
+void raster_circle(int16_t x0, int16_t y0, int16_t r, uint16_t color, uint8_t filled, raster_fn fn) {
+    if (r < 0) return;
+
+    if (filled) {
+        discs(x0, x0, y0, y0, r, color, fn);
+    } else {
+        arcs(x0, x0, y0, y0, r, color, fn);
+    }
+}
+
+void raster_round_rect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color, uint8_t filled, raster_fn fn) {
+    int32_t max_r;
+
+    if (w <= 0 || h <= 0) return;
+    max_r = ((w < h) ? w - 1 : h - 1) / 2;
+    if (r < 0) r = 0;
+    if (r > max_r) r = max_r;
+
+    if (filled) {
+        discs(x + r, x + w - 1 - r, y + r, y + h - 1 - r, r, color, fn);
+    } else {
+        arcs(x + r, x + w - 1 - r, y + r, y + h - 1 - r, r, color, fn);
+    }
+}
+
+/* ========================================================================== */
+/*                          LÍNEAS Y TRIÁNGULOS                               */
+/* ========================================================================== */
+
+/** Recibe un tramo sin recortar (esquinas incluidas). */
+typedef void (*run_fn)(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, raster_fn fn);
+
+/**
+ * Bresenham por tramos: una línea más ancha que alta avanza en tramos
+ * horizontales (y al revés); el tramo se cierra cuando cambia la otra
+ * coordenada.
+ */
+static void line_runs(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, run_fn run, raster_fn fn) {
+    int32_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    int32_t dy = (y1 > y0) ? y0 - y1 : y1 - y0;   // Negativo
+    int32_t sx = (x0 < x1) ? 1 : -1;
+    int32_t sy = (y0 < y1) ? 1 : -1;
+    int32_t err = dx + dy;
+    int32_t x = x0, y = y0;
+    int32_t rx = x0, ry = y0;                     // Principio del tramo
+    uint8_t horizontal = dx >= -dy;
+
+    while (x != x1 || y != y1) {
+        int32_t e2 = 2 * err;
+        int32_t nx = x, ny = y;
+
+        if (e2 >= dy) {
+            err += dy;
+            nx += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            ny += sy;
+        }
+
+        if (horizontal ? ny != ry : nx != rx) {
+            run(rx, ry, x, y, color, fn);
+            rx = nx;
+            ry = ny;
+        }
+        x = nx;
+        y = ny;
+    }
+    run(rx, ry, x, y, color, fn);
+}
+
+void raster_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color, raster_fn fn) {
+    line_runs(x0, y0, x1, y1, color, emit, fn);
+}
+
+// Extremos de cada fila de la pantalla que tocan los lados del triángulo.
+// Se guardan sin recortar (limitados a -1 y SCREEN_WIDTH): un lado fuera
+// de la pantalla sigue marcando dónde empieza la fila
+static int16_t row_min[SCREEN_HEIGHT];
+static int16_t row_max[SCREEN_HEIGHT];
+
+static void extent(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, raster_fn fn) {
+    int32_t t;
+
+    (void)color;
+    (void)fn;
+    if (x0 > x1) { t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { t = y0; y0 = y1; y1 = t; }
+    if (x0 < -1) x0 = -1;
+    if (x0 > SCREEN_WIDTH) x0 = SCREEN_WIDTH;
+    if (x1 < -1) x1 = -1;
+    if (x1 > SCREEN_WIDTH) x1 = SCREEN_WIDTH;
+    if (y0 < 0) y0 = 0;
+    if (y1 >= SCREEN_HEIGHT) y1 = SCREEN_HEIGHT - 1;
+
+    for (int32_t y = y0; y <= y1; y++) {
+        if (x0 < row_min[y]) row_min[y] = x0;
+        if (x1 > row_max[y]) row_max[y] = x1;
+    }
+}
+
+void raster_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color, uint8_t filled, raster_fn fn) {
+    int32_t top, bottom;
+
+    if (!filled) {
+        raster_line(x0, y0, x1, y1, color, fn);
+        raster_line(x1, y1, x2, y2, color, fn);
+        raster_line(x2, y2, x0, y0, color, fn);
+        return;
+    }
+
+    top = y0;
+    bottom = y0;
+    if (y1 < top) top = y1;
+    if (y2 < top) top = y2;
+    if (y1 > bottom) bottom = y1;
+    if (y2 > bottom) bottom = y2;
+    if (top < 0) top = 0;
+    if (bottom >= SCREEN_HEIGHT) bottom = SCREEN_HEIGHT - 1;
+    if (top > bottom) return;
+
+    // El triángulo es convexo: cada fila va del píxel más a la izquierda
+    // de sus lados al más a la derecha, así el relleno cubre el contorno
+    for (int32_t y = top; y <= bottom; y++) {
+        row_min[y] = SCREEN_WIDTH;
+        row_max[y] = -1;
+    }
+    line_runs(x0, y0, x1, y1, color, extent, fn);
+    line_runs(x1, y1, x2, y2, color, extent, fn);
+    line_runs(x2, y2, x0, y0, color, extent, fn);
+
+    for (int32_t y = top; y <= bottom; y++) {
+        int32_t first = y;
+
+        // Las filas seguidas con los mismos extremos van juntas
+        while (y < bottom && row_min[y + 1] == row_min[first] && row_max[y + 1] == row_max[first]) y++;
+        if (row_min[first] <= row_max[first]) {
+            emit(row_min[first], first, row_max[first], y, color, fn);
+        }
+    }
+}
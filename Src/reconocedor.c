@@ -1,5 +1,6 @@
 #include "reconocedor.h"
 #include "api.h"
+#include "sprites_reconocedor.h"  // Sprites 2D generados desde assets/reconocedor.sprites
 #include "sync.h"
 #include <stdint.h>
 
@@ -16,7 +17,6 @@
 // CONSTANTES GLOBALES
 // ========================================================================
 #define TILE_SIZE 16
-#define TILE_DATA_SIZE 10
 #define MAP_WIDTH 19
 #define MAP_HEIGHT 14
 #define MAP_OFFSET_X 8
@@ -117,100 +117,6 @@ typedef struct {
 #define COLOR_GREEN       0x07E0
 #define COLOR_GRAY        0xAD55
 
-// ========================================================================
-// SPRITES 2D (10x10 pixels)
-// ========================================================================
-static const uint32_t sprite_pared_azul[100] = {
-	0xff4930b0, 0xff23b6ce, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff4930b0,
-	0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff7058d1,
-	0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff7058d1,
-	0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff7058d1,
-	0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff23b6ce,
-	0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff23b6ce, 0xff4930b0, 0xff4930b0, 0xff23b6ce, 0xff4930b0, 0xff4930b0, 0xff23b6ce,
-	0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff23b6ce, 0xff4930b0, 0xff4930b0, 0xff23b6ce, 0xff4930b0, 0xff4930b0, 0xff23b6ce,
-	0xff7058d1, 0xff4930b0, 0xff4930b0, 0xff23b6ce, 0xff4930b0, 0xff4930b0, 0xff23b6ce, 0xff4930b0, 0xff4930b0, 0xff23b6ce,
-	0xff23b6ce, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff4930b0, 0xff23b6ce,
-	0xff4930b0, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff7058d1, 0xff23b6ce, 0xff4930b0
-};
-
-static const uint32_t sprite_pared_verde[100] = {
-	0xff30b030, 0xff33ce23, 0xff58d168, 0xff58d168, 0xff58d168, 0xff58d168, 0xff58d168, 0xff58d168, 0xff58d168, 0xff30b030,
-	0xff58d168, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff58d168,
-	0xff58d168, 0xff30b030, 0xff30b030, 0xff58d168, 0xff30b030, 0xff30b030, 0xff58d168, 0xff30b030, 0xff30b030, 0xff58d168,
-	0xff58d168, 0xff30b030, 0xff30b030, 0xff58d168, 0xff30b030, 0xff30b030, 0xff58d168, 0xff30b030, 0xff30b030, 0xff58d168,
-	0xff58d168, 0xff30b030, 0xff30b030, 0xff58d168, 0xff30b030, 0xff30b030, 0xff58d168, 0xff30b030, 0xff30b030, 0xff33ce23,
-	0xff58d168, 0xff30b030, 0xff30b030, 0xff33ce23, 0xff30b030, 0xff30b030, 0xff33ce23, 0xff30b030, 0xff30b030, 0xff33ce23,
-	0xff58d168, 0xff30b030, 0xff30b030, 0xff33ce23, 0xff30b030, 0xff30b030, 0xff33ce23, 0xff30b030, 0xff30b030, 0xff33ce23,
-	0xff58d168, 0xff30b030, 0xff30b030, 0xff33ce23, 0xff30b030, 0xff30b030, 0xff33ce23, 0xff30b030, 0xff30b030, 0xff33ce23,
-	0xff33ce23, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff30b030, 0xff33ce23,
-	0xff30b030, 0xff58d168, 0xff58d168, 0xff58d168, 0xff58d168, 0xff58d168, 0xff58d168, 0xff58d168, 0xff33ce23, 0xff30b030
-};
-
-static const uint32_t sprite_pared_amarilla[100] = {
-	0xffa7b030, 0xffc1ce23, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffa7b030,
-	0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffd1c558,
-	0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffd1c558,
-	0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffd1c558,
-	0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffc1ce23,
-	0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffc1ce23, 0xffa7b030, 0xffa7b030, 0xffc1ce23, 0xffa7b030, 0xffa7b030, 0xffc1ce23,
-	0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffc1ce23, 0xffa7b030, 0xffa7b030, 0xffc1ce23, 0xffa7b030, 0xffa7b030, 0xffc1ce23,
-	0xffd1c558, 0xffa7b030, 0xffa7b030, 0xffc1ce23, 0xffa7b030, 0xffa7b030, 0xffc1ce23, 0xffa7b030, 0xffa7b030, 0xffc1ce23,
-	0xffc1ce23, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffa7b030, 0xffc1ce23,
-	0xffa7b030, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffd1c558, 0xffc1ce23, 0xffa7b030
-};
-
-static const uint32_t sprite_caja[100] = {
-	0xffa65701, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xffa65701,
-	0xff7e4c15, 0xff7e4c15, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xff7e4c15,
-	0x00000000, 0xffa65701, 0xffe08b2f, 0xffa65701, 0xffe08b2f, 0xffe08b2f, 0xffa65701, 0xffe08b2f, 0xffa65701, 0x00000000,
-	0x00000000, 0xff7e4c15, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffa65701, 0x00000000,
-	0x00000000, 0xff7e4c15, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffa65701, 0x00000000,
-	0x00000000, 0xff7e4c15, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffa65701, 0x00000000,
-	0x00000000, 0xff7e4c15, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffa65701, 0x00000000,
-	0x00000000, 0xff7e4c15, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffe08b2f, 0xff7e4c15, 0xffe08b2f, 0xffa65701, 0x00000000,
-	0xffa65701, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xff7e4c15, 0xffa65701,
-	0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701, 0xffa65701
-};
-
-static const uint32_t sprite_jugador[100] = {
-	0x00000000, 0xff24a4b9, 0xffb9b9b9, 0xff24a4b9, 0xffb9b9b9, 0xffb9b9b9, 0xff24a4b9, 0xffb9b9b9, 0xff24a4b9, 0x00000000,
-	0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9,
-	0xffb9b9b9, 0xff24a4b9, 0xff24a4b9, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0xff24a4b9, 0xff24a4b9, 0xffb9b9b9,
-	0xffb9b9b9, 0xff24a4b9, 0xffb9b9b9, 0xff202020, 0xffb9b9b9, 0xffb9b9b9, 0xff202020, 0xffb9b9b9, 0xff24a4b9, 0xffb9b9b9,
-	0xff24a4b9, 0xff24a4b9, 0xffb9b9b9, 0xff202020, 0xffb9b9b9, 0xffb9b9b9, 0xff202020, 0xffb9b9b9, 0xff24a4b9, 0xff24a4b9,
-	0x00000000, 0xff24a4b9, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0xff24a4b9, 0x00000000,
-	0x00000000, 0x00000000, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0xffb9b9b9, 0x00000000, 0x00000000,
-	0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xffb9b9b9, 0xff24a4b9, 0xff24a4b9, 0xffb9b9b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9,
-	0xffb9b9b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xffb9b9b9, 0xffb9b9b9, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0xffb9b9b9,
-	0x00000000, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0x00000000, 0x00000000, 0xff24a4b9, 0xff24a4b9, 0xff24a4b9, 0x00000000
-};
-
-static const uint32_t sprite_maniqui_1[100] = {
-	0x00000000, 0xff000000, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xff000000, 0x00000000,
-	0xff000000, 0xffffe608, 0xffffe608, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xffffe608, 0xffffe608, 0xff000000,
-	0xff000000, 0xff000000, 0xffffe608, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xffffe608, 0xff000000, 0xff000000,
-	0xff000000, 0xff000000, 0xffffe608, 0xff000000, 0xff252525, 0xff252525, 0xff000000, 0xffffe608, 0xff000000, 0xff000000,
-	0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff252525, 0xff252525, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-	0x00000000, 0xff000000, 0xff000000, 0xffffe608, 0xff000000, 0xff000000, 0xffffe608, 0xff000000, 0xff000000, 0x00000000,
-	0x00000000, 0x00000000, 0xff252525, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff252525, 0x00000000, 0x00000000,
-	0xff000000, 0xffffe608, 0xff252525, 0xffffe608, 0xff252525, 0xff252525, 0xffffe608, 0xff252525, 0xffffe608, 0xff000000,
-	0xff252525, 0xff000000, 0xff000000, 0xffffe608, 0xff000000, 0xff000000, 0xffffe608, 0xff000000, 0xff000000, 0xff252525,
-	0x00000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000
-};
-
-static const uint32_t sprite_maniqui_2[100] = {
-	0x00000000, 0xff000000, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xff000000, 0x00000000,
-	0xff000000, 0xffff0000, 0xffff0000, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xffff0000, 0xffff0000, 0xff000000,
-	0xff000000, 0xff000000, 0xffff0000, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xffff0000, 0xff000000, 0xff000000,
-	0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff252525, 0xff252525, 0xff000000, 0xffff0000, 0xff000000, 0xff000000,
-	0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff252525, 0xff252525, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
-	0x00000000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0x00000000,
-	0x00000000, 0x00000000, 0xff252525, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff252525, 0x00000000, 0x00000000,
-	0xff000000, 0xffff0000, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xff252525, 0xffff0000, 0xff000000,
-	0xff252525, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff252525,
-	0x00000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000, 0x00000000, 0xff000000, 0xff000000, 0xff000000, 0x00000000
-};
-
 // Textura 3D para cajas (10x10 - conversión RGB565)
 static const uint16_t textura_caja_3d[100] = {
 	0xD2E0, 0xA260, 0xA260, 0xA260, 0xA260, 0xA260, 0xA260, 0xA260, 0xA260, 0xD2E0,
@@ -278,8 +184,8 @@ static void generar_mapa_laberinto(void);
 static void fase_2d_render(void);
 static void fase_3d_render(void);
 static void init_ray_table_3d(void);
-static void draw_tile(uint8_t x, uint8_t y, const uint32_t* sprite_data);
-static void draw_tile_rotated(uint8_t x, uint8_t y, const uint32_t* sprite_data, Direccion dir);
+static void draw_tile(uint8_t x, uint8_t y, const daos_sprite_t* sprite);
+static void draw_tile_rotated(uint8_t x, uint8_t y, const daos_sprite_t* sprite, Direccion dir);
 static void redraw_tile_content(uint8_t x, uint8_t y);
 
 // ========================================================================
@@ -471,108 +377,29 @@ static void draw_vertical_line(int16_t x, int16_t y0, int16_t y1, uint16_t color
 	}
 }
 
-static void draw_tile(uint8_t x, uint8_t y, const uint32_t* sprite_data) {
+static void draw_tile(uint8_t x, uint8_t y, const daos_sprite_t* sprite) {
 	int16_t screen_x = (x * TILE_SIZE) + MAP_OFFSET_X;
 	int16_t screen_y = (y * TILE_SIZE) + MAP_OFFSET_Y;
-
-	for (uint8_t row = 0; row < TILE_SIZE; row++) {
-		for (uint8_t col = 0; col < TILE_SIZE; col++) {
-			uint8_t mapped_row = (row * TILE_DATA_SIZE) / TILE_SIZE;
-			uint8_t mapped_col = (col * TILE_DATA_SIZE) / TILE_SIZE;
-
-			if (mapped_row >= TILE_DATA_SIZE) mapped_row = TILE_DATA_SIZE - 1;
-			if (mapped_col >= TILE_DATA_SIZE) mapped_col = TILE_DATA_SIZE - 1;
-
-			uint32_t color_32bit = sprite_data[mapped_row * TILE_DATA_SIZE + mapped_col];
-
-			if ((color_32bit >> 24) != 0x00) {
-				uint8_t r = (color_32bit >> 16) & 0xFF;
-				uint8_t g = (color_32bit >> 8) & 0xFF;
-				uint8_t b = color_32bit & 0xFF;
-				uint16_t color_16bit = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-
-				int16_t pixel_x = screen_x + col;
-				int16_t pixel_y = screen_y + row;
-
-				if (pixel_x >= 0 && pixel_x < 320 && pixel_y >= 0 && pixel_y < 240) {
-					daos_gfx_draw_pixel(pixel_x, pixel_y, color_16bit);
-				}
-			}
-		}
-	}
+	daos_gfx_draw_sprite(screen_x, screen_y, sprite);
 }
 
-static void draw_tile_rotated(uint8_t x, uint8_t y, const uint32_t* sprite_data, Direccion dir) {
-	int16_t screen_x = (x * TILE_SIZE) + MAP_OFFSET_X;
-	int16_t screen_y = (y * TILE_SIZE) + MAP_OFFSET_Y;
-
-	for (uint8_t row = 0; row < TILE_SIZE; row++) {
-		for (uint8_t col = 0; col < TILE_SIZE; col++) {
-			uint8_t data_row, data_col;
-			uint8_t mapped_row = (row * TILE_DATA_SIZE) / TILE_SIZE;
-			uint8_t mapped_col = (col * TILE_DATA_SIZE) / TILE_SIZE;
-
-			if (mapped_row >= TILE_DATA_SIZE) mapped_row = TILE_DATA_SIZE - 1;
-			if (mapped_col >= TILE_DATA_SIZE) mapped_col = TILE_DATA_SIZE - 1;
-
-			switch(dir) {
-				case DIR_UP:
-					data_row = mapped_row;
-					data_col = mapped_col;
-					break;
-				case DIR_RIGHT:
-					data_row = (TILE_DATA_SIZE - 1) - mapped_col;
-					data_col = mapped_row;
-					break;
-				case DIR_DOWN:
-					data_row = (TILE_DATA_SIZE - 1) - mapped_row;
-					data_col = (TILE_DATA_SIZE - 1) - mapped_col;
-					break;
-				case DIR_LEFT:
-					data_row = mapped_col;
-					data_col = (TILE_DATA_SIZE - 1) - mapped_row;
-					break;
-			}
-
-			uint32_t color_32bit = sprite_data[data_row * TILE_DATA_SIZE + data_col];
-
-			if ((color_32bit >> 24) != 0x00) {
-				uint8_t r = (color_32bit >> 16) & 0xFF;
-				uint8_t g = (color_32bit >> 8) & 0xFF;
-				uint8_t b = color_32bit & 0xFF;
-				uint16_t color_16bit = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-
-				int16_t pixel_x = screen_x + col;
-				int16_t pixel_y = screen_y + row;
-
-				if (pixel_x >= 0 && pixel_x < 320 && pixel_y >= 0 && pixel_y < 240) {
-					daos_gfx_draw_pixel(pixel_x, pixel_y, color_16bit);
-				}
-			}
-		}
-	}
+// sprite: las cuatro orientaciones, indexadas por Direccion
+static void draw_tile_rotated(uint8_t x, uint8_t y, const daos_sprite_t* sprite, Direccion dir) {
+	draw_tile(x, y, &sprite[dir]);
 }
 
 static void draw_tile_centro(uint8_t x, uint8_t y) {
 	int16_t screen_x = (x * TILE_SIZE) + MAP_OFFSET_X;
 	int16_t screen_y = (y * TILE_SIZE) + MAP_OFFSET_Y;
 	daos_gfx_fill_rect(screen_x, screen_y, TILE_SIZE, TILE_SIZE, COLOR_BLACK);
-	for (uint8_t row = 3; row < TILE_SIZE-3; row++) {
-		for (uint8_t col = 3; col < TILE_SIZE-3; col++) {
-			daos_gfx_draw_pixel(screen_x + col, screen_y + row, COLOR_CYAN);
-		}
-	}
+	daos_gfx_fill_rect(screen_x + 3, screen_y + 3, TILE_SIZE - 6, TILE_SIZE - 6, COLOR_CYAN);
 }
 
 static void draw_tile_raiz(uint8_t x, uint8_t y) {
 	int16_t screen_x = (x * TILE_SIZE) + MAP_OFFSET_X;
 	int16_t screen_y = (y * TILE_SIZE) + MAP_OFFSET_Y;
 	daos_gfx_fill_rect(screen_x, screen_y, TILE_SIZE, TILE_SIZE, COLOR_BLACK);
-	for (uint8_t row = 6; row < TILE_SIZE-6; row++) {
-		for (uint8_t col = 6; col < TILE_SIZE-6; col++) {
-			daos_gfx_draw_pixel(screen_x + col, screen_y + row, COLOR_RED);
-		}
-	}
+	daos_gfx_fill_rect(screen_x + 6, screen_y + 6, TILE_SIZE - 12, TILE_SIZE - 12, COLOR_RED);
 }
 
 static void redraw_tile_content(uint8_t x, uint8_t y) {
@@ -587,16 +414,16 @@ static void redraw_tile_content(uint8_t x, uint8_t y) {
 
 	switch(tile) {
 		case TILE_PARED_AZUL:
-			draw_tile(x, y, sprite_pared_azul);
+			draw_tile(x, y, &sprite_pared_azul);
 			break;
 		case TILE_PARED_VERDE:
-			draw_tile(x, y, sprite_pared_verde);
+			draw_tile(x, y, &sprite_pared_verde);
 			break;
 		case TILE_PARED_AMARILLA:
-			draw_tile(x, y, sprite_pared_amarilla);
+			draw_tile(x, y, &sprite_pared_amarilla);
 			break;
 		case TILE_CAJA:
-			draw_tile(x, y, sprite_caja);
+			draw_tile(x, y, &sprite_caja);
 			break;
 		case TILE_CENTRO:
 			draw_tile_centro(x, y);
@@ -1138,16 +965,16 @@ static void fase_2d_render(void) {
 
 				switch(tile) {
 					case TILE_PARED_AZUL:
-						draw_tile(x, y, sprite_pared_azul);
+						draw_tile(x, y, &sprite_pared_azul);
 						break;
 					case TILE_PARED_VERDE:
-						draw_tile(x, y, sprite_pared_verde);
+						draw_tile(x, y, &sprite_pared_verde);
 						break;
 					case TILE_PARED_AMARILLA:
-						draw_tile(x, y, sprite_pared_amarilla);
+						draw_tile(x, y, &sprite_pared_amarilla);
 						break;
 					case TILE_CAJA:
-						draw_tile(x, y, sprite_caja);
+						draw_tile(x, y, &sprite_caja);
 						break;
 					case TILE_CENTRO:
 						draw_tile_centro(x, y);
@@ -1699,7 +1526,8 @@ void reconocedor_render_task(void) {
 		daos_gfx_draw_text(100, 145, buf, COLOR_WHITE, COLOR_RED);
 	}
 
-	daos_sleep_ms(50);
+	// Lo dibujado queda en la lista de pantalla hasta el próximo refresco
+	daos_sleep_ms(daos_gfx_present(50));
 }
 
 // ========================================================================
@@ -0,0 +1,686 @@
+// sd.c - Driver SPI de la tarjeta SD
+#include "sd.h"
+#include "uart.h"
+#include "sched.h"
+#include "spi_dma.h"
+#include <stddef.h>
+
+// Tokens del protocolo de datos
+#define SD_TOKEN_START       0xFE   // Inicio de bloque (CMD17/18/24)
+#define SD_TOKEN_MULTI_WRITE 0xFC   // Inicio de bloque en CMD25
+#define SD_TOKEN_STOP_TRAN   0xFD   // Fin de CMD25
+
+// Timeouts de la especificación (lectura 100 ms, escritura 250 ms SDSC / 500 ms SDHC,
+// inicialización con ACMD41 1 s)
+#define SD_READ_TIMEOUT_MS   100
+#define SD_WRITE_TIMEOUT_MS  500
+#define SD_INIT_TIMEOUT_MS   1000
+#define SD_ACMD41_POLL_MS    10          // Entre intentos de ACMD41 el bus queda libre
+
+// Arranque
+#define SD_CMD0_TRIES        10
+#define SD_R1_IDLE           0x01
+#define SD_R1_ILLEGAL_CMD    0x04
+#define SD_ACMD41_HCS        0x40000000  // El host acepta tarjetas de alta capacidad
+#define SD_OCR_CCS           0x40        // Bit 30 del OCR (primer byte): SDHC/SDXC
+#define SD_FAST_PRESCALER    1           // Tras el arranque: PCLK2 / 4 = 4 MHz
+
+// Integridad de datos
+#define SD_CRC_RETRIES       3           // Reintentos seguidos de un bloque con CRC incorrecto
+#define SD_DATA_ACCEPTED     0x05        // Respuesta de datos: aceptado
+#define SD_DATA_CRC_ERROR    0x0B        // Respuesta de datos: CRC incorrecto
+
+// Fases de sd_init_step
+enum {
+    INIT_IDLE,      // Sin arrancar (o terminado)
+    INIT_CMD0,
+    INIT_CMD8,
+    INIT_CMD59,
+    INIT_ACMD41,
+    INIT_CMD58,
+    INIT_CMD16,
+    INIT_DONE
+};
+
+// Resultado de una pasada de transferencia
+enum {
+    SD_XFER_OK,
+    SD_XFER_ERROR,  // Sin respuesta, timeout o rechazo: no se reintenta
+    SD_XFER_CRC     // CRC incorrecto: se repite desde el bloque fallido
+};
+
+#ifndef DAOS_HOST
+// Registros RCC y GPIO (SPI1 lo programa el bus, spi_dma.c)
+#define RCC_BASE        0x40023800
+#define GPIOA_BASE      0x40020000
+#define GPIOB_BASE      0x40020400
+
+#define RCC_AHB1ENR     (*(volatile uint32_t*)(RCC_BASE + 0x30))
+#define RCC_APB2ENR     (*(volatile uint32_t*)(RCC_BASE + 0x44))
+
+#define GPIOA_MODER     (*(volatile uint32_t*)(GPIOA_BASE + 0x00))
+#define GPIOA_OSPEEDR   (*(volatile uint32_t*)(GPIOA_BASE + 0x08))
+#define GPIOA_ODR       (*(volatile uint32_t*)(GPIOA_BASE + 0x14))
+
+#define GPIOB_MODER     (*(volatile uint32_t*)(GPIOB_BASE + 0x00))
+#define GPIOB_OSPEEDR   (*(volatile uint32_t*)(GPIOB_BASE + 0x08))
+#define GPIOB_PUPDR     (*(volatile uint32_t*)(GPIOB_BASE + 0x0C))
+#define GPIOB_AFRL      (*(volatile uint32_t*)(GPIOB_BASE + 0x20))
+#endif
+
+// Variables privadas
+static uint8_t sd_ready = 0;
+static uint8_t is_sdhc = 0;
+static sd_stats_t sd_stats;
+
+// Funciones privadas
+static void cs_high(void);
+static void cs_low(void);
+static uint8_t spi_transfer(uint8_t data);
+static void spi_read_start(uint8_t *buffer);
+static void spi_write_start(const uint8_t *buffer);
+static uint8_t spi_data_wait(void);
+static void spi_init(void);
+static void spi_set_speed(uint8_t divisor);
+static uint8_t sd_command(uint8_t cmd, uint32_t arg);
+static uint8_t sd_wait_ready(uint32_t timeout_ms);
+static uint8_t sd_wait_token(uint32_t timeout_ms);
+static void sd_release(void);
+
+// ==================== FUNCIONES AUXILIARES ====================
+
+#ifdef DAOS_HOST
+// En el host el bus lo maneja un simulador de tarjeta (byte a byte, como SPI)
+extern uint8_t sd_host_transfer(uint8_t data);
+extern void sd_host_select(uint8_t selected);
+
+static void cs_high(void) {
+    sd_host_select(0);
+}
+
+static void cs_low(void) {
+    sd_host_select(1);
+}
+
+static uint8_t spi_transfer(uint8_t data) {
+    return sd_host_transfer(data);
+}
+
+static void spi_init(void) {
+    cs_high();
+}
+
+static void spi_set_speed(uint8_t divisor) {
+    (void)divisor;
+}
+
+static void spi_read_start(uint8_t *buffer) {
+    for(int i = 0; i < SD_BLOCK_SIZE; i++) {
+        buffer[i] = spi_transfer(0xFF);
+    }
+}
+
+static void spi_write_start(const uint8_t *buffer) {
+    for(int i = 0; i < SD_BLOCK_SIZE; i++) {
+        spi_transfer(buffer[i]);
+    }
+}
+
+static uint8_t spi_data_wait(void) {
+    return 1;
+}
+#else
+static void sd_select(uint8_t active) {
+    if(active) {
+        GPIOA_ODR &= ~(1 << SD_CS_PIN);
+    } else {
+        GPIOA_ODR |= (1 << SD_CS_PIN);
+    }
+}
+
+// La SD arranca a /256 (< 400 kHz); sd_init_step sube la velocidad al final
+static const spi_bus_device_t sd_device = {
+    .name = "sd",
+    .prescaler = 7,
+    .mode = SPI_MODE0,
+    .select = sd_select,
+};
+static int sd_bus = -1;
+
+// Cada acceso a la tarjeta es una transacción del bus: al empezar se
+// aplica la velocidad de la SD y se suelta la pantalla
+static void cs_high(void) {
+    spi_bus_end(sd_bus);
+}
+
+static void cs_low(void) {
+    spi_bus_begin(sd_bus);
+}
+
+// Bytes sueltos por sondeo (espera a que el bus quede libre de DMA)
+static uint8_t spi_transfer(uint8_t data) {
+    return spi_dma_exchange(data);
+}
+
+// Bloques de datos completos por DMA. Se lanzan sin esperar: mientras el
+// DMA mueve un bloque la CPU calcula un CRC16
+static spi_dma_xfer_t data_xfer;
+
+static void spi_read_start(uint8_t *buffer) {
+    data_xfer.tx = NULL;
+    data_xfer.rx = buffer;
+    data_xfer.count = SD_BLOCK_SIZE;
+    spi_dma_submit(&data_xfer);
+}
+
+static void spi_write_start(const uint8_t *buffer) {
+    data_xfer.tx = buffer;
+    data_xfer.rx = NULL;
+    data_xfer.count = SD_BLOCK_SIZE;
+    spi_dma_submit(&data_xfer);
+}
+
+static uint8_t spi_data_wait(void) {
+    return spi_dma_wait(&data_xfer) == 0;
+}
+
+static void spi_init(void) {
+    // Habilitar clocks
+    RCC_AHB1ENR |= (1 << 0) | (1 << 1);
+    RCC_APB2ENR |= (1 << 12);
+
+    // PB3 - SCK, PB4 - MISO, PB5 - MOSI
+    GPIOB_MODER &= ~((3 << 6) | (3 << 8) | (3 << 10));
+    GPIOB_MODER |= (2 << 6) | (2 << 8) | (2 << 10);
+    GPIOB_AFRL &= ~((0xF << 12) | (0xF << 16) | (0xF << 20));
+    GPIOB_AFRL |= (5 << 12) | (5 << 16) | (5 << 20);
+    GPIOB_OSPEEDR |= (3 << 6) | (3 << 10);
+    GPIOB_PUPDR &= ~(3 << 8);
+    GPIOB_PUPDR |= (1 << 8);
+
+    // PA10 - CS
+    GPIOA_MODER &= ~(3 << (SD_CS_PIN * 2));
+    GPIOA_MODER |= (1 << (SD_CS_PIN * 2));
+    GPIOA_OSPEEDR |= (3 << (SD_CS_PIN * 2));
+
+    // Registrar la SD en el bus (velocidad lenta) y dejar SPI1 listo para
+    // los ciclos de arranque con CS alto
+    sd_bus = spi_bus_add(&sd_device);
+    cs_high();
+    spi_bus_use(sd_bus);
+}
+
+static void spi_set_speed(uint8_t divisor) {
+    spi_bus_set_prescaler(sd_bus, divisor);
+}
+#endif
+
+// ==================== CRC ====================
+//
+// Comandos: CRC7 (x^7 + x^3 + 1), 5 bytes por comando, bit a bit.
+// Datos: CRC16-CCITT (x^16 + x^12 + x^5 + 1, valor inicial 0), un byte por
+// paso con una tabla de 256 entradas en flash.
+
+static const uint16_t crc16_table[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+static uint8_t sd_crc7(const uint8_t *data, uint8_t len) {
+    uint8_t crc = 0;
+
+    for(uint8_t i = 0; i < len; i++) {
+        uint8_t byte = data[i];
+        for(uint8_t bit = 0; bit < 8; bit++) {
+            crc <<= 1;
+            if((byte ^ crc) & 0x80) crc ^= 0x09;
+            byte <<= 1;
+        }
+    }
+
+    return crc & 0x7F;
+}
+
+static uint16_t sd_crc16(const uint8_t *data, uint32_t len) {
+    uint16_t crc = 0;
+
+    for(uint32_t i = 0; i < len; i++) {
+        crc = (crc << 8) ^ crc16_table[(crc >> 8) ^ data[i]];
+    }
+
+    return crc;
+}
+
+// ==================== COMANDOS ====================
+
+static uint8_t sd_command(uint8_t cmd, uint32_t arg) {
+    uint8_t frame[6], response;
+
+    frame[0] = cmd | 0x40;
+    frame[1] = (arg >> 24) & 0xFF;
+    frame[2] = (arg >> 16) & 0xFF;
+    frame[3] = (arg >> 8) & 0xFF;
+    frame[4] = arg & 0xFF;
+    frame[5] = (sd_crc7(frame, 5) << 1) | 0x01;  // CRC7 + bit de fin
+
+    // Esperar SD lista. CMD12 se envía mientras la tarjeta aún transmite datos.
+    if(cmd != 12 && !sd_wait_ready(SD_WRITE_TIMEOUT_MS)) return 0xFF;
+
+    for(int i = 0; i < 6; i++) spi_transfer(frame[i]);
+
+    if(cmd == 12) spi_transfer(0xFF);  // Byte de relleno tras CMD12
+
+    // Esperar respuesta
+    for(int i = 0; i < 10; i++) {
+        response = spi_transfer(0xFF);
+        if(!(response & 0x80)) return response;
+    }
+
+    return 0xFF;
+}
+
+// ==================== INICIALIZACIÓN ====================
+//
+// Secuencia de la especificación (modo SPI), un comando por paso:
+//
+//   CMD0   -> R1 = 0x01 (idle). Se reintenta unas pocas veces.
+//   CMD8   -> R7 con el patrón 0x1AA: tarjeta v2. "Comando ilegal": v1.
+//   CMD59  -> activar la comprobación de CRC (comandos y datos).
+//   ACMD41 -> con HCS si es v2. Se repite hasta R1 = 0x00 o 1 segundo.
+//   CMD58  -> (v2) bit CCS del OCR: 1 = SDHC/SDXC (direcciones por bloque).
+//   CMD16  -> (SDSC) bloques de 512 bytes.
+//
+// Los plazos salen de millis(); no hay esperas fijas entre pasos.
+
+static uint8_t init_phase = INIT_IDLE;
+static uint8_t init_tries;
+static uint8_t init_v2;
+static uint32_t init_start;
+static uint32_t init_poll;
+
+// Comando de arranque en su propia transacción. Si la respuesta es R3/R7
+// (CMD58, CMD8) y extra no es NULL, lee sus 4 bytes.
+static uint8_t sd_init_command(uint8_t cmd, uint32_t arg, uint8_t *extra) {
+    uint8_t response;
+
+    cs_low();
+    response = sd_command(cmd, arg);
+    if(extra && response <= SD_R1_IDLE) {
+        for(int i = 0; i < 4; i++) extra[i] = spi_transfer(0xFF);
+    }
+    sd_release();
+    return response;
+}
+
+static sd_init_status_t sd_init_fail(const char *msg) {
+    uart_puts("SD: ");
+    uart_puts(msg);
+    uart_puts("\r\n");
+    init_phase = INIT_IDLE;
+    return SD_INIT_FAILED;
+}
+
+sd_init_status_t sd_init_step(void) {
+    uint8_t response;
+    uint8_t r7[4];
+
+    switch(init_phase) {
+    case INIT_IDLE:
+        if(sd_ready) return SD_INIT_OK;
+
+        // Bus a velocidad de arranque y >= 74 ciclos con CS alto
+        spi_init();
+        is_sdhc = 0;
+        init_tries = 0;
+        init_start = millis();
+        for(int i = 0; i < 10; i++) spi_transfer(0xFF);
+        init_phase = INIT_CMD0;
+        return SD_INIT_BUSY;
+
+    case INIT_CMD0:
+        if(sd_init_command(0, 0, NULL) == SD_R1_IDLE) {
+            init_phase = INIT_CMD8;
+        } else if(++init_tries >= SD_CMD0_TRIES) {
+            return sd_init_fail("no responde a CMD0");
+        }
+        return SD_INIT_BUSY;
+
+    case INIT_CMD8:
+        response = sd_init_command(8, 0x1AA, r7);
+        if(response == SD_R1_IDLE) {
+            // v2: debe devolver el voltaje aceptado y el patrón
+            if((r7[2] & 0x0F) != 0x01 || r7[3] != 0xAA) {
+                return sd_init_fail("CMD8 con patron incorrecto");
+            }
+            init_v2 = 1;
+        } else if(response & SD_R1_ILLEGAL_CMD) {
+            init_v2 = 0;  // SD v1: no conoce CMD8
+        } else {
+            return sd_init_fail("CMD8 fallo");
+        }
+        init_phase = INIT_CMD59;
+        return SD_INIT_BUSY;
+
+    case INIT_CMD59:
+        // Sin CRC la tarjeta funciona igual; las lecturas se siguen verificando
+        sd_stats.crc_enabled = (sd_init_command(59, 1, NULL) == SD_R1_IDLE);
+        if(!sd_stats.crc_enabled) uart_puts("SD: sin CRC en la tarjeta\r\n");
+
+        init_start = millis();
+        init_poll = init_start - SD_ACMD41_POLL_MS;
+        init_phase = INIT_ACMD41;
+        return SD_INIT_BUSY;
+
+    case INIT_ACMD41:
+        if(millis() - init_poll < SD_ACMD41_POLL_MS) return SD_INIT_BUSY;
+        init_poll = millis();
+
+        sd_init_command(55, 0, NULL);
+        response = sd_init_command(41, init_v2 ? SD_ACMD41_HCS : 0, NULL);
+        if(response == 0x00) {
+            init_phase = init_v2 ? INIT_CMD58 : INIT_CMD16;
+        } else if(response != SD_R1_IDLE) {
+            return sd_init_fail("ACMD41 rechazado");
+        } else if(millis() - init_start >= SD_INIT_TIMEOUT_MS) {
+            return sd_init_fail("timeout en ACMD41");
+        }
+        return SD_INIT_BUSY;
+
+    case INIT_CMD58:
+        if(sd_init_command(58, 0, r7) != 0x00) {
+            return sd_init_fail("CMD58 fallo");
+        }
+        is_sdhc = (r7[0] & SD_OCR_CCS) ? 1 : 0;
+        init_phase = is_sdhc ? INIT_DONE : INIT_CMD16;
+        return SD_INIT_BUSY;
+
+    case INIT_CMD16:
+        if(sd_init_command(16, SD_BLOCK_SIZE, NULL) != 0x00) {
+            return sd_init_fail("CMD16 fallo");
+        }
+        init_phase = INIT_DONE;
+        return SD_INIT_BUSY;
+
+    case INIT_DONE:
+    default:
+        spi_set_speed(SD_FAST_PRESCALER);
+        sd_ready = 1;
+        init_phase = INIT_IDLE;
+        if(is_sdhc) uart_puts("SD lista (SDHC)\r\n");
+        else uart_puts(init_v2 ? "SD lista (SDSC v2)\r\n" : "SD lista (SDSC v1)\r\n");
+        return SD_INIT_OK;
+    }
+}
+
+// ==================== FUNCIONES PÚBLICAS ====================
+
+uint8_t sd_init(void) {
+    sd_init_status_t status;
+
+    if(init_phase == INIT_IDLE) sd_ready = 0;  // Reinicializar siempre
+    while((status = sd_init_step()) == SD_INIT_BUSY);
+    return status == SD_INIT_OK;
+}
+
+// ==================== TRANSFERENCIAS DE DATOS ====================
+
+static uint8_t sd_wait_ready(uint32_t timeout_ms) {
+    uint32_t start = millis();
+
+    do {
+        if(spi_transfer(0xFF) == 0xFF) return 1;
+    } while(millis() - start < timeout_ms);
+
+    return 0;
+}
+
+static uint8_t sd_wait_token(uint32_t timeout_ms) {
+    uint32_t start = millis();
+    uint8_t token;
+
+    do {
+        token = spi_transfer(0xFF);
+        if(token != 0xFF) return token;
+    } while(millis() - start < timeout_ms);
+
+    return 0xFF;
+}
+
+static void sd_release(void) {
+    cs_high();
+    spi_transfer(0xFF);  // La tarjeta suelta MISO con un ciclo más
+}
+
+static uint32_t sd_address(uint32_t sector) {
+    return is_sdhc ? sector : (sector * SD_BLOCK_SIZE);
+}
+
+// Una pasada de lectura desde el bloque *done: CMD17 si queda uno solo,
+// CMD18 + CMD12 si quedan varios. Cada bloque va a buffer (si no es NULL)
+// o al callback; *done avanza con cada bloque verificado.
+static uint8_t sd_read_pass(uint32_t sector, uint32_t count, uint8_t *buffer,
+                            sd_block_cb_t cb, void *ctx, uint32_t *done) {
+    static uint8_t stream_buf[SD_BLOCK_SIZE];
+    uint8_t result = SD_XFER_OK;
+    uint8_t multi = (count - *done) > 1;
+    uint8_t *pending = NULL;  // Bloque recibido y aún sin verificar
+    uint16_t pending_crc = 0;
+    uint16_t crc;
+
+    cs_low();
+    if(sd_command(multi ? 18 : 17, sd_address(sector + *done)) != 0x00) {
+        sd_release();
+        return SD_XFER_ERROR;
+    }
+
+    for(uint32_t n = *done; n < count; n++) {
+        uint8_t *dst = buffer ? buffer + n * SD_BLOCK_SIZE : stream_buf;
+
+        if(sd_wait_token(SD_READ_TIMEOUT_MS) != SD_TOKEN_START) {
+            result = SD_XFER_ERROR;
+            break;
+        }
+
+        // Con buffer, el CRC del bloque anterior se calcula mientras llega este
+        spi_read_start(dst);
+        if(pending) {
+            if(sd_crc16(pending, SD_BLOCK_SIZE) != pending_crc) {
+                spi_data_wait();
+                result = SD_XFER_CRC;
+                break;
+            }
+            (*done)++;
+            pending = NULL;
+        }
+        if(!spi_data_wait()) {
+            result = SD_XFER_ERROR;
+            break;
+        }
+
+        crc = spi_transfer(0xFF) << 8;
+        crc |= spi_transfer(0xFF);
+
+        if(buffer) {
+            pending = dst;
+            pending_crc = crc;
+            continue;
+        }
+
+        // El callback solo recibe bloques verificados
+        if(sd_crc16(dst, SD_BLOCK_SIZE) != crc) {
+            result = SD_XFER_CRC;
+            break;
+        }
+        (*done)++;
+        if(cb && cb(n, dst, ctx) != 0) {
+            *done = count;  // El consumidor pidió parar
+            break;
+        }
+    }
+
+    if(pending && result == SD_XFER_OK) {
+        if(sd_crc16(pending, SD_BLOCK_SIZE) != pending_crc) {
+            result = SD_XFER_CRC;
+        } else {
+            (*done)++;
+        }
+    }
+
+    if(multi) {
+        sd_command(12, 0);
+        sd_wait_ready(SD_WRITE_TIMEOUT_MS);
+    }
+    sd_release();
+
+    return result;
+}
+
+// Enviar un bloque con su CRC16 (calculado mientras el DMA lo envía) y
+// esperar a que la tarjeta lo programe
+static uint8_t sd_send_data(uint8_t token, const uint8_t *buffer) {
+    uint16_t crc;
+    uint8_t response;
+
+    spi_transfer(token);
+    spi_write_start(buffer);
+    crc = sd_crc16(buffer, SD_BLOCK_SIZE);
+    if(!spi_data_wait()) return SD_XFER_ERROR;
+    spi_transfer(crc >> 8);
+    spi_transfer(crc & 0xFF);
+
+    response = spi_transfer(0xFF) & 0x1F;
+    if(!sd_wait_ready(SD_WRITE_TIMEOUT_MS)) return SD_XFER_ERROR;
+    if(response == SD_DATA_CRC_ERROR) return SD_XFER_CRC;
+
+    return (response == SD_DATA_ACCEPTED) ? SD_XFER_OK : SD_XFER_ERROR;
+}
+
+// Una pasada de escritura desde el bloque *done: CMD24 si queda uno solo,
+// CMD25 + token de parada si quedan varios
+static uint8_t sd_write_pass(uint32_t sector, uint32_t count, const uint8_t *buffer,
+                             uint32_t *done) {
+    uint8_t result = SD_XFER_OK;
+    uint32_t left = count - *done;
+
+    cs_low();
+
+    // ACMD23: avisar cuántos bloques vienen para que la tarjeta los borre
+    // por adelantado. Es solo una pista; si la rechaza se sigue igual.
+    if(left > 1 && sd_command(55, 0) <= 0x01) {
+        sd_command(23, left & 0x007FFFFF);
+    }
+
+    if(sd_command(left > 1 ? 25 : 24, sd_address(sector + *done)) != 0x00) {
+        sd_release();
+        return SD_XFER_ERROR;
+    }
+
+    spi_transfer(0xFF);
+    while(*done < count && result == SD_XFER_OK) {
+        result = sd_send_data(left > 1 ? SD_TOKEN_MULTI_WRITE : SD_TOKEN_START,
+                              buffer + *done * SD_BLOCK_SIZE);
+        if(result == SD_XFER_OK) (*done)++;
+    }
+
+    // El token de parada se envía siempre, también tras un error
+    if(left > 1) {
+        spi_transfer(SD_TOKEN_STOP_TRAN);
+        spi_transfer(0xFF);
+        if(!sd_wait_ready(SD_WRITE_TIMEOUT_MS) && result == SD_XFER_OK) result = SD_XFER_ERROR;
+    }
+    sd_release();
+
+    return result;
+}
+
+// Repetir pasadas mientras fallen solo por CRC. Los intentos se cuentan
+// por bloque: cada vez que la transferencia avanza vuelven a empezar.
+static uint8_t sd_transfer(uint32_t sector, uint32_t count, uint8_t *rbuf,
+                           const uint8_t *wbuf, sd_block_cb_t cb, void *ctx) {
+    uint32_t done = 0, last = 0;
+    uint8_t attempts = 0, result;
+
+    if(!sd_ready || count == 0) return 0;
+
+    for(;;) {
+        result = wbuf ? sd_write_pass(sector, count, wbuf, &done)
+                      : sd_read_pass(sector, count, rbuf, cb, ctx, &done);
+        if(result == SD_XFER_OK) return 1;
+        if(result == SD_XFER_ERROR) return 0;
+
+        sd_stats.crc_errors++;
+        if(done != last) {
+            last = done;
+            attempts = 0;
+        }
+        if(++attempts > SD_CRC_RETRIES) {
+            sd_stats.failures++;
+            return 0;
+        }
+        sd_stats.retries++;
+    }
+}
+
+uint8_t sd_read_block(uint32_t sector, uint8_t *buffer) {
+    return sd_transfer(sector, 1, buffer, NULL, NULL, NULL);
+}
+
+uint8_t sd_read_multi(uint32_t sector, uint32_t count, uint8_t *buffer) {
+    return sd_transfer(sector, count, buffer, NULL, NULL, NULL);
+}
+
+uint8_t sd_read_blocks(uint32_t sector, uint32_t count, sd_block_cb_t cb, void *ctx) {
+    return sd_transfer(sector, count, NULL, NULL, cb, ctx);
+}
+
+uint8_t sd_write_block(uint32_t sector, const uint8_t *buffer) {
+    return sd_transfer(sector, 1, NULL, buffer, NULL, NULL);
+}
+
+uint8_t sd_write_multi(uint32_t sector, uint32_t count, const uint8_t *buffer) {
+    return sd_transfer(sector, count, NULL, buffer, NULL, NULL);
+}
+
+void sd_get_stats(sd_stats_t *stats) {
+    *stats = sd_stats;
+}
+
+uint8_t sd_is_ready(void) {
+    return sd_ready;
+}
+
+void sd_reset(void) {
+    sd_ready = 0;
+    is_sdhc = 0;
+    init_phase = INIT_IDLE;
+}
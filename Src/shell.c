@@ -28,6 +28,15 @@ static int history_count = 0;
 /* Flag para controlar la salida del shell */
 extern volatile uint8_t shell_mode_active;
 
+/*
+ * Escritura en curso de touch/append: la atiende la tarea de E/S y el
+ * shell sigue leyendo comandos. El contenido se copia porque input_buffer
+ * se reutiliza con la siguiente línea.
+ */
+static daos_aio_t shell_aio;
+static char shell_aio_data[SHELL_BUFFER_SIZE];
+static volatile uint8_t shell_aio_busy = 0;
+
 /* ============================================================ */
 /* UTILIDADES DE ENTRADA                      */
 /* ============================================================ */
@@ -53,19 +62,24 @@ static void cmd_help(void) {
     daos_uart_puts("║  Della and Operating System (DaOS)      ║\r\n");
     daos_uart_puts("╚══════════════════════════════════════════╝\r\n");
     daos_uart_puts("\r\n📁 ARCHIVO COMANDOS:\r\n");
-    daos_uart_puts("  library           - Listar archivos\r\n");
+    daos_uart_puts("  library [dir]     - Listar archivos\r\n");
     daos_uart_puts("  invoke <file>     - Leer archivo\r\n");
     daos_uart_puts("  touch <file> <txt>- Crear archivo\r\n");
     daos_uart_puts("  edit <file> <txt> - Editar/sobrescribir archivo\r\n");
     daos_uart_puts("  append <file> <txt>- Agregar al final\r\n");
     daos_uart_puts("  remove <file>     - Eliminar archivo\r\n");
+    daos_uart_puts("  mkdir <dir>       - Crear directorio\r\n");
+    daos_uart_puts("  rmdir <dir>       - Eliminar directorio vacío\r\n");
     daos_uart_puts("  rename <old> <new>- Renombrar archivo\r\n");
+    daos_uart_puts("  copy <src> <dst>  - Copiar (/ram, /rom, /sd)\r\n");
     daos_uart_puts("  hexdump <file>    - Ver en hexadecimal\r\n");
+    daos_uart_puts("  shrink <file> [off]- Comprimir archivo\r\n");
     daos_uart_puts("\r\n⚙️  SISTEMA:\r\n");
     daos_uart_puts("  chlorine          - Limpiar pantalla\r\n");
     daos_uart_puts("  bewitched         - Listar tareas\r\n");
     daos_uart_puts("  mingle <app>      - Ejecutar aplicación\r\n");
     daos_uart_puts("  fly               - Memoria\r\n");
+    daos_uart_puts("  portal [sync|close]- Montar/sincronizar/desmontar SD\r\n");
     daos_uart_puts("  hourglass         - Uptime\r\n");
     daos_uart_puts("  cauldronVer       - Versión\r\n");
     daos_uart_puts("  revive            - Reiniciar\r\n");
@@ -108,39 +122,70 @@ static void cmd_bewitched(void) {
     daos_uart_puts("\r\n");
 }
 
-static void cmd_library(void) {
-    daos_uart_puts("\r\n📚 Library of Files:\r\n");
-    daos_uart_puts("==================\r\n");
+/**
+ * Recorrer un directorio con sangría; cada nivel usa un descriptor abierto
+ * y un buffer de ruta propio, sin construir el listado completo en memoria.
+ */
+static void library_walk(const char* path, int depth, int* files, int* dirs) {
+    int dh = daos_opendir(path);
+    if (dh < 0) {
+        for (int d = 0; d <= depth; d++) daos_uart_puts("  ");
+        daos_uart_puts("...\r\n");  // Sin descriptores libres
+        return;
+    }
 
-    char buffer[512];
-    int n = daos_listdir(buffer, sizeof(buffer));
+    daos_dirent_t ent;
+    while (daos_readdir(dh, &ent) == 1) {
+        for (int d = 0; d <= depth; d++) daos_uart_puts("  ");
+        daos_uart_puts(ent.name);
 
-    if (n > 0) {
-        int count = 0;
-        char *line = buffer;
-        while (*line) {
-            char *end = strchr(line, '\n');
-            if (end) *end = '\0';
+        if (ent.is_dir) {
+            char child[DAOS_MAX_PATH];
+            int len = strlen(path);
 
-            daos_uart_puts("  ");
-            daos_uart_puts(line);
+            daos_uart_puts("/\r\n");
+            (*dirs)++;
 
-            int size = daos_get_file_size(line);
-            if (size >= 0) {
-                daos_uart_puts(" (");
-                daos_uart_putint(size);
-                daos_uart_puts(" bytes)");
+            if (len + strlen(ent.name) + 2 <= sizeof(child)) {
+                strcpy(child, path);
+                if (len == 0 || child[len - 1] != '/') strcat(child, "/");
+                strcat(child, ent.name);
+                library_walk(child, depth + 1, files, dirs);
             }
-            daos_uart_puts("\r\n");
-
-            count++;
-            if (!end) break;
-            line = end + 1;
+        } else {
+            daos_uart_puts(" (");
+            daos_uart_putint(ent.size);
+            daos_uart_puts(" bytes)\r\n");
+            (*files)++;
         }
+    }
+
+    daos_closedir(dh);
+}
+
+static void cmd_library(const char* path) {
+    int files = 0;
+    int dirs = 0;
+
+    if (!path || strlen(path) == 0) path = "/";
+
+    daos_uart_puts("\r\n📚 Library of Files:\r\n");
+    daos_uart_puts("==================\r\n");
+
+    if (!daos_is_dir(path)) {
+        daos_uart_puts("❌ No es un directorio\r\n\r\n");
+        return;
+    }
+
+    library_walk(path, 0, &files, &dirs);
+
+    if (files + dirs > 0) {
         daos_uart_puts("------------------\r\n");
         daos_uart_puts("Total: ");
-        daos_uart_putint(count);
-        daos_uart_puts(" files\r\n");
+        daos_uart_putint(files);
+        daos_uart_puts(" files, ");
+        daos_uart_putint(dirs);
+        daos_uart_puts(" dirs\r\n");
     } else {
         daos_uart_puts("(vacío)\r\n");
     }
@@ -188,6 +233,52 @@ static void cmd_invoke(const char* filename) {
     daos_uart_puts(" bytes leídos)\r\n\r\n");
 }
 
+/** Fin de una escritura de touch/append (desde la tarea de E/S). */
+static void shell_aio_done(daos_aio_t* req) {
+    if (req->result == (int)req->len) {
+        daos_uart_puts("\r\n✅ ");
+        daos_uart_puts(req->path);
+        daos_uart_puts(": ");
+        daos_uart_putint(req->len);
+        daos_uart_puts(" bytes escritos (");
+        daos_uart_putint(daos_get_file_size(req->path));
+        daos_uart_puts(" en total)\r\n");
+    } else {
+        daos_uart_puts("\r\n❌ Error al escribir ");
+        daos_uart_puts(req->path);
+        daos_uart_puts(" (sin espacio o no existe)\r\n");
+    }
+    shell_aio_busy = 0;
+}
+
+/**
+ * Encolar la escritura de touch/append sin esperar al medio.
+ * @return 0 si se encoló, -1 si hay otra en curso o no se pudo encolar.
+ */
+static int shell_aio_write(const char* filename, const char* content, int flags) {
+    uint32_t len = strlen(content);
+
+    if (shell_aio_busy) {
+        daos_uart_puts("❌ Hay una escritura en curso, reintenta\r\n\r\n");
+        return -1;
+    }
+
+    memcpy(shell_aio_data, content, len);
+    shell_aio.done = shell_aio_done;
+    shell_aio_busy = 1;
+
+    if (daos_aio_write(&shell_aio, filename, 0, shell_aio_data, len, flags) < 0) {
+        shell_aio_busy = 0;
+        daos_uart_puts("❌ Ruta inválida\r\n\r\n");
+        return -1;
+    }
+
+    daos_uart_puts("⏳ En cola (");
+    daos_uart_putint(len);
+    daos_uart_puts(" bytes)\r\n\r\n");
+    return 0;
+}
+
 static void cmd_touch(const char* args) {
     if (!args || strlen(args) == 0) {
         daos_uart_puts("\r\n❌ Uso: touch <archivo> <contenido>\r\n");
@@ -221,18 +312,7 @@ static void cmd_touch(const char* args) {
     daos_uart_puts(filename);
     daos_uart_puts("\r\n");
 
-    int result = daos_create_file(filename, content, strlen(content));
-
-    if (result == 0) {
-        daos_uart_puts("✅ Archivo creado\r\n");
-        daos_uart_puts("   Tamaño: ");
-        daos_uart_putint(strlen(content));
-        daos_uart_puts(" bytes\r\n");
-    } else {
-        daos_uart_puts("❌ Error (ya existe o sin espacio)\r\n");
-    }
-
-    daos_uart_puts("\r\n");
+    shell_aio_write(filename, content, DAOS_O_CREAT | DAOS_O_TRUNC);
 }
 
 static void cmd_edit(const char* args) {
@@ -308,18 +388,7 @@ static void cmd_append(const char* args) {
     daos_uart_puts(filename);
     daos_uart_puts("\r\n");
 
-    int result = daos_append(filename, new_content, strlen(new_content));
-
-    if (result == 0) {
-        daos_uart_puts("✅ Contenido agregado\r\n");
-        daos_uart_puts("   Nuevo tamaño: ");
-        daos_uart_putint(daos_get_file_size(filename));
-        daos_uart_puts(" bytes\r\n");
-    } else {
-        daos_uart_puts("❌ Error\r\n");
-    }
-
-    daos_uart_puts("\r\n");
+    shell_aio_write(filename, new_content, DAOS_O_APPEND);
 }
 
 static void cmd_remove(const char* filename) {
@@ -348,6 +417,32 @@ static void cmd_remove(const char* filename) {
     daos_uart_puts("\r\n");
 }
 
+static void cmd_mkdir(const char* path) {
+    if (!path || strlen(path) == 0) {
+        daos_uart_puts("\r\n❌ Uso: mkdir <directorio>\r\n\r\n");
+        return;
+    }
+
+    if (daos_mkdir(path) == 0) {
+        daos_uart_puts("\r\n✅ Directorio creado\r\n\r\n");
+    } else {
+        daos_uart_puts("\r\n❌ Error: ya existe o falta el directorio padre\r\n\r\n");
+    }
+}
+
+static void cmd_rmdir(const char* path) {
+    if (!path || strlen(path) == 0) {
+        daos_uart_puts("\r\n❌ Uso: rmdir <directorio>\r\n\r\n");
+        return;
+    }
+
+    if (daos_rmdir(path) == 0) {
+        daos_uart_puts("\r\n✅ Directorio eliminado\r\n\r\n");
+    } else {
+        daos_uart_puts("\r\n❌ Error: no existe o no está vacío\r\n\r\n");
+    }
+}
+
 static void cmd_rename(const char* args) {
     if (!args || strlen(args) == 0) {
         daos_uart_puts("\r\n❌ Uso: rename <nombre_actual> <nombre_nuevo>\r\n");
@@ -398,34 +493,53 @@ static void cmd_rename(const char* args) {
         return;
     }
 
-    int fd = daos_open(old_name);
-    if (fd < 0) {
-        daos_uart_puts("❌ Error al abrir archivo original\r\n\r\n");
+    // Dentro de un mismo montaje es un rename real; entre montajes copia y borra
+    if (daos_rename(old_name, new_name) != 0) {
+        daos_uart_puts("❌ Error al renombrar\r\n\r\n");
         return;
     }
 
-    char buffer[1024];
-    int size = daos_read(fd, buffer, sizeof(buffer));
-    daos_close(fd);
+    daos_uart_puts("✅ Archivo renombrado exitosamente\r\n\r\n");
+}
 
-    if (size < 0) {
-        daos_uart_puts("❌ Error al leer archivo\r\n\r\n");
-        return;
+static void cmd_copy(const char* args) {
+    char src[DAOS_MAX_PATH];
+    char dst[DAOS_MAX_PATH];
+    int i = 0;
+
+    if (!args) args = "";
+    while (*args == ' ') args++;
+    while (*args && *args != ' ' && i < DAOS_MAX_PATH - 1) {
+        src[i++] = *args++;
     }
+    src[i] = '\0';
 
-    int result = daos_create_file(new_name, buffer, size);
-    if (result != 0) {
-        daos_uart_puts("❌ Error al crear archivo con nuevo nombre\r\n\r\n");
+    i = 0;
+    while (*args == ' ') args++;
+    while (*args && *args != ' ' && i < DAOS_MAX_PATH - 1) {
+        dst[i++] = *args++;
+    }
+    dst[i] = '\0';
+
+    if (src[0] == '\0' || dst[0] == '\0') {
+        daos_uart_puts("\r\n❌ Uso: copy <origen> <destino>\r\n");
+        daos_uart_puts("Ejemplo: copy /rom/config.txt /sd/config.txt\r\n\r\n");
         return;
     }
 
-    result = daos_delete_file(old_name);
-    if (result != 0) {
-        daos_uart_puts("⚠️  Archivo creado pero no se pudo eliminar el original\r\n\r\n");
+    int copied = daos_copy_file(src, dst);
+    if (copied < 0) {
+        daos_uart_puts("\r\n❌ Error al copiar '");
+        daos_uart_puts(src);
+        daos_uart_puts("'\r\n\r\n");
         return;
     }
 
-    daos_uart_puts("✅ Archivo renombrado exitosamente\r\n\r\n");
+    daos_uart_puts("\r\n✅ ");
+    daos_uart_putint(copied);
+    daos_uart_puts(" bytes copiados a ");
+    daos_uart_puts(dst);
+    daos_uart_puts("\r\n\r\n");
 }
 
 static void cmd_hexdump(const char* filename) {
@@ -492,6 +606,38 @@ static void cmd_hexdump(const char* filename) {
     daos_uart_puts("\r\n");
 }
 
+static void cmd_shrink(const char* args) {
+    if (!args || strlen(args) == 0) {
+        daos_uart_puts("\r\n❌ Uso: shrink <archivo> [off]\r\n\r\n");
+        return;
+    }
+
+    char filename[64];
+    int i = 0;
+
+    while (*args == ' ') args++;
+    while (*args && *args != ' ' && i < 63) {
+        filename[i++] = *args++;
+    }
+    filename[i] = '\0';
+    while (*args == ' ') args++;
+
+    int enable = (strcmp(args, "off") != 0);
+
+    if (!daos_exists(filename)) {
+        daos_uart_puts("\r\n❌ Archivo no existe\r\n\r\n");
+        return;
+    }
+
+    if (daos_fs_set_compression(filename, enable) != 0) {
+        daos_uart_puts("\r\n❌ Sin espacio para descomprimir\r\n\r\n");
+        return;
+    }
+
+    daos_uart_puts(enable ? "\r\n✅ Compresión activada\r\n\r\n"
+                          : "\r\n✅ Compresión desactivada\r\n\r\n");
+}
+
 static void cmd_mingle(const char* app_name) {
     if (!app_name || strlen(app_name) == 0) {
         daos_uart_puts("\r\n🎮 Aplicaciones disponibles:\r\n");
@@ -522,7 +668,9 @@ static void cmd_fly(void) {
 
     daos_uart_puts("  RAMFS Files:   ");
     daos_uart_putint(mem.total_files);
-    daos_uart_puts("\r\n");
+    daos_uart_puts(" (");
+    daos_uart_putint(mem.inline_files);
+    daos_uart_puts(" inline)\r\n");
 
     daos_uart_puts("  Used Blocks:   ");
     daos_uart_putint(mem.used_blocks);
@@ -540,9 +688,158 @@ static void cmd_fly(void) {
     daos_uart_putint((mem.free_blocks * 256) / 1024);
     daos_uart_puts(" KB\r\n");
 
+    daos_uart_puts("  Fragmentation: ");
+    daos_uart_putint(mem.fragmentation);
+    daos_uart_puts(" %\r\n");
+
+    daos_uart_puts("  Compressed:    ");
+    daos_uart_putint(mem.packed_files);
+    daos_uart_puts(" files, ");
+    daos_uart_putint(mem.packed_raw_bytes);
+    daos_uart_puts(" -> ");
+    daos_uart_putint(mem.packed_stored_bytes);
+    daos_uart_puts(" bytes\r\n");
+
+    daos_uart_puts("  Path cache:    ");
+    daos_uart_putint(mem.dcache_hits);
+    daos_uart_puts(" hits, ");
+    daos_uart_putint(mem.dcache_misses);
+    daos_uart_puts(" misses\r\n");
+
+    daos_uart_puts("  Open files:    ");
+    daos_uart_putint(mem.vfs_open_fds);
+    daos_uart_puts(" fds, cache ");
+    daos_uart_putint(mem.vfs_cache_hits);
+    daos_uart_puts(" hits, ");
+    daos_uart_putint(mem.vfs_cache_misses);
+    daos_uart_puts(" misses\r\n");
+
+    daos_uart_puts("  SD cache:      ");
+    daos_uart_putint(mem.sd_cache_hits);
+    daos_uart_puts(" hits, ");
+    daos_uart_putint(mem.sd_cache_misses);
+    daos_uart_puts(" misses, ");
+    daos_uart_putint(mem.sd_cache_dirty);
+    daos_uart_puts(" dirty\r\n");
+
+    daos_uart_puts("  SD CRC:        ");
+    daos_uart_putint(mem.sd_crc_errors);
+    daos_uart_puts(" errors, ");
+    daos_uart_putint(mem.sd_crc_failures);
+    daos_uart_puts(" failed\r\n");
+
+    daos_uart_puts("  SPI bus:       ");
+    daos_uart_putint(mem.spi_transactions);
+    daos_uart_puts(" transactions, ");
+    daos_uart_putint(mem.spi_switches);
+    daos_uart_puts(" switches (");
+    daos_uart_putint(mem.spi_switch_cycles);
+    daos_uart_puts(" cycles each)\r\n");
+
+    daos_uart_puts("  Async I/O:     ");
+    daos_uart_putint(mem.aio_requests);
+    daos_uart_puts(" requests, ");
+    daos_uart_putint(mem.aio_merged);
+    daos_uart_puts(" merged, ");
+    daos_uart_putint(mem.aio_latency_ms);
+    daos_uart_puts(" ms avg\r\n");
+
+    daos_uart_puts("  Compositor:    ");
+    daos_uart_putint(mem.gfx_frames);
+    daos_uart_puts(" frames, ");
+    daos_uart_putint(mem.gfx_tiles_per_frame);
+    daos_uart_puts(" tiles/");
+    daos_uart_putint(mem.gfx_bytes_per_frame);
+    daos_uart_puts(" bytes per frame\r\n");
+
+    daos_uart_puts("  Display list:  ");
+    daos_uart_putint(mem.gfx_queued);
+    daos_uart_puts(" ops, ");
+    daos_uart_putint(mem.gfx_merged);
+    daos_uart_puts(" merged, ");
+    daos_uart_putint(mem.gfx_culled);
+    daos_uart_puts(" culled, ");
+    daos_uart_putint(mem.gfx_batches);
+    daos_uart_puts(" batches\r\n");
+
+    daos_uart_puts("  Frame pacing:  ");
+    daos_uart_putint(mem.gfx_presented);
+    daos_uart_puts(" frames, ");
+    daos_uart_putint(mem.gfx_dropped);
+    daos_uart_puts(" dropped, ");
+    daos_uart_putint(mem.gfx_torn);
+    daos_uart_puts(" torn, ");
+    daos_uart_putint(mem.gfx_present_latency_us);
+    daos_uart_puts("/");
+    daos_uart_putint(mem.gfx_present_max_us);
+    daos_uart_puts(" us wait (");
+    daos_uart_putint(mem.gfx_period_us ? 1000000 / mem.gfx_period_us : 0);
+    daos_uart_puts(" Hz, ");
+    daos_uart_puts(mem.gfx_vsync_source == 2 ? "TE" : mem.gfx_vsync_source == 1 ? "scanline" : "timer");
+    daos_uart_puts(")\r\n");
+
+    daos_uart_puts("  Glyph cache:   ");
+    daos_uart_putint(mem.gfx_glyph_hits);
+    daos_uart_puts(" hits, ");
+    daos_uart_putint(mem.gfx_glyph_misses);
+    daos_uart_puts(" misses\r\n");
+
+    daos_uart_puts("  LCD console:   ");
+    daos_uart_putint(mem.gfx_console_chars);
+    daos_uart_puts(" chars, ");
+    daos_uart_putint(mem.gfx_console_cells);
+    daos_uart_puts(" cells redrawn in ");
+    daos_uart_putint(mem.gfx_console_runs);
+    daos_uart_puts(" runs\r\n");
+
+    daos_uart_puts("  Persistence:   ");
+    if (mem.persistent) {
+        daos_uart_puts("flash log (");
+        daos_uart_putint(mem.log_used_bytes);
+        daos_uart_puts(" bytes)\r\n");
+    } else {
+        daos_uart_puts("RAM only\r\n");
+    }
+
     daos_uart_puts("\r\n");
 }
 
+static void cmd_portal(const char* args) {
+    uint32_t total_kb, free_kb;
+
+    if (args && strcmp(args, "close") == 0) {
+        daos_sd_unmount();
+        daos_uart_puts("\r\n🚪 SD desmontada\r\n\r\n");
+        return;
+    }
+
+    if (args && strcmp(args, "sync") == 0) {
+        if (daos_sd_sync() == 0) {
+            daos_uart_puts("\r\n💾 SD sincronizada\r\n\r\n");
+        } else {
+            daos_uart_puts("\r\n❌ Error al sincronizar la SD\r\n\r\n");
+        }
+        return;
+    }
+
+    daos_uart_puts("\r\n🌀 Abriendo portal a la SD...\r\n");
+    if (daos_sd_mount() != 0) {
+        daos_uart_puts("❌ No hay tarjeta o no tiene un volumen FAT32\r\n\r\n");
+        return;
+    }
+
+    daos_sd_get_info(&total_kb, &free_kb);
+    daos_uart_puts("✅ Montada en /sd: ");
+    daos_uart_putint(total_kb);
+    daos_uart_puts(" KB");
+    if (free_kb != 0xFFFFFFFF) {
+        daos_uart_puts(", ");
+        daos_uart_putint(free_kb);
+        daos_uart_puts(" KB libres");
+    }
+    daos_uart_puts("\r\n\r\n");
+}
+
 static void cmd_hourglass(void) {
     uint32_t ms = daos_millis();
     uint32_t seconds = ms / 1000;
@@ -644,16 +941,21 @@ static void parse_and_execute(char* cmd) {
     if (strcmp(cmd, "help") == 0) cmd_help();
     else if (strcmp(cmd, "chlorine") == 0) cmd_chlorine();
     else if (strcmp(cmd, "bewitched") == 0) cmd_bewitched();
-    else if (strcmp(cmd, "library") == 0) cmd_library();
+    else if (strcmp(cmd, "library") == 0) cmd_library(args);
     else if (strcmp(cmd, "invoke") == 0) cmd_invoke(args);
     else if (strcmp(cmd, "touch") == 0) cmd_touch(args);
     else if (strcmp(cmd, "edit") == 0) cmd_edit(args);
     else if (strcmp(cmd, "append") == 0) cmd_append(args);
     else if (strcmp(cmd, "remove") == 0) cmd_remove(args);
+    else if (strcmp(cmd, "mkdir") == 0) cmd_mkdir(args);
+    else if (strcmp(cmd, "rmdir") == 0) cmd_rmdir(args);
     else if (strcmp(cmd, "rename") == 0) cmd_rename(args);
+    else if (strcmp(cmd, "copy") == 0) cmd_copy(args);
     else if (strcmp(cmd, "hexdump") == 0) cmd_hexdump(args);
+    else if (strcmp(cmd, "shrink") == 0) cmd_shrink(args);
     else if (strcmp(cmd, "mingle") == 0) cmd_mingle(args);
     else if (strcmp(cmd, "fly") == 0) cmd_fly();
+    else if (strcmp(cmd, "portal") == 0) cmd_portal(args);
     else if (strcmp(cmd, "hourglass") == 0) cmd_hourglass();
     else if (strcmp(cmd, "cauldronver") == 0) cmd_cauldronVer();
     else if (strcmp(cmd, "revive") == 0) cmd_revive();
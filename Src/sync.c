@@ -213,6 +213,18 @@ void sem_post(sem_t *s) {
     task_yield();
 }
 
+/**
+ * SEM_POST DESDE INTERRUPCIÓN
+ *
+ * Solo incrementa count: la tarea interrumpida no es quien libera,
+ * así que no se toca ninguna prioridad ni se fuerza un yield.
+ */
+void sem_post_isr(sem_t *s) {
+    if (s->max_count == 0 || s->count < s->max_count) {
+        s->count++;
+    }
+}
+
 /**
  * SEM_TRYWAIT SIN HERENCIA
  *
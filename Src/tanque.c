@@ -1,12 +1,12 @@
 #include "tanque.h"
 #include "api.h"
+#include "sprites_tanque.h"  // Sprites generados desde assets/tanque.sprites
 #include "sync.h"
 
 // ========================================================================
 // CONSTANTES - ESCALA Y DIMENSIÓN
 // ========================================================================
 #define TILE_SIZE 16
-#define TILE_DATA_SIZE 10
 
 #define MAP_WIDTH 19
 #define MAP_HEIGHT 14
@@ -24,74 +24,6 @@ typedef enum {
     DIR_LEFT = 3
 } Direccion;
 
-// Sprites (sin cambios)
-static const uint32_t sprite_bloque_destructible[100] = {
-    0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff9d3312,
-    0xff8c2d10, 0xffffffff, 0xffffffff, 0xffcecece, 0xffcecece, 0xff8c2d10, 0xffffffff, 0xffcecece, 0xff8c2d10, 0xff9d3312,
-    0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff9d3312,
-    0xff8c2d10, 0xffffffff, 0xffcecece, 0xff8c2d10, 0xffffffff, 0xffcecece, 0xffcecece, 0xff8c2d10, 0xffffffff, 0xff8c2d10,
-    0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff8c2d10, 0xff9d3312,
-    0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff9d3312,
-    0xff8c2d10, 0xffffffff, 0xffffffff, 0xffcecece, 0xffcecece, 0xff8c2d10, 0xffffffff, 0xffcecece, 0xffcecece, 0xff8c2d10,
-    0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff8c2d10, 0xff9d3312,
-    0xff8c2d10, 0xffffffff, 0xffcecece, 0xff8c2d10, 0xffffffff, 0xffcecece, 0xff8c2d10, 0xffffffff, 0xffcecece, 0xff8c2d10,
-    0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff9d3312, 0xff8c2d10, 0xff8c2d10, 0xff9d3312
-};
-
-static const uint32_t sprite_bloque_acero[100] = {
-    0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b,
-    0xff7b7b7b, 0xffaeaeae, 0xff494847, 0xff494847, 0xff7b7b7b, 0xff7b7b7b, 0xffaeaeae, 0xff494847, 0xff494847, 0xff7b7b7b,
-    0xff7b7b7b, 0xff494847, 0xffaeaeae, 0xff494847, 0xff7b7b7b, 0xff7b7b7b, 0xff494847, 0xffaeaeae, 0xff494847, 0xff7b7b7b,
-    0xff7b7b7b, 0xff494847, 0xffaeaeae, 0xff494847, 0xff7b7b7b, 0xff7b7b7b, 0xff494847, 0xffaeaeae, 0xff494847, 0xff7b7b7b,
-    0xff7b7b7b, 0xff494847, 0xff494847, 0xffaeaeae, 0xff7b7b7b, 0xff7b7b7b, 0xff494847, 0xff494847, 0xffaeaeae, 0xff7b7b7b,
-    0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b,
-    0xff7b7b7b, 0xffaeaeae, 0xff494847, 0xff494847, 0xff7b7b7b, 0xff7b7b7b, 0xffaeaeae, 0xff494847, 0xff494847, 0xff7b7b7b,
-    0xff7b7b7b, 0xff494847, 0xffaeaeae, 0xff494847, 0xff7b7b7b, 0xff7b7b7b, 0xff494847, 0xffaeaeae, 0xff494847, 0xff7b7b7b,
-    0xff7b7b7b, 0xff494847, 0xff494847, 0xffaeaeae, 0xff7b7b7b, 0xff7b7b7b, 0xff494847, 0xff494847, 0xffaeaeae, 0xff7b7b7b,
-    0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b, 0xff7b7b7b
-};
-
-static const uint32_t sprite_planta[100] = {
-    0x00000000, 0xff1f882d, 0xff29ac3a, 0x00000000, 0x00000000, 0xff1f882d, 0x00000000, 0xff1f882d, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0xff29ac3a, 0xff74cc7f, 0x00000000, 0xff74cc7f, 0xff29ac3a, 0xff29ac3a, 0xff74cc7f, 0xff1f882d,
-    0xff29ac3a, 0x00000000, 0x00000000, 0xff1f882d, 0xff29ac3a, 0xff29ac3a, 0x00000000, 0xff1f882d, 0x00000000, 0x00000000,
-    0x00000000, 0xff74cc7f, 0xff1f882d, 0xff29ac3a, 0x00000000, 0x00000000, 0xff29ac3a, 0x00000000, 0xff74cc7f, 0xff1f882d,
-    0xff74cc7f, 0x00000000, 0x00000000, 0xff29ac3a, 0xff29ac3a, 0xff29ac3a, 0x00000000, 0xff74cc7f, 0x00000000, 0x00000000,
-    0xff1f882d, 0xff29ac3a, 0xff1f882d, 0x00000000, 0x00000000, 0xff29ac3a, 0x00000000, 0xff1f882d, 0x00000000, 0xff1f882d,
-    0x00000000, 0xff1f882d, 0x00000000, 0x00000000, 0xff29ac3a, 0xff29ac3a, 0xff29ac3a, 0x00000000, 0xff29ac3a, 0x00000000,
-    0xff29ac3a, 0x00000000, 0xff29ac3a, 0xff29ac3a, 0x00000000, 0xff74cc7f, 0x00000000, 0x00000000, 0xff74cc7f, 0x00000000,
-    0xff29ac3a, 0xff29ac3a, 0x00000000, 0xff29ac3a, 0x00000000, 0xff1f882d, 0xff29ac3a, 0xff74cc7f, 0xff1f882d, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0xff74cc7f, 0xff1f882d, 0x00000000, 0xff29ac3a, 0x00000000, 0x00000000, 0xff1f882d
-};
-
-// Tanque Azul
-static const uint32_t sprite_tanque_azul[100] = {
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xff42489f, 0xff42489f, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-    0xff585fcc, 0xff585fcc, 0x00000000, 0x00000000, 0xff42489f, 0xff42489f, 0x00000000, 0x00000000, 0xff585fcc, 0xff585fcc,
-    0xff19229b, 0xff19229b, 0xff171c63, 0x00000000, 0xff42489f, 0xff42489f, 0x00000000, 0xff171c63, 0xff19229b, 0xff19229b,
-    0xff585fcc, 0xff585fcc, 0xff171c63, 0xff171c63, 0xff171c63, 0xff171c63, 0xff171c63, 0xff171c63, 0xff585fcc, 0xff585fcc,
-    0xff19229b, 0xff19229b, 0xff171c63, 0xff171c63, 0xff2d3387, 0xff2d3387, 0xff171c63, 0xff171c63, 0xff19229b, 0xff19229b,
-    0xff585fcc, 0xff585fcc, 0xff171c63, 0xff2d3387, 0xff2d3387, 0xff2d3387, 0xff2d3387, 0xff171c63, 0xff585fcc, 0xff585fcc,
-    0xff19229b, 0xff19229b, 0xff171c63, 0xff171c63, 0xff2d3387, 0xff2d3387, 0xff171c63, 0xff171c63, 0xff19229b, 0xff19229b,
-    0xff585fcc, 0xff585fcc, 0xff42434f, 0xff171c63, 0xff171c63, 0xff171c63, 0xff171c63, 0xff42434f, 0xff585fcc, 0xff585fcc,
-    0xff19229b, 0xff19229b, 0xff42434f, 0xff42434f, 0xff171c63, 0xff171c63, 0xff42434f, 0xff42434f, 0xff19229b, 0xff19229b,
-    0x00000000, 0x00000000, 0xff42434f, 0xff42434f, 0xff42434f, 0xff42434f, 0xff42434f, 0xff42434f, 0x00000000, 0x00000000
-};
-
-// Tanque Rojo
-static const uint32_t sprite_tanque_rojo[100] = {
-    0x00000000, 0x00000000, 0x00000000, 0xffb31c1c, 0x00000000, 0x00000000, 0xffb31c1c, 0x00000000, 0x00000000, 0x00000000,
-    0xffe82323, 0x00000000, 0x00000000, 0x00000000, 0xffb31c1c, 0xffb31c1c, 0x00000000, 0x00000000, 0x00000000, 0xffe82323,
-    0xffe82323, 0xffe82323, 0x00000000, 0x00000000, 0xffb31c1c, 0xffb31c1c, 0x00000000, 0x00000000, 0xffe82323, 0xffe82323,
-    0xffbb2f2f, 0xffbb2f2f, 0xffa84444, 0x00000000, 0xffb31c1c, 0xffb31c1c, 0x00000000, 0xffa84444, 0xffbb2f2f, 0xffbb2f2f,
-    0xffe82323, 0xffe82323, 0xffa84444, 0xffbb2f2f, 0xffb31c1c, 0xffb31c1c, 0xffa84444, 0xffa84444, 0xffe82323, 0xffe82323,
-    0xffbb2f2f, 0xffbb2f2f, 0xffa84444, 0xffbb2f2f, 0xff9f6d6d, 0xff9f6d6d, 0xffa84444, 0xffa84444, 0xffbb2f2f, 0xffbb2f2f,
-    0xffe82323, 0xffe82323, 0xffa84444, 0xff9f6d6d, 0xff9f6d6d, 0xff9f6d6d, 0xff9f6d6d, 0xffa84444, 0xffe82323, 0xffe82323,
-    0xffbb2f2f, 0xffbb2f2f, 0xffa84444, 0xffa84444, 0xff9f6d6d, 0xff9f6d6d, 0xffbb2f2f, 0xffa84444, 0xffbb2f2f, 0xffbb2f2f,
-    0xffe82323, 0xffe82323, 0xff565656, 0xffa84444, 0xffbb2f2f, 0xffbb2f2f, 0xffbb2f2f, 0xff565656, 0xffe82323, 0xffe82323,
-    0x00000000, 0x00000000, 0xff565656, 0xff565656, 0xff565656, 0xff565656, 0xff565656, 0xff565656, 0x00000000, 0x00000000
-};
-
 // ========================================================================
 // TIPOS
 // ========================================================================
@@ -226,59 +158,15 @@ static void draw_vertical_line(int16_t x, int16_t y0, int16_t y1, uint16_t color
     }
 }
 
-static void draw_tile_rotated(uint8_t x, uint8_t y, const uint32_t* sprite_data, Direccion dir) {
+// sprite: las cuatro orientaciones, indexadas por Direccion
+static void draw_tile_rotated(uint8_t x, uint8_t y, const daos_sprite_t* sprite, Direccion dir) {
     int16_t screen_x = (x * TILE_SIZE) + MAP_OFFSET_X;
     int16_t screen_y = (y * TILE_SIZE) + MAP_OFFSET_Y;
-
-    for (uint8_t row = 0; row < TILE_SIZE; row++) {
-        for (uint8_t col = 0; col < TILE_SIZE; col++) {
-            uint8_t data_row, data_col;
-            uint8_t mapped_row = (row * TILE_DATA_SIZE) / TILE_SIZE;
-            uint8_t mapped_col = (col * TILE_DATA_SIZE) / TILE_SIZE;
-
-            if (mapped_row >= TILE_DATA_SIZE) mapped_row = TILE_DATA_SIZE - 1;
-            if (mapped_col >= TILE_DATA_SIZE) mapped_col = TILE_DATA_SIZE - 1;
-
-            switch(dir) {
-                case DIR_UP:
-                    data_row = mapped_row;
-                    data_col = mapped_col;
-                    break;
-                case DIR_RIGHT:
-                    data_row = (TILE_DATA_SIZE - 1) - mapped_col;
-                    data_col = mapped_row;
-                    break;
-                case DIR_DOWN:
-                    data_row = (TILE_DATA_SIZE - 1) - mapped_row;
-                    data_col = (TILE_DATA_SIZE - 1) - mapped_col;
-                    break;
-                case DIR_LEFT:
-                    data_row = mapped_col;
-                    data_col = (TILE_DATA_SIZE - 1) - mapped_row;
-                    break;
-            }
-
-            uint32_t color_32bit = sprite_data[data_row * TILE_DATA_SIZE + data_col];
-
-            if ((color_32bit >> 24) != 0x00) {
-                uint8_t r = (color_32bit >> 16) & 0xFF;
-                uint8_t g = (color_32bit >> 8) & 0xFF;
-                uint8_t b = color_32bit & 0xFF;
-                uint16_t color_16bit = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-
-                int16_t pixel_x = screen_x + col;
-                int16_t pixel_y = screen_y + row;
-
-                if (pixel_x >= 0 && pixel_x < 320 && pixel_y >= 0 && pixel_y < 240) {
-                    daos_gfx_draw_pixel(pixel_x, pixel_y, color_16bit);
-                }
-            }
-        }
-    }
+    daos_gfx_draw_sprite(screen_x, screen_y, &sprite[dir]);
 }
 
-static void draw_tile(uint8_t x, uint8_t y, const uint32_t* sprite_data) {
-    draw_tile_rotated(x, y, sprite_data, DIR_UP);
+static void draw_tile(uint8_t x, uint8_t y, const daos_sprite_t* sprite) {
+    draw_tile_rotated(x, y, sprite, DIR_UP);
 }
 
 static void draw_projectile(uint8_t x, uint8_t y) {
@@ -289,22 +177,14 @@ static void draw_projectile(uint8_t x, uint8_t y) {
     int16_t start_x = screen_x + (TILE_SIZE / 2) - (size / 2);
     int16_t start_y = screen_y + (TILE_SIZE / 2) - (size / 2);
 
-    for (int16_t i = 0; i < size; i++) {
-        for (int16_t j = 0; j < size; j++) {
-            daos_gfx_draw_pixel(start_x + i, start_y + j, COLOR_YELLOW);
-        }
-    }
+    daos_gfx_fill_rect(start_x, start_y, size, size, COLOR_YELLOW);
 }
 
 static void redraw_tile_content(uint8_t x, uint8_t y) {
     int16_t screen_x = (x * TILE_SIZE) + MAP_OFFSET_X;
     int16_t screen_y = (y * TILE_SIZE) + MAP_OFFSET_Y;
 
-    for (uint8_t row = 0; row < TILE_SIZE; row++) {
-        for (uint8_t col = 0; col < TILE_SIZE; col++) {
-             daos_gfx_draw_pixel(screen_x + col, screen_y + row, COLOR_BLACK);
-        }
-    }
+    daos_gfx_fill_rect(screen_x, screen_y, TILE_SIZE, TILE_SIZE, COLOR_BLACK);
 
     // PROTECCIÓN: Acceso al mapa con mutex
     mutex_lock(&tanque_map_mutex);
@@ -313,13 +193,13 @@ static void redraw_tile_content(uint8_t x, uint8_t y) {
 
     switch(tile) {
         case TILE_DESTRUCTIBLE:
-            draw_tile(x, y, sprite_bloque_destructible);
+            draw_tile(x, y, &sprite_bloque_destructible);
             break;
         case TILE_ACERO:
-            draw_tile(x, y, sprite_bloque_acero);
+            draw_tile(x, y, &sprite_bloque_acero);
             break;
         case TILE_PLANTA:
-            draw_tile(x, y, sprite_planta);
+            draw_tile(x, y, &sprite_planta);
             break;
         default:
             break;
@@ -1071,13 +951,13 @@ static uint8_t try_move_tank(Tanque* tank, uint8_t* move_counter) {
         	            for (uint8_t x = 0; x < MAP_WIDTH; x++) {
         	            	switch (mapa[y][x]) {
         	            	                    case TILE_DESTRUCTIBLE:
-        	            	                        draw_tile(x, y, sprite_bloque_destructible);
+        	            	                        draw_tile(x, y, &sprite_bloque_destructible);
         	            	                        break;
         	            	                    case TILE_ACERO:
-        	            	                        draw_tile(x, y, sprite_bloque_acero);
+        	            	                        draw_tile(x, y, &sprite_bloque_acero);
         	            	                        break;
         	            	                    case TILE_PLANTA:
-        	            	                        draw_tile(x, y, sprite_planta);
+        	            	                        draw_tile(x, y, &sprite_planta);
         	            	                        break;
         	            	                    default:
         	            	                        break;
@@ -1143,7 +1023,7 @@ static uint8_t try_move_tank(Tanque* tank, uint8_t* move_counter) {
         	            	        mutex_lock(&tanque_map_mutex);
         	            	        if (mapa[azul_y][azul_x] == TILE_PLANTA) {
         	            	            mutex_unlock(&tanque_map_mutex);
-        	            	            draw_tile(azul_x, azul_y, sprite_planta);
+        	            	            draw_tile(azul_x, azul_y, &sprite_planta);
         	            	        } else {
         	            	            mutex_unlock(&tanque_map_mutex);
         	            	        }
@@ -1153,7 +1033,7 @@ static uint8_t try_move_tank(Tanque* tank, uint8_t* move_counter) {
         	            	        mutex_lock(&tanque_map_mutex);
         	            	        if (mapa[rojo_y][rojo_x] == TILE_PLANTA) {
         	            	            mutex_unlock(&tanque_map_mutex);
-        	            	            draw_tile(rojo_x, rojo_y, sprite_planta);
+        	            	            draw_tile(rojo_x, rojo_y, &sprite_planta);
         	            	        } else {
         	            	            mutex_unlock(&tanque_map_mutex);
         	            	        }
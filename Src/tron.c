@@ -456,12 +456,9 @@ void tron_logic_task(void) {
 }
 
 void tron_render_task(void) {
-    static uint8_t first_frame = 1;
-
-    if (first_frame) {
-        daos_gfx_clear(DAOS_COLOR_BLACK);
-        first_frame = 0;
-    }
+    // Cada cuadro redibuja la escena completa; el compositor solo envía a
+    // la pantalla los tiles que cambiaron
+    daos_gfx_frame_begin(DAOS_COLOR_BLACK);
 
     // Dibujar marcadores superiores
     char buffer[32];
@@ -508,43 +505,6 @@ void tron_render_task(void) {
     daos_gfx_fill_rect(8, 28, 2, BOARD_HEIGHT * PIXEL_SIZE + 4, DAOS_COLOR_WHITE);
     daos_gfx_fill_rect(10 + BOARD_WIDTH * PIXEL_SIZE, 28, 2, BOARD_HEIGHT * PIXEL_SIZE + 4, DAOS_COLOR_WHITE);
 
-    // PROTECCIÓN: Verificar estado del juego
-    mutex_lock(&tron_game_state_mutex);
-    tron_state_t current_state = game_state;
-    tron_winner_t current_winner = winner;
-    mutex_unlock(&tron_game_state_mutex);
-
-    // Game Over
-    if (current_state == TRON_GAME_OVER) {
-        daos_gfx_fill_rect(60, 90, 200, 60, DAOS_COLOR_BLACK);
-        daos_gfx_fill_rect(58, 88, 204, 64, DAOS_COLOR_WHITE);
-        daos_gfx_fill_rect(60, 90, 200, 60, DAOS_COLOR_BLACK);
-
-        daos_gfx_draw_text_large(80, 100, "GAME OVER", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 2);
-
-        switch(current_winner) {
-            case TRON_PLAYER1_WINS:
-                daos_gfx_draw_text_large(90, 125, "P1 WINS", COLOR_P1, DAOS_COLOR_BLACK, 2);
-                break;
-            case TRON_PLAYER2_WINS:
-                daos_gfx_draw_text_large(90, 125, "P2 WINS", COLOR_P2, DAOS_COLOR_BLACK, 2);
-                break;
-            case TRON_PLAYER3_WINS:
-                daos_gfx_draw_text_large(90, 125, "P3 WINS", COLOR_P3, DAOS_COLOR_BLACK, 2);
-                break;
-            case TRON_PLAYER4_WINS:
-                daos_gfx_draw_text_large(90, 125, "P4 WINS", COLOR_P4, DAOS_COLOR_BLACK, 2);
-                break;
-            case TRON_DRAW:
-                daos_gfx_draw_text_large(100, 125, "DRAW", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 2);
-                breakdefault:
-                break;
-        }
-
-        daos_sleep_ms(5000);
-        return;
-    }
-
     // PROTECCIÓN: Leer posiciones de motos de forma segura
     mutex_lock(&tron_bike_mutex);
     Position current_bike_p1 = bike_p1;
@@ -581,7 +541,43 @@ void tron_render_task(void) {
     if (local_alive_p3) draw_game_pixel(current_bike_p3.x, current_bike_p3.y, DAOS_COLOR_WHITE);
     if (local_alive_p4) draw_game_pixel(current_bike_p4.x, current_bike_p4.y, DAOS_COLOR_WHITE);
 
-    daos_sleep_ms(100);
+    // PROTECCIÓN: Verificar estado del juego
+    mutex_lock(&tron_game_state_mutex);
+    tron_state_t current_state = game_state;
+    tron_winner_t current_winner = winner;
+    mutex_unlock(&tron_game_state_mutex);
+
+    // Game Over
+    if (current_state == TRON_GAME_OVER) {
+        daos_gfx_fill_rect(60, 90, 200, 60, DAOS_COLOR_BLACK);
+        daos_gfx_fill_rect(58, 88, 204, 64, DAOS_COLOR_WHITE);
+        daos_gfx_fill_rect(60, 90, 200, 60, DAOS_COLOR_BLACK);
+
+        daos_gfx_draw_text_large(80, 100, "GAME OVER", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 2);
+
+        switch(current_winner) {
+            case TRON_PLAYER1_WINS:
+                daos_gfx_draw_text_large(90, 125, "P1 WINS", COLOR_P1, DAOS_COLOR_BLACK, 2);
+                break;
+            case TRON_PLAYER2_WINS:
+                daos_gfx_draw_text_large(90, 125, "P2 WINS", COLOR_P2, DAOS_COLOR_BLACK, 2);
+                break;
+            case TRON_PLAYER3_WINS:
+                daos_gfx_draw_text_large(90, 125, "P3 WINS", COLOR_P3, DAOS_COLOR_BLACK, 2);
+                break;
+            case TRON_PLAYER4_WINS:
+                daos_gfx_draw_text_large(90, 125, "P4 WINS", COLOR_P4, DAOS_COLOR_BLACK, 2);
+                break;
+            case TRON_DRAW:
+                daos_gfx_draw_text_large(100, 125, "DRAW", DAOS_COLOR_WHITE, DAOS_COLOR_BLACK, 2);
+                breakdefault:
+                break;
+        }
+    }
+
+    // El cuadro sale al empezar un refresco del panel y la tarea duerme
+    // hasta poco antes del siguiente que le toca
+    daos_sleep_ms(daos_gfx_present(current_state == TRON_GAME_OVER ? 5000 : 100));
 }
 
 /* ============================================================ */
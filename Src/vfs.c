@@ -0,0 +1,597 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - VFS (Virtual File System) - Implementación
+ * ============================================================================
+ */
+
+#include "vfs.h"
+#include "fs.h"
+#include "uart.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                          ESTRUCTURAS INTERNAS                              */
+/* ========================================================================== */
+
+/** Punto de montaje. */
+typedef struct {
+    char prefix[VFS_MAX_PREFIX];   // "/ram"
+    uint8_t len;                   // strlen(prefix)
+    uint8_t in_use;
+    const vfs_ops_t* ops;
+    void* ctx;
+} vfs_mount_t;
+
+/** Tipos de descriptor. */
+#define FD_FREE  0
+#define FD_FILE  1
+#define FD_DIR   2
+#define FD_ROOT  3   // "/": puntos de montaje + montaje por defecto
+
+/** Descriptor abierto. ops y ctx se copian del montaje para despachar directo. */
+typedef struct {
+    const vfs_ops_t* ops;
+    void* ctx;
+    int16_t handle;                // Handle del backend
+    uint8_t mount;
+    uint8_t kind;                  // FD_*
+    uint8_t flags;                 // VFS_O_* de la apertura
+    uint8_t root_pos;              // FD_ROOT: siguiente montaje a listar
+    char path[VFS_MAX_PATH];       // Ruta relativa al montaje (para la caché)
+} vfs_fd_t;
+
+/** Archivo de solo lectura retenido tras cerrarse. */
+typedef struct {
+    int16_t handle;
+    uint8_t mount;
+    uint8_t in_use;
+    uint32_t stamp;                // Para desalojar el menos usado
+    char path[VFS_MAX_PATH];
+} vfs_cache_t;
+
+static vfs_mount_t mounts[VFS_MAX_MOUNTS];
+static vfs_fd_t fds[VFS_MAX_FDS];
+static vfs_cache_t cache[VFS_CACHE_SIZE];
+static int default_mount = -1;
+static uint32_t cache_clock = 0;
+static uint32_t cache_hits = 0;
+static uint32_t cache_misses = 0;
+
+/* ========================================================================== */
+/*                          FUNCIONES AUXILIARES                              */
+/* ========================================================================== */
+
+/**
+ * Resolver una ruta a (montaje, ruta relativa)
+ * Gana el prefijo más largo que coincida en un límite de componente; las
+ * rutas que no coinciden con ninguno van al montaje por defecto.
+ * @return Índice del montaje o -1.
+ */
+static int resolve(const char* path, char* rel) {
+    int best = -1;
+    int best_len = 0;
+
+    if (!path) return -1;
+
+    if (path[0] == '/') {
+        for (int i = 0; i < VFS_MAX_MOUNTS; i++) {
+            int len = mounts[i].len;
+            if (!mounts[i].in_use || len <= best_len) continue;
+            if (strncmp(path, mounts[i].prefix, len) == 0 &&
+                (path[len] == '/' || path[len] == '\0')) {
+                best = i;
+                best_len = len;
+            }
+        }
+    }
+
+    if (best < 0) {
+        best = default_mount;
+        best_len = 0;
+        if (best < 0) return -1;
+    }
+
+    const char* tail = path + best_len;
+    int tail_len = (int)strlen(tail);
+    int slash = (tail[0] != '/');
+
+    if (tail_len + slash >= VFS_MAX_PATH) return -1;
+    if (slash) rel[0] = '/';
+    memcpy(rel + slash, tail, tail_len + 1);
+    return best;
+}
+
+static int find_free_fd(void) {
+    for (int i = 0; i < VFS_MAX_FDS; i++) {
+        if (fds[i].kind == FD_FREE) return i;
+    }
+    return -1;
+}
+
+static int valid_fd(int fd, int kind) {
+    return fd >= 0 && fd < VFS_MAX_FDS && fds[fd].kind == kind;
+}
+
+static int is_read_only(int flags) {
+    return (flags & VFS_O_RDWR) == VFS_O_RDONLY &&
+           !(flags & (VFS_O_CREAT | VFS_O_TRUNC | VFS_O_APPEND));
+}
+
+/**
+ * Ruta de un archivo dentro de su almacén
+ * /rom guarda sus archivos en RAMFS bajo FS_DIR: /rom/x y /ram/rom/x son
+ * el mismo archivo.
+ * @return Backend que guarda el archivo, o NULL si la ruta no resuelve.
+ */
+static const vfs_ops_t* store_path(const char* path, char* out) {
+    char rel[VFS_MAX_PATH];
+    int m = resolve(path, rel);
+    if (m < 0) return NULL;
+
+    if (mounts[m].ops == &vfs_rom_ops) {
+        if (sizeof(FS_DIR) - 1 + strlen(rel) >= VFS_MAX_PATH) return NULL;
+        strcpy(out, FS_DIR);
+        strcat(out, rel);
+        return &vfs_ramfs_ops;
+    }
+    strcpy(out, rel);
+    return mounts[m].ops;
+}
+
+static char fold(char c) {
+    return (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+}
+
+/**
+ * Dos rutas que nombran el mismo archivo (FAT no distingue mayúsculas)
+ */
+static int same_file(const char* a, const char* b) {
+    char path_a[VFS_MAX_PATH];
+    char path_b[VFS_MAX_PATH];
+    const vfs_ops_t* store = store_path(a, path_a);
+
+    if (!store || store != store_path(b, path_b)) return 0;
+    if (store != &vfs_sd_ops) return strcmp(path_a, path_b) == 0;
+
+    for (int i = 0; ; i++) {
+        if (fold(path_a[i]) != fold(path_b[i])) return 0;
+        if (path_a[i] == '\0') return 1;
+    }
+}
+
+/* ========================================================================== */
+/*                          CACHÉ DE ARCHIVOS ABIERTOS                        */
+/* ========================================================================== */
+
+static void cache_evict(int i) {
+    const vfs_mount_t* mnt = &mounts[cache[i].mount];
+    if (mnt->ops->close) {
+        mnt->ops->close(mnt->ctx, cache[i].handle);
+    }
+    cache[i].in_use = 0;
+}
+
+/**
+ * Tomar un handle retenido para (montaje, ruta), rebobinado al inicio
+ * @return Handle del backend o -1 si no está en la caché.
+ */
+static int cache_take(int m, const char* rel) {
+    for (int i = 0; i < VFS_CACHE_SIZE; i++) {
+        if (cache[i].in_use && cache[i].mount == m && strcmp(cache[i].path, rel) == 0) {
+            const vfs_mount_t* mnt = &mounts[m];
+            if (mnt->ops->seek(mnt->ctx, cache[i].handle, 0, VFS_SEEK_SET) < 0) {
+                cache_evict(i);
+                return -1;
+            }
+            cache[i].in_use = 0;
+            return cache[i].handle;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Retener un handle de solo lectura; desaloja el menos usado si no hay sitio
+ */
+static void cache_put(int m, const char* rel, int handle) {
+    int slot = 0;
+    for (int i = 0; i < VFS_CACHE_SIZE; i++) {
+        if (!cache[i].in_use) {
+            slot = i;
+            break;
+        }
+        if (cache[i].stamp < cache[slot].stamp) slot = i;
+    }
+
+    if (cache[slot].in_use) cache_evict(slot);
+
+    cache[slot].handle = (int16_t)handle;
+    cache[slot].mount = (uint8_t)m;
+    cache[slot].stamp = ++cache_clock;
+    strcpy(cache[slot].path, rel);
+    cache[slot].in_use = 1;
+}
+
+/**
+ * Cerrar los handles retenidos de un montaje (rel == NULL) o de una ruta
+ * @return Número de handles cerrados.
+ */
+static int cache_drop(int m, const char* rel) {
+    int dropped = 0;
+    for (int i = 0; i < VFS_CACHE_SIZE; i++) {
+        if (cache[i].in_use && cache[i].mount == m &&
+            (!rel || strcmp(cache[i].path, rel) == 0)) {
+            cache_evict(i);
+            dropped++;
+        }
+    }
+    return dropped;
+}
+
+/**
+ * Invalidar lo retenido antes de modificar (montaje, ruta)
+ * Los montajes pueden compartir almacén: /rom son los archivos de RAMFS
+ * bajo FS_DIR, que /ram también ve como /ram/rom. La ruta de un montaje
+ * no dice a qué ruta de otro equivale, así que de los demás montajes se
+ * cierra todo lo retenido.
+ */
+static void cache_invalidate(int m, const char* rel) {
+    for (int i = 0; i < VFS_CACHE_SIZE; i++) {
+        if (cache[i].in_use &&
+            (cache[i].mount != m || !rel || strcmp(cache[i].path, rel) == 0)) {
+            cache_evict(i);
+        }
+    }
+}
+
+void vfs_cache_flush(void) {
+    for (int i = 0; i < VFS_CACHE_SIZE; i++) {
+        if (cache[i].in_use) cache_evict(i);
+    }
+}
+
+/* ========================================================================== */
+/*                          MONTAJE                                           */
+/* ========================================================================== */
+
+int vfs_mount(const char* prefix, const vfs_ops_t* ops, void* ctx) {
+    int slot = -1;
+    int len = prefix ? (int)strlen(prefix) : 0;
+
+    if (!ops || len < 2 || len >= VFS_MAX_PREFIX || prefix[0] != '/') return -1;
+    if (strchr(prefix + 1, '/')) return -1;  // Un solo componente
+
+    for (int i = 0; i < VFS_MAX_MOUNTS; i++) {
+        if (mounts[i].in_use && strcmp(mounts[i].prefix, prefix) == 0) return -1;
+        if (!mounts[i].in_use && slot < 0) slot = i;
+    }
+    if (slot < 0) return -1;
+
+    strcpy(mounts[slot].prefix, prefix);
+    mounts[slot].len = (uint8_t)len;
+    mounts[slot].ops = ops;
+    mounts[slot].ctx = ctx;
+    mounts[slot].in_use = 1;
+
+    if (default_mount < 0) default_mount = slot;
+
+    uart_puts("[VFS] Mounted ");
+    uart_puts(ops->name);
+    uart_puts(" on ");
+    uart_puts(prefix);
+    uart_puts("\r\n");
+    return 0;
+}
+
+int vfs_umount(const char* prefix) {
+    for (int m = 0; m < VFS_MAX_MOUNTS; m++) {
+        if (!mounts[m].in_use || strcmp(mounts[m].prefix, prefix) != 0) continue;
+
+        for (int i = 0; i < VFS_MAX_FDS; i++) {
+            if (fds[i].kind != FD_FREE && fds[i].kind != FD_ROOT && fds[i].mount == m) {
+                return -1; // Ocupado
+            }
+        }
+
+        cache_drop(m, NULL);
+        mounts[m].in_use = 0;
+        if (default_mount == m) default_mount = -1;
+        return 0;
+    }
+    return -1;
+}
+
+void vfs_init(void) {
+    vfs_cache_flush();
+    for (int i = 0; i < VFS_MAX_MOUNTS; i++) mounts[i].in_use = 0;
+    for (int i = 0; i < VFS_MAX_FDS; i++) fds[i].kind = FD_FREE;
+    default_mount = -1;
+
+    vfs_mount("/ram", &vfs_ramfs_ops, NULL);  // Primero: montaje por defecto
+    vfs_mount("/rom", &vfs_rom_ops, NULL);
+    vfs_mount("/sd", &vfs_sd_ops, NULL);
+}
+
+/* ========================================================================== */
+/*                          ARCHIVOS                                          */
+/* ========================================================================== */
+
+int vfs_open(const char* path, int flags) {
+    char rel[VFS_MAX_PATH];
+    int m = resolve(path, rel);
+    if (m < 0) return -1;
+
+    const vfs_mount_t* mnt = &mounts[m];
+    if (!mnt->ops->open) return -1;
+
+    int fd = find_free_fd();
+    if (fd < 0) return -1;
+
+    int read_only = is_read_only(flags);
+    int h = -1;
+
+    if (read_only && mnt->ops->seek) {
+        h = cache_take(m, rel);
+        if (h >= 0) {
+            cache_hits++;
+        } else {
+            cache_misses++;
+        }
+    } else {
+        cache_invalidate(m, rel);  // Una escritura invalida la copia retenida
+    }
+
+    if (h < 0) {
+        h = mnt->ops->open(mnt->ctx, rel, flags);
+
+        // El backend puede haberse quedado sin descriptores por la caché
+        if (h < 0 && cache_drop(m, NULL) > 0) {
+            h = mnt->ops->open(mnt->ctx, rel, flags);
+        }
+        if (h < 0) return -1;
+    }
+
+    vfs_fd_t* f = &fds[fd];
+    f->ops = mnt->ops;
+    f->ctx = mnt->ctx;
+    f->handle = (int16_t)h;
+    f->mount = (uint8_t)m;
+    f->flags = (uint8_t)flags;
+    f->kind = FD_FILE;
+    strcpy(f->path, rel);
+    return fd;
+}
+
+int vfs_read(int fd, void* buf, uint32_t n) {
+    if (!valid_fd(fd, FD_FILE) || !fds[fd].ops->read) return -1;
+    return fds[fd].ops->read(fds[fd].ctx, fds[fd].handle, buf, n);
+}
+
+int vfs_write(int fd, const void* buf, uint32_t n) {
+    if (!valid_fd(fd, FD_FILE) || !fds[fd].ops->write) return -1;
+    return fds[fd].ops->write(fds[fd].ctx, fds[fd].handle, buf, n);
+}
+
+int vfs_seek(int fd, int offset, int whence) {
+    if (!valid_fd(fd, FD_FILE) || !fds[fd].ops->seek) return -1;
+    return fds[fd].ops->seek(fds[fd].ctx, fds[fd].handle, offset, whence);
+}
+
+int vfs_close(int fd) {
+    if (!valid_fd(fd, FD_FILE)) return -1;
+
+    vfs_fd_t* f = &fds[fd];
+    int result = 0;
+
+    if (is_read_only(f->flags) && f->ops->seek) {
+        cache_put(f->mount, f->path, f->handle);
+    } else if (f->ops->close) {
+        result = f->ops->close(f->ctx, f->handle);
+    }
+
+    f->kind = FD_FREE;
+    return result;
+}
+
+int vfs_stat(const char* path, vfs_stat_t* st) {
+    char rel[VFS_MAX_PATH];
+    int m = resolve(path, rel);
+    if (m < 0 || !mounts[m].ops->stat) return -1;
+    return mounts[m].ops->stat(mounts[m].ctx, rel, st);
+}
+
+int vfs_unlink(const char* path) {
+    char rel[VFS_MAX_PATH];
+    int m = resolve(path, rel);
+    if (m < 0 || !mounts[m].ops->unlink) return -1;
+
+    cache_invalidate(m, rel);
+    return mounts[m].ops->unlink(mounts[m].ctx, rel);
+}
+
+int vfs_mkdir(const char* path) {
+    char rel[VFS_MAX_PATH];
+    int m = resolve(path, rel);
+    if (m < 0 || !mounts[m].ops->mkdir) return -1;
+    return mounts[m].ops->mkdir(mounts[m].ctx, rel);
+}
+
+int vfs_rmdir(const char* path) {
+    char rel[VFS_MAX_PATH];
+    int m = resolve(path, rel);
+    if (m < 0 || !mounts[m].ops->rmdir) return -1;
+    return mounts[m].ops->rmdir(mounts[m].ctx, rel);
+}
+
+int vfs_copy(const char* src, const char* dst) {
+    uint8_t buf[128];
+    int total = 0;
+    int n;
+
+    // Abrir el destino con TRUNC vaciaría también el origen
+    if (same_file(src, dst)) return -1;
+
+    int in = vfs_open(src, VFS_O_RDONLY);
+    if (in < 0) return -1;
+
+    int out = vfs_open(dst, VFS_O_WRONLY | VFS_O_CREAT | VFS_O_TRUNC);
+    if (out < 0) {
+        vfs_close(in);
+        return -1;
+    }
+
+    while ((n = vfs_read(in, buf, sizeof(buf))) > 0) {
+        if (vfs_write(out, buf, (uint32_t)n) != n) {
+            total = -1;
+            break;
+        }
+        total += n;
+    }
+    if (n < 0) total = -1;
+
+    vfs_close(in);
+    if (vfs_close(out) < 0) total = -1;
+    return total;
+}
+
+int vfs_rename(const char* old_path, const char* new_path) {
+    char rel_old[VFS_MAX_PATH];
+    char rel_new[VFS_MAX_PATH];
+    int m_old = resolve(old_path, rel_old);
+    int m_new = resolve(new_path, rel_new);
+    if (m_old < 0 || m_new < 0) return -1;
+
+    if (m_old == m_new) {
+        if (!mounts[m_old].ops->rename) return -1;
+        cache_invalidate(m_old, NULL);  // Puede mover un directorio entero
+        return mounts[m_old].ops->rename(mounts[m_old].ctx, rel_old, rel_new);
+    }
+
+    // Entre backends: copiar y borrar el original (/rom/x y /ram/rom/x
+    // son el mismo archivo: borrar la "copia" lo perdería)
+    if (same_file(old_path, new_path)) return -1;
+
+    vfs_stat_t st;
+    if (vfs_stat(old_path, &st) < 0 || st.is_dir) return -1;
+    if (vfs_stat(new_path, &st) == 0) return -1;  // El destino ya existe
+    if (vfs_copy(old_path, new_path) < 0) {
+        vfs_unlink(new_path);
+        return -1;
+    }
+    return vfs_unlink(old_path);
+}
+
+/* ========================================================================== */
+/*                          DIRECTORIOS                                       */
+/* ========================================================================== */
+
+/** @return 1 si name es el prefijo (sin '/') de un montaje activo. */
+static int is_mount_name(const char* name) {
+    for (int i = 0; i < VFS_MAX_MOUNTS; i++) {
+        if (mounts[i].in_use && strcmp(mounts[i].prefix + 1, name) == 0) return 1;
+    }
+    return 0;
+}
+
+int vfs_opendir(const char* path) {
+    int fd = find_free_fd();
+    if (fd < 0 || !path) return -1;
+
+    vfs_fd_t* f = &fds[fd];
+
+    if (strcmp(path, "/") == 0 || path[0] == '\0') {
+        if (default_mount < 0) return -1;
+        f->ops = mounts[default_mount].ops;
+        f->ctx = mounts[default_mount].ctx;
+        f->mount = (uint8_t)default_mount;
+        f->handle = -1;       // Se abre al terminar de listar los montajes
+        f->root_pos = 0;
+        f->kind = FD_ROOT;
+        return fd;
+    }
+
+    char rel[VFS_MAX_PATH];
+    int m = resolve(path, rel);
+    if (m < 0 || !mounts[m].ops->opendir) return -1;
+
+    int h = mounts[m].ops->opendir(mounts[m].ctx, rel);
+    if (h < 0 && cache_drop(m, NULL) > 0) {
+        h = mounts[m].ops->opendir(mounts[m].ctx, rel);
+    }
+    if (h < 0) return -1;
+
+    f->ops = mounts[m].ops;
+    f->ctx = mounts[m].ctx;
+    f->mount = (uint8_t)m;
+    f->handle = (int16_t)h;
+    f->kind = FD_DIR;
+    return fd;
+}
+
+int vfs_readdir(int fd, vfs_dirent_t* ent) {
+    if (valid_fd(fd, FD_ROOT)) {
+        vfs_fd_t* f = &fds[fd];
+
+        // Primero los puntos de montaje (menos el de por defecto)
+        while (f->root_pos < VFS_MAX_MOUNTS) {
+            int i = f->root_pos++;
+            if (!mounts[i].in_use || i == f->mount) continue;
+
+            strcpy(ent->name, mounts[i].prefix + 1);
+            ent->is_dir = 1;
+            ent->size = 0;
+            return 1;
+        }
+
+        // Después el contenido de la raíz del montaje por defecto
+        if (!f->ops->opendir || !f->ops->readdir) return 0;
+        if (f->handle < 0) {
+            f->handle = (int16_t)f->ops->opendir(f->ctx, "/");
+            if (f->handle < 0) return 0;
+        }
+
+        // Una entrada con el nombre de un montaje queda tapada por él (el
+        // directorio de fs.c en RAMFS se llama como /rom): ya se listó
+        int r;
+        do {
+            r = f->ops->readdir(f->ctx, f->handle, ent);
+        } while (r == 1 && is_mount_name(ent->name));
+        return r;
+    }
+
+    if (!valid_fd(fd, FD_DIR) || !fds[fd].ops->readdir) return -1;
+    return fds[fd].ops->readdir(fds[fd].ctx, fds[fd].handle, ent);
+}
+
+int vfs_closedir(int fd) {
+    if (!valid_fd(fd, FD_DIR) && !valid_fd(fd, FD_ROOT)) return -1;
+
+    vfs_fd_t* f = &fds[fd];
+    if (f->handle >= 0 && f->ops->closedir) {
+        f->ops->closedir(f->ctx, f->handle);
+    }
+    f->kind = FD_FREE;
+    return 0;
+}
+
+/* ========================================================================== */
+/*                          DIAGNÓSTICO                                       */
+/* ========================================================================== */
+
+void vfs_get_stats(vfs_stats_t* stats) {
+    stats->cache_hits = cache_hits;
+    stats->cache_misses = cache_misses;
+    stats->open_fds = 0;
+    stats->cached = 0;
+    stats->mounts = 0;
+
+    for (int i = 0; i < VFS_MAX_FDS; i++) {
+        if (fds[i].kind != FD_FREE) stats->open_fds++;
+    }
+    for (int i = 0; i < VFS_CACHE_SIZE; i++) {
+        if (cache[i].in_use) stats->cached++;
+    }
+    for (int i = 0; i < VFS_MAX_MOUNTS; i++) {
+        if (mounts[i].in_use) stats->mounts++;
+    }
+}
@@ -0,0 +1,108 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - VFS - Backend RAMFS
+ * ============================================================================
+ * Adaptador directo: los flags VFS_O_* y los descriptores de RAMFS se usan
+ * tal cual, así que cada operación es una llamada a la función de RAMFS.
+ * ============================================================================
+ */
+
+#include "vfs.h"
+#include "ramfs.h"
+#include <string.h>
+
+static int ram_open(void* ctx, const char* path, int flags) {
+    (void)ctx;
+    return ramfs_open(path, flags);
+}
+
+static int ram_read(void* ctx, int h, void* buf, uint32_t n) {
+    (void)ctx;
+    return ramfs_read(h, buf, n);
+}
+
+static int ram_write(void* ctx, int h, const void* buf, uint32_t n) {
+    (void)ctx;
+    return ramfs_write(h, buf, n);
+}
+
+static int ram_seek(void* ctx, int h, int offset, int whence) {
+    (void)ctx;
+    return ramfs_seek(h, offset, whence);
+}
+
+static int ram_close(void* ctx, int h) {
+    (void)ctx;
+    return ramfs_close(h);
+}
+
+static int ram_opendir(void* ctx, const char* path) {
+    (void)ctx;
+    return ramfs_opendir(path);
+}
+
+static int ram_readdir(void* ctx, int h, vfs_dirent_t* ent) {
+    ramfs_dirent_t e;
+    (void)ctx;
+
+    int r = ramfs_readdir(h, &e);
+    if (r == 1) {
+        strcpy(ent->name, e.name);
+        ent->is_dir = (e.type == RAMFS_TYPE_DIR);
+        ent->size = e.size;
+    }
+    return r;
+}
+
+static int ram_stat(void* ctx, const char* path, vfs_stat_t* st) {
+    (void)ctx;
+
+    if (ramfs_is_dir(path)) {
+        st->is_dir = 1;
+        st->size = 0;
+        return 0;
+    }
+
+    int size = ramfs_get_size(path);
+    if (size < 0) return -1;
+    st->is_dir = 0;
+    st->size = (uint32_t)size;
+    return 0;
+}
+
+static int ram_unlink(void* ctx, const char* path) {
+    (void)ctx;
+    return ramfs_delete(path);
+}
+
+static int ram_mkdir(void* ctx, const char* path) {
+    (void)ctx;
+    return ramfs_mkdir(path);
+}
+
+static int ram_rmdir(void* ctx, const char* path) {
+    (void)ctx;
+    return ramfs_rmdir(path);
+}
+
+static int ram_rename(void* ctx, const char* old_path, const char* new_path) {
+    (void)ctx;
+    return ramfs_rename(old_path, new_path);
+}
+
+const vfs_ops_t vfs_ramfs_ops = {
+    .name     = "ramfs",
+    .open     = ram_open,
+    .read     = ram_read,
+    .write    = ram_write,
+    .seek     = ram_seek,
+    .close    = ram_close,
+    .opendir  = ram_opendir,
+    .readdir  = ram_readdir,
+    .closedir = ram_close,
+    .stat     = ram_stat,
+    .unlink   = ram_unlink,
+    .mkdir    = ram_mkdir,
+    .rmdir    = ram_rmdir,
+    .rename   = ram_rename,
+};
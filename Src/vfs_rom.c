@@ -0,0 +1,124 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - VFS - Backend ROM (fs.c)
+ * ============================================================================
+ * Expone el almacén heredado de fs.c en solo lectura. Es plano: todos los
+ * archivos cuelgan de la raíz del montaje. Los handles del backend son los
+ * de fs.c (con generación): uno ya cerrado se rechaza.
+ * ============================================================================
+ */
+
+#include "vfs.h"
+#include "fs.h"
+#include <string.h>
+
+#define ROM_MAX_DIRS 2
+
+// Cursores de directorio (siguiente ranura de inodo), -1 = libre
+static int8_t rom_dirs[ROM_MAX_DIRS] = { -1, -1 };
+
+/**
+ * Convertir "/nombre" en "nombre"; rechaza subdirectorios
+ */
+static const char* rom_name(const char* path) {
+    if (path[0] == '/') path++;
+    return strchr(path, '/') ? NULL : path;
+}
+
+static int rom_open(void* ctx, const char* path, int flags) {
+    (void)ctx;
+
+    if ((flags & VFS_O_RDWR) != VFS_O_RDONLY || (flags & (VFS_O_CREAT | VFS_O_TRUNC))) {
+        return -1; // Solo lectura
+    }
+
+    const char* name = rom_name(path);
+    if (!name) return -1;
+
+    return fs_open_fd(name);
+}
+
+static int rom_read(void* ctx, int h, void* buf, uint32_t n) {
+    (void)ctx;
+    return fs_read_fd(h, buf, n);
+}
+
+static int rom_seek(void* ctx, int h, int offset, int whence) {
+    (void)ctx;
+    return fs_seek_fd(h, offset, whence);  // FS_SEEK_* == VFS_SEEK_*
+}
+
+static int rom_close(void* ctx, int h) {
+    (void)ctx;
+    return fs_close_fd(h);
+}
+
+static int rom_opendir(void* ctx, const char* path) {
+    (void)ctx;
+
+    if (strcmp(path, "/") != 0) return -1;
+
+    for (int i = 0; i < ROM_MAX_DIRS; i++) {
+        if (rom_dirs[i] < 0) {
+            rom_dirs[i] = 0;
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int rom_readdir(void* ctx, int h, vfs_dirent_t* ent) {
+    (void)ctx;
+
+    while (rom_dirs[h] < FS_MAX_FILES) {
+        const char* name = fs_name_at(rom_dirs[h]++);
+        if (name) {
+            strcpy(ent->name, name);
+            ent->is_dir = 0;
+            ent->size = (uint32_t)fs_get_size(name);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int rom_closedir(void* ctx, int h) {
+    (void)ctx;
+    rom_dirs[h] = -1;
+    return 0;
+}
+
+static int rom_stat(void* ctx, const char* path, vfs_stat_t* st) {
+    (void)ctx;
+
+    if (strcmp(path, "/") == 0) {
+        st->is_dir = 1;
+        st->size = 0;
+        return 0;
+    }
+
+    const char* name = rom_name(path);
+    int size = name ? fs_get_size(name) : -1;
+    if (size < 0) return -1;
+
+    st->is_dir = 0;
+    st->size = (uint32_t)size;
+    return 0;
+}
+
+const vfs_ops_t vfs_rom_ops = {
+    .name     = "rom",
+    .open     = rom_open,
+    .read     = rom_read,
+    .write    = NULL,
+    .seek     = rom_seek,
+    .close    = rom_close,
+    .opendir  = rom_opendir,
+    .readdir  = rom_readdir,
+    .closedir = rom_closedir,
+    .stat     = rom_stat,
+    .unlink   = NULL,
+    .mkdir    = NULL,
+    .rmdir    = NULL,
+    .rename   = NULL,
+};
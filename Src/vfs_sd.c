@@ -0,0 +1,106 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - VFS - Backend SD (FAT32)
+ * ============================================================================
+ * Envoltura directa de fat.c: los modos y orígenes de seek tienen los
+ * mismos valores en ambos lados. Mientras no haya un volumen montado
+ * (daos_sd_mount) todas las operaciones fallan.
+ * ============================================================================
+ */
+
+#include "vfs.h"
+#include "fat.h"
+#include <string.h>
+
+static int sd_open(void* ctx, const char* path, int flags) {
+    (void)ctx;
+    return fat_open(path, flags);
+}
+
+static int sd_read(void* ctx, int h, void* buf, uint32_t n) {
+    (void)ctx;
+    return fat_read(h, buf, n);
+}
+
+static int sd_write(void* ctx, int h, const void* buf, uint32_t n) {
+    (void)ctx;
+    return fat_write(h, buf, n);
+}
+
+static int sd_seek(void* ctx, int h, int offset, int whence) {
+    (void)ctx;
+    return fat_seek(h, offset, whence);
+}
+
+static int sd_close(void* ctx, int h) {
+    (void)ctx;
+    return fat_close(h);
+}
+
+static int sd_opendir(void* ctx, const char* path) {
+    (void)ctx;
+    return fat_opendir(path);
+}
+
+static int sd_readdir(void* ctx, int h, vfs_dirent_t* ent) {
+    fat_dirent_t e;
+    (void)ctx;
+
+    int r = fat_readdir(h, &e);
+    if (r == 1) {
+        strncpy(ent->name, e.name, VFS_MAX_NAME - 1);  // Nombres largos se recortan
+        ent->name[VFS_MAX_NAME - 1] = '\0';
+        ent->is_dir = e.is_dir;
+        ent->size = e.size;
+    }
+    return r;
+}
+
+static int sd_stat(void* ctx, const char* path, vfs_stat_t* st) {
+    uint8_t is_dir;
+    (void)ctx;
+
+    int size = fat_stat(path, &is_dir);
+    if (size < 0) return -1;
+
+    st->is_dir = is_dir;
+    st->size = (uint32_t)size;
+    return 0;
+}
+
+static int sd_unlink(void* ctx, const char* path) {
+    (void)ctx;
+    return fat_unlink(path);
+}
+
+static int sd_mkdir(void* ctx, const char* path) {
+    (void)ctx;
+    return fat_mkdir(path);
+}
+
+static int sd_rmdir(void* ctx, const char* path) {
+    (void)ctx;
+    return fat_rmdir(path);
+}
+
+static int sd_rename(void* ctx, const char* old_path, const char* new_path) {
+    (void)ctx;
+    return fat_rename(old_path, new_path);
+}
+
+const vfs_ops_t vfs_sd_ops = {
+    .name     = "fat32",
+    .open     = sd_open,
+    .read     = sd_read,
+    .write    = sd_write,
+    .seek     = sd_seek,
+    .close    = sd_close,
+    .opendir  = sd_opendir,
+    .readdir  = sd_readdir,
+    .closedir = sd_close,
+    .stat     = sd_stat,
+    .unlink   = sd_unlink,
+    .mkdir    = sd_mkdir,
+    .rmdir    = sd_rmdir,
+    .rename   = sd_rename,
+};
@@ -0,0 +1,236 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Ritmo de cuadros alineado al refresco del panel
+ * ============================================================================
+ * Ver vsync.h. Los instantes son ciclos de 32 bits y se comparan por
+ * diferencia con signo: el DWT da la vuelta cada 268 s sin que importe.
+ * ============================================================================
+ */
+
+#include "vsync.h"
+#include "pantalla.h"
+#include <string.h>
+
+#ifndef DAOS_HOST
+#define DWT_CYCCNT    (*(volatile uint32_t*)0xE0001004)
+#endif
+
+/** Ciclos por microsegundo (HSI a 16 MHz, sin PLL). */
+#define TICKS_US 16
+
+#define US(t) ((t) / TICKS_US)
+
+/** Un present que llega más tarde que esto es otro juego o una pausa. */
+#define RESTART_MS 1000
+
+/* ========================================================================== */
+/*                          ESTADO                                            */
+/* ========================================================================== */
+
+// Lo escribe también la interrupción del TE
+static volatile uint32_t period = VSYNC_PERIOD_US * TICKS_US;
+static volatile uint32_t phase;       // Comienzo de un barrido conocido
+static volatile uint8_t source = VSYNC_SRC_CLOCK;
+static volatile uint32_t last_te;
+static volatile uint8_t have_te;
+
+static uint32_t last_read;            // Última lectura de la línea
+static uint8_t have_read;
+static uint32_t read_start;           // Comienzo de barrido que dio esa lectura
+static uint8_t read_failed;           // El panel no contesta: solo reloj
+
+// Cuadro siguiente
+static uint8_t pacing;                // Hubo un cuadro: target y wake valen
+static uint32_t target;               // Refresco que le toca
+static uint32_t wake;                 // Cuándo debería despertar la tarea
+static uint32_t render;               // Desde wake hasta present (media)
+static uint8_t deferred;              // El último present no envió: falta el refresco
+
+static vsync_stats_t stats;
+
+uint32_t vsync_clock(void) {
+#ifdef DAOS_HOST
+    return vsync_host_clock();
+#else
+    return DWT_CYCCNT;
+#endif
+}
+
+void vsync_init(void) {
+    period = VSYNC_PERIOD_US * TICKS_US;
+    phase = vsync_clock();
+    source = VSYNC_SRC_CLOCK;
+    have_te = 0;
+    have_read = 0;
+    read_failed = 0;
+    pacing = 0;
+    render = 0;
+    deferred = 0;
+
+    memset(&stats, 0, sizeof(stats));
+}
+
+/* ========================================================================== */
+/*                          REFRESCO                                          */
+/* ========================================================================== */
+
+void vsync_te_edge(uint32_t now) {
+    if (have_te) {
+        uint32_t d = now - last_te;
+
+        // Un flanco perdido (o uno de más) no cuenta para el periodo
+        if (d > period / 2 && d < period * 2) {
+            period += ((int32_t)(d - period)) / 8;
+        }
+    }
+    last_te = now;
+    have_te = 1;
+    phase = now;
+    source = VSYNC_SRC_TE;
+}
+
+void vsync_scanline(uint32_t now, uint16_t line) {
+    uint32_t p = period;
+    uint32_t start;
+
+    if (source == VSYNC_SRC_TE) return;
+    if (line >= VSYNC_LINES) line = VSYNC_LINES - 1;
+
+    start = now - (uint32_t)(((uint64_t)p * line) / VSYNC_LINES);
+
+    if (source == VSYNC_SRC_SCANLINE) {
+        // El barrido se adelantó o atrasó err ciclos en n refrescos desde
+        // la lectura anterior: corregir la mitad por refresco. Se compara
+        // con esa lectura y no con phase, que cada present mueve a su
+        // refresco estimado y ya arrastra parte del error.
+        uint32_t x = start - read_start;
+        uint32_t n = (x + p / 2) / p;
+        int32_t err = (int32_t)(x - n * p);
+
+        if (n > 0) {
+            p += err / (int32_t)(2 * n);
+            if (p < VSYNC_PERIOD_US * TICKS_US * 3 / 4) p = VSYNC_PERIOD_US * TICKS_US * 3 / 4;
+            if (p > VSYNC_PERIOD_US * TICKS_US * 5 / 4) p = VSYNC_PERIOD_US * TICKS_US * 5 / 4;
+            period = p;
+        }
+    }
+    read_start = start;
+    phase = start;
+    source = VSYNC_SRC_SCANLINE;
+}
+
+uint32_t vsync_next(uint32_t now) {
+    uint32_t p = period;
+    uint32_t base = phase;
+    uint32_t since = now - base;
+
+    if ((int32_t)since <= 0) return base;
+    return base + ((since + p - 1) / p) * p;
+}
+
+/** Sin TE, leer la línea del panel cada VSYNC_RESYNC_MS. */
+static void resync(uint32_t now) {
+    int line;
+
+    if (source == VSYNC_SRC_TE || read_failed) return;
+    if (have_read && now - last_read < VSYNC_RESYNC_MS * 1000 * TICKS_US) return;
+
+    line = pantalla_get_scanline();
+    last_read = now;
+    have_read = 1;
+    if (line < 0) {
+        if (source == VSYNC_SRC_CLOCK) read_failed = 1;
+        return;
+    }
+    vsync_scanline(now, (uint16_t)line);
+}
+
+/* ========================================================================== */
+/*                          PRESENTAR                                         */
+/* ========================================================================== */
+
+uint32_t vsync_present(uint32_t interval_ms, vsync_flush_fn flush) {
+    uint32_t now = vsync_clock();
+    uint32_t flip, start, end, lead, refreshes, sleep_ms;
+    uint32_t p;
+
+    resync(now);
+    p = period;
+
+    if (pacing && (int32_t)(now - wake) > (int32_t)(RESTART_MS * 1000 * TICKS_US)) pacing = 0;
+
+    // Lo que tardó en dibujar desde que debía despertar (una vez por cuadro:
+    // al volver de un aplazamiento ya se contó)
+    if (pacing && !deferred) {
+        int32_t took = (int32_t)(now - wake);
+
+        if (took < 0) took = 0;
+        render += (took - (int32_t)render) / 4;
+    }
+
+    flip = vsync_next(now);
+    if (flush) {
+        // La espera activa no pasa de VSYNC_MARGIN_US (más el redondeo a
+        // ms): si el refresco queda más lejos, el resto se duerme
+        uint32_t far = flip - now;
+
+        if ((int32_t)far > (int32_t)(VSYNC_MARGIN_US * TICKS_US)) {
+            sleep_ms = (far - VSYNC_MARGIN_US * TICKS_US) / (1000 * TICKS_US);
+            if (sleep_ms > 0) {
+                if (!deferred) stats.deferred++;
+                deferred = 1;
+                return sleep_ms;
+            }
+        }
+
+        // Tarde por un refresco entero (no por el ajuste de la fase)
+        if (pacing && (int32_t)(flip - target) > (int32_t)(p / 2)) stats.dropped++;
+
+        while ((int32_t)(flip - vsync_clock()) > 0) {
+        }
+
+        start = vsync_clock();
+        flush();
+        end = vsync_clock();
+
+        stats.frames++;
+        stats.latency_total_us += US(start - now);
+        if (US(start - now) > stats.latency_max_us) stats.latency_max_us = US(start - now);
+        stats.flush_total_us += US(end - start);
+        if (end - start > p) stats.torn++;
+    }
+    deferred = 0;
+
+    // Sin TE no llegan flancos: la fase avanza con cada cuadro para que la
+    // cuenta no se aleje
+    if (source != VSYNC_SRC_TE) phase = flip;
+
+    // El próximo cuadro va interval_ms más tarde, en un refresco entero
+    refreshes = (interval_ms * 1000 * TICKS_US + p / 2) / p;
+    if (refreshes == 0) refreshes = 1;
+    target = flip + refreshes * p;
+
+    // Despertar con tiempo para dibujar (lo que suele tardar más un margen);
+    // lo que sobre se espera en el próximo present
+    lead = render + VSYNC_MARGIN_US * TICKS_US;
+    now = vsync_clock();
+    sleep_ms = 0;
+    if ((int32_t)(target - lead - now) > 0) {
+        sleep_ms = (target - lead - now) / (1000 * TICKS_US);
+    }
+    wake = now + sleep_ms * 1000 * TICKS_US;
+    pacing = 1;
+
+    return sleep_ms;
+}
+
+uint8_t vsync_pending(void) {
+    return deferred;
+}
+
+void vsync_get_stats(vsync_stats_t* out) {
+    if (!out) return;
+    *out = stats;
+    out->period_us = US(period);
+    out->source = source;
+}
@@ -0,0 +1,405 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Imágenes FAT32 para las pruebas del host
+ * ============================================================================
+ * Ver fat_image.h. Solo cubre lo que fat.c escribe: sectores de 512
+ * bytes, sin particiones y nombres largos en ASCII.
+ * ============================================================================
+ */
+
+#include "fat_image.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SECTOR 512
+#define RESERVED 32
+#define NUM_FATS 2
+#define EOC 0x0FFFFFFF
+#define BAD 0x0FFFFFF7
+#define MAX_ENTRIES 4096      // Entradas cortas por directorio que se comparan
+
+static void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    put16(p, (uint16_t)v);
+    put16(p + 2, (uint16_t)(v >> 16));
+}
+
+static uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return get16(p) | ((uint32_t)get16(p + 2) << 16);
+}
+
+/* ========================================================================== */
+/*                          FORMATEAR                                         */
+/* ========================================================================== */
+
+int fat_image_format(const char* path, uint32_t sectors, uint8_t sec_per_clus) {
+    uint32_t fat_size = (sectors - RESERVED) / (sec_per_clus * 128 + NUM_FATS) + 1;
+    uint32_t clusters = (sectors - RESERVED - NUM_FATS * fat_size) / sec_per_clus;
+    uint8_t* img = calloc(sectors, SECTOR);
+    FILE* f;
+
+    if (!img) return -1;
+
+    // Sector de arranque con el BPB
+    uint8_t* bs = img;
+    memcpy(bs, "\xEB\x58\x90" "MSWIN4.1", 11);
+    put16(bs + 11, SECTOR);
+    bs[13] = sec_per_clus;
+    put16(bs + 14, RESERVED);
+    bs[16] = NUM_FATS;
+    bs[21] = 0xF8;
+    put16(bs + 24, 32);
+    put16(bs + 26, 64);
+    put32(bs + 32, sectors);
+    put32(bs + 36, fat_size);
+    put32(bs + 44, 2);                // Raíz en el cluster 2
+    put16(bs + 48, 1);                // FSInfo
+    put16(bs + 50, 6);                // Copia del arranque
+    bs[64] = 0x80;
+    bs[66] = 0x29;
+    put32(bs + 67, 0x20260101);
+    memcpy(bs + 71, "NO NAME    FAT32   ", 19);
+    put16(bs + 510, 0xAA55);
+
+    // FSInfo: todo libre salvo la raíz
+    uint8_t* fsi = img + SECTOR;
+    put32(fsi, 0x41615252);
+    put32(fsi + 484, 0x61417272);
+    put32(fsi + 488, clusters - 1);
+    put32(fsi + 492, 3);
+    put32(fsi + 508, 0xAA550000);
+
+    memcpy(img + 6 * SECTOR, img, 2 * SECTOR);
+
+    for (int k = 0; k < NUM_FATS; k++) {
+        uint8_t* fat = img + (RESERVED + k * fat_size) * SECTOR;
+        put32(fat, 0x0FFFFFF8);
+        put32(fat + 4, EOC);
+        put32(fat + 8, EOC);
+    }
+
+    f = fopen(path, "wb");
+    if (!f) {
+        free(img);
+        return -1;
+    }
+    size_t n = fwrite(img, SECTOR, sectors, f);
+    fclose(f);
+    free(img);
+    return (n == sectors) ? 0 : -1;
+}
+
+int fat_image_mark_bad(const char* path, uint32_t first, uint32_t count) {
+    uint8_t bs[SECTOR];
+    uint8_t entry[4];
+    FILE* f = fopen(path, "r+b");
+
+    if (!f) return -1;
+    if (fread(bs, 1, SECTOR, f) != SECTOR) {
+        fclose(f);
+        return -1;
+    }
+
+    uint32_t fat_lba = get16(bs + 14);
+    uint32_t fat_size = get32(bs + 36);
+    int result = 0;
+
+    put32(entry, BAD);
+    for (uint32_t c = first; c < first + count; c++) {
+        for (int k = 0; k < bs[16]; k++) {
+            long off = (long)(fat_lba + k * fat_size) * SECTOR + c * 4;
+            if (fseek(f, off, SEEK_SET) != 0 || fwrite(entry, 1, 4, f) != 4) result = -1;
+        }
+    }
+
+    // FSInfo: los defectuosos no cuentan como libres
+    uint8_t fsi[4];
+    fseek(f, SECTOR + 488, SEEK_SET);
+    if (fread(fsi, 1, 4, f) != 4) result = -1;
+    put32(fsi, get32(fsi) - count);
+    fseek(f, SECTOR + 488, SEEK_SET);
+    if (fwrite(fsi, 1, 4, f) != 4) result = -1;
+
+    fclose(f);
+    return result;
+}
+
+/* ========================================================================== */
+/*                          LEER LA IMAGEN                                    */
+/* ========================================================================== */
+
+typedef struct {
+    uint8_t* data;
+    long len;
+    uint32_t fat_lba;
+    uint32_t data_lba;
+    uint32_t cluster_bytes;
+    uint32_t clusters;
+    uint32_t root;
+    uint8_t* used;            // Cluster ya visto en alguna cadena
+    int errors;
+    uint32_t files;
+} image_t;
+
+#define FAIL(img, ...) do { fprintf(stderr, "fsck: " __VA_ARGS__); fputc('\n', stderr); (img)->errors++; } while (0)
+
+static int image_load(image_t* img, const char* path) {
+    FILE* f = fopen(path, "rb");
+
+    memset(img, 0, sizeof(*img));
+    if (!f) return -1;
+    fseek(f, 0, SEEK_END);
+    img->len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    img->data = malloc(img->len);
+    if (!img->data || fread(img->data, 1, img->len, f) != (size_t)img->len) {
+        fclose(f);
+        free(img->data);
+        return -1;
+    }
+    fclose(f);
+
+    const uint8_t* bs = img->data;
+    uint32_t reserved = get16(bs + 14);
+    uint32_t fat_size = get32(bs + 36);
+    uint32_t meta = reserved + bs[16] * fat_size;
+
+    if (get16(bs + 11) != SECTOR || bs[13] == 0 || get32(bs + 32) <= meta) {
+        free(img->data);
+        return -1;
+    }
+
+    img->fat_lba = reserved;
+    img->data_lba = meta;
+    img->cluster_bytes = bs[13] * SECTOR;
+    img->clusters = (get32(bs + 32) - meta) / bs[13];
+    img->root = get32(bs + 44);
+    img->used = calloc(img->clusters + 2, 1);
+
+    if (bs[16] > 1 && memcmp(img->data + img->fat_lba * SECTOR,
+                             img->data + (img->fat_lba + fat_size) * SECTOR,
+                             fat_size * SECTOR) != 0) {
+        FAIL(img, "las copias de la FAT no coinciden");
+    }
+    return 0;
+}
+
+static uint32_t fat_next(const image_t* img, uint32_t c) {
+    return get32(img->data + img->fat_lba * SECTOR + c * 4) & 0x0FFFFFFF;
+}
+
+static uint8_t* cluster_ptr(const image_t* img, uint32_t c) {
+    return img->data + (size_t)img->data_lba * SECTOR + (size_t)(c - 2) * img->cluster_bytes;
+}
+
+/**
+ * Recorrer una cadena marcando sus clusters
+ * @param out Si no es NULL, recibe los clusters (hasta max).
+ * @return Clusters de la cadena.
+ */
+static uint32_t walk_chain(image_t* img, uint32_t c, const char* what,
+                           uint32_t* out, uint32_t max) {
+    uint32_t n = 0;
+
+    while (c >= 2 && c < 0x0FFFFFF8) {
+        if (c >= img->clusters + 2) {
+            FAIL(img, "%s: cluster %u fuera del volumen", what, c);
+            break;
+        }
+        if (img->used[c]) {
+            FAIL(img, "%s: cluster %u cruzado con otra cadena", what, c);
+            break;
+        }
+        img->used[c] = 1;
+        if (out && n < max) out[n] = c;
+        n++;
+        c = fat_next(img, c);
+    }
+    return n;
+}
+
+static uint8_t sfn_checksum(const uint8_t* sfn) {
+    uint8_t sum = 0;
+    for (int i = 0; i < 11; i++) sum = (uint8_t)(((sum & 1) << 7) + (sum >> 1) + sfn[i]);
+    return sum;
+}
+
+static const uint8_t lfn_offsets[13] = { 1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30 };
+
+static char lower(uint8_t c, int fold) {
+    return (char)((fold && c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c);
+}
+
+/** Nombre de una entrada: el largo si lo hay, si no el 8.3 (con NTRes). */
+static void entry_name(const uint8_t* e, const char* lfn, char* out) {
+    int n = 0;
+
+    if (lfn[0]) {
+        strcpy(out, lfn);
+        return;
+    }
+    for (int i = 0; i < 8 && e[i] != ' '; i++) out[n++] = lower(e[i], e[12] & 0x08);
+    if (e[8] != ' ') {
+        out[n++] = '.';
+        for (int i = 8; i < 11 && e[i] != ' '; i++) out[n++] = lower(e[i], e[12] & 0x10);
+    }
+    out[n] = 0;
+}
+
+/**
+ * Revisar un directorio y, recursivamente, lo que contiene
+ * @param find Si no es NULL, nombre que se busca en el directorio dir.
+ * @return Tamaño del archivo buscado, o -1.
+ */
+static int check_dir(image_t* img, uint32_t cluster, const char* path,
+                     const char* dir, const char* find) {
+    uint32_t max = img->clusters;
+    uint32_t* chain = malloc(max * sizeof(uint32_t));
+    uint8_t (*seen)[11] = malloc(MAX_ENTRIES * 11);
+    uint32_t n = walk_chain(img, cluster, path, chain, max);
+    uint32_t per_cluster = img->cluster_bytes / 32;
+    int num_seen = 0;
+    int found = -1;
+    char lfn[260] = "";
+    int lfn_next = 0;             // Ordinal de la próxima entrada LFN esperada
+    uint8_t lfn_sum = 0;
+
+    for (uint32_t i = 0; i < n * per_cluster; i++) {
+        const uint8_t* e = cluster_ptr(img, chain[i / per_cluster]) + (i % per_cluster) * 32;
+
+        if (e[0] == 0x00) break;
+        if (e[0] == 0xE5) {
+            lfn_next = 0;
+            lfn[0] = 0;
+            continue;
+        }
+
+        if ((e[11] & 0x3F) == 0x0F) {
+            int ord = e[0] & 0x1F;
+
+            if (e[0] & 0x40) {
+                lfn_next = ord;
+                lfn_sum = e[13];
+                memset(lfn, 0, sizeof(lfn));
+            } else if (ord != lfn_next || e[13] != lfn_sum) {
+                FAIL(img, "%s: secuencia LFN rota", path);
+                lfn_next = 0;
+                continue;
+            }
+            for (int k = 0; k < 13; k++) {
+                uint16_t ch = get16(e + lfn_offsets[k]);
+                if (ch != 0 && ch != 0xFFFF && (ord - 1) * 13 + k < 255) {
+                    lfn[(ord - 1) * 13 + k] = (char)ch;
+                }
+            }
+            lfn_next--;
+            continue;
+        }
+
+        // Entrada corta: cierra la secuencia LFN pendiente
+        if (lfn[0] && (lfn_next != 0 || lfn_sum != sfn_checksum(e))) {
+            FAIL(img, "%s: la LFN \"%s\" no corresponde a su alias", path, lfn);
+            lfn[0] = 0;
+        }
+        lfn_next = 0;
+
+        if (e[11] & 0x08) {
+            lfn[0] = 0;
+            continue;
+        }
+        if (e[0] == '.') {
+            lfn[0] = 0;
+            continue;
+        }
+
+        for (int k = 0; k < num_seen; k++) {
+            if (memcmp(seen[k], e, 11) == 0) {
+                FAIL(img, "%s: alias %.11s repetido", path, (const char*)e);
+            }
+        }
+        if (num_seen < MAX_ENTRIES) memcpy(seen[num_seen++], e, 11);
+
+        char name[260];
+        char sub[512];
+        uint32_t first = ((uint32_t)get16(e + 20) << 16) | get16(e + 26);
+        uint32_t size = get32(e + 28);
+
+        entry_name(e, lfn, name);
+        lfn[0] = 0;
+        snprintf(sub, sizeof(sub), "%s%s%s", path, strcmp(path, "/") ? "/" : "", name);
+
+        if (e[11] & 0x10) {
+            int in_sub = check_dir(img, first, sub, dir, find);
+            if (in_sub >= 0) found = in_sub;
+            continue;
+        }
+
+        uint32_t need = (size + img->cluster_bytes - 1) / img->cluster_bytes;
+        uint32_t got = walk_chain(img, first, sub, NULL, 0);
+        if (got != need) FAIL(img, "%s: %u bytes en %u clusters", sub, size, got);
+        img->files++;
+
+        if (find && strcmp(path, dir) == 0 && strcmp(name, find) == 0) found = (int)size;
+    }
+
+    free(seen);
+    free(chain);
+    return found;
+}
+
+static int image_check(image_t* img, const char* dir, const char* find) {
+    int found = check_dir(img, img->root, "/", dir, find);
+    uint32_t in_use = 0;
+
+    for (uint32_t c = 2; c < img->clusters + 2; c++) {
+        if (img->used[c] || fat_next(img, c) == BAD) {
+            in_use++;
+        } else if (fat_next(img, c) != 0) {
+            FAIL(img, "cluster %u reservado pero perdido", c);
+        }
+    }
+
+    uint32_t fsi_free = get32(img->data + SECTOR + 488);
+    if (fsi_free != 0xFFFFFFFF && fsi_free != img->clusters - in_use) {
+        FAIL(img, "FSInfo dice %u libres, hay %u", fsi_free, img->clusters - in_use);
+    }
+    return found;
+}
+
+static void image_free(image_t* img) {
+    free(img->used);
+    free(img->data);
+}
+
+/* ========================================================================== */
+/*                          API                                               */
+/* ========================================================================== */
+
+int fat_image_check(const char* path, uint32_t* files) {
+    image_t img;
+
+    if (image_load(&img, path) < 0) return -1;
+    image_check(&img, "/", NULL);
+    if (files) *files = img.files;
+    image_free(&img);
+    return img.errors;
+}
+
+int fat_image_find(const char* path, const char* dir, const char* name) {
+    image_t img;
+    int size;
+
+    if (image_load(&img, path) < 0) return -1;
+    size = image_check(&img, dir, name);
+    image_free(&img);
+    return size;
+}
@@ -0,0 +1,53 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Imágenes FAT32 para las pruebas del host
+ * ============================================================================
+ * Formatear una imagen vacía y revisarla después como lo haría fsck.fat,
+ * leyendo el archivo directamente (sin pasar por fat.c ni por la caché):
+ * lo que la revisión ve es lo que quedaría en la tarjeta si se cortara la
+ * alimentación en ese momento.
+ * ============================================================================
+ */
+
+#ifndef FAT_IMAGE_H // Guarda de inclusión para las imágenes de prueba
+#define FAT_IMAGE_H
+
+#pragma once
+#include <stdint.h>
+
+/**
+ * Crear una imagen FAT32 sin particiones, con el directorio raíz vacío.
+ * @param path Archivo a crear (se sobrescribe).
+ * @param sectors Sectores de 512 bytes de la imagen.
+ * @param sec_per_clus Sectores por cluster.
+ * @return 0 si OK, -1 si error.
+ */
+int fat_image_format(const char* path, uint32_t sectors, uint8_t sec_per_clus);
+
+/**
+ * Marcar clusters como defectuosos (0x0FFFFFF7) en todas las copias de la
+ * FAT y descontarlos de los libres de FSInfo.
+ * @return 0 si OK, -1 si error.
+ */
+int fat_image_mark_bad(const char* path, uint32_t first, uint32_t count);
+
+/**
+ * Revisar la imagen: copias de la FAT iguales, cadenas sin cruces ni
+ * clusters fuera del volumen, tamaños que caben en su cadena, clusters
+ * perdidos (los defectuosos no lo son), contador libre de FSInfo, sumas
+ * de las entradas LFN y alias 8.3 únicos en cada directorio. Cada error
+ * se imprime por stderr.
+ * @param path Imagen a revisar.
+ * @param files Salida: archivos encontrados (puede ser NULL).
+ * @return Número de errores (0 si la imagen está bien), -1 si no se puede leer.
+ */
+int fat_image_check(const char* path, uint32_t* files);
+
+/**
+ * Buscar un archivo por su nombre largo en la imagen (comparación exacta).
+ * @param dir Ruta del directorio ("/" o "/logs").
+ * @return Tamaño del archivo, o -1 si no está.
+ */
+int fat_image_find(const char* path, const char* dir, const char* name);
+
+#endif /* FAT_IMAGE_H */
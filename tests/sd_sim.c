@@ -0,0 +1,435 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Tarjeta SD simulada para las pruebas del host
+ * ============================================================================
+ * Ver sd_sim.h. Solo cubre lo que usa sd.c: arranque (CMD0, CMD8, CMD59,
+ * ACMD41, CMD58, CMD16), lecturas CMD17/CMD18 + CMD12 y escrituras
+ * CMD24/CMD25 con ACMD23. Las respuestas salen por una cola: cada byte que
+ * el host envía devuelve el siguiente de la cola (0xFF si está vacía).
+ * ============================================================================
+ */
+
+#include "sd_sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SECTOR 512
+#define QUEUE 2048                // Un bloque con token, CRC y esperas cabe de sobra
+#define ACCESS_BYTES 2            // Bytes 0xFF antes del token de datos (Nac)
+#define ACMD41_BUSY 2             // Intentos de ACMD41 que responde "idle"
+
+#define R1_IDLE 0x01
+#define R1_ILLEGAL 0x04
+#define R1_CRC 0x08
+#define R1_ADDRESS 0x20
+
+#define DATA_ACCEPTED 0xE5
+#define DATA_CRC_ERROR 0xEB
+
+/** Qué espera la tarjeta fuera de las tramas de comando. */
+enum {
+    MODE_CMD,             // Solo comandos
+    MODE_READ_MULTI,      // Enviando bloques hasta CMD12
+    MODE_WRITE_TOKEN,     // Esperando token de datos (o de parada)
+    MODE_WRITE_DATA       // Recibiendo bloque + CRC
+};
+
+static sd_sim_card_t card;
+static uint8_t* image;
+static uint32_t image_sectors;
+static sd_sim_stats_t stats;
+
+static uint8_t selected;
+static uint8_t idle;
+static uint8_t app_cmd;           // El comando anterior fue CMD55
+static uint8_t crc_on;            // CMD59: comprobar CRC7 y CRC16
+static uint32_t acmd41_count;
+static uint8_t stuck;             // ACMD41 no sale nunca de idle
+static uint32_t corrupt_lba;      // Bloque a dañar...
+static uint32_t corrupt_reads;    // ...las próximas veces que se envía
+static uint32_t corrupt_writes;   // ...las próximas veces que se recibe
+static uint8_t flip_queued;       // Hay un byte dañado en la cola...
+static uint32_t flip_at;          // ...en esta posición
+
+static uint8_t frame[6];
+static int frame_len = -1;        // -1: esperando el primer byte de una trama
+
+static int mode = MODE_CMD;
+static uint8_t write_multi;
+static uint32_t cur_sector;
+static uint8_t wbuf[SECTOR + 2];
+static int wlen;
+
+static uint8_t queue[QUEUE];
+static uint32_t q_head, q_tail;
+
+/* ========================================================================== */
+/*                          CRC Y COLA                                        */
+/* ========================================================================== */
+
+static uint8_t crc7(const uint8_t* data, int len) {
+    uint8_t crc = 0;
+
+    for (int i = 0; i < len; i++) {
+        uint8_t byte = data[i];
+        for (int b = 0; b < 8; b++) {
+            crc <<= 1;
+            if ((byte ^ crc) & 0x80) crc ^= 0x09;
+            byte <<= 1;
+        }
+    }
+    return crc & 0x7F;
+}
+
+// Bit a bit, a propósito distinto de la tabla de sd.c
+static uint16_t crc16(const uint8_t* data, int len) {
+    uint16_t crc = 0;
+
+    for (int i = 0; i < len; i++) {
+        crc ^= (uint16_t)(data[i] << 8);
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static void push(uint8_t b) {
+    queue[q_tail++ % QUEUE] = b;
+}
+
+static int queue_empty(void) {
+    return q_head == q_tail;
+}
+
+/* ========================================================================== */
+/*                          DATOS                                             */
+/* ========================================================================== */
+
+/** Encolar el bloque cur_sector: espera, token, datos y CRC16. */
+static void send_block(void) {
+    if (cur_sector >= image_sectors) {
+        push(0x09);               // Token de error: fuera de rango
+        mode = MODE_CMD;
+        return;
+    }
+
+    const uint8_t* src = image + (size_t)cur_sector * SECTOR;
+    uint16_t crc = crc16(src, SECTOR);
+
+    for (int i = 0; i < ACCESS_BYTES; i++) push(0xFF);
+    push(0xFE);
+    for (int i = 0; i < SECTOR; i++) push(src[i]);
+    if (corrupt_reads && cur_sector == corrupt_lba) {
+        // Un bit cambiado en mitad del bloque, con el CRC del original
+        flip_at = q_tail - 1 - SECTOR / 2;
+        flip_queued = 1;
+        queue[flip_at % QUEUE] ^= 0x10;
+        corrupt_reads--;
+        stats.corrupted++;
+    }
+    push((uint8_t)(crc >> 8));
+    push((uint8_t)crc);
+
+    cur_sector++;
+    stats.blocks_read++;
+}
+
+/** Bloque completo recibido: programarlo y responder. */
+static void receive_block(void) {
+    uint16_t got = (uint16_t)((wbuf[SECTOR] << 8) | wbuf[SECTOR + 1]);
+
+    mode = write_multi ? MODE_WRITE_TOKEN : MODE_CMD;
+
+    if (corrupt_writes && cur_sector == corrupt_lba) {
+        wbuf[SECTOR / 2] ^= 0x01;
+        corrupt_writes--;
+        stats.corrupted++;
+    }
+    if (crc_on && got != crc16(wbuf, SECTOR)) {
+        push(DATA_CRC_ERROR);
+        push(0x00);               // Ocupada un ciclo
+        return;
+    }
+    if (cur_sector >= image_sectors) {
+        push(0x0D);               // Error de escritura
+        push(0x00);
+        mode = MODE_CMD;
+        return;
+    }
+
+    memcpy(image + (size_t)cur_sector * SECTOR, wbuf, SECTOR);
+    cur_sector++;
+    stats.blocks_written++;
+    push(DATA_ACCEPTED);
+    push(0x00);                   // Programando
+    push(0x00);
+}
+
+/* ========================================================================== */
+/*                          COMANDOS                                          */
+/* ========================================================================== */
+
+/** Dirección de datos: en bytes para SDSC, en bloques para SDHC. */
+static int data_address(uint32_t arg, uint32_t* sector) {
+    if (card == SD_SIM_SDHC) {
+        *sector = arg;
+        return 1;
+    }
+    if (arg % SECTOR) return 0;
+    *sector = arg / SECTOR;
+    return 1;
+}
+
+static void command(void) {
+    uint8_t cmd = frame[0] & 0x3F;
+    uint32_t arg = ((uint32_t)frame[1] << 24) | ((uint32_t)frame[2] << 16) |
+                   ((uint32_t)frame[3] << 8) | frame[4];
+    uint8_t was_app = app_cmd;
+    uint8_t r1 = idle ? R1_IDLE : 0x00;
+    uint32_t sector;
+
+    app_cmd = 0;
+    stats.cmds++;
+
+    // CMD0 y CMD8 llevan siempre CRC; el resto, desde CMD59
+    if ((cmd == 0 || cmd == 8 || crc_on) && frame[5] != ((crc7(frame, 5) << 1) | 1)) {
+        stats.bad_frames++;
+        push(0xFF);
+        push(r1 | R1_CRC);
+        return;
+    }
+
+    if (cmd == 12) {
+        // Parada: se descarta lo que quedaba del flujo de lectura. Un bloque
+        // dañado que el host no llegó a recibir no cuenta como inyectado.
+        stats.cmd12++;
+        if (flip_queued && (int32_t)(flip_at - q_head) >= 0) {
+            corrupt_reads++;
+            stats.corrupted--;
+        }
+        flip_queued = 0;
+        q_head = q_tail = 0;
+        mode = MODE_CMD;
+        push(0xFF);
+        push(0x00);
+        push(0x00);               // Ocupada un ciclo
+        return;
+    }
+
+    push(0xFF);                   // Ncr
+
+    switch (cmd) {
+    case 0:
+        idle = 1;
+        crc_on = 0;
+        acmd41_count = 0;
+        push(R1_IDLE);
+        break;
+
+    case 8:
+        if (card == SD_SIM_SDSC_V1) {
+            push(R1_IDLE | R1_ILLEGAL);
+            break;
+        }
+        push(r1);
+        push(0x00);
+        push(0x00);
+        push(0x01);               // 2,7-3,6 V
+        push((uint8_t)arg);       // Patrón de eco
+        break;
+
+    case 55:
+        app_cmd = 1;
+        push(r1);
+        break;
+
+    case 41:
+        if (!was_app) {
+            push(r1 | R1_ILLEGAL);
+            break;
+        }
+        stats.acmd41++;
+        // Una SDHC no sale de idle si el host no acepta alta capacidad
+        if (card == SD_SIM_SDHC && !(arg & 0x40000000)) {
+            push(R1_IDLE);
+            break;
+        }
+        if (++acmd41_count > ACMD41_BUSY && !stuck) idle = 0;
+        push(idle ? R1_IDLE : 0x00);
+        break;
+
+    case 58:
+        push(r1);
+        push(idle ? 0x00 : (card == SD_SIM_SDHC ? 0xC0 : 0x80));  // Encendida (+ CCS)
+        push(0xFF);
+        push(0x80);
+        push(0x00);
+        break;
+
+    case 59:
+        crc_on = arg & 1;
+        push(r1);
+        break;
+
+    case 16:
+        stats.cmd16++;
+        push(arg == SECTOR ? r1 : (uint8_t)(r1 | 0x40));
+        break;
+
+    case 23:
+        if (!was_app) {
+            push(r1 | R1_ILLEGAL);
+            break;
+        }
+        stats.acmd23++;
+        stats.acmd23_blocks = arg & 0x007FFFFF;
+        push(r1);
+        break;
+
+    case 17:
+    case 18:
+    case 24:
+    case 25:
+        if (idle) {
+            push(R1_IDLE | R1_ILLEGAL);
+            break;
+        }
+        if (!data_address(arg, &sector)) {
+            push(R1_ADDRESS);
+            break;
+        }
+        cur_sector = sector;
+        push(0x00);
+        if (cmd == 17) {
+            stats.cmd17++;
+            send_block();
+        } else if (cmd == 18) {
+            stats.cmd18++;
+            mode = MODE_READ_MULTI;
+        } else {
+            if (cmd == 24) stats.cmd24++;
+            else stats.cmd25++;
+            write_multi = (cmd == 25);
+            mode = MODE_WRITE_TOKEN;
+        }
+        break;
+
+    default:
+        push(r1 | R1_ILLEGAL);
+        break;
+    }
+}
+
+/* ========================================================================== */
+/*                          BUS                                               */
+/* ========================================================================== */
+
+void sd_host_select(uint8_t sel) {
+    selected = sel;
+    if (!sel) frame_len = -1;
+}
+
+uint8_t sd_host_transfer(uint8_t in) {
+    uint8_t out;
+
+    if (card == SD_SIM_NONE || !selected) return 0xFF;
+
+    if (queue_empty() && mode == MODE_READ_MULTI) send_block();
+    if (queue_empty()) {
+        out = 0xFF;
+    } else {
+        if (flip_queued && q_head == flip_at) flip_queued = 0;
+        out = queue[q_head++ % QUEUE];
+    }
+
+    if (mode == MODE_WRITE_DATA) {
+        wbuf[wlen++] = in;
+        if (wlen == SECTOR + 2) receive_block();
+        return out;
+    }
+
+    if (mode == MODE_WRITE_TOKEN && frame_len < 0) {
+        if (in == 0xFF) return out;
+        if ((in == 0xFE && !write_multi) || (in == 0xFC && write_multi)) {
+            mode = MODE_WRITE_DATA;
+            wlen = 0;
+            return out;
+        }
+        mode = MODE_CMD;
+        if (in == 0xFD && write_multi) {
+            push(0xFF);
+            push(0x00);           // Ocupada mientras termina de programar
+            return out;
+        }
+    }
+
+    if (frame_len < 0) {
+        if ((in & 0xC0) == 0x40) {
+            frame[0] = in;
+            frame_len = 1;
+        }
+    } else {
+        frame[frame_len++] = in;
+        if (frame_len == 6) {
+            frame_len = -1;
+            command();
+        }
+    }
+    return out;
+}
+
+/* ========================================================================== */
+/*                          API                                               */
+/* ========================================================================== */
+
+void sd_sim_insert(sd_sim_card_t type, uint32_t sectors) {
+    free(image);
+    image = NULL;
+    image_sectors = 0;
+    card = type;
+    if (type != SD_SIM_NONE) {
+        image = calloc(sectors, SECTOR);
+        if (!image) {
+            fprintf(stderr, "sd_sim: sin memoria para %u sectores\n", sectors);
+            exit(1);
+        }
+        image_sectors = sectors;
+    }
+
+    idle = 1;
+    app_cmd = 0;
+    crc_on = 0;
+    acmd41_count = 0;
+    stuck = 0;
+    corrupt_reads = 0;
+    corrupt_writes = 0;
+    flip_queued = 0;
+    frame_len = -1;
+    mode = MODE_CMD;
+    q_head = q_tail = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+void sd_sim_stuck_idle(void) {
+    stuck = 1;
+}
+
+void sd_sim_corrupt(uint32_t lba, uint32_t reads, uint32_t writes) {
+    corrupt_lba = lba;
+    corrupt_reads = reads;
+    corrupt_writes = writes;
+}
+
+uint8_t* sd_sim_sector(uint32_t lba) {
+    return (lba < image_sectors) ? image + (size_t)lba * SECTOR : NULL;
+}
+
+void sd_sim_get_stats(sd_sim_stats_t* out) {
+    *out = stats;
+}
+
+void sd_sim_clear_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,79 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Tarjeta SD simulada para las pruebas del host
+ * ============================================================================
+ * sd.c compilado con -DDAOS_HOST habla con la tarjeta byte a byte por
+ * sd_host_transfer y sd_host_select. Este simulador las implementa: recibe
+ * las tramas de comando (con su CRC7), responde R1/R3/R7 y mueve bloques
+ * de datos con su CRC16 sobre una imagen en memoria, como una tarjeta en
+ * modo SPI. Cuenta cada comando para que las pruebas puedan comprobar qué
+ * órdenes usó el driver.
+ * ============================================================================
+ */
+
+#ifndef SD_SIM_H // Guarda de inclusión para la tarjeta simulada
+#define SD_SIM_H
+
+#pragma once
+#include <stdint.h>
+
+/** Tipo de tarjeta insertada. */
+typedef enum {
+    SD_SIM_NONE = 0,    /** Ranura vacía: MISO siempre a 0xFF. */
+    SD_SIM_SDSC_V1,     /** SD 1.x: no conoce CMD8, direcciones en bytes. */
+    SD_SIM_SDSC_V2,     /** SD 2.0 de capacidad estándar: direcciones en bytes. */
+    SD_SIM_SDHC         /** SDHC/SDXC: direcciones por bloque, exige HCS en ACMD41. */
+} sd_sim_card_t;
+
+/** Comandos y bloques vistos por la tarjeta. */
+typedef struct {
+    uint32_t cmds;          /** Comandos recibidos (todos). */
+    uint32_t cmd12;         /** Paradas de lectura multibloque. */
+    uint32_t cmd17;         /** Lecturas de un bloque. */
+    uint32_t cmd18;         /** Lecturas multibloque. */
+    uint32_t cmd24;         /** Escrituras de un bloque. */
+    uint32_t cmd25;         /** Escrituras multibloque. */
+    uint32_t acmd23;        /** Avisos de bloques a pre-borrar. */
+    uint32_t acmd23_blocks; /** Argumento del último ACMD23. */
+    uint32_t cmd16;         /** Cambios de tamaño de bloque. */
+    uint32_t acmd41;        /** Intentos de ACMD41. */
+    uint32_t blocks_read;   /** Bloques enviados al host. */
+    uint32_t blocks_written;/** Bloques programados en la imagen. */
+    uint32_t bad_frames;    /** Comandos con CRC7 incorrecto. */
+    uint32_t corrupted;     /** Bloques dañados a propósito (sd_sim_corrupt). */
+} sd_sim_stats_t;
+
+/**
+ * Insertar una tarjeta nueva (imagen a ceros) o vaciar la ranura. La
+ * tarjeta arranca sin inicializar, como tras encenderla.
+ * @param type Tipo de tarjeta.
+ * @param sectors Tamaño en bloques de 512 bytes.
+ */
+void sd_sim_insert(sd_sim_card_t type, uint32_t sectors);
+
+/**
+ * Tarjeta que nunca termina su arranque: ACMD41 responde siempre "idle".
+ * Se conserva hasta la siguiente sd_sim_insert.
+ */
+void sd_sim_stuck_idle(void);
+
+/**
+ * Dañar un bloque en el cable: las próximas reads veces que se envía lba
+ * lleva un bit cambiado (con el CRC16 del original), y las próximas writes
+ * veces que se recibe se rechaza por CRC.
+ */
+void sd_sim_corrupt(uint32_t lba, uint32_t reads, uint32_t writes);
+
+/**
+ * Acceder a un bloque de la imagen (para preparar datos o comprobarlos).
+ * @return Puntero a SD_BLOCK_SIZE bytes.
+ */
+uint8_t* sd_sim_sector(uint32_t lba);
+
+/** Leer los contadores. */
+void sd_sim_get_stats(sd_sim_stats_t* stats);
+
+/** Poner los contadores a cero. */
+void sd_sim_clear_stats(void);
+
+#endif /* SD_SIM_H */
@@ -0,0 +1,35 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Funciones del núcleo para las pruebas del host
+ * ============================================================================
+ * Los sistemas de archivos solo usan la UART para mensajes y el reloj del
+ * sistema: en el host la UART se descarta y millis avanza con cada
+ * consulta.
+ * ============================================================================
+ */
+
+#include <stdint.h>
+
+void uart_puts(const char* str) {
+    (void)str;
+}
+
+void uart_putint(uint32_t n) {
+    (void)n;
+}
+
+void uart_putc(char c) {
+    (void)c;
+}
+
+void uart_newline(void) {
+}
+
+uint32_t millis(void) {
+    static uint32_t ticks;
+    return ticks++ / 64;
+}
+
+void task_delay(uint32_t ms) {
+    (void)ms;
+}
@@ -0,0 +1,280 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Prueba de la E/S asíncrona en el host
+ * ============================================================================
+ * aio.c sobre el VFS real, con /sd montado en una imagen FAT32 (fat.c, la
+ * caché de bloques y el dispositivo de archivo). La tarea de E/S no es una
+ * tarea: la prueba llama a aio_task entre envío y envío.
+ *
+ * - Ascensor y fusión: una cola fija cuyo orden de servicio se conoce, con
+ *   los contadores batches, merged y reordered exactos.
+ * - Carga mixta: ráfagas al azar de lecturas, escrituras y añadidos a dos
+ *   archivos mientras la cola avanza. Una copia en memoria aplica las
+ *   escrituras en orden de envío; como las que se solapan no cambian de
+ *   orden, cada lectura debe ver esa copia tal como estaba al enviarla, y
+ *   al final los archivos deben coincidir con ella.
+ * ============================================================================
+ */
+
+#include "aio.h"
+#include "vfs.h"
+#include "fat.h"
+#include "blockdev.h"
+#include "fat_image.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMAGE "test_aio.img"
+#define IMAGE_SECTORS 16384           // 8 MB
+#define DATA "/sd/data.bin"
+#define LOG "/sd/log.txt"
+#define DATA_SIZE (64 * 1024)
+#define LOG_MAX (16 * 1024)
+#define SLOTS 16
+#define MAX_LEN 2048
+#define ROUNDS 400
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+/* En el núcleo lo libera la tarea de E/S; aquí basta con contarlo */
+void sem_post(sem_t* s) {
+    s->count++;
+}
+
+/* ========================================================================== */
+/*                          AUXILIARES                                        */
+/* ========================================================================== */
+
+static uint8_t shadow[DATA_SIZE];     // Lo que debe tener data.bin
+static uint8_t shadow_log[LOG_MAX];   // Lo que debe tener log.txt
+static uint32_t log_len;
+
+static void fill(uint8_t* p, uint32_t len, uint32_t seed) {
+    for (uint32_t i = 0; i < len; i++) p[i] = (uint8_t)(seed * 31 + i * 7 + (i >> 8));
+}
+
+static void prepare(aio_req_t* r, const char* path, uint8_t op, uint32_t offset,
+                    void* buf, uint32_t len, uint8_t flags) {
+    memset(r, 0, sizeof(*r));
+    strcpy(r->path, path);
+    r->op = op;
+    r->offset = offset;
+    r->buf = buf;
+    r->len = len;
+    r->flags = flags;
+}
+
+static void drain(void) {
+    int turns = 0;
+
+    while (aio_pending() && turns++ < 10000) aio_task();
+    CHECK(aio_pending() == 0);
+}
+
+/** Comparar un archivo entero con lo esperado. */
+static int file_equals(const char* path, const uint8_t* expect, uint32_t len) {
+    static uint8_t buf[DATA_SIZE + 1];
+    int fd = vfs_open(path, VFS_O_RDONLY);
+    int n;
+
+    if (fd < 0) return 0;
+    n = vfs_read(fd, buf, sizeof(buf));
+    vfs_close(fd);
+    return n == (int)len && memcmp(buf, expect, len) == 0;
+}
+
+/* ========================================================================== */
+/*                          PRUEBAS                                           */
+/* ========================================================================== */
+
+/**
+ * Cola fija. Tras servir W1 el cabezal queda en 10240: W4 (16384) va
+ * antes que W2 (reordered), y luego W2 arrastra a W3 y W5, contiguas
+ * (merged). El añadido a log.txt no se fusiona ni adelanta.
+ */
+static void test_elevator(void) {
+    static uint8_t buf[5][MAX_LEN], line[128];
+    static const uint32_t offset[5] = { 8192, 0, 2048, 16384, 4096 };
+    static const uint32_t len[5] = { 2048, 2048, 2048, 1024, 512 };
+    aio_req_t w[5], l;
+    aio_stats_t st0, st;
+    sem_t sem = {0};
+
+    aio_get_stats(&st0);
+    for (int i = 0; i < 5; i++) {
+        fill(buf[i], len[i], 100 + i);
+        prepare(&w[i], DATA, AIO_WRITE, offset[i], buf[i], len[i], 0);
+        w[i].sem = &sem;
+    }
+    fill(line, sizeof(line), 200);
+    prepare(&l, LOG, AIO_WRITE, 0, line, sizeof(line), VFS_O_CREAT | VFS_O_APPEND);
+
+    // W1, W2, W3, W4, añadido, W5
+    for (int i = 0; i < 4; i++) CHECK(aio_submit(&w[i]) == 0);
+    CHECK(aio_submit(&l) == 0);
+    CHECK(aio_submit(&w[4]) == 0);
+    CHECK(aio_submit(&w[0]) == -1);           // Ya está en la cola
+    CHECK(aio_pending() == 6);
+
+    drain();
+    for (int i = 0; i < 5; i++) {
+        CHECK(w[i].state == AIO_DONE && w[i].result == (int)len[i]);
+        memcpy(shadow + offset[i], buf[i], len[i]);
+    }
+    CHECK(l.state == AIO_DONE && l.result == (int)sizeof(line));
+    memcpy(shadow_log + log_len, line, sizeof(line));
+    log_len += sizeof(line);
+    CHECK(sem.count == 5);
+
+    aio_get_stats(&st);
+    CHECK(st.submitted - st0.submitted == 6);
+    CHECK(st.completed - st0.completed == 6);
+    CHECK(st.batches - st0.batches == 4);     // W1 | W4 | W2+W3+W5 | añadido
+    CHECK(st.merged - st0.merged == 2);
+    CHECK(st.reordered - st0.reordered == 1);
+    CHECK(st.errors == st0.errors);
+
+    CHECK(file_equals(DATA, shadow, DATA_SIZE));
+    CHECK(file_equals(LOG, shadow_log, log_len));
+
+    printf("  ascensor: %u grupos, %u fusionadas, %u adelantadas\n",
+           st.batches - st0.batches, st.merged - st0.merged, st.reordered - st0.reordered);
+}
+
+/* ----- Carga mixta ----- */
+
+typedef struct {
+    aio_req_t req;
+    uint8_t buf[MAX_LEN];
+    uint8_t expect[MAX_LEN];          // Lectura: lo que debe traer
+} slot_t;
+
+static slot_t slots[SLOTS];
+static uint32_t reads_checked;
+
+/** Recoger una petición terminada. */
+static void reap(slot_t* s) {
+    aio_req_t* r = &s->req;
+
+    if (!aio_is_done(r)) return;
+    CHECK(r->state == AIO_DONE && r->result == (int)r->len);
+    if (r->op == AIO_READ) {
+        CHECK(memcmp(s->buf, s->expect, r->len) == 0);
+        reads_checked++;
+    }
+    r->state = AIO_IDLE;
+}
+
+/** Enviar una petición al azar y aplicarla a la copia en memoria. */
+static void submit_random(slot_t* s, uint32_t seq) {
+    aio_req_t* r = &s->req;
+    uint32_t kind = (uint32_t)rand() % 8;
+    uint32_t len = 512u * (1 + (uint32_t)rand() % 4);
+    // Posiciones en sectores, a menudo pegadas a la anterior
+    static uint32_t last_end;
+    uint32_t offset = (rand() % 2) ? last_end : 512u * ((uint32_t)rand() % 120);
+
+    if (offset + len > DATA_SIZE) offset = DATA_SIZE - len;
+
+    if (kind == 0 && log_len + 128 <= LOG_MAX) {
+        fill(s->buf, 128, seq);
+        prepare(r, LOG, AIO_WRITE, 0, s->buf, 128, VFS_O_APPEND);
+        memcpy(shadow_log + log_len, s->buf, 128);
+        log_len += 128;
+    } else if (kind < 4) {
+        prepare(r, DATA, AIO_READ, offset, s->buf, len, 0);
+        memcpy(s->expect, shadow + offset, len);
+    } else {
+        fill(s->buf, len, seq);
+        prepare(r, DATA, AIO_WRITE, offset, s->buf, len, 0);
+        memcpy(shadow + offset, s->buf, len);
+    }
+    last_end = r->offset + r->len;
+    CHECK(aio_submit(r) == 0);
+}
+
+static void test_mixed(void) {
+    aio_stats_t st0, st;
+    uint32_t seq = 0;
+
+    aio_get_stats(&st0);
+    srand(7);
+
+    for (int round = 0; round < ROUNDS; round++) {
+        // Ráfaga de 1 a 4 peticiones en los huecos libres
+        int burst = 1 + rand() % 4;
+        for (int i = 0; i < SLOTS && burst > 0; i++) {
+            if (slots[i].req.state != AIO_IDLE) continue;
+            submit_random(&slots[i], seq++);
+            burst--;
+        }
+
+        // La tarea de E/S recibe de 0 a 3 turnos
+        for (int t = rand() % 4; t > 0; t--) aio_task();
+        for (int i = 0; i < SLOTS; i++) reap(&slots[i]);
+    }
+    drain();
+    for (int i = 0; i < SLOTS; i++) reap(&slots[i]);
+
+    aio_get_stats(&st);
+    CHECK(st.submitted - st0.submitted == seq);
+    CHECK(st.completed - st0.completed == seq);
+    CHECK(st.errors == st0.errors);
+    CHECK(st.merged > st0.merged);
+    CHECK(st.reordered > st0.reordered);
+    CHECK(st.max_depth > 4);
+
+    CHECK(file_equals(DATA, shadow, DATA_SIZE));
+    CHECK(file_equals(LOG, shadow_log, log_len));
+
+    printf("  mixta: %u peticiones (%u lecturas comprobadas), %u grupos, "
+           "%u fusionadas, %u adelantadas, cola hasta %u\n",
+           seq, reads_checked, st.batches - st0.batches, st.merged - st0.merged,
+           st.reordered - st0.reordered, st.max_depth);
+}
+
+int main(void) {
+    blockdev_t disk;
+    const blockdev_t* bd;
+    int fd;
+
+    printf("E/S asíncrona sobre FAT32:\n");
+
+    CHECK(fat_image_format(IMAGE, IMAGE_SECTORS, 1) == 0);
+    CHECK(blockdev_file_open_disk(&disk, IMAGE, FAT_SECTOR_SIZE) == 0);
+    bd = blockdev_cache_wrap(&disk);
+    CHECK(bd != NULL);
+    CHECK(fat_mount(bd) == 0);
+    vfs_init();
+
+    // data.bin ya tiene su tamaño: las escrituras no lo cambian
+    fd = vfs_open(DATA, VFS_O_WRONLY | VFS_O_CREAT | VFS_O_TRUNC);
+    CHECK(fd >= 0);
+    CHECK(vfs_write(fd, shadow, DATA_SIZE) == DATA_SIZE);
+    CHECK(vfs_close(fd) == 0);
+
+    test_elevator();
+    test_mixed();
+
+    // Lo que quedó en la imagen tras cerrar los archivos que el VFS guarda
+    vfs_cache_flush();
+    CHECK(fat_image_check(IMAGE, NULL) == 0);
+
+    fat_umount();
+    blockdev_file_close(&disk);
+
+    if (failures) {
+        printf("test_aio: %d fallos\n", failures);
+        return 1;
+    }
+    printf("test_aio: OK\n");
+    return 0;
+}
@@ -0,0 +1,198 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Tráfico de sectores con y sin la caché de bloques
+ * ============================================================================
+ * Una carga de metadatos como la de la shell (crear, leer, listar y borrar
+ * archivos de configuración pequeños) sobre una imagen FAT32, primero con
+ * fat.c directamente sobre la imagen y después sobre blockdev_cache. Un
+ * dispositivo intermedio cuenta los sectores que llegan al medio, como
+ * llegarían por SPI a la tarjeta.
+ *
+ * Se compila dos veces: con BLOCKDEV_CACHE_BLOCKS por defecto y con 32
+ * (test_blockdev_cache32). Las lecturas deben bajar al menos MIN_GAIN
+ * veces. Las escrituras bajan poco: fat_close sincroniza, así que cada
+ * archivo cerrado escribe sus sectores sucios (entrada, FAT, datos,
+ * FSInfo) aunque la caché junte lo que cambia varias veces antes. Además
+ * lo leído tiene que ser lo escrito en las dos pasadas y las dos imágenes
+ * tienen que quedar correctas.
+ * ============================================================================
+ */
+
+#include "fat.h"
+#include "blockdev.h"
+#include "fat_image.h"
+#include <stdio.h>
+#include <string.h>
+
+#define IMAGE_SECTORS 16384           // 8 MB
+#define ROUNDS 5
+#define SETTINGS 20
+#define MIN_GAIN 5
+
+#ifndef TEST_NAME
+#define TEST_NAME "test_blockdev_cache"
+#endif
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+/* ========================================================================== */
+/*                          CONTADOR DE SECTORES                              */
+/* ========================================================================== */
+
+static blockdev_t disk;               // Imagen en el host
+static blockdev_t counting;           // Lo que ve fat.c o la caché
+static uint32_t sectors_read, sectors_written;
+
+static int count_read(const blockdev_t* bd, uint32_t block, uint32_t off,
+                      void* buf, uint32_t len) {
+    (void)bd;
+    sectors_read++;
+    return disk.read(&disk, block, off, buf, len);
+}
+
+static int count_prog(const blockdev_t* bd, uint32_t block, uint32_t off,
+                      const void* buf, uint32_t len) {
+    (void)bd;
+    sectors_written++;
+    return disk.prog(&disk, block, off, buf, len);
+}
+
+static int count_read_blocks(const blockdev_t* bd, uint32_t block, uint32_t count, void* buf) {
+    (void)bd;
+    sectors_read += count;
+    return disk.read_blocks(&disk, block, count, buf);
+}
+
+static int count_prog_blocks(const blockdev_t* bd, uint32_t block, uint32_t count,
+                             const void* buf) {
+    (void)bd;
+    sectors_written += count;
+    return disk.prog_blocks(&disk, block, count, buf);
+}
+
+static int count_sync(const blockdev_t* bd) {
+    (void)bd;
+    return disk.sync ? disk.sync(&disk) : 0;
+}
+
+/* ========================================================================== */
+/*                          CARGA                                             */
+/* ========================================================================== */
+
+static void setting_path(char* out, int i) {
+    sprintf(out, "/cfg/apps/ajuste %02d.ini", i);
+}
+
+/** Archivos de ajustes reescritos, leídos y listados varias veces. */
+static void workload(void) {
+    char path[FAT_MAX_PATH], buf[64], want[64];
+    fat_dirent_t e;
+
+    CHECK(fat_mkdir("/cfg") == 0);
+    CHECK(fat_mkdir("/cfg/apps") == 0);
+
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < SETTINGS; i++) {
+            int h, n;
+
+            setting_path(path, i);
+            n = sprintf(buf, "valor=%d\n", round * 100 + i);
+            h = fat_open(path, FAT_O_WRONLY | FAT_O_CREAT | FAT_O_TRUNC);
+            CHECK(h >= 0);
+            CHECK(fat_write(h, buf, (uint32_t)n) == n);
+            CHECK(fat_close(h) == 0);
+        }
+        for (int i = 0; i < SETTINGS; i++) {
+            uint8_t is_dir;
+            int h, n, len;
+
+            setting_path(path, i);
+            len = sprintf(want, "valor=%d\n", round * 100 + i);
+            CHECK(fat_stat(path, &is_dir) == len && !is_dir);
+            h = fat_open(path, FAT_O_RDONLY);
+            n = fat_read(h, buf, sizeof(buf));
+            fat_close(h);
+            CHECK(n == len && memcmp(buf, want, (size_t)len) == 0);
+        }
+
+        int h = fat_opendir("/cfg/apps");
+        int entries = 0;
+        while (fat_readdir(h, &e) == 1) entries++;
+        fat_close(h);
+        CHECK(entries == SETTINGS);
+    }
+
+    for (int i = 0; i < SETTINGS; i += 2) {
+        setting_path(path, i);
+        CHECK(fat_unlink(path) == 0);
+    }
+}
+
+/**
+ * Formatear la imagen y pasar la carga.
+ * @return Sectores leídos más escritos.
+ */
+static uint32_t run(const char* image, int cached, uint32_t* reads, uint32_t* writes) {
+    const blockdev_t* bd;
+
+    CHECK(fat_image_format(image, IMAGE_SECTORS, 1) == 0);
+    CHECK(blockdev_file_open_disk(&disk, image, FAT_SECTOR_SIZE) == 0);
+
+    counting = disk;
+    counting.read = count_read;
+    counting.prog = count_prog;
+    counting.sync = count_sync;
+    counting.read_blocks = disk.read_blocks ? count_read_blocks : NULL;
+    counting.prog_blocks = disk.prog_blocks ? count_prog_blocks : NULL;
+    sectors_read = sectors_written = 0;
+
+    bd = cached ? blockdev_cache_wrap(&counting) : &counting;
+    CHECK(bd != NULL);
+    CHECK(fat_mount(bd) == 0);
+    workload();
+    fat_umount();
+    if (cached) CHECK(blockdev_cache_invalidate() == 0);
+    blockdev_file_close(&disk);
+
+    CHECK(fat_image_check(image, NULL) == 0);
+    *reads = sectors_read;
+    *writes = sectors_written;
+    return sectors_read + sectors_written;
+}
+
+int main(void) {
+    char image[64];
+    uint32_t plain, cached, plain_reads, reads, writes;
+    blockdev_cache_stats_t st;
+
+    printf("tráfico de sectores (%d rondas de %d ajustes):\n", ROUNDS, SETTINGS);
+    sprintf(image, "test_blockdev_cache%d.img", BLOCKDEV_CACHE_BLOCKS);
+
+    plain = run(image, 0, &plain_reads, &writes);
+    printf("  sin caché:  %5u sectores (%u leídos, %u escritos)\n", plain, plain_reads, writes);
+
+    cached = run(image, 1, &reads, &writes);
+    blockdev_cache_get_stats(&st);
+    printf("  caché de %2d: %5u sectores (%u leídos, %u escritos), "
+           "%u aciertos, %u fallos, x%.1f menos\n",
+           BLOCKDEV_CACHE_BLOCKS, cached, reads, writes, st.hits, st.misses,
+           (double)plain / cached);
+
+    CHECK(st.dirty == 0);
+    CHECK(reads * MIN_GAIN <= plain_reads);
+    CHECK(cached < plain);
+
+    if (failures) {
+        printf(TEST_NAME ": %d fallos\n", failures);
+        return 1;
+    }
+    printf(TEST_NAME ": OK\n");
+    return 0;
+}
@@ -0,0 +1,173 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Prueba de FAT32 en el host
+ * ============================================================================
+ * Formatea una imagen, la monta con fat.c sobre la caché de bloques y el
+ * dispositivo de archivo, y crea, renombra y borra nombres largos. Después
+ * de cada paso revisa la imagen en disco con fat_image_check, sin
+ * desmontar: lo cerrado tiene que estar ya en la imagen.
+ * Más de 99 nombres con la misma base 8.3 obligan a usar los alias con
+ * hash (INFORM~1 a INFORM~99 y luego IN1A2B~1...). La imagen tiene
+ * clusters marcados como defectuosos, que la reserva debe saltar.
+ * ============================================================================
+ */
+
+#include "fat.h"
+#include "fat_image.h"
+#include <stdio.h>
+#include <string.h>
+
+#define IMAGE "test_fat.img"
+#define IMAGE_SECTORS 16384           // 8 MB
+#define NUM_REPORTS 130
+#define BAD_CLUSTERS 8
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+static void report_path(char* out, const char* dir, const char* kind, int i) {
+    sprintf(out, "%s/%s semanal %03d.txt", dir, kind, i);
+}
+
+static int write_file(const char* path, const char* data) {
+    int h = fat_open(path, FAT_O_WRONLY | FAT_O_CREAT | FAT_O_TRUNC);
+    int n = (int)strlen(data);
+
+    if (h < 0) return -1;
+    if (fat_write(h, data, n) != n) {
+        fat_close(h);
+        return -1;
+    }
+    return fat_close(h);
+}
+
+/** El archivo contiene exactamente data. */
+static int file_is(const char* path, const char* data) {
+    char buf[128];
+    int h = fat_open(path, FAT_O_RDONLY);
+    int n;
+
+    if (h < 0) return 0;
+    n = fat_read(h, buf, sizeof(buf));
+    fat_close(h);
+    return n == (int)strlen(data) && memcmp(buf, data, n) == 0;
+}
+
+/** Revisar la imagen tal como está en disco; devuelve los archivos. */
+static uint32_t fsck(const char* step) {
+    uint32_t files = 0;
+    int errors = fat_image_check(IMAGE, &files);
+
+    if (errors != 0) printf("FALLO fsck tras %s: %d errores\n", step, errors);
+    CHECK(errors == 0);
+    return files;
+}
+
+static int count_entries(const char* dir) {
+    fat_dirent_t e;
+    int h = fat_opendir(dir);
+    int n = 0;
+
+    if (h < 0) return -1;
+    while (fat_readdir(h, &e) == 1) n++;
+    fat_close(h);
+    return n;
+}
+
+int main(void) {
+    blockdev_t disk;
+    const blockdev_t* bd;
+    char path[FAT_MAX_PATH];
+    char path2[FAT_MAX_PATH];
+
+    CHECK(fat_image_format(IMAGE, IMAGE_SECTORS, 1) == 0);
+    // Clusters defectuosos justo donde empieza a buscar la reserva
+    CHECK(fat_image_mark_bad(IMAGE, 3, BAD_CLUSTERS) == 0);
+    CHECK(fsck("formatear") == 0);
+
+    CHECK(blockdev_file_open_disk(&disk, IMAGE, FAT_SECTOR_SIZE) == 0);
+    bd = blockdev_cache_wrap(&disk);
+    CHECK(bd != NULL);
+    CHECK(fat_mount(bd) == 0);
+
+    // Crear: los cerrados tienen que estar en la imagen sin desmontar
+    CHECK(fat_mkdir("/informes") == 0);
+    for (int i = 0; i < NUM_REPORTS; i++) {
+        report_path(path, "/informes", "Informe", i);
+        CHECK(write_file(path, path) == 0);
+    }
+    CHECK(fsck("crear") == NUM_REPORTS);
+    CHECK(fat_image_find(IMAGE, "/informes", "Informe semanal 129.txt") ==
+          (int)strlen("/informes/Informe semanal 129.txt"));
+
+    for (int i = 0; i < NUM_REPORTS; i++) {
+        report_path(path, "/informes", "Informe", i);
+        CHECK(file_is(path, path));
+    }
+
+    // Renombrar en el mismo directorio y a otro
+    CHECK(fat_mkdir("/archivo") == 0);
+    for (int i = 0; i < NUM_REPORTS; i += 3) {
+        report_path(path, "/informes", "Informe", i);
+        report_path(path2, (i % 2) ? "/archivo" : "/informes", "Resumen", i);
+        CHECK(fat_rename(path, path2) == 0);
+        CHECK(fat_stat(path, NULL) < 0);
+    }
+    CHECK(fsck("renombrar") == NUM_REPORTS);
+
+    // Borrar y volver a crear: los alias libres se reutilizan
+    for (int i = 1; i < NUM_REPORTS; i += 3) {
+        report_path(path, "/informes", "Informe", i);
+        CHECK(fat_unlink(path) == 0);
+    }
+    for (int i = 0; i < 40; i++) {
+        report_path(path, "/informes", "Informe nuevo", i);
+        CHECK(write_file(path, path) == 0);
+    }
+    uint32_t expected = NUM_REPORTS - (NUM_REPORTS + 1) / 3 + 40;
+    CHECK(fsck("borrar") == expected);
+
+    // Un archivo abierto sigue en la imagen con el tamaño del último cierre
+    CHECK(write_file("/informes/Archivo abierto.txt", "antes") == 0);
+    int h = fat_open("/informes/Archivo abierto.txt", FAT_O_WRONLY | FAT_O_APPEND);
+    CHECK(h >= 0);
+    CHECK(fat_write(h, " y despues", 10) == 10);
+    CHECK(fat_image_find(IMAGE, "/informes", "Archivo abierto.txt") == 5);
+    CHECK(fat_close(h) == 0);
+    CHECK(fat_image_find(IMAGE, "/informes", "Archivo abierto.txt") == 15);
+
+    // Remontar: todo sigue ahí
+    int in_informes = count_entries("/informes");
+    int in_archivo = count_entries("/archivo");
+    fat_umount();
+    CHECK(fat_mount(bd) == 0);
+    CHECK(count_entries("/informes") == in_informes);
+    CHECK(count_entries("/archivo") == in_archivo);
+    CHECK((uint32_t)(in_informes + in_archivo) == expected + 1);
+    for (int i = 0; i < NUM_REPORTS; i++) {
+        report_path(path, (i % 3 == 0 && i % 2) ? "/archivo" : "/informes",
+                    (i % 3 == 0) ? "Resumen" : "Informe", i);
+        if (i % 3 == 1) {
+            CHECK(fat_stat(path, NULL) < 0);
+        } else {
+            report_path(path2, "/informes", "Informe", i);
+            CHECK(file_is(path, path2));
+        }
+    }
+    fat_umount();
+    blockdev_file_close(&disk);
+    CHECK(fsck("desmontar") == expected + 1);
+
+    if (failures) {
+        printf("test_fat: %d fallos\n", failures);
+        return 1;
+    }
+    printf("test_fat: OK (%u archivos)\n", expected + 1);
+    return 0;
+}
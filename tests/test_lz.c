@@ -0,0 +1,213 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Medida del compresor LZ en el host
+ * ============================================================================
+ * RAMFS comprime cada bloque de RAMFS_BLOCK_SIZE por separado con lz.c y
+ * lo guarda tal cual si no gana nada. Aquí se hace lo mismo, trozo a trozo,
+ * sobre dos corpus:
+ *
+ * - Texto de la shell: líneas como las que dejan los comandos en un log.
+ * - Sprites: los datos de los banners y del tanque tal como los genera
+ *   tools/sprites.py (filas codificadas de RGB565).
+ *
+ * Para cada uno se imprime la razón de compresión y el caudal de
+ * compresión y de descompresión en el host (solo sirve para comparar).
+ * Antes se comprueba que cualquier entrada vuelve igual, que lo que no se
+ * puede comprimir crece como mucho un byte por cada 128 y que los datos
+ * dañados no escriben fuera del buffer.
+ * ============================================================================
+ */
+
+#include "lz.h"
+#include "sprites_banners.h"
+#include "sprites_tanque.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CHUNK 256                     // Igual que RAMFS_BLOCK_SIZE
+#define TEXT_SIZE 6144
+#define DECODE_RUNS 2000
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* ========================================================================== */
+/*                          CORPUS                                            */
+/* ========================================================================== */
+
+static uint8_t text[TEXT_SIZE];
+static uint8_t sprites[12 * 1024];
+static uint32_t sprites_len;
+
+static void build_text(void) {
+    static const char* lines[] = {
+        "[RAMFS] Initialized: 32 files, 64 blocks\r\n",
+        "daos> ls\r\n",
+        "  notas.txt (12 bytes, inline)\r\n",
+        "  puntos.txt (214 bytes)\r\n",
+        "Uptime: 0h 3m 12s\r\n",
+        "task 3 READY prio 2 cpu 1234\r\n",
+        "task 5 BLOCKED prio 1 cpu 87\r\n",
+        "[SD] Mounted FAT32, 7.4 GB free\r\n",
+        "daos> cat /sd/log.txt\r\n",
+    };
+    uint32_t len = 0;
+
+    srand(1);
+    while (len < TEXT_SIZE) {
+        const char* l = lines[rand() % (int)(sizeof(lines) / sizeof(lines[0]))];
+        uint32_t n = (uint32_t)strlen(l);
+
+        if (n > TEXT_SIZE - len) n = TEXT_SIZE - len;
+        memcpy(text + len, l, n);
+        len += n;
+    }
+}
+
+static void add_sprite(const uint16_t* data, uint32_t bytes) {
+    if (sprites_len + bytes > sizeof(sprites)) bytes = sizeof(sprites) - sprites_len;
+    memcpy(sprites + sprites_len, data, bytes);
+    sprites_len += bytes;
+}
+
+static void build_sprites(void) {
+    add_sprite(banner_tron4p_data, sizeof(banner_tron4p_data));
+    add_sprite(banner_tanque_data, sizeof(banner_tanque_data));
+    add_sprite(banner_tron2p_data, sizeof(banner_tron2p_data));
+    add_sprite(banner_reconocedor_data, sizeof(banner_reconocedor_data));
+    add_sprite(banner_snake_data, sizeof(banner_snake_data));
+    add_sprite(banner_disco_data, sizeof(banner_disco_data));
+    add_sprite(sprite_bloque_destructible_data, sizeof(sprite_bloque_destructible_data));
+    add_sprite(sprite_bloque_acero_data, sizeof(sprite_bloque_acero_data));
+    add_sprite(sprite_planta_data, sizeof(sprite_planta_data));
+    add_sprite(sprite_tanque_azul_data0, sizeof(sprite_tanque_azul_data0));
+    add_sprite(sprite_tanque_azul_data1, sizeof(sprite_tanque_azul_data1));
+    add_sprite(sprite_tanque_azul_data2, sizeof(sprite_tanque_azul_data2));
+    add_sprite(sprite_tanque_azul_data3, sizeof(sprite_tanque_azul_data3));
+    add_sprite(sprite_tanque_rojo_data0, sizeof(sprite_tanque_rojo_data0));
+    add_sprite(sprite_tanque_rojo_data1, sizeof(sprite_tanque_rojo_data1));
+    add_sprite(sprite_tanque_rojo_data2, sizeof(sprite_tanque_rojo_data2));
+    add_sprite(sprite_tanque_rojo_data3, sizeof(sprite_tanque_rojo_data3));
+}
+
+/* ========================================================================== */
+/*                          PRUEBAS                                           */
+/* ========================================================================== */
+
+static void test_roundtrip(void) {
+    uint8_t in[CHUNK], out[CHUNK + CHUNK / 128 + 1], back[CHUNK];
+
+    srand(2);
+    for (int it = 0; it < 3000; it++) {
+        uint32_t n = (uint32_t)rand() % (CHUNK + 1);
+        int mode = it % 3;
+        int packed, got;
+
+        for (uint32_t i = 0; i < n; i++) {
+            if (mode == 0) in[i] = (uint8_t)rand();                  // Ruido
+            else if (mode == 1) in[i] = (uint8_t)"abcab"[rand() % 5];
+            else in[i] = text[(uint32_t)it + i];
+        }
+
+        // Lo incompresible crece un byte por cada literal de 128
+        packed = lz_compress(in, n, out, n + n / 128 + 1);
+        CHECK(packed >= 0);
+        if (packed < 0) continue;
+        got = lz_decompress(out, (uint32_t)packed, back, sizeof(back));
+        CHECK(got == (int)n && memcmp(in, back, n) == 0);
+
+        // Sin sitio para la salida falla en vez de desbordar
+        if (n > 8) {
+            CHECK(lz_decompress(out, (uint32_t)packed, back, n - 1) == -1);
+        }
+    }
+
+    // Una copia que apunta antes del principio está dañada
+    {
+        const uint8_t bad[] = { 0x00, 'x', 0x80, 5 };
+        CHECK(lz_decompress(bad, sizeof(bad), back, sizeof(back)) == -1);
+    }
+    printf("  ida y vuelta: 3000 trozos de ruido, repetidos y texto\n");
+}
+
+/**
+ * Comprimir el corpus en trozos de CHUNK (sin ganancia se guarda tal cual)
+ * y medir.
+ */
+static void measure(const char* label, const uint8_t* data, uint32_t len, double min_ratio) {
+    static uint8_t packed[CHUNK * 64];
+    uint32_t plen[64], raw[64];
+    uint32_t chunks = 0, stored = 0, kept_raw = 0;
+    double t0, compress_ns, decode_ns;
+    uint8_t back[CHUNK];
+
+    t0 = now_ns();
+    for (uint32_t off = 0; off < len && chunks < 64; off += CHUNK, chunks++) {
+        uint32_t n = (len - off < CHUNK) ? len - off : CHUNK;
+        int p = lz_compress(data + off, n, packed + chunks * CHUNK, n - 1);
+
+        raw[chunks] = n;
+        if (p < 0) {
+            memcpy(packed + chunks * CHUNK, data + off, n);
+            plen[chunks] = 0;
+            stored += n;
+            kept_raw++;
+        } else {
+            plen[chunks] = (uint32_t)p;
+            stored += (uint32_t)p;
+        }
+    }
+    compress_ns = now_ns() - t0;
+
+    // Cada trozo vuelve igual
+    for (uint32_t c = 0; c < chunks; c++) {
+        if (!plen[c]) continue;
+        CHECK(lz_decompress(packed + c * CHUNK, plen[c], back, sizeof(back)) == (int)raw[c]);
+        CHECK(memcmp(back, data + c * CHUNK, raw[c]) == 0);
+    }
+
+    t0 = now_ns();
+    for (int r = 0; r < DECODE_RUNS; r++) {
+        for (uint32_t c = 0; c < chunks; c++) {
+            if (plen[c]) lz_decompress(packed + c * CHUNK, plen[c], back, sizeof(back));
+        }
+    }
+    decode_ns = (now_ns() - t0) / DECODE_RUNS;
+
+    CHECK((double)len / stored >= min_ratio);
+    printf("  %-8s %5u -> %5u bytes (x%.2f), %u de %u trozos sin comprimir, "
+           "comprime %.0f MB/s, descomprime %.0f MB/s\n",
+           label, len, stored, (double)len / stored, kept_raw, chunks,
+           len / compress_ns * 1e3, len / decode_ns * 1e3);
+}
+
+int main(void) {
+    build_text();
+    build_sprites();
+
+    printf("compresor LZ (trozos de %d bytes, ventana de %d):\n", CHUNK, LZ_WINDOW);
+    test_roundtrip();
+    measure("texto", text, TEXT_SIZE, 1.5);
+    measure("sprites", sprites, sprites_len, 1.5);
+
+    if (failures) {
+        printf("test_lz: %d fallos\n", failures);
+        return 1;
+    }
+    printf("test_lz: OK\n");
+    return 0;
+}
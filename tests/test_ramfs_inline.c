@@ -0,0 +1,223 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Medida de los archivos inline de RAMFS en el host
+ * ============================================================================
+ * Los archivos de hasta RAMFS_INLINE_MAX bytes viven en su inodo y no
+ * gastan bloques de RAMFS_BLOCK_SIZE. Con una carga de archivos pequeños
+ * como los de touch y edit en la shell se mide:
+ *
+ * - Capacidad efectiva: bloques gastados por los archivos pequeños y bytes
+ *   que aún caben en un archivo grande, frente a lo que quedaría si cada
+ *   uno gastara un bloque.
+ * - Latencia de búsqueda (ramfs_exists, con y sin la caché de rutas) y de
+ *   lectura (ramfs_pread y open/read/close) de un archivo inline frente a
+ *   uno en un bloque.
+ *
+ * Los tiempos son del host y solo sirven para comparar; se comprueba que
+ * los datos leídos son los escritos y que un archivo que crece o encoge
+ * pasa de inline a bloques y vuelve sin perder contenido.
+ * ============================================================================
+ */
+
+#include "ramfs.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define SMALL_FILES (RAMFS_MAX_FILES - 2)  // Deja sitio al archivo grande
+#define RUNS 200000
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void small_name(char* out, int i) {
+    sprintf(out, "nota%02d.txt", i);
+}
+
+/** Tamaño del archivo pequeño i: de 8 a RAMFS_INLINE_MAX bytes, como los de la shell. */
+static uint32_t small_size(int i) {
+    return 8 + (uint32_t)(i * 13) % (RAMFS_INLINE_MAX - 7);
+}
+
+static void fill(uint8_t* p, uint32_t len, int seed) {
+    for (uint32_t i = 0; i < len; i++) p[i] = (uint8_t)('a' + (seed + i) % 26);
+}
+
+/* ========================================================================== */
+/*                          CAPACIDAD                                         */
+/* ========================================================================== */
+
+/**
+ * Crear SMALL_FILES archivos de hasta RAMFS_INLINE_MAX bytes y luego un
+ * archivo tan grande como quepa en los bloques que quedan.
+ * @return Bytes del archivo grande.
+ */
+static uint32_t capacity_run(int* used_blocks, uint32_t* small_bytes) {
+    static uint8_t buf[RAMFS_BLOCK_SIZE];
+    char name[RAMFS_MAX_FILENAME];
+    int files, used, free_blocks;
+    uint32_t big = 0;
+
+    ramfs_init();
+    *small_bytes = 0;
+    for (int i = 0; i < SMALL_FILES; i++) {
+        uint32_t size = small_size(i);
+
+        small_name(name, i);
+        fill(buf, size, i);
+        CHECK(ramfs_create(name, buf, size) == 0);
+        *small_bytes += size;
+    }
+    ramfs_stats(&files, &used, &free_blocks);
+    *used_blocks = used;
+
+    // El grande crece de bloque en bloque hasta llenar la memoria
+    fill(buf, sizeof(buf), 99);
+    CHECK(ramfs_create("grande.bin", NULL, 0) == 0);
+    while (ramfs_append("grande.bin", buf, sizeof(buf)) == 0) big += sizeof(buf);
+
+    // Los pequeños siguen intactos
+    for (int i = 0; i < SMALL_FILES; i++) {
+        uint8_t got[RAMFS_BLOCK_SIZE], want[RAMFS_BLOCK_SIZE];
+        uint32_t size = small_size(i);
+
+        small_name(name, i);
+        fill(want, size, i);
+        CHECK(ramfs_pread(name, 0, got, size) == (int)size && memcmp(got, want, size) == 0);
+    }
+    return big;
+}
+
+static void test_capacity(void) {
+    uint32_t small_bytes, big;
+    int used;
+    // Sin inline cada archivo pequeño gastaría un bloque entero
+    uint32_t big_without = (RAMFS_MAX_BLOCKS - SMALL_FILES) * RAMFS_BLOCK_SIZE;
+
+    big = capacity_run(&used, &small_bytes);
+    CHECK(used == 0);
+    CHECK(ramfs_inline_count() == SMALL_FILES);
+    CHECK(big == RAMFS_MAX_BLOCKS * RAMFS_BLOCK_SIZE);
+
+    // Un byte más que el límite ya va a un bloque
+    ramfs_init();
+    {
+        uint8_t buf[RAMFS_INLINE_MAX + 1] = {0};
+        int files, used_blocks, free_blocks;
+
+        CHECK(ramfs_create("justo.txt", buf, RAMFS_INLINE_MAX) == 0);
+        CHECK(ramfs_create("pasado.txt", buf, RAMFS_INLINE_MAX + 1) == 0);
+        ramfs_stats(&files, &used_blocks, &free_blocks);
+        CHECK(used_blocks == 1 && ramfs_inline_count() == 1);
+    }
+
+    printf("  capacidad con %d archivos de 8 a %d bytes (%u bytes en total):\n",
+           SMALL_FILES, RAMFS_INLINE_MAX, small_bytes);
+    printf("    inline: %d bloques gastados, caben %u bytes más; "
+           "en bloques serían %d y %u bytes\n",
+           used, big, SMALL_FILES, big_without);
+}
+
+/* ========================================================================== */
+/*                          LATENCIA                                          */
+/* ========================================================================== */
+
+static volatile int sink;
+
+/** ns por búsqueda recorriendo n nombres (más de RAMFS_DCACHE_SIZE: fallos). */
+static double lookup_ns(int n) {
+    char names[SMALL_FILES][RAMFS_MAX_FILENAME];
+    double t0;
+
+    for (int i = 0; i < n; i++) small_name(names[i], i);
+    t0 = now_ns();
+    for (int r = 0; r < RUNS; r++) sink += ramfs_exists(names[r % n]);
+    return (now_ns() - t0) / RUNS;
+}
+
+static double pread_ns(const char* name, uint32_t size) {
+    uint8_t buf[RAMFS_BLOCK_SIZE];
+    double t0 = now_ns();
+
+    for (int r = 0; r < RUNS; r++) sink += ramfs_pread(name, 0, buf, size);
+    return (now_ns() - t0) / RUNS;
+}
+
+static double open_read_ns(const char* name, uint32_t size) {
+    uint8_t buf[RAMFS_BLOCK_SIZE];
+    double t0 = now_ns();
+
+    for (int r = 0; r < RUNS; r++) {
+        int fd = ramfs_open(name, RAMFS_O_RDONLY);
+        sink += ramfs_read(fd, buf, size);
+        ramfs_close(fd);
+    }
+    return (now_ns() - t0) / RUNS;
+}
+
+static void test_latency(void) {
+    uint8_t data[RAMFS_BLOCK_SIZE], got[RAMFS_BLOCK_SIZE];
+    char name[RAMFS_MAX_FILENAME];
+    uint32_t hits0, misses0, hits, misses;
+    double hot, cold;
+
+    ramfs_init();
+    for (int i = 0; i < SMALL_FILES; i++) {
+        small_name(name, i);
+        fill(data, 20, i);
+        CHECK(ramfs_create(name, data, 20) == 0);
+    }
+    fill(data, RAMFS_INLINE_MAX + 1, 7);
+    CHECK(ramfs_create("inline.txt", data, RAMFS_INLINE_MAX) == 0);
+    CHECK(ramfs_create("bloque.txt", data, RAMFS_INLINE_MAX + 1) == 0);
+
+    // Búsqueda: el mismo nombre (en la caché) y todos por turno
+    ramfs_dcache_stats(&hits0, &misses0);
+    hot = lookup_ns(1);
+    cold = lookup_ns(SMALL_FILES);
+    ramfs_dcache_stats(&hits, &misses);
+    CHECK(hits - hits0 > RUNS);               // Al menos la pasada caliente acierta
+
+    printf("  búsqueda: %.0f ns un nombre, %.0f ns rotando %d nombres "
+           "(caché: %u aciertos, %u fallos)\n",
+           hot, cold, SMALL_FILES, hits - hits0, misses - misses0);
+    printf("  lectura de %d bytes inline / %d en un bloque: pread %.0f / %.0f ns, "
+           "open+read+close %.0f / %.0f ns\n",
+           RAMFS_INLINE_MAX, RAMFS_INLINE_MAX + 1,
+           pread_ns("inline.txt", RAMFS_INLINE_MAX), pread_ns("bloque.txt", RAMFS_INLINE_MAX + 1),
+           open_read_ns("inline.txt", RAMFS_INLINE_MAX), open_read_ns("bloque.txt", RAMFS_INLINE_MAX + 1));
+
+    // Crecer pasa a bloques y encoger vuelve al inodo, con el mismo contenido
+    CHECK(ramfs_append("inline.txt", data + RAMFS_INLINE_MAX, 1) == 0);
+    CHECK(ramfs_inline_count() == SMALL_FILES);
+    CHECK(ramfs_pread("inline.txt", 0, got, sizeof(got)) == RAMFS_INLINE_MAX + 1);
+    CHECK(memcmp(got, data, RAMFS_INLINE_MAX + 1) == 0);
+    CHECK(ramfs_truncate("bloque.txt", RAMFS_INLINE_MAX) == 0);
+    CHECK(ramfs_pread("bloque.txt", 0, got, sizeof(got)) == RAMFS_INLINE_MAX);
+    CHECK(memcmp(got, data, RAMFS_INLINE_MAX) == 0);
+}
+
+int main(void) {
+    printf("RAMFS inline (hasta %d bytes, bloques de %d):\n", RAMFS_INLINE_MAX, RAMFS_BLOCK_SIZE);
+    test_capacity();
+    test_latency();
+
+    if (failures) {
+        printf("test_ramfs_inline: %d fallos\n", failures);
+        return 1;
+    }
+    printf("test_ramfs_inline: OK\n");
+    return 0;
+}
@@ -0,0 +1,327 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Prueba del log de RAMFS en el host
+ * ============================================================================
+ * El log va sobre una imagen de dos bloques de 128 KB con semántica de
+ * flash (blockdev_file_open), como los sectores 6 y 7 del STM32F446.
+ *
+ * - Cortes de alimentación: un dispositivo intermedio deja de programar
+ *   tras un número de bytes (el último prog queda a medias) y falla todo
+ *   lo demás. Para cada corte posible de una operación se reinicia RAMFS,
+ *   se vuelve a montar y el archivo tiene que estar como antes o como
+ *   después de la operación, nunca a medias.
+ * - Tiempo de montaje frente al tamaño del log: se mide el montaje con
+ *   colas de registros cada vez más largas, hasta que el compactador
+ *   (RAMFS_LOG_MAX_TAIL, ramfs_log_maintain) las acota.
+ * ============================================================================
+ */
+
+#include "ramfs.h"
+#include "ramfs_log.h"
+#include <stdio.h>
+#include <string.h>
+
+#define IMAGE "test_ramfs_log.img"
+#define FLASH_BLOCK (128 * 1024)
+#define MOUNT_RUNS 20
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+/* ========================================================================== */
+/*                          DISPOSITIVO CON CORTES                            */
+/* ========================================================================== */
+
+static blockdev_t flash;              // Imagen en el host
+static blockdev_t dev;                // Lo que ve ramfs_log
+static long budget = -1;              // Bytes que se pueden programar (-1: sin límite)
+static uint32_t programmed;           // Bytes programados (para medir una operación)
+
+static int cut_read(const blockdev_t* bd, uint32_t block, uint32_t off,
+                    void* buf, uint32_t len) {
+    (void)bd;
+    return flash.read(&flash, block, off, buf, len);
+}
+
+static int cut_prog(const blockdev_t* bd, uint32_t block, uint32_t off,
+                    const void* buf, uint32_t len) {
+    (void)bd;
+    if (budget >= 0 && (long)len > budget) {
+        // El corte llega a mitad de la escritura
+        if (budget > 0) flash.prog(&flash, block, off, buf, (uint32_t)budget);
+        budget = 0;
+        return -1;
+    }
+    if (budget >= 0) budget -= len;
+    programmed += len;
+    return flash.prog(&flash, block, off, buf, len);
+}
+
+static int cut_erase(const blockdev_t* bd, uint32_t block) {
+    (void)bd;
+    if (budget == 0) return -1;
+    return flash.erase(&flash, block);
+}
+
+static void cut_setup(void) {
+    dev = flash;
+    dev.read = cut_read;
+    dev.prog = cut_prog;
+    dev.erase = cut_erase;
+}
+
+/* ========================================================================== */
+/*                          AYUDAS                                            */
+/* ========================================================================== */
+
+/** Reiniciar: RAMFS vacío y montar lo que haya en la flash. */
+static int reboot(void) {
+    ramfs_log_unmount();
+    ramfs_init();
+    return ramfs_log_mount(&dev);
+}
+
+/** Contenido del archivo igual a want (NULL: no existe). */
+static int file_is(const char* name, const char* want) {
+    char buf[4096];
+    int size = ramfs_get_size(name);
+
+    if (!want) return size < 0;
+    if (size != (int)strlen(want)) return 0;
+    return ramfs_pread(name, 0, buf, size) == size && memcmp(buf, want, size) == 0;
+}
+
+/** Borrar la flash y dejar en ella el estado de partida de los cortes. */
+static void base_state(void) {
+    ramfs_log_unmount();
+    flash.erase(&flash, 0);
+    flash.erase(&flash, 1);
+    ramfs_init();
+    ramfs_mkdir("/datos");
+    ramfs_create("/datos/a.txt", "hola mundo", 10);
+    ramfs_create("/b.txt", "bbb", 3);
+    CHECK(ramfs_log_mount(&dev) == 0);
+}
+
+typedef void (*op_fn)(void);
+
+static void op_append(void) { ramfs_append("/datos/a.txt", " y adios", 8); }
+static void op_create(void) { ramfs_create("/c.txt", "nuevo archivo", 13); }
+static void op_rename(void) { ramfs_rename("/b.txt", "/datos/b2.txt"); }
+static void op_delete(void) { ramfs_delete("/datos/a.txt"); }
+static void op_compact(void) { ramfs_log_compact(); }
+
+/** Estado tras el corte: uno de los dos, y el resto intacto. */
+static int state_ok(op_fn op) {
+    if (op == op_append) {
+        return (file_is("/datos/a.txt", "hola mundo") ||
+                file_is("/datos/a.txt", "hola mundo y adios")) && file_is("/b.txt", "bbb");
+    }
+    if (op == op_create) {
+        // ramfs_create son dos registros (abrir con TRUNC y escribir): el
+        // corte entre ambos deja el archivo creado y vacío
+        return (file_is("/c.txt", NULL) || file_is("/c.txt", "") ||
+                file_is("/c.txt", "nuevo archivo")) &&
+               file_is("/datos/a.txt", "hola mundo");
+    }
+    if (op == op_rename) {
+        return (file_is("/b.txt", "bbb") && file_is("/datos/b2.txt", NULL)) ||
+               (file_is("/b.txt", NULL) && file_is("/datos/b2.txt", "bbb"));
+    }
+    if (op == op_delete) {
+        return (file_is("/datos/a.txt", NULL) || file_is("/datos/a.txt", "hola mundo")) &&
+               file_is("/b.txt", "bbb");
+    }
+    return file_is("/datos/a.txt", "hola mundo") && file_is("/b.txt", "bbb");
+}
+
+/**
+ * Cortar la alimentación en cada byte que escribe op
+ * @return Cortes probados.
+ */
+static int crash_each_byte(const char* label, op_fn op) {
+    uint32_t cost;
+    int cuts = 0;
+    int torn = 0;
+
+    // Bytes que escribe la operación sin cortes
+    base_state();
+    programmed = 0;
+    op();
+    cost = programmed;
+
+    for (uint32_t k = 0; k <= cost; k++) {
+        base_state();
+        budget = (long)k;
+        op();
+        ramfs_log_unmount();          // Con el corte ya no escribe nada
+        budget = -1;
+
+        CHECK(reboot() == 0);
+        if (!state_ok(op)) {
+            printf("FALLO %s: estado a medias con corte en el byte %u\n", label, k);
+            failures++;
+        }
+        ramfs_log_stats_t st;
+        ramfs_log_get_stats(&st);
+        if (st.records_skipped) torn++;
+        cuts++;
+    }
+    printf("  %-8s %4u bytes, %4d cortes (%d con registro sin confirmar)\n",
+           label, cost, cuts, torn);
+    return cuts;
+}
+
+/** Montaje medio en microsegundos según mount_us (RAMFS vacío cada vez). */
+static double mount_time(ramfs_log_stats_t* st) {
+    double total = 0;
+
+    for (int i = 0; i < MOUNT_RUNS; i++) {
+        ramfs_log_unmount();
+        ramfs_init();
+        CHECK(ramfs_log_mount(&dev) == 0);
+        ramfs_log_get_stats(st);
+        total += st->mount_us;
+    }
+    return total / MOUNT_RUNS;
+}
+
+/* ========================================================================== */
+/*                          PRUEBAS                                           */
+/* ========================================================================== */
+
+static void test_persist(void) {
+    base_state();
+    ramfs_append("/datos/a.txt", "!", 1);
+    ramfs_create("/d.txt", "x", 1);
+    ramfs_rename("/d.txt", "/datos/e.txt");
+    ramfs_delete("/b.txt");
+    ramfs_mkdir("/vacio");
+
+    CHECK(reboot() == 0);
+    CHECK(file_is("/datos/a.txt", "hola mundo!"));
+    CHECK(file_is("/datos/e.txt", "x"));
+    CHECK(file_is("/d.txt", NULL));
+    CHECK(file_is("/b.txt", NULL));
+    CHECK(ramfs_is_dir("/vacio") == 1);
+
+    // Lo mismo después de compactar
+    CHECK(ramfs_log_compact() == 0);
+    CHECK(reboot() == 0);
+    CHECK(file_is("/datos/a.txt", "hola mundo!"));
+    CHECK(file_is("/datos/e.txt", "x"));
+    CHECK(ramfs_is_dir("/vacio") == 1);
+}
+
+/** Pasar de RAMFS_LOG_MAX_TAIL no borra flash en la llamada: lo hace la tarea. */
+static void test_deferred_compact(void) {
+    char chunk[256];
+    ramfs_log_stats_t st;
+
+    base_state();
+    memset(chunk, 'q', sizeof(chunk));
+    ramfs_create("/datos/cola.bin", NULL, 0);
+    int fd = ramfs_open("/datos/cola.bin", RAMFS_O_RDWR);
+    CHECK(fd >= 0);
+    ramfs_log_get_stats(&st);
+    uint32_t before = st.compactions;
+
+    while (st.used_bytes - st.snapshot_bytes <= RAMFS_LOG_MAX_TAIL) {
+        ramfs_seek(fd, 0, SEEK_SET);
+        ramfs_write(fd, chunk, sizeof(chunk));
+        ramfs_log_get_stats(&st);
+    }
+    ramfs_close(fd);
+    CHECK(st.compactions == before);
+
+    CHECK(ramfs_log_maintain() == 1);
+    ramfs_log_get_stats(&st);
+    CHECK(st.compactions == before + 1);
+    CHECK(st.used_bytes - st.snapshot_bytes == 0);
+    CHECK(ramfs_log_maintain() == 0);
+
+    CHECK(reboot() == 0);
+    CHECK(ramfs_get_size("/datos/cola.bin") == (int)sizeof(chunk));
+}
+
+static void test_crashes(void) {
+    int cuts = 0;
+
+    printf("cortes de alimentación:\n");
+    cuts += crash_each_byte("append", op_append);
+    cuts += crash_each_byte("create", op_create);
+    cuts += crash_each_byte("rename", op_rename);
+    cuts += crash_each_byte("delete", op_delete);
+    cuts += crash_each_byte("compact", op_compact);
+    CHECK(cuts > 0);
+}
+
+static void test_mount_time(void) {
+    static const uint32_t tails[] = { 0, 1024, 4096, 8192, 16384, 32768, 65536, 131072 };
+    char chunk[64];
+    uint32_t written = 0;
+
+    base_state();
+    memset(chunk, 'z', sizeof(chunk));
+    ramfs_create("/datos/contador.bin", NULL, 0);
+    for (int i = 0; i < 32; i++) ramfs_append("/datos/contador.bin", chunk, sizeof(chunk));
+    CHECK(ramfs_log_compact() == 0);
+
+    printf("montaje frente al log (RAMFS_LOG_MAX_TAIL = %u):\n", RAMFS_LOG_MAX_TAIL);
+    printf("  %9s %9s %9s %9s %9s\n", "escrito", "log", "cola", "registros", "us");
+
+    for (unsigned t = 0; t < sizeof(tails) / sizeof(tails[0]); t++) {
+        // Reescribir trozos del mismo archivo: crece el log, no RAMFS
+        int fd = ramfs_open("/datos/contador.bin", RAMFS_O_RDWR);
+        CHECK(fd >= 0);
+        while (written < tails[t]) {
+            ramfs_seek(fd, (int)((written / sizeof(chunk)) % 32) * sizeof(chunk), SEEK_SET);
+            chunk[0] = (char)('a' + written / sizeof(chunk) % 26);
+            ramfs_write(fd, chunk, sizeof(chunk));
+            ramfs_log_maintain();     // Lo que hace daos_fs_compact_task
+            written += sizeof(chunk);
+        }
+        ramfs_close(fd);
+
+        ramfs_log_stats_t st;
+        double us = mount_time(&st);
+        uint32_t tail = st.used_bytes - st.snapshot_bytes;
+
+        printf("  %9u %9u %9u %9u %9.1f\n", written, st.used_bytes, tail, st.records_replayed, us);
+
+        // El montaje no puede durar cero: mount_us no depende de millis()
+        CHECK(us > 0);
+
+        // El compactador acota la cola y, con ella, lo que se reproduce
+        CHECK(tail <= RAMFS_LOG_MAX_TAIL + 2 * sizeof(chunk) + 256);
+        CHECK(st.records_skipped == 0);
+        CHECK(ramfs_get_size("/datos/contador.bin") == 32 * (int)sizeof(chunk));
+    }
+}
+
+int main(void) {
+    remove(IMAGE);
+    CHECK(blockdev_file_open(&flash, IMAGE, FLASH_BLOCK, 2) == 0);
+    cut_setup();
+
+    test_persist();
+    test_deferred_compact();
+    test_crashes();
+    test_mount_time();
+
+    ramfs_log_unmount();
+    blockdev_file_close(&flash);
+
+    if (failures) {
+        printf("test_ramfs_log: %d fallos\n", failures);
+        return 1;
+    }
+    printf("test_ramfs_log: OK\n");
+    return 0;
+}
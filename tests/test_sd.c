@@ -0,0 +1,381 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Prueba del driver SD en el host
+ * ============================================================================
+ * sd.c habla con la tarjeta simulada (sd_sim.c) byte a byte, como por SPI.
+ *
+ * - Órdenes multibloque: varios bloques seguidos se leen con un solo CMD18
+ *   (+ CMD12) y se escriben con un solo CMD25 precedido de ACMD23 con el
+ *   número de bloques; un bloque suelto usa CMD17/CMD24. Se comprueba con
+ *   los contadores de la tarjeta y con el contenido de la imagen, en SDHC
+ *   (direcciones por bloque) y en SDSC (direcciones en bytes).
+ * - Arranque: sin tarjeta, tarjeta que no sale de idle, SDSC v1, SDSC v2 y
+ *   SDHC, paso a paso con sd_init_step. Las buenas terminan listas y leen
+ *   el bloque correcto; las malas fallan dentro de su plazo y dejan el
+ *   driver sin tarjeta.
+ * - CRC: la tarjeta daña bloques a propósito. Un bloque dañado se repite
+ *   (SD_CRC_RETRIES veces seguidas como mucho) y los contadores de sd.c
+ *   tienen que cuadrar con lo inyectado. Además se mide la CRC16 con la
+ *   tabla de sd.c frente a la versión bit a bit.
+ * ============================================================================
+ */
+
+#include "sd.h"
+#include "blockdev.h"
+#include "sd_sim.h"
+#include "sched.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define CARD_SECTORS 4096
+#define RUN 16                    // Bloques de una transferencia multibloque
+#define INIT_TIMEOUT_MS 1000      // Plazo de ACMD41 en sd.c
+#define ACMD41_POLL_MS 10         // Entre intentos de ACMD41
+#define CRC_RETRIES 3             // SD_CRC_RETRIES en sd.c
+#define CRC_RUNS 20000            // Sectores por medida de la CRC16
+#define SPI_HZ 4000000            // Reloj del bus tras el arranque
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+static uint8_t pattern(uint32_t lba, uint32_t i) {
+    return (uint8_t)(lba * 131 + i * 7 + (i >> 8));
+}
+
+/** Llenar la imagen con un patrón que identifica cada bloque. */
+static void fill_card(void) {
+    for (uint32_t lba = 0; lba < CARD_SECTORS; lba++) {
+        uint8_t* s = sd_sim_sector(lba);
+        for (uint32_t i = 0; i < SD_BLOCK_SIZE; i++) s[i] = pattern(lba, i);
+    }
+}
+
+static int block_is(const uint8_t* data, uint32_t lba) {
+    for (uint32_t i = 0; i < SD_BLOCK_SIZE; i++) {
+        if (data[i] != pattern(lba, i)) return 0;
+    }
+    return 1;
+}
+
+/** Insertar, rellenar e inicializar. */
+static int insert(sd_sim_card_t type) {
+    sd_reset();
+    sd_sim_insert(type, CARD_SECTORS);
+    fill_card();
+    int ok = sd_init();
+    sd_sim_clear_stats();
+    return ok;
+}
+
+/* ========================================================================== */
+/*                          ÓRDENES MULTIBLOQUE                               */
+/* ========================================================================== */
+
+static uint32_t stream_calls;
+
+static int stop_at_five(uint32_t index, const uint8_t* data, void* ctx) {
+    uint32_t first = *(uint32_t*)ctx;
+    CHECK(index == stream_calls);
+    CHECK(block_is(data, first + index));
+    stream_calls++;
+    return index == 5;
+}
+
+static void test_multi(sd_sim_card_t type, const char* label) {
+    static uint8_t buf[RUN * SD_BLOCK_SIZE];
+    sd_sim_stats_t st;
+
+    CHECK(insert(type));
+
+    // Lectura de varios bloques: un CMD18 y su CMD12, ningún CMD17
+    CHECK(sd_read_multi(100, RUN, buf));
+    sd_sim_get_stats(&st);
+    CHECK(st.cmd18 == 1 && st.cmd12 == 1 && st.cmd17 == 0);
+    for (uint32_t n = 0; n < RUN; n++) CHECK(block_is(buf + n * SD_BLOCK_SIZE, 100 + n));
+
+    // Un bloque suelto: CMD17
+    sd_sim_clear_stats();
+    CHECK(sd_read_block(7, buf));
+    sd_sim_get_stats(&st);
+    CHECK(st.cmd17 == 1 && st.cmd18 == 0);
+    CHECK(block_is(buf, 7));
+
+    // En flujo, el callback puede cortar la lectura a mitad
+    uint32_t first = 300;
+    stream_calls = 0;
+    sd_sim_clear_stats();
+    CHECK(sd_read_blocks(first, 20, stop_at_five, &first));
+    sd_sim_get_stats(&st);
+    CHECK(stream_calls == 6);
+    CHECK(st.cmd18 == 1 && st.cmd12 == 1);
+
+    // Escritura de varios bloques: ACMD23 con el número y un CMD25
+    for (uint32_t n = 0; n < RUN; n++) {
+        for (uint32_t i = 0; i < SD_BLOCK_SIZE; i++) buf[n * SD_BLOCK_SIZE + i] = pattern(2000 + n, i);
+    }
+    sd_sim_clear_stats();
+    CHECK(sd_write_multi(500, RUN, buf));
+    sd_sim_get_stats(&st);
+    CHECK(st.acmd23 == 1 && st.acmd23_blocks == RUN);
+    CHECK(st.cmd25 == 1 && st.cmd24 == 0);
+    CHECK(st.blocks_written == RUN);
+    for (uint32_t n = 0; n < RUN; n++) CHECK(block_is(sd_sim_sector(500 + n), 2000 + n));
+    CHECK(block_is(sd_sim_sector(499), 499));
+    CHECK(block_is(sd_sim_sector(500 + RUN), 500 + RUN));
+
+    // Un bloque suelto: CMD24 sin ACMD23
+    sd_sim_clear_stats();
+    CHECK(sd_write_block(900, buf));
+    sd_sim_get_stats(&st);
+    CHECK(st.cmd24 == 1 && st.cmd25 == 0 && st.acmd23 == 0);
+    CHECK(block_is(sd_sim_sector(900), 2000));
+
+    // El dispositivo de bloques usa las mismas órdenes
+    const blockdev_t* bd = blockdev_sd_get();
+    sd_sim_clear_stats();
+    CHECK(bd->read_blocks(bd, 500, RUN, buf) == 0);
+    CHECK(bd->prog_blocks(bd, 1500, RUN, buf) == 0);
+    sd_sim_get_stats(&st);
+    CHECK(st.cmd18 == 1 && st.cmd25 == 1 && st.acmd23 == 1);
+    for (uint32_t n = 0; n < RUN; n++) CHECK(block_is(sd_sim_sector(1500 + n), 2000 + n));
+
+    printf("  %-8s CMD18, CMD25 y ACMD23 correctos\n", label);
+}
+
+/* ========================================================================== */
+/*                          ARRANQUE                                          */
+/* ========================================================================== */
+
+/** Un escenario de arranque: qué se espera de cada tarjeta. */
+typedef struct {
+    const char* label;
+    sd_sim_card_t type;
+    int stuck;                    // ACMD41 no sale nunca de idle
+    int ready;                    // Debe quedar lista
+    int cmd16;                    // Debe fijar el bloque con CMD16 (SDSC)
+} init_case_t;
+
+static void test_init_case(const init_case_t* c) {
+    uint8_t buf[SD_BLOCK_SIZE];
+    sd_init_status_t status;
+    sd_sim_stats_t st;
+    sd_stats_t link;
+    uint32_t steps = 0;
+
+    sd_reset();
+    sd_sim_insert(c->type, CARD_SECTORS);
+    if (c->type != SD_SIM_NONE) fill_card();
+    if (c->stuck) sd_sim_stuck_idle();
+
+    // Paso a paso, como la tarea de montaje: ningún paso bloquea el plazo entero
+    uint32_t start = millis();
+    while ((status = sd_init_step()) == SD_INIT_BUSY) steps++;
+    uint32_t elapsed = millis() - start;
+    sd_sim_get_stats(&st);
+    sd_get_stats(&link);
+
+    CHECK(status == (c->ready ? SD_INIT_OK : SD_INIT_FAILED));
+    CHECK(sd_is_ready() == (c->ready ? 1 : 0));
+    CHECK(sd_read_block(42, buf) == (c->ready ? 1 : 0));
+    if (c->ready) {
+        CHECK(block_is(buf, 42));
+        CHECK(link.crc_enabled == 1);
+        CHECK((st.cmd16 > 0) == c->cmd16);
+        CHECK(st.bad_frames == 0);
+    }
+    if (c->stuck) {
+        // Se rinde al agotar el plazo, sin martillear la tarjeta
+        CHECK(elapsed >= INIT_TIMEOUT_MS);
+        CHECK(st.acmd41 <= INIT_TIMEOUT_MS / ACMD41_POLL_MS + 2);
+    }
+    if (c->type == SD_SIM_NONE) {
+        CHECK(st.cmds == 0);
+        CHECK(elapsed < INIT_TIMEOUT_MS);
+    }
+
+    // La siguiente sd_init vuelve a empezar desde CMD0
+    CHECK(sd_init() == (c->ready ? 1 : 0));
+
+    printf("  %-14s %-5s %6u pasos %5u ms %3u ACMD41\n", c->label,
+           c->ready ? "lista" : "falla", steps, elapsed, st.acmd41);
+}
+
+static void test_init(void) {
+    static const init_case_t cases[] = {
+        { "sin tarjeta",  SD_SIM_NONE,    0, 0, 0 },
+        { "siempre idle", SD_SIM_SDHC,    1, 0, 0 },
+        { "SDSC v1",      SD_SIM_SDSC_V1, 0, 1, 1 },
+        { "SDSC v2",      SD_SIM_SDSC_V2, 0, 1, 1 },
+        { "SDHC",         SD_SIM_SDHC,    0, 1, 0 },
+    };
+
+    printf("arranque:\n");
+    for (unsigned i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        test_init_case(&cases[i]);
+    }
+}
+
+/* ========================================================================== */
+/*                          CRC                                               */
+/* ========================================================================== */
+
+/** Diferencia de contadores de sd.c entre dos lecturas. */
+static sd_stats_t link_delta(const sd_stats_t* before) {
+    sd_stats_t now;
+    sd_get_stats(&now);
+    now.crc_errors -= before->crc_errors;
+    now.retries -= before->retries;
+    now.failures -= before->failures;
+    return now;
+}
+
+/**
+ * Una transferencia con bloques dañados.
+ * @param write 1 escritura, 0 lectura.
+ * @param count Bloques de la transferencia.
+ * @param bad Veces seguidas que la tarjeta daña el mismo bloque (el sexto de
+ *            la transferencia, o el único).
+ */
+static void crc_case(const char* label, int write, uint32_t count, uint32_t bad) {
+    static uint8_t buf[RUN * SD_BLOCK_SIZE];
+    int recovers = bad <= CRC_RETRIES;
+    sd_stats_t before, d;
+    sd_sim_stats_t st;
+    uint32_t victim = (count > 1) ? 1005 : 1000;
+    uint8_t ok;
+
+    CHECK(insert(SD_SIM_SDHC));
+    sd_get_stats(&before);
+
+    if (write) {
+        for (uint32_t n = 0; n < count; n++) {
+            for (uint32_t i = 0; i < SD_BLOCK_SIZE; i++) buf[n * SD_BLOCK_SIZE + i] = pattern(3000 + n, i);
+        }
+        sd_sim_corrupt(victim, 0, bad);
+        ok = (count > 1) ? sd_write_multi(1000, count, buf) : sd_write_block(1000, buf);
+    } else {
+        sd_sim_corrupt(victim, bad, 0);
+        ok = (count > 1) ? sd_read_multi(1000, count, buf) : sd_read_block(1000, buf);
+    }
+    d = link_delta(&before);
+    sd_sim_get_stats(&st);
+
+    // Cada bloque dañado se detecta; tras 1 + SD_CRC_RETRIES intentos, se abandona
+    CHECK(ok == recovers);
+    CHECK(st.corrupted == (recovers ? bad : CRC_RETRIES + 1));
+    CHECK(d.crc_errors == st.corrupted);
+    CHECK(d.retries == (recovers ? bad : CRC_RETRIES));
+    CHECK(d.failures == (recovers ? 0u : 1u));
+
+    if (recovers) {
+        for (uint32_t n = 0; n < count; n++) {
+            const uint8_t* got = write ? sd_sim_sector(1000 + n) : buf + n * SD_BLOCK_SIZE;
+            CHECK(block_is(got, (write ? 3000 : 1000) + n));
+        }
+    }
+
+    printf("  %-22s dañado %ux: %-9s crc_errors=%u retries=%u failures=%u\n", label, bad,
+           ok ? "recupera," : "falla,", d.crc_errors, d.retries, d.failures);
+}
+
+static uint16_t crc16_table[256];
+
+static void crc16_build(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint16_t crc = (uint16_t)(i << 8);
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+        crc16_table[i] = crc;
+    }
+}
+
+// Como sd_crc16 (tabla de 256 entradas, un byte por paso)
+static __attribute__((noinline)) uint16_t crc16_by_table(const uint8_t* data, uint32_t len) {
+    uint16_t crc = 0;
+    for (uint32_t i = 0; i < len; i++) crc = (uint16_t)((crc << 8) ^ crc16_table[(crc >> 8) ^ data[i]]);
+    return crc;
+}
+
+// La versión anterior de sd.c: ocho desplazamientos por byte
+static __attribute__((noinline)) uint16_t crc16_by_bit(const uint8_t* data, uint32_t len) {
+    uint16_t crc = 0;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)(data[i] << 8);
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double crc16_time(uint16_t (*fn)(const uint8_t*, uint32_t), uint8_t* sector) {
+    volatile uint16_t sink = 0;
+    double t0 = now_ns();
+
+    for (int i = 0; i < CRC_RUNS; i++) {
+        sector[0] = (uint8_t)i;
+        sink ^= fn(sector, SD_BLOCK_SIZE);
+    }
+    (void)sink;
+    return (now_ns() - t0) / CRC_RUNS;
+}
+
+static void test_crc(void) {
+    static uint8_t sector[SD_BLOCK_SIZE];
+
+    printf("CRC de datos:\n");
+    crc_case("lectura de un bloque", 0, 1, 1);
+    crc_case("lectura multibloque", 0, RUN, 2);
+    crc_case("lectura multibloque", 0, RUN, CRC_RETRIES);
+    crc_case("lectura multibloque", 0, RUN, CRC_RETRIES + 1);
+    crc_case("escritura de un bloque", 1, 1, 1);
+    crc_case("escritura multibloque", 1, RUN, 2);
+    crc_case("escritura multibloque", 1, RUN, CRC_RETRIES + 1);
+
+    // La tabla y la versión bit a bit dan lo mismo (CRC-16/XMODEM)
+    crc16_build();
+    CHECK(crc16_by_table((const uint8_t*)"123456789", 9) == 0x31C3);
+    for (uint32_t i = 0; i < SD_BLOCK_SIZE; i++) sector[i] = (uint8_t)(i * 7);
+    CHECK(crc16_by_table(sector, SD_BLOCK_SIZE) == crc16_by_bit(sector, SD_BLOCK_SIZE));
+
+    double bit = crc16_time(crc16_by_bit, sector);
+    double table = crc16_time(crc16_by_table, sector);
+    double wire = SD_BLOCK_SIZE * 8 * 1e9 / SPI_HZ;
+    printf("  CRC16 de un sector en el host: bit a bit %.0f ns, tabla %.0f ns (x%.1f)\n",
+           bit, table, bit / table);
+    printf("  el sector ocupa el bus %.0f us a %u MHz\n", wire / 1000, SPI_HZ / 1000000);
+}
+
+int main(void) {
+    test_init();
+
+    printf("ordenes multibloque:\n");
+    test_multi(SD_SIM_SDHC, "SDHC");
+    test_multi(SD_SIM_SDSC_V2, "SDSC v2");
+    test_multi(SD_SIM_SDSC_V1, "SDSC v1");
+
+    test_crc();
+
+    sd_sim_insert(SD_SIM_NONE, 0);
+
+    if (failures) {
+        printf("test_sd: %d fallos\n", failures);
+        return 1;
+    }
+    printf("test_sd: OK\n");
+    return 0;
+}
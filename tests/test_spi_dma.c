@@ -0,0 +1,323 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Prueba del motor SPI/DMA en el host
+ * ============================================================================
+ * spi_dma.c con -DDAOS_HOST llama a los spi_dma_host_* en lugar de tocar
+ * SPI1 y DMA2. Aquí los implementa un mock mínimo: apunta cada tramo que
+ * se lanza y, cuando la CPU espera (spi_dma_host_idle), lo da por enviado
+ * simulando la interrupción de fin.
+ *
+ * - Cola: las cortas con la cola vacía van por sondeo, las largas se parten
+ *   en tramos de SPI_DMA_MAX_CHUNK, y los callbacks se ejecutan en orden.
+ * - Fin de transferencia: el callback y quien espera en el semáforo ven ya
+ *   el estado DONE, y el callback puede volver a enviar la transferencia
+ *   sin que se arranque dos veces.
+ * - Bus compartido: el CS se suelta desde la interrupción si al cerrar la
+ *   transacción quedaban transferencias, solo se reprograma SPI1 al cambiar
+ *   de dispositivo, y registrar otra vez un dispositivo reutiliza su hueco.
+ * ============================================================================
+ */
+
+#include "spi_dma.h"
+#include <stdio.h>
+#include <string.h>
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+/* ========================================================================== */
+/*                          MOCK DEL HARDWARE                                 */
+/* ========================================================================== */
+
+static int starts;                    // Tramos lanzados
+static const spi_dma_xfer_t* last_x;  // Transferencia del último tramo
+static uint32_t last_first;           // Primera trama del último tramo
+static uint32_t last_frames;          // Tramas del último tramo
+static uint8_t chunk_active;          // Hay un tramo lanzado sin terminar
+static uint32_t polled_bytes;         // Bytes por sondeo
+
+void spi_dma_host_start(const spi_dma_xfer_t* x, uint32_t first, uint32_t frames) {
+    CHECK(!chunk_active);             // Nunca dos tramos a la vez
+    starts++;
+    last_x = x;
+    last_first = first;
+    last_frames = frames;
+    chunk_active = 1;
+}
+
+/** El tramo lanzado sale por el bus: interrupción de fin. */
+static void irq(void) {
+    chunk_active = 0;
+    spi_dma_host_irq();
+}
+
+void spi_dma_host_idle(void) {
+    if (chunk_active) irq();
+}
+
+uint8_t spi_dma_host_exchange(uint8_t data) {
+    polled_bytes++;
+    return data;                      // MISO unido a MOSI
+}
+
+/* ========================================================================== */
+/*                          NÚCLEO                                            */
+/* ========================================================================== */
+
+// Transferencia vigilada y su estado cuando se libera el semáforo
+static const spi_dma_xfer_t* watched;
+static uint8_t state_at_post;
+
+void sem_post_isr(sem_t* s) {
+    if (watched) state_at_post = watched->state;
+    s->count++;
+}
+
+/* ========================================================================== */
+/*                          PRUEBAS                                           */
+/* ========================================================================== */
+
+static char trace[128];
+
+static void on_begin(spi_dma_xfer_t* x) {
+    strcat(trace, "<");
+    strcat(trace, (const char*)x->ctx);
+}
+
+static void on_done(spi_dma_xfer_t* x) {
+    strcat(trace, (const char*)x->ctx);
+    strcat(trace, ">");
+}
+
+static void reset(void) {
+    spi_dma_init();
+    starts = 0;
+    chunk_active = 0;
+    polled_bytes = 0;
+    trace[0] = '\0';
+}
+
+static void test_queue(void) {
+    static const uint16_t red = 0xF800;
+    spi_dma_xfer_t fill = {0}, block = {0}, cmd = {0};
+    spi_dma_stats_t st0, st;
+
+    reset();
+    spi_dma_get_stats(&st0);
+
+    fill.tx = &red;
+    fill.count = 320 * 240;
+    fill.flags = SPI_DMA_16BIT | SPI_DMA_REPEAT;
+    fill.begin = on_begin;
+    fill.done = on_done;
+    fill.ctx = "A";
+    block.count = 512;
+    block.begin = on_begin;
+    block.done = on_done;
+    block.ctx = "B";
+    cmd.count = 3;
+    cmd.begin = on_begin;
+    cmd.done = on_done;
+    cmd.ctx = "C";
+
+    // Corta con la cola vacía: por sondeo, terminada al retornar
+    CHECK(spi_dma_submit(&cmd) == 0);
+    CHECK(cmd.state == SPI_DMA_DONE);
+    CHECK(starts == 0 && polled_bytes == 3);
+
+    // Larga: tramos de SPI_DMA_MAX_CHUNK
+    CHECK(spi_dma_submit(&fill) == 0);
+    CHECK(fill.state == SPI_DMA_ACTIVE);
+    CHECK(starts == 1 && last_first == 0 && last_frames == SPI_DMA_MAX_CHUNK);
+    CHECK(spi_dma_submit(&fill) == -1);       // Ya está en la cola
+
+    // Detrás de otra, también la corta espera su turno
+    CHECK(spi_dma_submit(&block) == 0 && block.state == SPI_DMA_QUEUED);
+    CHECK(spi_dma_submit(&cmd) == 0 && cmd.state == SPI_DMA_QUEUED);
+
+    irq();
+    CHECK(starts == 2 && last_x == &fill && last_first == SPI_DMA_MAX_CHUNK);
+    CHECK(last_frames == fill.count - SPI_DMA_MAX_CHUNK);
+    irq();
+    CHECK(fill.state == SPI_DMA_DONE && block.state == SPI_DMA_ACTIVE && last_x == &block);
+    CHECK(spi_dma_wait(&cmd) == 0);
+    CHECK(!spi_dma_busy());
+    CHECK(!strcmp(trace, "<CC><AA><BB><CC>"));
+
+    spi_dma_host_irq();                       // Interrupción espuria: nada
+    CHECK(!spi_dma_busy());
+
+    spi_dma_get_stats(&st);
+    CHECK(st.submitted - st0.submitted == 4);
+    CHECK(st.polled - st0.polled == 1);
+    CHECK(st.frames - st0.frames == fill.count + block.count + cmd.count);
+
+    // Síncrona: encolar y esperar
+    uint8_t out[64], in[64];
+    for (int i = 0; i < 64; i++) out[i] = (uint8_t)i;
+    CHECK(spi_dma_transfer(out, in, sizeof(out), 0) == 0);
+    CHECK(!spi_dma_busy());
+
+    printf("  cola: sondeo, tramos de %u y orden de los callbacks correctos\n", SPI_DMA_MAX_CHUNK);
+}
+
+/* ----- Fin de transferencia ----- */
+
+static sem_t done_sem;
+static uint8_t state_in_done;
+static int resubmits;
+
+static void check_done(spi_dma_xfer_t* x) {
+    state_in_done = x->state;
+    if (resubmits > 0) {
+        resubmits--;
+        CHECK(spi_dma_submit(x) == 0);        // Como aio: reenviar desde el callback
+    }
+}
+
+static void test_completion(void) {
+    spi_dma_xfer_t x = {0}, y = {0};
+
+    reset();
+    x.count = 600;
+    x.done = check_done;
+    x.sem = &done_sem;
+    watched = &x;
+
+    // El callback y el semáforo llegan con la transferencia ya terminada
+    CHECK(spi_dma_submit(&x) == 0);
+    irq();
+    CHECK(state_in_done == SPI_DMA_DONE);
+    CHECK(state_at_post == SPI_DMA_DONE);
+    CHECK(done_sem.count == 1);
+    CHECK(spi_dma_is_done(&x));
+
+    // Reenviar desde el callback con la cola vacía: un solo arranque por envío
+    resubmits = 1;
+    CHECK(spi_dma_submit(&x) == 0);
+    CHECK(starts == 2);
+    irq();
+    CHECK(starts == 3 && x.state == SPI_DMA_ACTIVE);
+    CHECK(spi_dma_wait(&x) == 0);
+    CHECK(starts == 3 && done_sem.count == 3);
+
+    // Con otra detrás, la reenviada se pone a la cola
+    resubmits = 1;
+    y.count = 100;
+    CHECK(spi_dma_submit(&x) == 0);
+    CHECK(spi_dma_submit(&y) == 0);
+    irq();
+    CHECK(last_x == &y && x.state == SPI_DMA_QUEUED);
+    spi_dma_flush();
+    CHECK(x.state == SPI_DMA_DONE && y.state == SPI_DMA_DONE);
+    CHECK(starts == 6);
+    watched = NULL;
+
+    printf("  fin: estado DONE antes del callback y del semáforo, reenvío seguro\n");
+}
+
+/* ----- Bus compartido ----- */
+
+static uint8_t lcd_cs, sd_cs;
+
+static void lcd_select(uint8_t active) { lcd_cs = active; }
+static void sd_select(uint8_t active) { sd_cs = active; }
+static void extra_select(uint8_t active) { (void)active; }
+static void extra2_select(uint8_t active) { (void)active; }
+static void extra3_select(uint8_t active) { (void)active; }
+
+static void test_bus(void) {
+    static const uint16_t black = 0x0000;
+    spi_bus_device_t lcd_dev = { "lcd", 0, SPI_MODE0, lcd_select };
+    spi_bus_device_t sd_dev = { "sd", 7, SPI_MODE0, sd_select };
+    spi_dma_xfer_t fill = {0};
+    spi_dma_stats_t st0, st;
+
+    reset();
+    spi_dma_get_stats(&st0);
+
+    int lcd = spi_bus_add(&lcd_dev);
+    int sd = spi_bus_add(&sd_dev);
+    CHECK(lcd >= 0 && sd >= 0 && lcd != sd);
+
+    // Soltar el CS se aplaza hasta que termine la cola
+    fill.tx = &black;
+    fill.count = 1000;
+    fill.flags = SPI_DMA_16BIT | SPI_DMA_REPEAT;
+    spi_bus_begin(lcd);
+    CHECK(lcd_cs == 1);
+    CHECK(spi_dma_submit(&fill) == 0);
+    spi_bus_end(lcd);
+    CHECK(lcd_cs == 1 && fill.state == SPI_DMA_ACTIVE);
+    irq();
+    CHECK(lcd_cs == 0 && fill.state == SPI_DMA_DONE);
+
+    // Sin nada en la cola se suelta al momento
+    spi_bus_begin(lcd);
+    spi_bus_end(lcd);
+    CHECK(lcd_cs == 0);
+
+    // Empezar con otro dispositivo espera la cola del anterior
+    spi_bus_begin(lcd);
+    CHECK(spi_dma_submit(&fill) == 0);
+    spi_bus_end(lcd);
+    spi_bus_begin(sd);
+    CHECK(fill.state == SPI_DMA_DONE);
+    CHECK(lcd_cs == 0 && sd_cs == 1);
+    spi_bus_end(sd);
+    CHECK(sd_cs == 0);
+
+    // Seguir con el mismo dispositivo no reprograma SPI1
+    spi_bus_begin(sd);
+    spi_bus_end(sd);
+    spi_bus_use(sd);
+    spi_dma_get_stats(&st);
+    CHECK(st.transactions - st0.transactions == 5);
+    CHECK(st.switches - st0.switches == 2);   // Primer uso del lcd y paso a la sd
+
+    // Volver a registrar (p. ej. con otra velocidad) reutiliza el hueco y
+    // obliga a reprogramar en el próximo uso
+    sd_dev.prescaler = 1;
+    CHECK(spi_bus_add(&sd_dev) == sd);
+    spi_bus_begin(sd);
+    spi_bus_end(sd);
+    spi_dma_get_stats(&st);
+    CHECK(st.switches - st0.switches == 3);
+
+    // La tabla se llena con dispositivos distintos, no con los repetidos
+    spi_bus_device_t extra = { "x1", 0, SPI_MODE0, extra_select };
+    CHECK(spi_bus_add(&extra) >= 0);
+    CHECK(spi_bus_add(&extra) == spi_bus_add(&extra));
+    extra.select = extra2_select;
+    CHECK(spi_bus_add(&extra) == SPI_BUS_MAX_DEVICES - 1);
+    extra.select = extra3_select;
+    CHECK(spi_bus_add(&extra) == -1);
+
+    // El dueño pasa a otro sin soltar antes el CS: spi_bus_use lo suelta
+    spi_bus_begin(lcd);
+    spi_bus_use(sd);
+    CHECK(lcd_cs == 0 && sd_cs == 0);
+
+    printf("  bus: CS diferido, %u cambios en %u transacciones, huecos reutilizados\n",
+           st.switches - st0.switches, st.transactions - st0.transactions);
+}
+
+int main(void) {
+    printf("motor SPI/DMA:\n");
+    test_queue();
+    test_completion();
+    test_bus();
+
+    if (failures) {
+        printf("test_spi_dma: %d fallos\n", failures);
+        return 1;
+    }
+    printf("test_spi_dma: OK\n");
+    return 0;
+}
@@ -0,0 +1,203 @@
+/**
+ * ============================================================================
+ * DaOS v2.0 - Prueba del ritmo de cuadros en el host
+ * ============================================================================
+ * vsync.c con -DDAOS_HOST lee el reloj de vsync_host_clock y la línea del
+ * panel de pantalla_get_scanline: aquí los implementa un panel simulado
+ * con su propio periodo y fase. Cada lectura del reloj avanza 1 µs (lo que
+ * cuesta una vuelta de espera) y, con el pin TE cableado, el reloj llama a
+ * vsync_te_edge al cruzar cada comienzo de barrido, como la interrupción.
+ *
+ * Un juego simulado dibuja, llama a vsync_present, duerme lo que retorna y
+ * repite. Para cada fuente (reloj, línea del panel, TE) se comprueba:
+ * - el cuadro sale al comienzo de un barrido del panel (salvo sin fase),
+ * - ninguna espera activa pasa de VSYNC_MARGIN_US más el redondeo a ms,
+ * - el periodo medido se acerca al del panel y no se pierden refrescos.
+ * ============================================================================
+ */
+
+#include "vsync.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TICKS_US 16
+#define FRAMES 200
+#define DRAW_US 3000              // Lo que tarda el juego en dibujar
+#define INTERVAL_MS 30            // Cada cuánto quiere dibujar
+#define WARMUP 20                 // Cuadros para aprender el panel y lo que tarda el juego
+
+static int failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FALLO %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+/* ========================================================================== */
+/*                          PANEL SIMULADO                                    */
+/* ========================================================================== */
+
+static uint32_t clock_ticks;      // Reloj de la CPU (ciclos del DWT)
+static uint32_t panel_period;     // Periodo real del panel en ciclos
+static uint32_t panel_phase;      // Un comienzo de barrido real
+static uint8_t te_wired;          // Pin TE conectado
+static uint8_t miso_wired;        // Se puede leer la línea
+static uint32_t next_edge;        // Próximo flanco de TE
+
+/** Ciclos desde el último comienzo de barrido real hasta t. */
+static uint32_t since_refresh(uint32_t t) {
+    return (t - panel_phase) % panel_period;
+}
+
+/** Avanzar el reloj; con TE, los flancos cruzados llegan por "interrupción". */
+static void advance(uint32_t ticks) {
+    uint32_t target = clock_ticks + ticks;
+
+    while (te_wired && (int32_t)(target - next_edge) >= 0) {
+        clock_ticks = next_edge;
+        vsync_te_edge(next_edge);
+        next_edge += panel_period;
+    }
+    clock_ticks = target;
+}
+
+uint32_t vsync_host_clock(void) {
+    advance(TICKS_US);
+    return clock_ticks;
+}
+
+int pantalla_get_scanline(void) {
+    if (!miso_wired) return -1;
+    return (int)((uint64_t)since_refresh(clock_ticks) * VSYNC_LINES / panel_period);
+}
+
+/* ========================================================================== */
+/*                          JUEGO SIMULADO                                    */
+/* ========================================================================== */
+
+static uint32_t flush_at;         // Cuándo salió el último cuadro
+static int flushed;
+
+static void flush(void) {
+    flush_at = clock_ticks;
+    flushed++;
+    advance(5000 * TICKS_US);     // Enviar los tiles cambiados
+}
+
+typedef struct {
+    uint32_t dropped;             // Refrescos perdidos ya enganchado
+    uint32_t max_spin_us;         // Espera activa más larga dentro de present
+    uint32_t max_offset_us;       // Mayor distancia del envío al comienzo del barrido
+    uint32_t deferrals;           // Veces que present pidió dormir antes de enviar
+} run_result_t;
+
+static void run(run_result_t* r) {
+    r->max_spin_us = 0;
+    r->max_offset_us = 0;
+    r->deferrals = 0;
+    uint32_t dropped_warm = 0;
+
+    // Arranque a mitad de un barrido cualquiera
+    advance((uint32_t)(rand() % (int)panel_period));
+
+    for (int f = 0; f < FRAMES; f++) {
+        uint32_t sleep_ms, called;
+        int before = flushed;
+
+        advance(DRAW_US * TICKS_US);
+
+        // Como daos_gfx_present: si llega pronto, dormir y volver a llamar
+        called = clock_ticks;
+        sleep_ms = vsync_present(INTERVAL_MS, flush);
+        while (vsync_pending()) {
+            r->deferrals++;
+            CHECK(flushed == before);
+            advance(sleep_ms * 1000 * TICKS_US);
+            called = clock_ticks;
+            sleep_ms = vsync_present(INTERVAL_MS, flush);
+        }
+        CHECK(flushed == before + 1);
+
+        uint32_t spin = (flush_at - called) / TICKS_US;
+        uint32_t off = since_refresh(flush_at);
+        if (off > panel_period / 2) off = panel_period - off;  // Justo antes también vale
+        off /= TICKS_US;
+        if (spin > r->max_spin_us) r->max_spin_us = spin;
+        if (f == WARMUP) {
+            vsync_stats_t st;
+            vsync_get_stats(&st);
+            dropped_warm = st.dropped;
+        }
+        if (f > WARMUP && off > r->max_offset_us) r->max_offset_us = off;
+
+        advance(sleep_ms * 1000 * TICKS_US);
+    }
+
+    vsync_stats_t st;
+    vsync_get_stats(&st);
+    r->dropped = st.dropped - dropped_warm;
+}
+
+/* ========================================================================== */
+/*                          PRUEBAS                                           */
+/* ========================================================================== */
+
+/**
+ * Un escenario.
+ * @param period_us Periodo real del panel.
+ * @param max_offset_us Distancia tolerada entre el envío y el barrido
+ *        (0: sin fase conocida, no se comprueba).
+ */
+static void scenario(const char* label, uint8_t te, uint8_t miso, uint32_t period_us,
+                     uint8_t want_source, uint32_t max_offset_us) {
+    vsync_stats_t st;
+    run_result_t r;
+
+    panel_period = period_us * TICKS_US;
+    panel_phase = clock_ticks + 1234 * TICKS_US;
+    next_edge = panel_phase;
+    te_wired = te;
+    miso_wired = miso;
+    if (te) advance(2 * panel_period);           // Llegan los primeros flancos
+    vsync_init();
+
+    run(&r);
+    vsync_get_stats(&st);
+
+    CHECK(st.source == want_source);
+    CHECK(st.frames == FRAMES);
+    CHECK(r.dropped == 0);
+    CHECK(st.deferred == r.deferrals);
+
+    // Lo que falta hasta el barrido se duerme: la espera activa es corta
+    CHECK(r.max_spin_us <= VSYNC_MARGIN_US + 1000);
+    if (max_offset_us) {
+        CHECK(r.max_offset_us <= max_offset_us);
+        CHECK(abs((int)st.period_us - (int)period_us) <= (int)period_us / 100);
+    }
+
+    printf("  %-7s panel %5u us, medido %5u us, envío a %4u us del barrido, "
+           "espera activa <= %4u us, %u aplazados\n",
+           label, period_us, st.period_us, r.max_offset_us, r.max_spin_us, r.deferrals);
+}
+
+int main(void) {
+    srand(1);
+    printf("ritmo de cuadros (%d cuadros cada %d ms):\n", FRAMES, INTERVAL_MS);
+
+    // Sin TE ni MISO: periodo nominal, la fase no se conoce
+    scenario("reloj", 0, 0, VSYNC_PERIOD_US, VSYNC_SRC_CLOCK, 0);
+    // Con la línea del panel, que va algo más lento que el nominal
+    scenario("linea", 0, 1, 14700, VSYNC_SRC_SCANLINE, 400);
+    // Con TE, algo más rápido
+    scenario("TE", 1, 0, 13900, VSYNC_SRC_TE, 50);
+
+    if (failures) {
+        printf("test_vsync: %d fallos\n", failures);
+        return 1;
+    }
+    printf("test_vsync: OK\n");
+    return 0;
+}
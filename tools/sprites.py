@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""
+============================================================================
+DaOS v2.0 - Compilador de sprites
+============================================================================
+Convierte las tablas ARGB8888 de assets/*.sprites en cabeceras con sprites
+RGB565 ya escalados al tamaño en pantalla y codificados por tramos, listos
+para daos_gfx_draw_sprite():
+
+    por fila:  n                      número de corridas (o REPEAT)
+               n x corrida
+
+    corrida:   salto, largo, color              (largo píxeles del mismo color)
+               salto, LITERAL | largo, píxeles  (largo píxeles tal cual)
+
+- salto: píxeles transparentes antes de la corrida (desde el final de la
+  anterior); las corridas con salto 0 siguen el mismo tramo opaco.
+- LITERAL (0x8000 en largo): para tramos de muchos colores, donde repetir
+  el color por corrida ocuparía más que los píxeles.
+- REPEAT (0x8000 en n): la fila es igual a la anterior y no lleva corridas.
+
+Formato de entrada (una tabla por bloque, comentarios con #):
+
+    @sprite sprite_jugador 10x10 -> 16x16 rot4
+    0xff74e3e4, 0x00000000, ...
+
+Con rot4 se generan las cuatro orientaciones (arriba, derecha, abajo,
+izquierda) como un arreglo de daos_sprite_t. Un píxel es transparente si
+su alfa es 0.
+
+Uso:  python3 tools/sprites.py assets/tanque.sprites Inc/sprites_tanque.h
+============================================================================
+"""
+
+import os
+import re
+import sys
+
+ROW_REPEAT = 0x8000
+LITERAL = 0x8000
+
+
+def parse(path):
+    """Leer los bloques @sprite de un archivo de assets."""
+    sprites = []
+    header = re.compile(r'@sprite\s+(\w+)\s+(\d+)x(\d+)\s*->\s*(\d+)x(\d+)\s*(rot4)?\s*$')
+
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            if line.startswith('@'):
+                m = header.match(line)
+                if not m:
+                    sys.exit('%s:%d: cabecera inválida' % (path, lineno))
+                name, sw, sh, dw, dh, rot = m.groups()
+                sprites.append({'name': name, 'src': (int(sw), int(sh)),
+                                'dst': (int(dw), int(dh)), 'rot4': bool(rot),
+                                'argb': []})
+                continue
+            if not sprites:
+                sys.exit('%s:%d: datos antes de @sprite' % (path, lineno))
+            sprites[-1]['argb'] += [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', line)]
+
+    for s in sprites:
+        sw, sh = s['src']
+        if len(s['argb']) != sw * sh:
+            sys.exit('%s: %s tiene %d píxeles, se esperaban %d'
+                     % (path, s['name'], len(s['argb']), sw * sh))
+    return sprites
+
+
+def rgb565(argb):
+    r = (argb >> 16) & 0xFF
+    g = (argb >> 8) & 0xFF
+    b = argb & 0xFF
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def render(sprite, rot):
+    """
+    Escalar (vecino más cercano, como hacían los juegos) y rotar.
+    @return Filas de píxeles RGB565, None = transparente.
+    """
+    sw, sh = sprite['src']
+    dw, dh = sprite['dst']
+    rows = []
+
+    for row in range(dh):
+        line = []
+        for col in range(dw):
+            mr = min(row * sh // dh, sh - 1)
+            mc = min(col * sw // dw, sw - 1)
+            if rot == 0:
+                r, c = mr, mc
+            elif rot == 1:
+                r, c = (sh - 1) - mc, mr
+            elif rot == 2:
+                r, c = (sh - 1) - mr, (sw - 1) - mc
+            else:
+                r, c = mc, (sw - 1) - mr
+            argb = sprite['argb'][r * sw + c]
+            line.append(rgb565(argb) if (argb >> 24) else None)
+        rows.append(line)
+    return rows
+
+
+def encode_span(skip, pixels):
+    """Un tramo opaco: corridas de color o un literal, lo que ocupe menos."""
+    runs = []
+    col = 0
+
+    while col < len(pixels):
+        start = col
+        while col < len(pixels) and pixels[col] == pixels[start]:
+            col += 1
+        runs.append((0, col - start, pixels[start]))
+    runs[0] = (skip,) + runs[0][1:]
+
+    if 3 * len(runs) <= 2 + len(pixels):
+        return runs
+    return [(skip, LITERAL | len(pixels)) + tuple(pixels)]
+
+
+def encode_row(line):
+    """Corridas de una fila, tramo opaco por tramo opaco."""
+    runs = []
+    skip = 0
+    col = 0
+
+    while col < len(line):
+        if line[col] is None:
+            skip += 1
+            col += 1
+            continue
+        start = col
+        while col < len(line) and line[col] is not None:
+            col += 1
+        runs += encode_span(skip, line[start:col])
+        skip = 0
+    return runs
+
+
+def encode(rows):
+    words = []
+    prev = None
+
+    for line in rows:
+        runs = encode_row(line)
+        if runs == prev:
+            words.append(ROW_REPEAT)
+            continue
+        words.append(len(runs))
+        for run in runs:
+            words += run
+        prev = runs
+    return words
+
+
+def c_array(name, words):
+    out = ['static const uint16_t %s[%d] = {' % (name, len(words))]
+    for i in range(0, len(words), 12):
+        out.append('    ' + ', '.join('0x%04X' % w for w in words[i:i + 12]) + ',')
+    out.append('};')
+    return out
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('uso: sprites.py <entrada.sprites> <salida.h>')
+    src, dst = sys.argv[1], sys.argv[2]
+    sprites = parse(src)
+    guard = re.sub(r'\W', '_', os.path.basename(dst)).upper()
+
+    out = ['/**',
+           ' * Generado por tools/sprites.py desde %s: no editar a mano.' % src.replace(os.sep, '/'),
+           ' * Formato de los datos: ver daos_sprite_t en api.h.',
+           ' */',
+           '',
+           '#ifndef %s' % guard,
+           '#define %s' % guard,
+           '',
+           '#include "api.h"',
+           '']
+
+    total_argb = 0
+    total_words = 0
+    for s in sprites:
+        sw, sh = s['src']
+        dw, dh = s['dst']
+        rots = range(4) if s['rot4'] else range(1)
+        descs = []
+        size = 0
+        for rot in rots:
+            data = '%s_data%s' % (s['name'], rot if s['rot4'] else '')
+            words = encode(render(s, rot))
+            out += c_array(data, words)
+            descs.append('{ %d, %d, %s }' % (dw, dh, data))
+            size += len(words)
+        total_argb += sw * sh * 4
+        total_words += size
+
+        out.append('/* %dx%d -> %dx%d: %d B ARGB8888 -> %d B */'
+                   % (sw, sh, dw, dh, sw * sh * 4, size * 2))
+        if s['rot4']:
+            out.append('static const daos_sprite_t %s[4] = {' % s['name'])
+            out += ['    %s,' % d for d in descs]
+            out.append('};')
+        else:
+            out.append('static const daos_sprite_t %s = %s;' % (s['name'], descs[0]))
+        out.append('')
+
+    out.append('#endif /* %s */' % guard)
+
+    with open(dst, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+    print('%s: %d sprites, %d B ARGB8888 -> %d B RGB565 por tramos'
+          % (dst, len(sprites), total_argb, total_words * 2))
+
+
+if __name__ == '__main__':
+    main()